@@ -14,16 +14,36 @@ int channel = 1; // Channel for AP Mode
 int hidden = 0; // Probably leave at zero
 int maxconnection = 1; // Only allow one at a time
 
-// Libraries. If you get errors compiling, please downgrade ESP32 by Espressif.
-// Use version 1.0.2 (Tools, Manage Libraries).
+// Libraries. Needs the esp32 boards package by Espressif 3.0.0 or later
+// (Tools, Board, Boards Manager), built on ESP-IDF 5.1: /stream hands its
+// request to a task of its own with httpd_req_async_handler_begin(), and
+// the motors use the pin-based LEDC API.
 #include <WiFi.h>
 #include "esp_wifi.h"
 #include "esp_camera.h"
+#include "esp_timer.h"
 #include "soc/soc.h"
 #include "soc/rtc_cntl_reg.h"
 
+#include "logger.h"
+#include "task_config.h"
+#include "boot_timeline.h"
+#include "wifi_cache.h"
 #include "chassis.h"
+#include "motor_control.h"
 #include "pages.h"
+#include "camera_stream.h"
+#include "sensor_config.h"
+#include "recorder.h"
+#include "power_manager.h"
+
+#if !defined(ESP_ARDUINO_VERSION_MAJOR) || ESP_ARDUINO_VERSION_MAJOR < 3
+#error "Scout32 needs the esp32 boards package 3.0.0 or later"
+#endif
+
+// Task layout (see task_config.h): TASK_PRESET_LOW_LATENCY keeps driving
+// responsive under video load, TASK_PRESET_MAX_THROUGHPUT favours frame rate
+task_preset_t task_preset = TASK_PRESET_LOW_LATENCY;
 
 // Camera Pin Definitions - Don't heckin' touch.
 #define PWDN_GPIO_NUM     32
@@ -48,17 +68,100 @@ void startCameraServer();
 
 
 
+// Camera bring-up takes the longest of the init steps (probing the sensor,
+// loading its registers, allocating frame buffers), so it runs on a task of
+// its own while setup() gets the chassis, server and network going.
+static volatile bool camera_init_done = false;
+
+static void camera_init_task(void * arg)
+{
+  camera_config_t * config = (camera_config_t *)arg;
+  esp_err_t err = esp_camera_init(config);
+  if (err == ESP_OK) {
+    //drop down frame size for higher initial frame rate
+    sensor_t * s = esp_camera_sensor_get();
+    s->set_framesize(s, FRAMESIZE_QVGA);
+    s->set_vflip(s, 1);
+    s->set_hmirror(s, 1);
+    initSensorConfig();
+    initStream(config->fb_count);
+    initRecorder();
+    bootMark("camera");
+  } else {
+    LOG_ERROR("Camera init failed with error 0x%x", err);
+  }
+  camera_init_done = true;
+  vTaskDelete(NULL);
+}
+
+// Start connecting to the router, straight to the access point we found
+// last time if we have it cached. Returns without waiting.
+static bool wifi_begin(bool use_cache)
+{
+  wifi_cache_t cache;
+  if (use_cache && wifiCacheLoad(ssid, &cache)) {
+    WiFi.begin(ssid, password, cache.channel, cache.bssid);
+    return true;
+  }
+  WiFi.begin(ssid, password);
+  return false;
+}
+
+static void wifi_wait_connected(bool cached)
+{
+  int64_t start = esp_timer_get_time();
+  while (WiFi.status() != WL_CONNECTED) {
+    if (cached && esp_timer_get_time() - start > WIFI_FAST_CONNECT_TIMEOUT_MS * 1000LL) {
+      LOG_WARN("Cached access point not found, scanning");
+      cached = false;
+      WiFi.disconnect();
+      wifiCacheClear();
+      wifi_begin(false);
+    }
+    delay(10);
+    LOG_EVERY(LOG_LEVEL_INFO, 5000, "Waiting for WiFi...");
+  }
+
+  wifi_cache_t cache;
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+  wifiCacheSave(ssid, &cache);
+}
+
 void setup() 
 {
   WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 0); // Prevent brownouts by silencing them. You probably want to keep this.
+  bootMark("setup");
+  taskConfigSetPreset(task_preset);
   
   Serial.begin(115200);
-  Serial.setDebugOutput(true);
-  Serial.println();
-
+  // Core debug output writes to the UART synchronously; our own logging
+  // goes through the logger's ring buffer instead
+  Serial.setDebugOutput(false);
+  initLogger();
+
+  // Radio first: association runs in the background while everything
+  // else comes up
+  bool wifi_cached = false;
+  if(!ap){
+    // Connect to Router
+    LOG_INFO("ssid: %s", ssid);
+    LOG_INFO("password: %s", password);
+    LOG_INFO("WiFi is Client Scout32");
+    WiFi.mode(WIFI_STA);
+    wifi_cached = wifi_begin(true);
+  } else {
+    // Setup Access Point
+    LOG_INFO("ssid: %s", ssid);
+    LOG_INFO("password: %s", password);
+    LOG_INFO("WiFi is Standalone Scout32");
+    WiFi.mode(WIFI_AP);
+    WiFi.softAP(ssid,password,channel,hidden,maxconnection);
+    bootMark("network");
+  }
 
 // Camera Configuration - Again, don't touch.
-  camera_config_t config;
+  static camera_config_t config;
   config.ledc_channel = LEDC_CHANNEL_0;
   config.ledc_timer = LEDC_TIMER_0;
   config.pin_d0 = Y2_GPIO_NUM;
@@ -83,61 +186,43 @@ void setup()
   if(psramFound()){
     config.frame_size = FRAMESIZE_QVGA;
     config.jpeg_quality = 10;
-    config.fb_count = 2;
+    config.fb_count = STREAM_FB_COUNT;
   } else {
     config.frame_size = FRAMESIZE_QVGA;
     config.jpeg_quality = 12;
     config.fb_count = 1;
   }
-  // camera init
-  esp_err_t err = esp_camera_init(&config);
-  if (err == ESP_OK) {
-    //drop down frame size for higher initial frame rate
-    sensor_t * s = esp_camera_sensor_get();
-    s->set_framesize(s, FRAMESIZE_QVGA);
-    s->set_vflip(s, 1);
-    s->set_hmirror(s, 1);
-  } else {
-    Serial.printf("Camera init failed with error 0x%x", err);
-  }
+  // camera init, where capture will run
+  taskCreate(TASK_CAMERA_INIT, camera_init_task, &config, NULL);
   
   initChassis();
-  
+  initMotorControl();
+  bootMark("chassis");
 
+  // The server only needs the network stack, which WiFi.mode() brought up:
+  // it's listening by the time we have an address. /stream answers 503
+  // until the camera is ready.
+  startCameraServer();
+  bootMark("server");
 
- if(!ap){
-  // Connect to Router
-  Serial.println("ssid: " + (String)ssid);
-  Serial.println("password: " + (String)password);
-  Serial.println("WiFi is Client Scout32");
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid, password);
-    while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    Serial.print(".");
+  if(!ap){
+    wifi_wait_connected(wifi_cached);
+    bootMark("network");
+    LOG_INFO("Camera Ready! Use 'http://%s' to connect", WiFi.localIP().toString().c_str());
+  } else {
+    LOG_INFO("Camera Ready! Use 'http://%s' to connect", WiFi.softAPIP().toString().c_str());
   }
-  Serial.print("Camera Ready! Use 'http://");
-  Serial.print(WiFi.localIP());
-  Serial.println("' to connect");
- } else {
-  // Setup Access Point
-  Serial.println("ssid: " + (String)ssid);
-  Serial.println("password: " + (String)password);
-  Serial.println("WiFi is Standalone Scout32");
-  WiFi.mode(WIFI_AP);
-  WiFi.softAP(ssid,password,channel,hidden,maxconnection);
-  Serial.print("Camera Ready! Use 'http://");
-  Serial.print(WiFi.softAPIP());
-  Serial.println("' to connect");
-}
-
-  //Start Webserver
-  startCameraServer();
 
+  while (!camera_init_done) {
+    delay(10);
+  }
+  bootLogTimeline();
+  // Housekeeping puts it to sleep, so the camera has to be up for both
+  initPowerManager();
+  initHousekeeping();
 }
 
 void loop() {
-  // put your main code here, to run repeatedly:
-  delay(1000);
-  Serial.printf("RSSi: %ld dBm\n",WiFi.RSSI()); 
+  // Everything runs on the tasks in task_config.h, the RSSI report included
+  vTaskDelete(NULL);
 }
@@ -0,0 +1,245 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_wifi.h"
+#include "esp_timer.h"
+#include "esp_camera.h"
+#include "camera_stream.h"
+#include "adaptive_bitrate.h"
+#include "logger.h"
+
+// 4:3 sizes to step through, largest first. Stepping by enum would wander
+// through the square and widescreen modes.
+static const framesize_t ladder_sizes[] = {
+    FRAMESIZE_UXGA, FRAMESIZE_XGA, FRAMESIZE_SVGA, FRAMESIZE_VGA,
+    FRAMESIZE_CIF, FRAMESIZE_QVGA, FRAMESIZE_QQVGA,
+};
+const int LADDER_SIZE_COUNT = sizeof(ladder_sizes) / sizeof(ladder_sizes[0]);
+
+// Rough cost of one step back up the ladder, used to check the link has
+// room before taking it
+const float QUALITY_STEP_COST = 1.3;
+const float FRAMESIZE_STEP_COST = 1.8;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t bytes;
+    int64_t send_us;
+} window_stats_t;
+
+static portMUX_TYPE bitrate_mux = portMUX_INITIALIZER_UNLOCKED;
+static window_stats_t window[STREAM_MAX_CLIENTS];
+static int64_t window_start = 0;
+static int64_t last_change = 0;
+static bool enabled = true;
+static float target_fps = BITRATE_TARGET_FPS;
+static framesize_t ceiling_framesize = FRAMESIZE_INVALID;
+static int ceiling_quality = -1;
+static bool ceiling_changed = false;
+static int level = 0;
+static bitrate_state_t state;
+
+
+void bitrateSetEnabled(bool value){
+    portENTER_CRITICAL(&bitrate_mux);
+    enabled = value;
+    // Going back to manual means going back to the user's settings
+    ceiling_changed = true;
+    portEXIT_CRITICAL(&bitrate_mux);
+}
+
+void bitrateSetTargetFps(float fps){
+    portENTER_CRITICAL(&bitrate_mux);
+    target_fps = fps > 0 ? fps : BITRATE_TARGET_FPS;
+    portEXIT_CRITICAL(&bitrate_mux);
+}
+
+void bitrateSetMaxFramesize(framesize_t framesize){
+    portENTER_CRITICAL(&bitrate_mux);
+    ceiling_framesize = framesize;
+    ceiling_changed = true;
+    portEXIT_CRITICAL(&bitrate_mux);
+}
+
+void bitrateSetBestQuality(int quality){
+    portENTER_CRITICAL(&bitrate_mux);
+    ceiling_quality = quality;
+    ceiling_changed = true;
+    portEXIT_CRITICAL(&bitrate_mux);
+}
+
+void bitrateReportFrame(int client, size_t bytes, int64_t send_us){
+    portENTER_CRITICAL(&bitrate_mux);
+    window[client].frames++;
+    window[client].bytes += bytes;
+    window[client].send_us += send_us;
+    portEXIT_CRITICAL(&bitrate_mux);
+}
+
+void bitrateGetState(bitrate_state_t * out){
+    portENTER_CRITICAL(&bitrate_mux);
+    *out = state;
+    portEXIT_CRITICAL(&bitrate_mux);
+}
+
+// Number of quality steps tried at each frame size
+static int quality_steps(){
+    int steps = (BITRATE_QUALITY_WORST - ceiling_quality) / BITRATE_QUALITY_STEP;
+    return steps > 0 ? steps + 1 : 1;
+}
+
+// Frame sizes available below the ceiling, the ceiling itself included
+static int size_steps(int * first){
+    *first = LADDER_SIZE_COUNT;
+    for(int i = 0; i < LADDER_SIZE_COUNT; i++){
+        if(ladder_sizes[i] < ceiling_framesize){
+            *first = i;
+            break;
+        }
+    }
+    return 1 + LADDER_SIZE_COUNT - *first;
+}
+
+// Level 0 is the ceiling. Quality drops first, then the frame size steps
+// down and quality starts again from the user's setting.
+static void level_settings(int l, framesize_t * framesize, int * quality){
+    int first;
+    size_steps(&first);
+    int size_index = l / quality_steps();
+    *framesize = size_index == 0 ? ceiling_framesize : ladder_sizes[first + size_index - 1];
+    *quality = ceiling_quality + (l % quality_steps()) * BITRATE_QUALITY_STEP;
+}
+
+static int max_level(){
+    int first;
+    return size_steps(&first) * quality_steps() - 1;
+}
+
+// Signal strength of the link the video goes over. In AP mode that's the
+// weakest connected station, 0 if nobody is connected.
+static int link_rssi(){
+    if(WiFi.getMode() == WIFI_MODE_AP){
+        wifi_sta_list_t stations;
+        if(esp_wifi_ap_get_sta_list(&stations) != ESP_OK || stations.num == 0){
+            return 0;
+        }
+        int rssi = 0;
+        for(int i = 0; i < stations.num; i++){
+            rssi = min(rssi, (int)stations.sta[i].rssi);
+        }
+        return rssi;
+    }
+    return WiFi.RSSI();
+}
+
+static void apply(sensor_t * s, framesize_t framesize, int quality){
+    if(s->status.framesize != framesize){
+        s->set_framesize(s, framesize);
+    }
+    if(s->status.quality != quality){
+        s->set_quality(s, quality);
+    }
+}
+
+void bitrateUpdate(sensor_t * s){
+    if(!s){
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    window_stats_t stats[STREAM_MAX_CLIENTS];
+
+    portENTER_CRITICAL(&bitrate_mux);
+    bool reset = ceiling_changed;
+    ceiling_changed = false;
+    if(ceiling_framesize == FRAMESIZE_INVALID){
+        ceiling_framesize = s->status.framesize;
+    }
+    if(ceiling_quality < 0){
+        ceiling_quality = s->status.quality;
+    }
+    bool window_done = now - window_start >= BITRATE_WINDOW_MS * 1000LL;
+    if(window_done){
+        memcpy(stats, window, sizeof(stats));
+        memset(window, 0, sizeof(window));
+    }
+    bool active = enabled;
+    float fps_target = target_fps;
+    portEXIT_CRITICAL(&bitrate_mux);
+
+    if(reset){
+        // The user picked new settings: start again from the top
+        level = 0;
+        last_change = now;
+        apply(s, ceiling_framesize, ceiling_quality);
+    }
+    if(!window_done){
+        return;
+    }
+    int64_t window_us = now - window_start;
+    window_start = now;
+
+    // Judge by the client that's struggling most
+    float fps = 0;
+    float busy = 0;
+    float send_per_frame_us = 0;
+    bool any = false;
+    for(int i = 0; i < STREAM_MAX_CLIENTS; i++){
+        if(!stats[i].frames){
+            continue;
+        }
+        float client_busy = (float)stats[i].send_us / window_us;
+        if(!any || client_busy > busy){
+            busy = client_busy;
+            fps = stats[i].frames * 1000000.0 / window_us;
+            send_per_frame_us = (float)stats[i].send_us / stats[i].frames;
+        }
+        any = true;
+    }
+    int rssi = link_rssi();
+
+    int next = level;
+    const char * reason = NULL;
+    if(active && any){
+        float budget_us = 1000000.0 / fps_target;
+        bool link_bound = fps < fps_target * 0.9 && busy > 0.85;
+        bool critical = rssi != 0 && rssi < BITRATE_RSSI_CRITICAL;
+        bool weak = rssi != 0 && rssi < BITRATE_RSSI_WEAK;
+        if((link_bound || critical) && level < max_level()
+                && now - last_change >= BITRATE_DOWN_HOLD_MS * 1000LL){
+            next = level + 1;
+            reason = link_bound ? "link saturated" : "signal critical";
+        } else if(level > 0 && !link_bound && !weak
+                && now - last_change >= BITRATE_UP_HOLD_MS * 1000LL){
+            // Only step up if the frame would still fit the budget
+            float cost = level % quality_steps() == 0 ? FRAMESIZE_STEP_COST : QUALITY_STEP_COST;
+            if(send_per_frame_us * cost < budget_us * 0.7){
+                next = level - 1;
+                reason = "headroom";
+            }
+        }
+    }
+
+    if(next != level){
+        framesize_t framesize;
+        int quality;
+        level = next;
+        last_change = now;
+        level_settings(level, &framesize, &quality);
+        apply(s, framesize, quality);
+        LOG_INFO("ABR: %s, framesize %d quality %d (%.1ffps, %u%% busy, %ddBm)",
+            reason, framesize, quality, fps, (uint32_t)(busy * 100), rssi);
+    }
+
+    portENTER_CRITICAL(&bitrate_mux);
+    state.enabled = active;
+    state.framesize = s->status.framesize;
+    state.quality = s->status.quality;
+    state.level = level;
+    state.fps = fps;
+    state.busy = busy;
+    state.rssi = rssi;
+    if(reason){
+        state.changes++;
+    }
+    portEXIT_CRITICAL(&bitrate_mux);
+}
@@ -0,0 +1,50 @@
+#ifndef adaptive_bitrate_h
+#define adaptive_bitrate_h
+
+#include "esp_camera.h"
+
+// Closed-loop video quality control. Stream clients report how long each
+// frame took to send; once a window the controller compares the achieved
+// frame rate and link utilisation (plus RSSI) against the target and steps
+// JPEG quality and frame size down a ladder, or back up towards the
+// user's settings. Changes are applied by the capture task between frames.
+
+const float BITRATE_TARGET_FPS = 15;
+const int BITRATE_WINDOW_MS = 1000;
+// Hysteresis: minimum time after a change before stepping down again, and
+// before stepping back up
+const int BITRATE_DOWN_HOLD_MS = 2000;
+const int BITRATE_UP_HOLD_MS = 5000;
+const int BITRATE_QUALITY_STEP = 8;
+const int BITRATE_QUALITY_WORST = 42;
+// Below this RSSI we don't step up, below the second we step down early
+const int BITRATE_RSSI_WEAK = -78;
+const int BITRATE_RSSI_CRITICAL = -86;
+
+typedef struct {
+    bool enabled;
+    framesize_t framesize;
+    int quality;
+    int level;          // 0 is the user's setting, higher is cheaper
+    float fps;          // worst client over the last window
+    float busy;         // fraction of that window the worst client spent sending
+    int rssi;
+    uint32_t changes;
+} bitrate_state_t;
+
+void bitrateSetEnabled(bool enabled);
+void bitrateSetTargetFps(float fps);
+
+// The user's chosen settings: the best the controller will go back up to
+void bitrateSetMaxFramesize(framesize_t framesize);
+void bitrateSetBestQuality(int quality);
+
+// Called by a stream client after each frame
+void bitrateReportFrame(int client, size_t bytes, int64_t send_us);
+
+// Called by the capture task between frames; may reconfigure the sensor
+void bitrateUpdate(sensor_t * s);
+
+void bitrateGetState(bitrate_state_t * state);
+
+#endif
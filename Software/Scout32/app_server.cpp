@@ -6,8 +6,8 @@ int neutral = 4915; // Servo Neutral Point
 int lneutral = neutral;
 int rneutral = neutral;
 
-// Libraries. If you get errors compiling, please downgrade ESP32 by Espressif.
-// Use version 1.0.2 (Tools, Manage Libraries).
+// Libraries. Needs the esp32 boards package by Espressif 3.0.0 or later
+// (ESP-IDF 5.1) for httpd_req_async_handler_begin(); see Scout32.ino.
 #include <esp32-hal-ledc.h> 
 #include "esp_http_server.h"
 #include "esp_timer.h"
@@ -16,11 +16,23 @@ int rneutral = neutral;
 #include "Arduino.h"
 
 #include "chassis.h"
+#include "motor_control.h"
 #include "pages.h"
-
-#include "fb_gfx.h"
-#include "fd_forward.h"
-#include "fr_forward.h"
+#include "camera_stream.h"
+#include "adaptive_bitrate.h"
+#include "metrics.h"
+#include "logger.h"
+#include "task_config.h"
+#include "control_protocol.h"
+#include "rtp_stream.h"
+#include "stream_writer.h"
+#include "buffer_pool.h"
+#include "sensor_config.h"
+#include "jpeg_scale.h"
+#include "recorder.h"
+#include "query_parser.h"
+#include "power_manager.h"
+#include "lwip/sockets.h"
 
 // Stream Encoding
 typedef struct {
@@ -28,259 +40,723 @@ typedef struct {
         size_t len;
 } jpg_chunking_t;
 
-#define PART_BOUNDARY "123456789000000000000987654321"
-static const char* _STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
-static const char* _STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char* _STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n";
-httpd_handle_t stream_httpd = NULL;
+typedef struct {
+        uint8_t *buf;
+        size_t size;
+        size_t len;
+        bool overflow;
+} jpg_block_t;
+
 httpd_handle_t camera_httpd = NULL;
+static uint32_t capture_max_age_ms = STREAM_SNAPSHOT_MAX_AGE_MS;
+
+// httpd_resp_send_chunk for a converted /capture, timed for /metrics
+static esp_err_t send_chunk(httpd_req_t *req, const char *buf, ssize_t len){
+    int64_t start = esp_timer_get_time();
+    esp_err_t res = httpd_resp_send_chunk(req, buf, len);
+    metricsObserve(METRIC_CAPTURE_CHUNK_SEND, esp_timer_get_time() - start);
+    return res;
+}
+
 static size_t jpg_encode_stream(void * arg, size_t index, const void* data, size_t len){
     jpg_chunking_t *j = (jpg_chunking_t *)arg;
     if(!index){
         j->len = 0;
     }
-    if(httpd_resp_send_chunk(j->req, (const char *)data, len) != ESP_OK){
+    if(send_chunk(j->req, (const char *)data, len) != ESP_OK){
         return 0;
     }
     j->len += len;
     return len;
 }
 
-static esp_err_t capture_handler(httpd_req_t *req){
+static size_t jpg_encode_block(void * arg, size_t index, const void* data, size_t len){
+    jpg_block_t *j = (jpg_block_t *)arg;
+    if(index + len > j->size){
+        j->overflow = true;
+        return 0;
+    }
+    memcpy(j->buf + index, data, len);
+    j->len = index + len;
+    return len;
+}
+
+// frame2jpg, but into a pool block instead of a fresh malloc every frame.
+// A frame whose JPEG doesn't fit a block (raw SVGA and up) is encoded
+// again into twice the space, which the pool takes from the heap and
+// counts as a fallback. Free the result with poolFree().
+static bool frame2jpg_pooled(camera_fb_t * fb, uint8_t quality, uint8_t ** out, size_t * out_len){
+    for(size_t size = POOL_FRAME_BLOCK; ; size *= 2){
+        jpg_block_t block = {(uint8_t *)poolAlloc(size), size, 0, false};
+        if(!block.buf){
+            return false;
+        }
+        if(frame2jpg_cb(fb, quality, jpg_encode_block, &block)){
+            *out = block.buf;
+            *out_len = block.len;
+            return true;
+        }
+        poolFree(block.buf);
+        if(!block.overflow){
+            return false;
+        }
+    }
+}
+
+// Still image. While a stream is running this is the frame it last
+// published, or the next one if that's too old, so /capture never takes a
+// frame buffer away from the live view. Only with no stream running do we
+// go to the camera ourselves.
+esp_err_t capture_handler(httpd_req_t *req){
     camera_fb_t * fb = NULL;
     esp_err_t res = ESP_OK;
     int64_t fr_start = esp_timer_get_time();
-
-    fb = esp_camera_fb_get();
-    if (!fb) {
-        Serial.println("Camera capture failed");
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
+    int64_t frame_timestamp = 0;
+
+    stream_frame_t * frame = streamSnapshot(capture_max_age_ms);
+    if(!frame && streamActive()){
+        int client = streamAddClient();
+        if(client >= 0){
+            frame = streamAcquireFrame(client);
+            streamRemoveClient(client);
+        }
+    }
+    if(frame){
+        metricsCount(METRIC_CAPTURES_CACHED);
+        fb = frame->fb;
+        frame_timestamp = frame->timestamp;
+    } else {
+        powerNoteActivity(POWER_SOURCE_CAPTURE);
+        fb = esp_camera_fb_get();
+        metricsObserve(METRIC_CAMERA_GRAB, esp_timer_get_time() - fr_start);
+        if (!fb) {
+            metricsCount(METRIC_CAPTURE_FAILURES);
+            LOG_ERROR("Camera capture failed");
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        metricsCount(METRIC_CAPTURES_SENSOR);
+        frame_timestamp = fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
     }
 
+    uint32_t age_ms = (uint32_t)((esp_timer_get_time() - frame_timestamp) / 1000);
+    char age_str[12];
+    snprintf(age_str, sizeof(age_str), "%u", age_ms);
     httpd_resp_set_type(req, "image/jpeg");
     httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=capture.jpg");
+    httpd_resp_set_hdr(req, "X-Frame-Age-Ms", age_str);
 
-    size_t out_len, out_width, out_height;
-    uint8_t * out_buf;
-    bool s;
-    {
-        size_t fb_len = 0;
-        if(fb->format == PIXFORMAT_JPEG){
-            fb_len = fb->len;
-            res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
-        } else {
-            jpg_chunking_t jchunk = {req, 0};
-            res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk)?ESP_OK:ESP_FAIL;
-            httpd_resp_send_chunk(req, NULL, 0);
-            fb_len = jchunk.len;
-        }
-        esp_camera_fb_return(fb);
-        int64_t fr_end = esp_timer_get_time();
-        Serial.printf("JPG: %uB %ums\n", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start)/1000));
-        return res;
+    size_t fb_len = 0;
+    if(fb->format == PIXFORMAT_JPEG){
+        // Straight out of the frame buffer, no copy
+        fb_len = fb->len;
+        res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
+    } else {
+        jpg_chunking_t jchunk = {req, 0};
+        int64_t encode_start = esp_timer_get_time();
+        res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk)?ESP_OK:ESP_FAIL;
+        metricsObserve(METRIC_JPEG_ENCODE, esp_timer_get_time() - encode_start);
+        httpd_resp_send_chunk(req, NULL, 0);
+        fb_len = jchunk.len;
     }
-
-    dl_matrix3du_t *image_matrix = dl_matrix3du_alloc(1, fb->width, fb->height, 3);
-    if (!image_matrix) {
+    if(frame){
+        streamReleaseFrame(frame);
+    } else {
         esp_camera_fb_return(fb);
-        Serial.println("dl_matrix3du_alloc failed");
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
     }
+    int64_t fr_end = esp_timer_get_time();
+    LOG_INFO("JPG: %uB %ums, %s frame %ums old", (uint32_t)(fb_len), (uint32_t)((fr_end - fr_start)/1000),
+        frame ? "stream" : "camera", age_ms);
+    return res;
+}
 
-    out_buf = image_matrix->item;
-    out_len = fb->width * fb->height * 3;
-    out_width = fb->width;
-    out_height = fb->height;
-
-    s = fmt2rgb888(fb->buf, fb->len, fb->format, out_buf);
-    esp_camera_fb_return(fb);
-    if(!s){
-        dl_matrix3du_free(image_matrix);
-        Serial.println("to rgb888 failed");
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
+// Split the next key=value pair off a query string, in place. NULL at the end.
+static char * next_query_pair(char ** query, char ** value){
+    char * key = *query;
+    if(!*key){
+        return NULL;
     }
-
-    jpg_chunking_t jchunk = {req, 0};
-    s = fmt2jpg_cb(out_buf, out_len, out_width, out_height, PIXFORMAT_RGB888, 90, jpg_encode_stream, &jchunk);
-    dl_matrix3du_free(image_matrix);
-    if(!s){
-        Serial.println("JPEG compression failed");
-        return ESP_FAIL;
+    char * end = strchr(key, '&');
+    if(end){
+        *end = 0;
+        *query = end + 1;
+    } else {
+        *query = key + strlen(key);
     }
+    char * eq = strchr(key, '=');
+    if(eq){
+        *eq = 0;
+        *value = eq + 1;
+    } else {
+        *value = key + strlen(key);
+    }
+    return key;
+}
 
-    int64_t fr_end = esp_timer_get_time();
-    return res;
+// Per-client preview options: /stream?scale=4&roi=x,y,w,h crops to the
+// given part of the frame (fractions of its size) and scales it down by 2,
+// 4 or 8. False if they don't make sense.
+static bool parse_scale_options(httpd_req_t *req, jpeg_scale_t * scale){
+    *scale = JPEG_SCALE_NONE;
+    char buf[96];
+    size_t len = httpd_req_get_url_query_len(req);
+    if(!len){
+        return true;
+    }
+    if(len >= sizeof(buf) || httpd_req_get_url_query_str(req, buf, sizeof(buf)) != ESP_OK){
+        return false;
+    }
+    char * query = buf;
+    char * key;
+    char * value;
+    while((key = next_query_pair(&query, &value))){
+        if(strcmp(key, "scale") == 0){
+            scale->scale = atoi(value);
+            if(scale->scale != 1 && scale->scale != 2 && scale->scale != 4 && scale->scale != 8){
+                return false;
+            }
+        } else if(strcmp(key, "roi") == 0){
+            if(sscanf(value, "%f,%f,%f,%f", &scale->roi_x, &scale->roi_y, &scale->roi_w, &scale->roi_h) != 4 ||
+                    scale->roi_x < 0 || scale->roi_y < 0 || scale->roi_w <= 0 || scale->roi_h <= 0 ||
+                    scale->roi_x + scale->roi_w > 1.001f || scale->roi_y + scale->roi_h > 1.001f){
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
-static esp_err_t stream_handler(httpd_req_t *req){
+// Runs on a stream sender task, for as long as the client stays connected
+static void stream_frames(httpd_req_t *req, void * arg){
+    stream_frame_t * frame = NULL;
     camera_fb_t * fb = NULL;
     esp_err_t res = ESP_OK;
     size_t _jpg_buf_len = 0;
     uint8_t * _jpg_buf = NULL;
-    char * part_buf[64];
-    dl_matrix3du_t *image_matrix = NULL;
-
-    static int64_t last_frame = 0;
-    if(!last_frame) {
-        last_frame = esp_timer_get_time();
+    int64_t frame_timestamp = 0;
+    stream_part_info_t part;
+    stream_client_stats_t stats;
+    int64_t last_frame = esp_timer_get_time();
+    uint8_t * pooled = NULL;
+
+    jpeg_scale_t scale;
+    if(!parse_scale_options(req, &scale)){
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad scale or roi");
+        return;
+    }
+    bool scaling = jpegScaleActive(&scale);
+
+    // Frames are signalled to the task that registers
+    int client = streamAddClient();
+    if(client < 0){
+        LOG_WARN("Too many stream clients, or the camera isn't ready");
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_send(req, NULL, 0);
+        return;
     }
 
-    res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
+    res = streamWriterBegin(req);
     if(res != ESP_OK){
-        return res;
+        streamRemoveClient(client);
+        return;
     }
 
     while(true){
-        fb = esp_camera_fb_get();
-        if (!fb) {
-            Serial.println("Camera capture failed");
+        frame = streamAcquireFrame(client);
+        if (!frame) {
+            LOG_ERROR("Camera capture failed");
             res = ESP_FAIL;
         } else {
-             {
-                if(fb->format != PIXFORMAT_JPEG){
-                    bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-                    esp_camera_fb_return(fb);
-                    fb = NULL;
-                    if(!jpeg_converted){
-                        Serial.println("JPEG compression failed");
-                        res = ESP_FAIL;
-                    }
+            frame_timestamp = frame->timestamp;
+            part.seq = frame->seq;
+            part.timestamp = frame->timestamp;
+            part.exposure = frame->exposure;
+            part.gain = frame->gain;
+            fb = frame->fb;
+            if(fb->format != PIXFORMAT_JPEG){
+                int64_t encode_start = esp_timer_get_time();
+                bool jpeg_converted = frame2jpg_pooled(fb, 80, &_jpg_buf, &_jpg_buf_len);
+                metricsObserve(METRIC_JPEG_ENCODE, esp_timer_get_time() - encode_start);
+                streamReleaseFrame(frame);
+                frame = NULL;
+                pooled = _jpg_buf;
+                if(!jpeg_converted){
+                    LOG_ERROR("JPEG compression failed");
+                    res = ESP_FAIL;
+                }
+            } else {
+                _jpg_buf_len = fb->len;
+                _jpg_buf = fb->buf;
+            }
+            // Only the sensor's own JPEGs: scaling a converted frame would
+            // take a second pool block
+            if(scaling && frame){
+                int64_t scale_start = esp_timer_get_time();
+                pooled = (uint8_t *)poolAlloc(POOL_FRAME_BLOCK);
+                if(pooled && jpegScale(fb->buf, fb->len, &scale, pooled, POOL_FRAME_BLOCK, &_jpg_buf, &_jpg_buf_len)){
+                    metricsObserve(METRIC_JPEG_SCALE, esp_timer_get_time() - scale_start);
+                    streamReleaseFrame(frame);
+                    frame = NULL;
                 } else {
-                    _jpg_buf_len = fb->len;
-                    _jpg_buf = fb->buf;
+                    // Send it as it is
+                    LOG_EVERY(LOG_LEVEL_WARN, 5000, "MJPG: can't scale a %ux%u frame", (unsigned)fb->width, (unsigned)fb->height);
+                    poolFree(pooled);
+                    pooled = NULL;
                 }
             }
         }
+        int64_t send_start = esp_timer_get_time();
         if(res == ESP_OK){
-            size_t hlen = snprintf((char *)part_buf, 64, _STREAM_PART, _jpg_buf_len);
-            res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
-        }
-        if(res == ESP_OK){
-            res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+            res = streamWriterSendFrame(req, _jpg_buf, _jpg_buf_len, &part);
         }
-        if(res == ESP_OK){
-            res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+        if(frame){
+            streamReleaseFrame(frame);
+            frame = NULL;
         }
-        if(fb){
-            esp_camera_fb_return(fb);
-            fb = NULL;
-            _jpg_buf = NULL;
-        } else if(_jpg_buf){
-            free(_jpg_buf);
-            _jpg_buf = NULL;
+        if(pooled){
+            poolFree(pooled);
+            pooled = NULL;
         }
+        _jpg_buf = NULL;
         if(res != ESP_OK){
             break;
         }
         int64_t fr_end = esp_timer_get_time();
+        bitrateReportFrame(client, _jpg_buf_len, fr_end - send_start);
+        metricsObserve(METRIC_FRAME_SEND, fr_end - send_start);
+        metricsCount(METRIC_FRAMES_SENT);
+        metricsCount(METRIC_STREAM_BYTES, _jpg_buf_len);
         int64_t frame_time = fr_end - last_frame;
         last_frame = fr_end;
         frame_time /= 1000;
-        Serial.printf("MJPG: %uB %ums (%.1ffps)\n",
+        streamGetClientStats(client, &stats);
+        // One line a frame would swamp the UART: sample it
+        LOG_EVERY(LOG_LEVEL_INFO, 1000, "MJPG: %uB %ums (%.1ffps) age %ums, %u dropped",
             (uint32_t)(_jpg_buf_len),
-            (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time           
+            (uint32_t)frame_time, 1000.0 / (uint32_t)frame_time,
+            (uint32_t)((fr_end - frame_timestamp)/1000),
+            stats.skipped + stats.stale
         );
     }
 
-    last_frame = 0;
-    return res;
+    streamGetClientStats(client, &stats);
+    LOG_INFO("MJPG: client done, %u sent, %u skipped, %u stale, %u unchanged",
+        stats.sent, stats.skipped, stats.stale, stats.unchanged);
+    streamRemoveClient(client);
+}
+
+// Hand the stream to a sender task, keeping this server's task free for
+// the other endpoints
+esp_err_t stream_handler(httpd_req_t *req){
+    if(streamWriterHandOff(req, stream_frames, NULL) == ESP_OK){
+        return ESP_OK;
+    }
+    LOG_WARN("No stream sender free");
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    return httpd_resp_send(req, NULL, 0);
+}
+
+// The black box recording, on a sender task: it's a couple of MB
+static void send_recording(httpd_req_t *req, void * arg){
+    bool csv = arg != NULL;
+    esp_err_t res = csv ? recorderSendCsv(req) : recorderSendAvi(req);
+    if(res == ESP_ERR_NOT_FOUND){
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Nothing recorded");
+    } else if(res == ESP_ERR_INVALID_STATE || res == ESP_ERR_NO_MEM){
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_send(req, NULL, 0);
+    }
+}
+
+// /recording sends the AVI, /recording?format=csv just the event log
+esp_err_t recording_handler(httpd_req_t *req){
+    char query[32];
+    char format[8] = "";
+    if(httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK){
+        httpd_query_key_value(query, "format", format, sizeof(format));
+    }
+    bool csv = strcmp(format, "csv") == 0;
+    if(streamWriterHandOff(req, send_recording, csv ? (void *)1 : NULL) == ESP_OK){
+        return ESP_OK;
+    }
+    LOG_WARN("No stream sender free");
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    return httpd_resp_send(req, NULL, 0);
 }
 
 
-// Drive the vehicle
-static esp_err_t drive_handler(httpd_req_t *req)
+// Drive the vehicle. Returns when the motors will take the command up.
+static int64_t drive(int forward, int steer, recorder_source_t source)
 {
-    char*  buf;
-    size_t buf_len;
-    char forward_str[32] = {0,};
-    char steer_str[32] = {0,};
-
-    buf_len = httpd_req_get_url_query_len(req) + 1;
-    if (buf_len > 1) {
-        buf = (char*)malloc(buf_len);
-        if(!buf){
-            httpd_resp_send_500(req);
-            return ESP_FAIL;
-        }
-        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
-            if (httpd_query_key_value(buf, "forward", forward_str, sizeof(forward_str)) == ESP_OK &&
-                httpd_query_key_value(buf, "steer", steer_str, sizeof(steer_str)) == ESP_OK) {
-                    int forward = atoi(forward_str);
-                    int steer = atoi(steer_str);
-
-                    setLeftMotor(forward + steer);
-                    setRightMotor(forward - steer);
-            } else {
-                free(buf);
-                httpd_resp_send_404(req);
-                return ESP_FAIL;
-            }
-        } else {
-            free(buf);
-            httpd_resp_send_404(req);
-            return ESP_FAIL;
+    motorSetpoint(forward + steer, forward - steer);
+    int64_t actuate = motorActuateTime();
+    recorderLogDrive(forward, steer, source);
+    return actuate;
+}
+
+// A 400 saying what was wrong with the query
+static esp_err_t send_query_error(httpd_req_t *req, const query_result_t * result){
+    char message[64];
+    httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, queryErrorMessage(result, message, sizeof(message)));
+    return ESP_FAIL;
+}
+
+// /drive?forward=..&steer=..[&t=..], as -100 to 100
+typedef struct {
+    int forward;
+    int steer;
+    char client_time[24];
+} drive_query_t;
+
+static const query_param_t drive_params[] = {
+    {"forward", QUERY_INT, offsetof(drive_query_t, forward), -100, 100, 0, true},
+    {"steer", QUERY_INT, offsetof(drive_query_t, steer), -100, 100, 0, true},
+    {"t", QUERY_STRING, offsetof(drive_query_t, client_time), 0, sizeof(((drive_query_t *)0)->client_time) - 1, 0, false},
+};
+const int DRIVE_PARAM_COUNT = sizeof(drive_params) / sizeof(drive_params[0]);
+
+// esp_timer time as seconds, the way stream parts give it
+static void format_time(char * buf, size_t size, int64_t us){
+    snprintf(buf, size, "%u.%06u", (unsigned)(us / 1000000), (unsigned)(us % 1000000));
+}
+
+// Latency probes: /drive?...&t=<client time> gets t back along with when
+// the command arrived and when it reaches the motors, so the client can
+// work out the clock offset from the round trip and time client->motor.
+// Anything but digits and a point in t is dropped.
+static esp_err_t send_drive_response(httpd_req_t *req, const char * client_time, int64_t received, int64_t actuate){
+    char received_str[20];
+    char actuate_str[20];
+    format_time(received_str, sizeof(received_str), received);
+    format_time(actuate_str, sizeof(actuate_str), actuate);
+    if(client_time[0] && strspn(client_time, "0123456789.") == strlen(client_time)){
+        httpd_resp_set_hdr(req, "X-Client-Time", client_time);
+    }
+    httpd_resp_set_hdr(req, "X-Receive-Time", received_str);
+    httpd_resp_set_hdr(req, "X-Actuate-Time", actuate_str);
+    httpd_resp_set_hdr(req, "Access-Control-Expose-Headers", "X-Client-Time, X-Receive-Time, X-Actuate-Time");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, NULL, 0);
+}
+
+esp_err_t drive_handler(httpd_req_t *req)
+{
+    int64_t start = esp_timer_get_time();
+    drive_query_t query;
+    query_target_t target = {drive_params, DRIVE_PARAM_COUNT, &query, 0};
+    query_result_t result;
+    if (!queryParse(req->uri, &target, 1, &result)) {
+        return send_query_error(req, &result);
+    }
+
+    int64_t actuate = drive(query.forward, query.steer, RECORDER_SOURCE_HTTP);
+    metricsCount(METRIC_DRIVE_COMMANDS_HTTP);
+    metricsObserve(METRIC_DRIVE_HANDLER, esp_timer_get_time() - start);
+    return send_drive_response(req, query.client_time, start, actuate);
+}
+
+
+// Drive the vehicle over a persistent WebSocket. Each frame is one fixed
+// size control_drive_msg_t; commands that arrive out of order are dropped
+// and every applied one is acknowledged with telemetry on the same socket.
+typedef struct {
+    uint16_t last_seq;
+    uint16_t discarded;
+    bool started;
+} control_session_t;
+
+static esp_err_t control_ws_handler(httpd_req_t *req)
+{
+    if (req->method == HTTP_GET) {
+        // Handshake. Per-connection state lives as long as the socket.
+        control_session_t * session = (control_session_t *)calloc(1, sizeof(control_session_t));
+        if(!session){
+            return ESP_ERR_NO_MEM;
         }
-        free(buf);
-    } else {
-        httpd_resp_send_404(req);
+        req->sess_ctx = session;
+        req->free_ctx = free;
+        return ESP_OK;
+    }
+    control_session_t * session = (control_session_t *)req->sess_ctx;
+    int64_t start = esp_timer_get_time();
+
+    control_drive_msg_t msg;
+    httpd_ws_frame_t frame;
+    memset(&frame, 0, sizeof(frame));
+    esp_err_t res = httpd_ws_recv_frame(req, &frame, 0);
+    if(res != ESP_OK){
+        return res;
+    }
+    if(frame.type != HTTPD_WS_TYPE_BINARY || frame.len != sizeof(msg)){
+        // Not our protocol: we can't skip the payload, so drop the client
         return ESP_FAIL;
     }
+    frame.payload = (uint8_t *)&msg;
+    res = httpd_ws_recv_frame(req, &frame, sizeof(msg));
+    if(res != ESP_OK){
+        return res;
+    }
+    if(msg.type != CONTROL_MSG_DRIVE){
+        return ESP_OK;
+    }
+
+    bool reset = msg.flags & CONTROL_FLAG_RESET;
+    if(session->started && !reset && (int16_t)(msg.seq - session->last_seq) <= 0){
+        session->discarded++;
+        metricsCount(METRIC_DRIVE_COMMANDS_DISCARDED);
+        return ESP_OK;
+    }
+    session->started = true;
+    session->last_seq = msg.seq;
+    int64_t actuate = drive(msg.forward, msg.steer, RECORDER_SOURCE_WS);
+    metricsCount(METRIC_DRIVE_COMMANDS_WS);
+    metricsObserve(METRIC_DRIVE_HANDLER, esp_timer_get_time() - start);
+
+    control_telemetry_msg_t telemetry;
+    memset(&telemetry, 0, sizeof(telemetry));
+    telemetry.type = CONTROL_MSG_TELEMETRY;
+    telemetry.ack_seq = msg.seq;
+    telemetry.left = max(min(msg.forward + msg.steer, 100), -100);
+    telemetry.right = max(min(msg.forward - msg.steer, 100), -100);
+    telemetry.client_ms = msg.client_ms;
+    telemetry.device_ms = millis();
+    int64_t actuate_us = actuate - (int64_t)telemetry.device_ms * 1000;
+    telemetry.actuate_us = max(min(actuate_us, (int64_t)65535), (int64_t)0);
+    telemetry.discarded = session->discarded;
+
+    httpd_ws_frame_t reply;
+    memset(&reply, 0, sizeof(reply));
+    reply.final = true;
+    reply.type = HTTPD_WS_TYPE_BINARY;
+    reply.payload = (uint8_t *)&telemetry;
+    reply.len = sizeof(telemetry);
+    return httpd_ws_send_frame(req, &reply);
+}
+
+
+// Settings /config takes besides the camera's (see sensor_config.h), in
+// stream_params order
+typedef enum {
+    STREAM_SETTING_ADAPTIVE,
+    STREAM_SETTING_TARGET_FPS,
+    STREAM_SETTING_CAPTURE_MAX_AGE,
+    STREAM_SETTING_CHANGE_THRESHOLD,
+    STREAM_SETTING_KEYFRAME_MS,
+    STREAM_SETTING_NODELAY,
+    STREAM_SETTING_SNDBUF,
+    STREAM_SETTING_RECORD,
+    STREAM_SETTING_RECORD_FPS,
+    STREAM_SETTING_IDLE_MS,
+    STREAM_SETTING_COUNT
+} stream_setting_t;
+
+typedef struct {
+    bool adaptive;
+    float target_fps;
+    int capture_max_age;
+    float change_threshold;
+    int keyframe_ms;
+    bool nodelay;
+    int sndbuf;
+    bool record;
+    int record_fps;
+    int idle_ms;
+} stream_settings_t;
+
+static const query_param_t stream_params[STREAM_SETTING_COUNT] = {
+    {"adaptive", QUERY_BOOL, offsetof(stream_settings_t, adaptive), 0, 1, 0, false},
+    {"target_fps", QUERY_FLOAT, offsetof(stream_settings_t, target_fps), 0, 60, 0, false},
+    {"capture_max_age", QUERY_INT, offsetof(stream_settings_t, capture_max_age), 0, 60000, 0, false},
+    {"change_threshold", QUERY_FLOAT, offsetof(stream_settings_t, change_threshold), 0, 255, 0, false},
+    {"keyframe_ms", QUERY_INT, offsetof(stream_settings_t, keyframe_ms), 0, 60000, 0, false},
+    {"nodelay", QUERY_BOOL, offsetof(stream_settings_t, nodelay), 0, 1, 0, false},
+    {"sndbuf", QUERY_INT, offsetof(stream_settings_t, sndbuf), 0, 65535, 0, false},
+    {"record", QUERY_BOOL, offsetof(stream_settings_t, record), 0, 1, 0, false},
+    {"record_fps", QUERY_INT, offsetof(stream_settings_t, record_fps), 1, RECORDER_MAX_FPS, 0, false},
+    // 0 never goes idle
+    {"idle_ms", QUERY_INT, offsetof(stream_settings_t, idle_ms), 0, 3600000, 0, false},
+};
+
+static void apply_stream_settings(const stream_settings_t * settings, uint32_t mask){
+    if(mask & (1u << STREAM_SETTING_ADAPTIVE)){
+        bitrateSetEnabled(settings->adaptive);
+    }
+    if(mask & (1u << STREAM_SETTING_TARGET_FPS)){
+        bitrateSetTargetFps(settings->target_fps);
+    }
+    if(mask & (1u << STREAM_SETTING_CAPTURE_MAX_AGE)){
+        capture_max_age_ms = settings->capture_max_age;
+    }
+    if(mask & (1u << STREAM_SETTING_CHANGE_THRESHOLD)){
+        streamSetChangeThreshold(settings->change_threshold);
+    }
+    if(mask & (1u << STREAM_SETTING_KEYFRAME_MS)){
+        streamSetKeyframeInterval(settings->keyframe_ms);
+    }
+    if(mask & (1u << STREAM_SETTING_NODELAY)){
+        streamWriterSetNoDelay(settings->nodelay);
+    }
+    if(mask & (1u << STREAM_SETTING_SNDBUF)){
+        streamWriterSetSendBuffer(settings->sndbuf);
+    }
+    if(mask & (1u << STREAM_SETTING_RECORD)){
+        recorderSetEnabled(settings->record);
+    }
+    if(mask & (1u << STREAM_SETTING_RECORD_FPS)){
+        recorderSetFps(settings->record_fps);
+    }
+    if(mask & (1u << STREAM_SETTING_IDLE_MS)){
+        powerSetIdleTimeout(settings->idle_ms);
+    }
+}
 
+static esp_err_t send_config_state(httpd_req_t *req){
+    sensor_settings_t settings;
+    sensorConfigGet(&settings);
+    bitrate_state_t bitrate;
+    bitrateGetState(&bitrate);
 
+    char * json = (char*)poolAlloc(POOL_REQUEST_BLOCK);
+    if(!json){
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    int len = 0;
+    json[len++] = '{';
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        len += snprintf(json + len, POOL_REQUEST_BLOCK - len, "\"%s\":%d,", sensorConfigKey(i), settings.values[i]);
+    }
+    // What the bitrate controller is actually running at
+    len += snprintf(json + len, POOL_REQUEST_BLOCK - len,
+        "\"adaptive\":%s,\"change_threshold\":%g,\"live_framesize\":%d,\"live_quality\":%d,\"idle_ms\":%u}",
+        bitrate.enabled ? "true" : "false", streamGetChangeThreshold(), bitrate.framesize, bitrate.quality,
+        (unsigned)powerIdleTimeout());
+    httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    return httpd_resp_send(req, NULL, 0);
+    esp_err_t res = httpd_resp_send(req, json, len);
+    poolFree(json);
+    return res;
+}
+
+// Configure the vehicle: /config?key=value&key=value... sets any number of
+// settings in one request, camera settings as one batch between frames.
+// Answers with the full camera state, so a bare /config reads it.
+esp_err_t config_handler(httpd_req_t *req)
+{
+    // Check everything before applying anything
+    sensor_settings_t settings;
+    stream_settings_t stream;
+    query_target_t targets[] = {
+        {sensorConfigParams(), SENSOR_SETTING_COUNT, &settings, 0},
+        {stream_params, STREAM_SETTING_COUNT, &stream, 0},
+    };
+    query_result_t result;
+    if(!queryParse(req->uri, targets, 2, &result)){
+        return send_query_error(req, &result);
+    }
+
+    apply_stream_settings(&stream, targets[1].seen);
+    uint32_t mask = targets[0].seen;
+    esp_err_t res = mask ? sensorConfigSet(&settings, mask) : ESP_OK;
+    if(res != ESP_OK){
+        // Only before the camera is up
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    return send_config_state(req);
+}
+
+
+// Prometheus text exposition of the counters and histograms in metrics.h
+static bool metrics_write_chunk(void * arg, const char * data, size_t len){
+    return httpd_resp_send_chunk((httpd_req_t *)arg, data, len) == ESP_OK;
 }
 
+esp_err_t metrics_handler(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    if(!metricsWrite(metrics_write_chunk, req)){
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+
+// Start or stop an RTP/JPEG session: /rtp?start=1[&host=a.b.c.d][&port=n]
+// or /rtp?stop=1. The host defaults to whoever made the request.
+static bool peer_address(httpd_req_t *req, uint32_t * host)
+{
+    struct sockaddr_in6 addr;
+    socklen_t addr_len = sizeof(addr);
+    if(getpeername(httpd_req_to_sockfd(req), (struct sockaddr *)&addr, &addr_len) != 0){
+        return false;
+    }
+    if(addr.sin6_family == AF_INET){
+        *host = ((struct sockaddr_in *)&addr)->sin_addr.s_addr;
+        return true;
+    }
+    // httpd listens on IPv6 when lwIP has it, with IPv4 peers mapped in
+    if(addr.sin6_family == AF_INET6 && IN6_IS_ADDR_V4MAPPED(&addr.sin6_addr)){
+        memcpy(host, &addr.sin6_addr.s6_addr[12], 4);
+        return true;
+    }
+    return false;
+}
 
-// Cofigure the vehicle
-static esp_err_t config_handler(httpd_req_t *req)
+esp_err_t rtp_handler(httpd_req_t *req)
 {
-    char*  buf;
-    size_t buf_len;
+    char query[96] = {0,};
     char val_str[32] = {0,};
-    int res = 0;
+    if(httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK){
+        query[0] = 0;
+    }
 
-    buf_len = httpd_req_get_url_query_len(req) + 1;
-    if (buf_len > 1) {
-        buf = (char*)malloc(buf_len);
-        if(!buf){
-            httpd_resp_send_500(req);
+    if(httpd_query_key_value(query, "start", val_str, sizeof(val_str)) == ESP_OK && atoi(val_str)){
+        uint32_t host;
+        uint16_t port = RTP_DEFAULT_PORT;
+        if(httpd_query_key_value(query, "host", val_str, sizeof(val_str)) == ESP_OK){
+            struct in_addr addr;
+            if(!inet_aton(val_str, &addr)){
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad host");
+                return ESP_FAIL;
+            }
+            host = addr.s_addr;
+        } else if(!peer_address(req, &host)){
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No host");
             return ESP_FAIL;
         }
-        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
-            if (httpd_query_key_value(buf, "framesize", val_str, sizeof(val_str)) == ESP_OK) {
-                sensor_t * s = esp_camera_sensor_get();
-                int val = atoi(val_str);
-                if (s->pixformat == PIXFORMAT_JPEG) {
-                    res = s->set_framesize(s, (framesize_t)val);
-                }
-            } else if (httpd_query_key_value(buf, "quality", val_str, sizeof(val_str)) == ESP_OK) {
-                sensor_t * s = esp_camera_sensor_get();
-                int val = atoi(val_str);
-                res = s->set_quality(s, val);
-            } else if (httpd_query_key_value(buf, "flash", val_str, sizeof(val_str)) == ESP_OK) {
-                int val = atoi(val_str);
-                setLedBrightness(val);
-            } else {
-                free(buf);
-                httpd_resp_send_404(req);
+        if(httpd_query_key_value(query, "port", val_str, sizeof(val_str)) == ESP_OK){
+            // Checked before it's narrowed; RTCP goes to port + 1
+            char * end;
+            long value = strtol(val_str, &end, 10);
+            if(end == val_str || *end || value < 1 || value > 0xFFFE){
+                httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad port (1 to 65534)");
                 return ESP_FAIL;
             }
-        } else {
-            free(buf);
-            httpd_resp_send_404(req);
+            port = value;
+        }
+        if(rtpStart(host, port) == ESP_FAIL){
+            httpd_resp_send_500(req);
             return ESP_FAIL;
         }
-        free(buf);
-    } else {
-        httpd_resp_send_404(req);
-        return ESP_FAIL;
+        // ESP_ERR_INVALID_STATE: already running, report that session
+    } else if(httpd_query_key_value(query, "stop", val_str, sizeof(val_str)) == ESP_OK && atoi(val_str)){
+        rtpStop();
     }
+
+    rtp_stats_t stats;
+    rtpGetStats(&stats);
+    struct in_addr addr;
+    addr.s_addr = stats.host;
+    char json[224];
+    int len = snprintf(json, sizeof(json),
+        "{\"running\":%s,\"host\":\"%s\",\"port\":%u,\"frames\":%u,\"packets\":%u,"
+        "\"bytes\":%u,\"dropped\":%u,\"unsupported\":%u}",
+        stats.running ? "true" : "false", inet_ntoa(addr), stats.port, stats.frames,
+        stats.packets, stats.bytes, stats.dropped, stats.unsupported);
+    httpd_resp_set_type(req, "application/json");
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-    return httpd_resp_send(req, NULL, 0);
+    return httpd_resp_send(req, json, len);
 }
 
 
@@ -289,47 +765,27 @@ static esp_err_t config_handler(httpd_req_t *req)
 void startCameraServer()
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-
-    httpd_uri_t drive_uri = {
-        .uri       = "/drive",
-        .method    = HTTP_GET,
-        .handler   = drive_handler,
-        .user_ctx  = NULL
-    };
-    
-    httpd_uri_t config_uri = {
-        .uri       = "/config",
-        .method    = HTTP_GET,
-        .handler   = config_handler,
-        .user_ctx  = NULL
-    };
-
-    httpd_uri_t capture_uri = {
-        .uri       = "/capture",
-        .method    = HTTP_GET,
-        .handler   = capture_handler,
-        .user_ctx  = NULL
-    };
-
-   httpd_uri_t stream_uri = {
-        .uri       = "/stream",
+    const task_spec_t * task = taskSpec(TASK_HTTP);
+    config.core_id = task->core;
+    config.task_priority = task->priority;
+    config.stack_size = task->stack;
+    // The route table's dispatcher is registered as "/*" (see pages.h)
+    config.uri_match_fn = httpd_uri_match_wildcard;
+
+    // The websocket handshake needs a handler registered as one, so /ws
+    // is the only path outside the route table. It goes first: the server
+    // takes the first match, and "/*" matches everything.
+    httpd_uri_t control_ws_uri = {
+        .uri       = "/ws",
         .method    = HTTP_GET,
-        .handler   = stream_handler,
-        .user_ctx  = NULL
+        .handler   = control_ws_handler,
+        .user_ctx  = NULL,
+        .is_websocket = true
     };
     
-    Serial.printf("Starting web server on port: '%d'\n", config.server_port);
+    LOG_INFO("Starting web server on port: '%d'", config.server_port);
     if (httpd_start(&camera_httpd, &config) == ESP_OK) {
-        registerStaticPages(camera_httpd);
-        httpd_register_uri_handler(camera_httpd, &capture_uri);
-        httpd_register_uri_handler(camera_httpd, &config_uri);
-        httpd_register_uri_handler(camera_httpd, &drive_uri);
-    }
-
-    config.server_port += 1;
-    config.ctrl_port += 1;
-    Serial.printf("Starting stream server on port: '%d'\n", config.server_port);
-    if (httpd_start(&stream_httpd, &config) == ESP_OK) {
-        httpd_register_uri_handler(stream_httpd, &stream_uri);
+        httpd_register_uri_handler(camera_httpd, &control_ws_uri);
+        registerRoutes(camera_httpd);
     }
 }
@@ -0,0 +1,53 @@
+#include <Arduino.h>
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "logger.h"
+#include "boot_timeline.h"
+
+static portMUX_TYPE boot_mux = portMUX_INITIALIZER_UNLOCKED;
+static boot_phase_t phases[BOOT_MAX_PHASES];
+static int phase_count = 0;
+
+static const char * reset_reason_name(esp_reset_reason_t reason){
+    switch(reason){
+        case ESP_RST_POWERON: return "power on";
+        case ESP_RST_BROWNOUT: return "brownout";
+        case ESP_RST_SW: return "software";
+        case ESP_RST_PANIC: return "panic";
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT: return "watchdog";
+        case ESP_RST_DEEPSLEEP: return "deep sleep";
+        case ESP_RST_EXT: return "reset pin";
+        default: return "unknown";
+    }
+}
+
+void bootMark(const char * name){
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&boot_mux);
+    if(phase_count < BOOT_MAX_PHASES){
+        phases[phase_count].name = name;
+        phases[phase_count].us = now;
+        phase_count++;
+    }
+    portEXIT_CRITICAL(&boot_mux);
+}
+
+int bootGetTimeline(boot_phase_t * out, int max){
+    portENTER_CRITICAL(&boot_mux);
+    int n = min(max, phase_count);
+    memcpy(out, phases, n * sizeof(boot_phase_t));
+    portEXIT_CRITICAL(&boot_mux);
+    return n;
+}
+
+void bootLogTimeline(){
+    boot_phase_t timeline[BOOT_MAX_PHASES];
+    int n = bootGetTimeline(timeline, BOOT_MAX_PHASES);
+    LOG_INFO("Boot timeline (reset: %s):", reset_reason_name(esp_reset_reason()));
+    for(int i = 0; i < n; i++){
+        LOG_INFO("  %-12s %6u ms", timeline[i].name, (uint32_t)(timeline[i].us / 1000));
+    }
+}
@@ -0,0 +1,23 @@
+#ifndef boot_timeline_h
+#define boot_timeline_h
+
+#include <stdint.h>
+
+// Boot timeline. Each init step marks when it finished, from whichever task
+// ran it, on the esp_timer clock (time since the app started). Steps run
+// concurrently, so the timeline is a list of finish times rather than a
+// sum of durations. Once boot is over it's logged, and /metrics keeps it.
+
+const int BOOT_MAX_PHASES = 12;
+
+typedef struct {
+    const char * name;
+    int64_t us;
+} boot_phase_t;
+
+// `name` must outlive the timeline: pass a string literal
+void bootMark(const char * name);
+int bootGetTimeline(boot_phase_t * phases, int max);
+void bootLogTimeline();
+
+#endif
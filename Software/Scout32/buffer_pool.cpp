@@ -0,0 +1,151 @@
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "buffer_pool.h"
+
+typedef struct {
+    size_t block_size;
+    uint32_t blocks;
+    uint32_t caps;
+    uint8_t * arena;
+    uint32_t free_mask;     // bit n set: block n is free
+    pool_stats_t stats;
+} pool_t;
+
+// Fallback allocations carry their size in front, so poolBlockSize() works
+// on them too
+typedef struct {
+    size_t size;
+    uint32_t pad;
+} fallback_header_t;
+
+static portMUX_TYPE pool_mux = portMUX_INITIALIZER_UNLOCKED;
+static pool_t pools[POOL_CLASS_COUNT] = {
+    {POOL_REQUEST_BLOCK, POOL_REQUEST_BLOCKS, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+    {POOL_FRAME_BLOCK, POOL_FRAME_BLOCKS, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT},
+};
+
+static pool_t * pool_for_size(size_t size){
+    for(int i = 0; i < POOL_CLASS_COUNT; i++){
+        if(size <= pools[i].block_size){
+            return &pools[i];
+        }
+    }
+    return NULL;
+}
+
+static pool_t * pool_owning(const void * ptr){
+    for(int i = 0; i < POOL_CLASS_COUNT; i++){
+        pool_t * pool = &pools[i];
+        if(pool->arena && (const uint8_t *)ptr >= pool->arena &&
+                (const uint8_t *)ptr < pool->arena + pool->block_size * pool->blocks){
+            return pool;
+        }
+    }
+    return NULL;
+}
+
+// Allocate the arena on first use. The allocation is made outside the lock;
+// if another task got there first, ours goes back.
+static bool pool_ready(pool_t * pool){
+    if(pool->arena){
+        return true;
+    }
+    uint32_t caps = pool->caps;
+    if((caps & MALLOC_CAP_SPIRAM) && !psramFound()){
+        caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    }
+    uint8_t * arena = (uint8_t *)heap_caps_malloc(pool->block_size * pool->blocks, caps);
+    if(!arena){
+        return false;
+    }
+    bool installed = false;
+    portENTER_CRITICAL(&pool_mux);
+    if(!pool->arena){
+        pool->arena = arena;
+        pool->caps = caps;
+        pool->free_mask = pool->blocks >= 32 ? 0xFFFFFFFF : (1u << pool->blocks) - 1;
+        installed = true;
+    }
+    portEXIT_CRITICAL(&pool_mux);
+    if(!installed){
+        heap_caps_free(arena);
+    }
+    return true;
+}
+
+static void * fallback_alloc(pool_t * pool, size_t size){
+    fallback_header_t * header = (fallback_header_t *)heap_caps_malloc(sizeof(fallback_header_t) + size,
+        pool ? pool->caps : MALLOC_CAP_8BIT);
+    portENTER_CRITICAL(&pool_mux);
+    if(pool){
+        if(header){
+            pool->stats.fallbacks++;
+        } else {
+            pool->stats.failures++;
+        }
+    }
+    portEXIT_CRITICAL(&pool_mux);
+    if(!header){
+        return NULL;
+    }
+    header->size = size;
+    return header + 1;
+}
+
+void * poolAlloc(size_t size){
+    pool_t * pool = pool_for_size(size);
+    if(!pool){
+        // Bigger than any class: count it against the largest
+        pool = &pools[POOL_CLASS_COUNT - 1];
+        portENTER_CRITICAL(&pool_mux);
+        pool->stats.largest_request = max(pool->stats.largest_request, size);
+        portEXIT_CRITICAL(&pool_mux);
+        return fallback_alloc(pool, size);
+    }
+    void * block = NULL;
+    if(pool_ready(pool)){
+        portENTER_CRITICAL(&pool_mux);
+        pool->stats.largest_request = max(pool->stats.largest_request, size);
+        if(pool->free_mask){
+            int index = __builtin_ctz(pool->free_mask);
+            pool->free_mask &= ~(1u << index);
+            block = pool->arena + index * pool->block_size;
+            pool->stats.allocs++;
+            pool->stats.in_use++;
+            pool->stats.peak_in_use = max(pool->stats.peak_in_use, pool->stats.in_use);
+        }
+        portEXIT_CRITICAL(&pool_mux);
+    }
+    return block ? block : fallback_alloc(pool, size);
+}
+
+void poolFree(void * ptr){
+    if(!ptr){
+        return;
+    }
+    pool_t * pool = pool_owning(ptr);
+    if(!pool){
+        heap_caps_free((fallback_header_t *)ptr - 1);
+        return;
+    }
+    int index = ((uint8_t *)ptr - pool->arena) / pool->block_size;
+    portENTER_CRITICAL(&pool_mux);
+    pool->free_mask |= 1u << index;
+    pool->stats.in_use--;
+    portEXIT_CRITICAL(&pool_mux);
+}
+
+size_t poolBlockSize(const void * ptr){
+    pool_t * pool = pool_owning(ptr);
+    return pool ? pool->block_size : ((const fallback_header_t *)ptr - 1)->size;
+}
+
+void poolGetStats(pool_class_t pool, pool_stats_t * stats){
+    portENTER_CRITICAL(&pool_mux);
+    *stats = pools[pool].stats;
+    stats->block_size = pools[pool].block_size;
+    stats->blocks = pools[pool].arena ? pools[pool].blocks : 0;
+    stats->psram = pools[pool].arena && (pools[pool].caps & MALLOC_CAP_SPIRAM);
+    portEXIT_CRITICAL(&pool_mux);
+}
@@ -0,0 +1,50 @@
+#ifndef buffer_pool_h
+#define buffer_pool_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Fixed-block buffers for the per-frame and per-request scratch space, so
+// those paths don't malloc and free every time and fragment the heap over
+// hours of driving. Each size class is one arena, allocated the first time
+// the class is used and never freed, carved into equal blocks. Frame-sized
+// blocks live in PSRAM when the board has it; request blocks in internal
+// RAM. A request bigger than every class, or made while its class is all
+// in use, falls back to the heap and is counted, so /metrics shows whether
+// the pools are sized right: in steady state the fallbacks stay at zero.
+
+typedef enum {
+    POOL_REQUEST,   // query strings and other per-request scratch
+    POOL_FRAME,     // JPEG conversion output
+    POOL_CLASS_COUNT
+} pool_class_t;
+
+// A query string can't be longer than the URI (CONFIG_HTTPD_MAX_URI_LEN)
+const size_t POOL_REQUEST_BLOCK = 512;
+const uint32_t POOL_REQUEST_BLOCKS = 8;
+// Converted frames, one per stream sender
+const size_t POOL_FRAME_BLOCK = 96 * 1024;
+const uint32_t POOL_FRAME_BLOCKS = 2;
+
+typedef struct {
+    size_t block_size;
+    uint32_t blocks;
+    bool psram;
+    uint32_t in_use;
+    uint32_t peak_in_use;
+    uint32_t allocs;      // served from the pool
+    uint32_t fallbacks;   // went to the heap instead
+    uint32_t failures;    // the heap couldn't serve them either
+    size_t largest_request;
+} pool_stats_t;
+
+// At least `size` bytes, or NULL. Hand it back with poolFree().
+void * poolAlloc(size_t size);
+void poolFree(void * ptr);
+
+// Size of the block behind `ptr`, which may be more than was asked for
+size_t poolBlockSize(const void * ptr);
+
+void poolGetStats(pool_class_t pool, pool_stats_t * stats);
+
+#endif
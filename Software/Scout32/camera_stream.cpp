@@ -0,0 +1,305 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "camera_stream.h"
+#include "adaptive_bitrate.h"
+#include "sensor_config.h"
+#include "metrics.h"
+#include "logger.h"
+#include "task_config.h"
+#include "power_manager.h"
+
+// How long a client waits for a frame before deciding the camera is gone.
+// Longer than the driver's own 4s frame timeout.
+const TickType_t STREAM_FRAME_TIMEOUT = pdMS_TO_TICKS(5000);
+
+typedef struct {
+    TaskHandle_t task;
+    uint32_t last_seq;
+    stream_client_stats_t stats;
+    frame_signature_t last_sent;
+    int64_t last_sent_us;
+} stream_client_t;
+
+static portMUX_TYPE stream_mux = portMUX_INITIALIZER_UNLOCKED;
+static stream_frame_t frame_slots[STREAM_FB_COUNT];
+static stream_frame_t * latest = NULL;
+static stream_client_t clients[STREAM_MAX_CLIENTS];
+static int client_count = 0;
+static TaskHandle_t capture_task_handle = NULL;
+static uint32_t next_seq = 1;
+static int64_t max_frame_age_us = STREAM_MAX_FRAME_AGE_MS * 1000LL;
+static float change_threshold = STREAM_CHANGE_THRESHOLD;
+static int64_t keyframe_us = STREAM_KEYFRAME_MS * 1000LL;
+// With a single frame buffer the capture task can't keep the latest frame
+// around while it grabs the next one.
+static bool hold_latest = true;
+
+
+// Drop one reference, handing the buffer back to the driver on the last one
+void streamReleaseFrame(stream_frame_t * frame){
+    if(!frame){
+        return;
+    }
+    portENTER_CRITICAL(&stream_mux);
+    bool last = --frame->refs == 0;
+    portEXIT_CRITICAL(&stream_mux);
+    if(last){
+        esp_camera_fb_return(frame->fb);
+        portENTER_CRITICAL(&stream_mux);
+        frame->fb = NULL;
+        portEXIT_CRITICAL(&stream_mux);
+    }
+}
+
+static stream_frame_t * take_slot(camera_fb_t * fb, const sensor_t * s){
+    // The driver doesn't say how each frame was exposed, only what the
+    // sensor was last set to
+    int16_t exposure = s && !s->status.aec ? s->status.aec_value : -1;
+    int8_t gain = s && !s->status.agc ? s->status.agc_gain : -1;
+    stream_frame_t * frame = NULL;
+    portENTER_CRITICAL(&stream_mux);
+    for(int i = 0; i < STREAM_FB_COUNT; i++){
+        if(!frame_slots[i].fb){
+            frame = &frame_slots[i];
+            frame->fb = fb;
+            frame->seq = next_seq++;
+            frame->timestamp = fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
+            frame->exposure = exposure;
+            frame->gain = gain;
+            frame->refs = 1; // held by `latest`
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&stream_mux);
+    return frame;
+}
+
+static void publish(stream_frame_t * frame){
+    TaskHandle_t waiting[STREAM_MAX_CLIENTS];
+    int n = 0;
+
+    portENTER_CRITICAL(&stream_mux);
+    stream_frame_t * old = latest;
+    latest = frame;
+    for(int i = 0; i < STREAM_MAX_CLIENTS; i++){
+        if(clients[i].task){
+            waiting[n++] = clients[i].task;
+        }
+    }
+    portEXIT_CRITICAL(&stream_mux);
+
+    streamReleaseFrame(old);
+    for(int i = 0; i < n; i++){
+        xTaskNotifyGive(waiting[i]);
+    }
+}
+
+static void capture_task(void * arg){
+    while(true){
+        portENTER_CRITICAL(&stream_mux);
+        bool idle = client_count == 0;
+        portEXIT_CRITICAL(&stream_mux);
+        if(idle){
+            // Give the buffer back so /capture can use it, and catch a
+            // camera setting that arrived as the last client left
+            publish(NULL);
+            sensorConfigApply(esp_camera_sensor_get());
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // Between frames is the safe time to reconfigure the sensor
+        sensorConfigApply(esp_camera_sensor_get());
+        bitrateUpdate(esp_camera_sensor_get());
+
+        int64_t grab_start = esp_timer_get_time();
+        camera_fb_t * fb = esp_camera_fb_get();
+        metricsObserve(METRIC_CAMERA_GRAB, esp_timer_get_time() - grab_start);
+        if(!fb){
+            metricsCount(METRIC_CAPTURE_FAILURES);
+            LOG_ERROR("Camera capture failed");
+            continue;
+        }
+        metricsCount(METRIC_FRAMES_CAPTURED);
+        stream_frame_t * frame = take_slot(fb, esp_camera_sensor_get());
+        if(!frame){
+            // More buffers in flight than STREAM_FB_COUNT: drop this one
+            esp_camera_fb_return(fb);
+            continue;
+        }
+        frame->signature.valid = false;
+        if(change_threshold > 0){
+            int64_t sign_start = esp_timer_get_time();
+            frameSignature(fb, &frame->signature);
+            metricsObserve(METRIC_FRAME_SIGNATURE, esp_timer_get_time() - sign_start);
+        }
+        publish(frame);
+
+        if(!hold_latest){
+            // Wait for every client to pick the frame up, then let it go
+            ulTaskNotifyTake(pdTRUE, STREAM_FRAME_TIMEOUT);
+            publish(NULL);
+        }
+    }
+}
+
+void initStream(size_t fb_count){
+    hold_latest = fb_count > 1;
+    TaskHandle_t task = NULL;
+    taskCreate(TASK_CAPTURE, capture_task, NULL, &task);
+    portENTER_CRITICAL(&stream_mux);
+    capture_task_handle = task;
+    portEXIT_CRITICAL(&stream_mux);
+}
+
+void streamSetMaxFrameAge(uint32_t ms){
+    portENTER_CRITICAL(&stream_mux);
+    max_frame_age_us = ms * 1000LL;
+    portEXIT_CRITICAL(&stream_mux);
+}
+
+void streamSetChangeThreshold(float levels){
+    portENTER_CRITICAL(&stream_mux);
+    change_threshold = max(levels, 0.0f);
+    portEXIT_CRITICAL(&stream_mux);
+}
+
+float streamGetChangeThreshold(){
+    portENTER_CRITICAL(&stream_mux);
+    float levels = change_threshold;
+    portEXIT_CRITICAL(&stream_mux);
+    return levels;
+}
+
+void streamSetKeyframeInterval(uint32_t ms){
+    portENTER_CRITICAL(&stream_mux);
+    keyframe_us = ms * 1000LL;
+    portEXIT_CRITICAL(&stream_mux);
+}
+
+// Whether `frame` shows too little new since this client's last frame to
+// be worth sending. Call with stream_mux held.
+static bool unchanged(const stream_client_t * c, const stream_frame_t * frame, int64_t now){
+    return change_threshold > 0 && frame->signature.valid && c->last_sent.valid
+        && now - c->last_sent_us < keyframe_us
+        && frameDifference(&frame->signature, &c->last_sent) < change_threshold;
+}
+
+stream_frame_t * streamSnapshot(uint32_t max_age_ms){
+    stream_frame_t * frame = NULL;
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&stream_mux);
+    if(latest && now - latest->timestamp <= max_age_ms * 1000LL){
+        frame = latest;
+        frame->refs++;
+    }
+    portEXIT_CRITICAL(&stream_mux);
+    return frame;
+}
+
+bool streamActive(){
+    portENTER_CRITICAL(&stream_mux);
+    bool active = client_count > 0;
+    portEXIT_CRITICAL(&stream_mux);
+    return active;
+}
+
+void streamGetClientStats(int client, stream_client_stats_t * stats){
+    portENTER_CRITICAL(&stream_mux);
+    *stats = clients[client].stats;
+    portEXIT_CRITICAL(&stream_mux);
+}
+
+int streamAddClient(){
+    // Camera out of standby before the capture task goes to it
+    powerNoteActivity(POWER_SOURCE_STREAM);
+    int client = -1;
+    portENTER_CRITICAL(&stream_mux);
+    // Nothing to stream until the camera is up (it starts after the server)
+    for(int i = 0; i < STREAM_MAX_CLIENTS && capture_task_handle; i++){
+        if(!clients[i].task){
+            clients[i].task = xTaskGetCurrentTaskHandle();
+            clients[i].last_seq = 0;
+            clients[i].stats = stream_client_stats_t();
+            clients[i].last_sent.valid = false;
+            client_count++;
+            client = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&stream_mux);
+    if(client >= 0){
+        // Wake the capture task if it was idle
+        xTaskNotifyGive(capture_task_handle);
+    }
+    return client;
+}
+
+void streamRemoveClient(int client){
+    portENTER_CRITICAL(&stream_mux);
+    clients[client].task = NULL;
+    client_count--;
+    portEXIT_CRITICAL(&stream_mux);
+}
+
+stream_frame_t * streamAcquireFrame(int client){
+    while(true){
+        stream_frame_t * frame = NULL;
+        bool all_taken = true;
+        uint32_t skipped = 0;
+        bool stale = false;
+        bool same = false;
+        int64_t now = esp_timer_get_time();
+
+        portENTER_CRITICAL(&stream_mux);
+        stream_client_t * c = &clients[client];
+        if(latest && latest->seq != c->last_seq){
+            if(c->last_seq){
+                skipped = latest->seq - c->last_seq - 1;
+                c->stats.skipped += skipped;
+            }
+            c->last_seq = latest->seq;
+            if(now - latest->timestamp > max_frame_age_us){
+                stale = true;
+                c->stats.stale++;
+            } else if(unchanged(c, latest, now)){
+                same = true;
+                c->stats.unchanged++;
+            } else {
+                frame = latest;
+                frame->refs++;
+                c->stats.sent++;
+                c->last_sent = latest->signature;
+                c->last_sent_us = now;
+            }
+            for(int i = 0; i < STREAM_MAX_CLIENTS; i++){
+                if(clients[i].task && clients[i].last_seq != latest->seq){
+                    all_taken = false;
+                }
+            }
+        }
+        portEXIT_CRITICAL(&stream_mux);
+
+        if(skipped){
+            metricsCount(METRIC_FRAMES_SKIPPED, skipped);
+        }
+        if(stale){
+            metricsCount(METRIC_FRAMES_STALE);
+        }
+        if(same){
+            metricsCount(METRIC_FRAMES_UNCHANGED);
+        }
+        if((frame || same) && !hold_latest && all_taken){
+            xTaskNotifyGive(capture_task_handle);
+        }
+        if(frame){
+            return frame;
+        }
+        if(ulTaskNotifyTake(pdTRUE, STREAM_FRAME_TIMEOUT) == 0){
+            return NULL;
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef camera_stream_h
+#define camera_stream_h
+
+#include "esp_camera.h"
+#include "frame_change.h"
+
+// One capture task grabs frames from the camera and publishes each one to
+// every connected /stream client. Frames are reference counted and go back
+// to the camera driver when the last client has finished sending them, so
+// a slow client skips frames rather than stalling the sensor.
+//
+// Capture and sending are pipelined on separate cores. The published frame
+// is a latest-wins mailbox: a client that finishes sending always picks up
+// the newest completed frame, and never one older than the age limit.
+
+// Operator plus recorder, with room for one more
+const int STREAM_MAX_CLIENTS = 3;
+
+// Frame buffers needed so the capture task never waits on a client: one per
+// client being sent, the latest published frame and the one being captured.
+const int STREAM_FB_COUNT = STREAM_MAX_CLIENTS + 2;
+
+// Frames older than this when a client gets to them are dropped
+const uint32_t STREAM_MAX_FRAME_AGE_MS = 200;
+
+// /capture serves the latest streamed frame if it's no older than this
+const uint32_t STREAM_SNAPSHOT_MAX_AGE_MS = 100;
+
+// Change detection: a client isn't given a frame whose signature (see
+// frame_change.h) differs from the last one it sent by less than this many
+// luma levels in every cell, unless that was longer ago than the keyframe
+// interval. 0, the default, sends every frame. Sensor noise moves a cell by
+// a level or two; something crossing it, by tens. 6 is a good setting.
+const float STREAM_CHANGE_THRESHOLD = 0;
+const uint32_t STREAM_KEYFRAME_MS = 1000;
+
+typedef struct {
+    camera_fb_t * fb;
+    uint32_t seq;
+    int64_t timestamp; // capture time, esp_timer_get_time() clock
+    int16_t exposure;  // sensor's manual exposure (aec_value) when grabbed, -1 with AEC on
+    int8_t gain;       // manual gain (agc_gain), -1 with AGC on
+    int refs;
+    frame_signature_t signature; // only taken with change detection on
+} stream_frame_t;
+
+typedef struct {
+    uint32_t sent;    // frames handed to the client
+    uint32_t skipped; // superseded while the client was still sending
+    uint32_t stale;   // over the age limit by the time the client was free
+    uint32_t unchanged; // too like the last frame sent to be worth sending
+} stream_client_stats_t;
+
+void initStream(size_t fb_count);
+void streamSetMaxFrameAge(uint32_t ms);
+void streamSetChangeThreshold(float levels);
+float streamGetChangeThreshold();
+void streamSetKeyframeInterval(uint32_t ms);
+
+// Register the calling task as a stream client. Returns a client id, or -1
+// if STREAM_MAX_CLIENTS are already connected or the camera isn't ready.
+int streamAddClient();
+void streamRemoveClient(int client);
+
+// Block until a frame newer than the last one this client took is
+// published. Returns NULL if the camera stopped producing frames. The frame
+// must be handed back with streamReleaseFrame().
+stream_frame_t * streamAcquireFrame(int client);
+void streamReleaseFrame(stream_frame_t * frame);
+
+// Take a reference to the latest published frame without waiting, if it's
+// no older than `max_age_ms`. NULL if there isn't one, e.g. because no
+// stream is running. Release it with streamReleaseFrame().
+stream_frame_t * streamSnapshot(uint32_t max_age_ms);
+
+// True while any /stream client is connected and the capture task is
+// using the camera
+bool streamActive();
+
+void streamGetClientStats(int client, stream_client_stats_t * stats);
+
+#endif
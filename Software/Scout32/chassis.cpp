@@ -4,16 +4,12 @@
 
 
 void initChassis() {
-  
-  ledcSetup(PWM_CHANNEL_LEFT_1, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION);
-  ledcSetup(PWM_CHANNEL_LEFT_2, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION);
-  ledcSetup(PWM_CHANNEL_RIGHT_1, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION);
-  ledcSetup(PWM_CHANNEL_RIGHT_2, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION);
-
-  ledcAttachPin(PIN_LEFT_1, PWM_CHANNEL_LEFT_1);
-  ledcAttachPin(PIN_LEFT_2, PWM_CHANNEL_LEFT_2);
-  ledcAttachPin(PIN_RIGHT_1, PWM_CHANNEL_RIGHT_1);
-  ledcAttachPin(PIN_RIGHT_2, PWM_CHANNEL_RIGHT_2);
+  // Fixed channels: ledcAttach() would hand out channel 0, which the
+  // camera's XCLK already drives through the IDF
+  ledcAttachChannel(PIN_LEFT_1, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION, PWM_CHANNEL_LEFT_1);
+  ledcAttachChannel(PIN_LEFT_2, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION, PWM_CHANNEL_LEFT_2);
+  ledcAttachChannel(PIN_RIGHT_1, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION, PWM_CHANNEL_RIGHT_1);
+  ledcAttachChannel(PIN_RIGHT_2, PWM_MOTOR_FREQUENCY, PWM_MOTOR_RESOLUTION, PWM_CHANNEL_RIGHT_2);
 }
 
 
@@ -23,14 +19,14 @@ void setLeftMotor(int16_t speed) {
   spd *= (65536 / 100);
   spd = -spd;
   if (spd > 0) {
-    ledcWrite(PWM_CHANNEL_LEFT_1,0);
-    ledcWrite(PWM_CHANNEL_LEFT_2,abs(spd));
+    ledcWrite(PIN_LEFT_1,0);
+    ledcWrite(PIN_LEFT_2,abs(spd));
   } else if (spd < 0) {
-    ledcWrite(PWM_CHANNEL_LEFT_1,abs(spd));
-    ledcWrite(PWM_CHANNEL_LEFT_2,0);
+    ledcWrite(PIN_LEFT_1,abs(spd));
+    ledcWrite(PIN_LEFT_2,0);
   } else {
-    ledcWrite(PWM_CHANNEL_LEFT_1,0);
-    ledcWrite(PWM_CHANNEL_LEFT_2,0);
+    ledcWrite(PIN_LEFT_1,0);
+    ledcWrite(PIN_LEFT_2,0);
   }
 }
 
@@ -40,14 +36,14 @@ void setRightMotor(int16_t speed) {
   spd = max(min(spd, 100), -100);
   spd *= (65536 / 100);
   if (spd > 0) {
-    ledcWrite(PWM_CHANNEL_RIGHT_1,0);
-    ledcWrite(PWM_CHANNEL_RIGHT_2,abs(spd));
+    ledcWrite(PIN_RIGHT_1,0);
+    ledcWrite(PIN_RIGHT_2,abs(spd));
   } else if (spd < 0) {
-    ledcWrite(PWM_CHANNEL_RIGHT_1,abs(spd));
-    ledcWrite(PWM_CHANNEL_RIGHT_2,0);
+    ledcWrite(PIN_RIGHT_1,abs(spd));
+    ledcWrite(PIN_RIGHT_2,0);
   } else {
-    ledcWrite(PWM_CHANNEL_RIGHT_1,0);
-    ledcWrite(PWM_CHANNEL_RIGHT_2,0);
+    ledcWrite(PIN_RIGHT_1,0);
+    ledcWrite(PIN_RIGHT_2,0);
   }
 }
 
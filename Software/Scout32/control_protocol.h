@@ -0,0 +1,40 @@
+#ifndef control_protocol_h
+#define control_protocol_h
+
+#include <stdint.h>
+
+// Binary messages on the /ws control WebSocket. Fixed size, little endian
+// (as are the ESP32 and every browser), one message per frame.
+// Keep in step with control.js.
+
+const uint8_t CONTROL_MSG_DRIVE = 1;
+const uint8_t CONTROL_MSG_TELEMETRY = 2;
+
+// Accept this command whatever its seq; sent first on every connection
+const uint8_t CONTROL_FLAG_RESET = 0x01;
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;         // CONTROL_MSG_DRIVE
+    uint8_t flags;
+    uint16_t seq;         // +1 per command, wrapping; anything not newer is stale
+    int8_t forward;       // -100 to 100
+    int8_t steer;         // -100 to 100
+    uint16_t client_ms;   // sender's clock, echoed in the telemetry reply
+} control_drive_msg_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t type;         // CONTROL_MSG_TELEMETRY
+    uint8_t flags;
+    uint16_t ack_seq;     // last command applied
+    int8_t left;          // motor outputs, -100 to 100
+    int8_t right;
+    uint16_t client_ms;   // from the command being acknowledged
+    uint32_t device_ms;   // millis() when it was applied
+    uint16_t discarded;   // stale commands dropped on this connection
+    uint16_t actuate_us;  // after device_ms, when the motor outputs take it up
+} control_telemetry_msg_t;
+
+static_assert(sizeof(control_drive_msg_t) == 8, "drive message must stay 8 bytes");
+static_assert(sizeof(control_telemetry_msg_t) == 16, "telemetry message must stay 16 bytes");
+
+#endif
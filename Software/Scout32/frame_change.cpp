@@ -0,0 +1,99 @@
+#include <Arduino.h>
+#include "esp_heap_caps.h"
+#include "frame_change.h"
+#include "jpeg_reader.h"
+
+const int CELLS = FRAME_CHANGE_GRID_W * FRAME_CHANGE_GRID_H;
+
+// Only the capture task signs frames. The decoder's tables are a few KB, so
+// they're allocated the first time a JPEG is signed rather than sitting in
+// RAM with change detection off.
+static jpeg_reader_t * jpeg = NULL;
+static uint32_t cell_sum[CELLS];
+static uint16_t cell_count[CELLS];
+
+static bool sign_jpeg(const camera_fb_t * fb){
+    if(!jpeg){
+        jpeg = (jpeg_reader_t *)heap_caps_malloc(sizeof(jpeg_reader_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if(!jpeg || !jpegParse(jpeg, fb->buf, fb->len)){
+        return false;
+    }
+    jpeg_component_t * luma = &jpeg->comps[0];
+    // Only the DC entry matters; it comes first in zig-zag order
+    int q = jpeg->quant[luma->tq][0];
+
+    int mcus = jpeg->mcus_x * jpeg->mcus_y;
+    for(int mcu = 0; mcu < mcus; mcu++){
+        if(!jpegStartMcu(jpeg, mcu)){
+            return false;
+        }
+        int mx = mcu % jpeg->mcus_x;
+        int my = mcu / jpeg->mcus_x;
+        for(int c = 0; c < jpeg->ncomps; c++){
+            jpeg_component_t * comp = &jpeg->comps[c];
+            for(int b = 0; b < comp->h * comp->v; b++){
+                // The AC coefficients are skipped
+                if(!jpegDecodeBlock(jpeg, comp, NULL)){
+                    return false;
+                }
+                if(c == 0){
+                    int px = (mx * comp->h + b % comp->h) * 8;
+                    int py = (my * comp->v + b / comp->h) * 8;
+                    if(px < jpeg->width && py < jpeg->height){
+                        int cell = (py * FRAME_CHANGE_GRID_H / jpeg->height) * FRAME_CHANGE_GRID_W
+                            + px * FRAME_CHANGE_GRID_W / jpeg->width;
+                        // The DC term is eight times the block's mean, less 128
+                        int dc = comp->pred * q;
+                        cell_sum[cell] += constrain((dc + (dc < 0 ? -4 : 4)) / 8 + 128, 0, 255);
+                        cell_count[cell]++;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static bool sign_grayscale(const camera_fb_t * fb){
+    if(fb->len < fb->width * fb->height){
+        return false;
+    }
+    // Every other pixel of every other row is plenty for a 16x12 grid
+    for(size_t y = 0; y < fb->height; y += 2){
+        const uint8_t * row = fb->buf + y * fb->width;
+        int cell_row = (y * FRAME_CHANGE_GRID_H / fb->height) * FRAME_CHANGE_GRID_W;
+        for(size_t x = 0; x < fb->width; x += 2){
+            int cell = cell_row + x * FRAME_CHANGE_GRID_W / fb->width;
+            cell_sum[cell] += row[x];
+            cell_count[cell]++;
+        }
+    }
+    return true;
+}
+
+bool frameSignature(const camera_fb_t * fb, frame_signature_t * sig){
+    memset(cell_sum, 0, sizeof(cell_sum));
+    memset(cell_count, 0, sizeof(cell_count));
+    bool ok = false;
+    if(fb->format == PIXFORMAT_JPEG){
+        ok = sign_jpeg(fb);
+    } else if(fb->format == PIXFORMAT_GRAYSCALE){
+        ok = sign_grayscale(fb);
+    }
+    sig->valid = ok;
+    if(ok){
+        for(int i = 0; i < CELLS; i++){
+            sig->cells[i] = cell_count[i] ? cell_sum[i] / cell_count[i] : 0;
+        }
+    }
+    return ok;
+}
+
+float frameDifference(const frame_signature_t * a, const frame_signature_t * b){
+    int largest = 0;
+    for(int i = 0; i < CELLS; i++){
+        largest = max(largest, abs((int)a->cells[i] - (int)b->cells[i]));
+    }
+    return largest;
+}
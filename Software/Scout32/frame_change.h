@@ -0,0 +1,29 @@
+#ifndef frame_change_h
+#define frame_change_h
+
+#include "esp_camera.h"
+
+// Coarse luma signatures for spotting frames that show nothing new. A
+// signature is the mean brightness of each cell of a fixed grid, whatever
+// the frame size. JPEG frames are signed from their DC coefficients, which
+// takes an entropy decode but no IDCT or colour conversion. Raw grayscale
+// frames are signed from a sample of their pixels.
+
+const int FRAME_CHANGE_GRID_W = 16;
+const int FRAME_CHANGE_GRID_H = 12;
+
+typedef struct {
+    bool valid;
+    uint8_t cells[FRAME_CHANGE_GRID_W * FRAME_CHANGE_GRID_H];
+} frame_signature_t;
+
+// False, with `sig` marked invalid, for formats we can't sign (other raw
+// formats, progressive or corrupt JPEG)
+bool frameSignature(const camera_fb_t * fb, frame_signature_t * sig);
+
+// Largest difference between corresponding cells, in luma levels (0-255).
+// Something moving in one corner of the view counts as much as the whole
+// view changing.
+float frameDifference(const frame_signature_t * a, const frame_signature_t * b);
+
+#endif
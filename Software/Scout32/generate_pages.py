@@ -1,21 +1,123 @@
 # generates a C file containing the contents of the 'serve' folder
+#
+# Each file is gzipped at build time (when that makes it smaller) and
+# embedded as a sized byte array. The handler serves it with a content-hash
+# ETag so browsers revalidate with If-None-Match and get a 304 instead of
+# the whole file.
+#
+# It also writes the route table for the server: the pages and the
+# endpoints in ENDPOINTS, behind one dispatcher (see pages.h).
+import gzip
+import hashlib
 import os
 
 FILE_TEMPLATE = """
-static const char PROGMEM {varname}[] = R"rawliteral(
+// {filename}: {raw_len} bytes{compressed}
+static const uint8_t PROGMEM {varname}[] = {{
 {contents}
-)rawliteral";
+}};
+static const static_page_t {varname}_PAGE = {{
+    {varname},
+    sizeof({varname}),
+    "{mimetype}",
+    "\\"{etag}\\"",
+    {gzipped}
+}};
 
 """
 
 HANDLER_TEMPLATE = """
-static esp_err_t {handlername}(httpd_req_t *req){{
-    httpd_resp_set_type(req, "{mimetype}");
-    return httpd_resp_send(req, (const char *){varname}, strlen({varname}));
+static esp_err_t static_page_handler(httpd_req_t *req){
+    const static_page_t * page = (const static_page_t *)req->user_ctx;
+    char if_none_match[64];
+
+    httpd_resp_set_hdr(req, "ETag", page->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+        strstr(if_none_match, page->etag) != NULL) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+
+    httpd_resp_set_type(req, page->mimetype);
+    if (page->gzipped) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    }
+    return httpd_resp_send(req, (const char *)page->data, page->len);
+}
+
+"""
+
+ROUTES_TEMPLATE = """
+// {count} routes in {slots} slots
+static const uint32_t ROUTE_SEED = {seed};
+static const int ROUTE_SLOT_BITS = {bits};
+static const size_t ROUTE_BUCKETS = {buckets};
+
+static const route_t routes[] = {{
+{routes}
+}};
+
+// Per bucket, what its paths' hashes are mixed with to land in a free slot
+static const uint8_t route_displace[ROUTE_BUCKETS] = {{ {displace} }};
+
+// Index into routes by slot, -1 where no path lands
+static const int8_t route_slots[1 << ROUTE_SLOT_BITS] = {{ {table} }};
+
+const route_t * findRoute(const char * uri){{
+    uint32_t h = ROUTE_SEED;
+    const char * p = uri;
+    for(; *p && *p != '?'; p++){{
+        h = (h ^ (uint8_t)*p) * 16777619u;
+    }}
+    uint32_t slot = ((h ^ route_displace[h & (ROUTE_BUCKETS - 1)]) * 0x9e3779b1u) >> (32 - ROUTE_SLOT_BITS);
+    if(route_slots[slot] < 0){{
+        return NULL;
+    }}
+    const route_t * route = &routes[route_slots[slot]];
+    size_t len = p - uri;
+    return strncmp(route->path, uri, len) == 0 && route->path[len] == 0 ? route : NULL;
 }}
 
+static esp_err_t route_handler(httpd_req_t *req){{
+    const route_t * route = findRoute(req->uri);
+    if(!route){{
+        return httpd_resp_send_404(req);
+    }}
+    req->user_ctx = (void *)route->ctx;
+    return route->handler(req);
+}}
+
+void registerRoutes(httpd_handle_t httpd){{
+    httpd_uri_t uri = {{
+        .uri       = "/*",
+        .method    = HTTP_GET,
+        .handler   = route_handler,
+        .user_ctx  = NULL
+    }};
+    httpd_register_uri_handler(httpd, &uri);
+}}
 """
 
+# The dynamic endpoints, served from the same table as the pages. Each
+# handler is defined in app_server.cpp and declared in pages.h.
+ENDPOINTS = [
+    ("/capture", "capture_handler"),
+    ("/config", "config_handler"),
+    ("/drive", "drive_handler"),
+    ("/metrics", "metrics_handler"),
+    ("/recording", "recording_handler"),
+    ("/rtp", "rtp_handler"),
+    ("/stream", "stream_handler"),
+]
+
+MIMETYPES = {
+    'html': 'text/html',
+    'js': 'text/javascript',
+    'css': 'text/css',
+    'jpg': 'image/jpeg',
+}
+
 
 input_folder = 'serve'
 
@@ -25,71 +127,116 @@ out = """// GENERATED FILE. DO NOT EDIT
 
 #include "Arduino.h"
 #include "esp_http_server.h"
+#include "pages.h"
+
+typedef struct {
+    const uint8_t * data;
+    size_t len;
+    const char * mimetype;
+    const char * etag;
+    bool gzipped;
+} static_page_t;
 
 """
 
 
+def format_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x{:02x},".format(b) for b in data[i:i + 16]))
+    return "\n".join(lines)
+
+
 varnames = []
-for filename in os.listdir(input_folder):
-    if filename.endswith('.jpg') or filename == "drive":
+for filename in sorted(os.listdir(input_folder)):
+    if filename == "drive":
         continue
     filepath = os.path.join(input_folder, filename)
-    contents = open(filepath).read()
-    varname = filename.replace(".", "_").upper()
-    out += FILE_TEMPLATE.format(varname=varname, contents=contents)
-    varnames.append((varname, filename))
-
+    raw = open(filepath, 'rb').read()
+    # mtime=0 keeps the output identical between runs
+    compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+    gzipped = len(compressed) < len(raw)
+    contents = compressed if gzipped else raw
 
-handlers = []
-for (varname, filename) in varnames:
-    handlername = varname.lower() + "_handler"
-    mimetype = {
-        'html': 'text/html',
-        'js': 'text/javascript',
-        'css': 'text/css',
-    }[filename.split('.')[-1]]
-    
-    handlers.append((handlername, filename))
-    
-    out += HANDLER_TEMPLATE.format(
-        handlername=handlername,
-        mimetype=mimetype,
-        varname=varname
+    varname = filename.replace(".", "_").upper()
+    out += FILE_TEMPLATE.format(
+        filename=filename,
+        raw_len=len(raw),
+        compressed=", {} gzipped".format(len(compressed)) if gzipped else "",
+        varname=varname,
+        contents=format_bytes(contents),
+        mimetype=MIMETYPES[filename.split('.')[-1]],
+        etag=hashlib.sha1(raw).hexdigest()[:16],
+        gzipped="true" if gzipped else "false",
     )
-
-out += """void registerStaticPages(httpd_handle_t httpd){"""
+    varnames.append((varname, filename))
 
 
-for (handlername, filename) in handlers:
-    out += """
-    httpd_uri_t {handler}_uri = {{
-        .uri       = "/{filename}",
-        .method    = HTTP_GET,
-        .handler   = {handler},
-        .user_ctx  = NULL
-    }};
-    httpd_register_uri_handler(httpd, &{handler}_uri);
-    
-    """.format(handler=handlername, filename=filename)
- 
- 
-# Create root "/" handler as a ref to "index.html" handler
-out += """
-    httpd_uri_t roothandler_uri = {
-        .uri       = "/",
-        .method    = HTTP_GET,
-        .handler   = index_html_handler,
-        .user_ctx  = NULL
-    };
-    httpd_register_uri_handler(httpd, &roothandler_uri);
-"""
-        
-
-out += """}
-"""
-    
-    
-    
+out += HANDLER_TEMPLATE
+
+
+# Every path is found by an FNV-1a hash of it, in two steps so that no
+# two paths share a slot (hash and displace): the low bits pick a bucket,
+# and the bucket's displacement byte, searched for here, mixes the whole
+# hash into a slot of a table twice the size of the route list. A lookup
+# is one pass over the path, two table reads and one compare.
+def route_hash(path, seed):
+    h = seed
+    for b in path.encode():
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h
+
+
+def route_slot(h, displace, bits):
+    return (((h ^ displace) * 0x9e3779b1) & 0xffffffff) >> (32 - bits)
+
+
+def place_routes(paths, seed, buckets, bits):
+    hashes = [route_hash(path, seed) for path in paths]
+    members = [[] for _ in range(buckets)]
+    for (i, h) in enumerate(hashes):
+        members[h & (buckets - 1)].append(i)
+    table = [-1] * (1 << bits)
+    displace = [0] * buckets
+    # The fullest buckets are the hardest to place, so they go first
+    for b in sorted(range(buckets), key=lambda b: -len(members[b])):
+        for d in range(256):
+            placed = [route_slot(hashes[i], d, bits) for i in members[b]]
+            if len(set(placed)) == len(placed) and all(table[s] < 0 for s in placed):
+                for (i, s) in zip(members[b], placed):
+                    table[s] = i
+                displace[b] = d
+                break
+        else:
+            return None
+    return (table, displace)
+
+
+routes = [("/" + filename, "static_page_handler", "&{}_PAGE".format(varname))
+          for (varname, filename) in varnames]
+# "/" is index.html
+routes.append(("/", "static_page_handler", "&INDEX_HTML_PAGE"))
+routes += [(path, handler, "NULL") for (path, handler) in ENDPOINTS]
+assert len(routes) < 128, "route indexes are int8_t"
+
+bits = 1
+while (1 << bits) < 2 * len(routes):
+    bits += 1
+buckets = 1
+while buckets < len(routes) // 2:
+    buckets *= 2
+(seed, (table, displace)) = next((s, placed) for s in range(1, 1 << 16)
+                                  for placed in [place_routes([r[0] for r in routes], s, buckets, bits)] if placed)
+
+out += ROUTES_TEMPLATE.format(
+    count=len(routes),
+    slots=len(table),
+    bits=bits,
+    buckets=buckets,
+    seed="0x{:08x}".format(seed),
+    routes="\n".join('    {{"{}", {}, {}}},'.format(*route) for route in routes),
+    displace=", ".join(str(d) for d in displace),
+    table=", ".join(str(i) for i in table),
+)
 
-    
 open("pages.cpp", "w").write(out)
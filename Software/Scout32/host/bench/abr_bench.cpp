@@ -0,0 +1,139 @@
+// Adaptive bitrate benchmark.
+//
+// Streams from /stream while the link throughput and RSSI step through a
+// profile, like driving away from the access point and back. The mock
+// camera's size model makes frame size and quality changes show up in the
+// bytes sent. Prints one line a second with what the client saw and what
+// the controller chose, then a summary per profile step.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include "adaptive_bitrate.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+static const uint16_t STREAM_PORT = 80;
+
+struct link_step {
+    double kbps;
+    int rssi;
+    int seconds;
+};
+
+// Stream client that publishes its progress for the main thread and hangs
+// up when told to
+class abr_client : public mjpeg_client {
+public:
+    abr_client() : mjpeg_client((size_t)-1) {}
+
+    esp_err_t on_body(const char *data, size_t len) override
+    {
+        if (stop) {
+            return ESP_FAIL;
+        }
+        esp_err_t res = mjpeg_client::on_body(data, len);
+        received = frames.size();
+        payload += len;
+        return res;
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> received{0};
+    std::atomic<size_t> payload{0};
+};
+
+static void usage()
+{
+    printf("usage: scout32_abr_bench [options]\n"
+           "  --profile P      kbps/dBm/seconds steps, comma separated\n"
+           "                   (default 6000/-55/8,1500/-72/12,600/-80/12,6000/-55/16)\n"
+           "  --target-fps F   controller target frame rate (default %.0f)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --no-adaptive    turn the controller off, for comparison\n"
+           "  --serial         echo firmware Serial output to stderr\n", BITRATE_TARGET_FPS);
+}
+
+static std::vector<link_step> parse_profile(const char *text)
+{
+    std::vector<link_step> steps;
+    while (text && *text) {
+        link_step step;
+        if (sscanf(text, "%lf/%d/%d", &step.kbps, &step.rssi, &step.seconds) != 3) {
+            break;
+        }
+        steps.push_back(step);
+        text = strchr(text, ',');
+        text = text ? text + 1 : NULL;
+    }
+    return steps;
+}
+
+static void set_config(const char *query)
+{
+    mock_httpd_client client;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, (String("/config?") + query).c_str(), client);
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    std::vector<link_step> profile = parse_profile(
+        bench_arg(argc, argv, "--profile", "6000/-55/8,1500/-72/12,600/-80/12,6000/-55/16"));
+    if (profile.empty()) {
+        usage();
+        return 1;
+    }
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    bool adaptive = !bench_flag(argc, argv, "--no-adaptive");
+
+    mock_camera_set_size_model(true);
+    mock_wifi_set_rssi(profile[0].rssi);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    set_config(adaptive ? "adaptive=1" : "adaptive=0");
+    set_config((String("target_fps=") + bench_arg(argc, argv, "--target-fps", "15")).c_str());
+
+    abr_client client;
+    client.set_link_kbps(profile[0].kbps);
+    std::thread stream([&client]() { mock_httpd_request(STREAM_PORT, HTTP_GET, "/stream", client); });
+
+    printf("controller %s, sensor %.0ffps\n", adaptive ? "on" : "off", fps);
+    printf("%4s %8s %6s %6s %8s %9s %7s\n", "t", "kbps", "dBm", "fps", "KB/s", "framesize", "quality");
+    int t = 0;
+    for (const link_step &step : profile) {
+        client.set_link_kbps(step.kbps);
+        mock_wifi_set_rssi(step.rssi);
+        size_t step_frames = client.received;
+        for (int s = 0; s < step.seconds; s++, t++) {
+            size_t frames = client.received;
+            size_t bytes = client.payload;
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            sensor_t *sensor = esp_camera_sensor_get();
+            printf("%4d %8.0f %6d %6zu %8.1f %9d %7d\n", t, step.kbps, step.rssi,
+                client.received - frames, (client.payload - bytes) / 1024.0,
+                sensor->status.framesize, sensor->status.quality);
+        }
+        printf("     -- %.0f kbps: %.1f fps average\n", step.kbps,
+            (double)(client.received - step_frames) / step.seconds);
+    }
+    client.stop = true;
+    stream.join();
+
+    bitrate_state_t state;
+    bitrateGetState(&state);
+    printf("\n%zu frames, %u controller changes\n", (size_t)client.received, state.changes);
+    return 0;
+}
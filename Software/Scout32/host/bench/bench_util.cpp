@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "Arduino.h"
+#include "bench_util.h"
+
+void bench_boot(bool serial)
+{
+    mock_serial_set_output(serial ? stderr : NULL);
+    setup();
+}
+
+const char *bench_arg(int argc, char **argv, const char *name, const char *fallback)
+{
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return fallback;
+}
+
+bool bench_flag(int argc, char **argv, const char *name)
+{
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static double percentile(const std::vector<int64_t> &sorted, double p)
+{
+    size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+    return sorted[index] / 1000.0;
+}
+
+void bench_print_latency(const char *name, std::vector<int64_t> samples_us)
+{
+    if (samples_us.empty()) {
+        printf("%s: no samples\n", name);
+        return;
+    }
+    std::sort(samples_us.begin(), samples_us.end());
+    double sum = 0;
+    for (int64_t s : samples_us) {
+        sum += s;
+    }
+    printf("%s: n=%zu min=%.2fms mean=%.2fms p50=%.2fms p95=%.2fms p99=%.2fms max=%.2fms\n",
+        name, samples_us.size(),
+        samples_us.front() / 1000.0,
+        sum / samples_us.size() / 1000.0,
+        percentile(samples_us, 0.50),
+        percentile(samples_us, 0.95),
+        percentile(samples_us, 0.99),
+        samples_us.back() / 1000.0);
+}
@@ -0,0 +1,24 @@
+// Shared helpers for the host benchmarks
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdint.h>
+
+#include <vector>
+
+// Firmware entry points from Scout32.ino
+void setup();
+void loop();
+
+// Boot the firmware the way the board does, with Serial output discarded
+// (or sent to stderr if `serial` is set) but still paced at the baud rate.
+void bench_boot(bool serial);
+
+// Simple --name value / --flag argument lookup
+const char *bench_arg(int argc, char **argv, const char *name, const char *fallback);
+bool bench_flag(int argc, char **argv, const char *name);
+
+// Prints "name: n=.. min=.. mean=.. p50=.. p95=.. p99=.. max=.." in ms
+void bench_print_latency(const char *name, std::vector<int64_t> samples_us);
+
+#endif
@@ -0,0 +1,140 @@
+// Boot time benchmark.
+//
+// Reboots the firmware in station mode a number of times, each boot in a
+// fresh process with the NVS store kept in a file between them, and reports
+// how long it took until the rover could be driven: /drive answering and
+// the station connected. The first boot is cold (nothing cached, power-on
+// reset), the rest are warm restarts after a brownout. With --stale the
+// access point moves to another channel after the cold boot, so the
+// cached network details are wrong. Each boot's timeline is printed as the
+// firmware reports it in /metrics.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "WiFi.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "mock_httpd.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+// Station or access point, from Scout32.ino
+extern bool ap;
+
+static void usage()
+{
+    printf("usage: scout32_boot_bench [options]\n"
+           "  --boots N        boots to run, the first one cold (default 5)\n"
+           "  --camera-ms N    time the camera driver takes to initialise (default 450)\n"
+           "  --stale          move the access point to another channel after the cold boot\n"
+           "  --nvs PATH       file backing the NVS store (default /tmp/scout32_boot_bench.nvs)\n");
+}
+
+// One boot, in this process. Prints "controllable <ms>" then the timeline.
+static int boot_once(int argc, char **argv)
+{
+    bool warm = bench_flag(argc, argv, "--warm");
+    mock_nvs_set_path(bench_arg(argc, argv, "--nvs", "/tmp/scout32_boot_bench.nvs"));
+    mock_camera_set_init_time_ms(atoi(bench_arg(argc, argv, "--camera-ms", "450")));
+    mock_set_reset_reason(warm ? ESP_RST_BROWNOUT : ESP_RST_POWERON);
+    if (warm && bench_flag(argc, argv, "--stale")) {
+        mock_wifi_move_ap(11);
+    }
+    ap = false;
+
+    int64_t start = esp_timer_get_time();
+    std::thread boot([]() { bench_boot(false); });
+
+    // Drive the way the page does until a command gets through
+    int64_t controllable = -1;
+    while (controllable < 0) {
+        mock_httpd_client client;
+        if (WiFi.status() == WL_CONNECTED &&
+            mock_httpd_request(HTTP_PORT, HTTP_GET, "/drive?forward=0&steer=0", client) == ESP_OK &&
+            client.status.compare(0, 3, "200") == 0) {
+            controllable = esp_timer_get_time() - start;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    boot.join();
+    printf("controllable %.1f\n", controllable / 1000.0);
+
+    mock_httpd_client metrics;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/metrics", metrics);
+    const char *key = "scout32_boot_phase_seconds{phase=\"";
+    for (size_t pos = metrics.body.find(key); pos != std::string::npos; pos = metrics.body.find(key, pos + 1)) {
+        char phase[32];
+        double seconds;
+        if (sscanf(metrics.body.c_str() + pos + strlen(key), "%31[^\"]\"} %lf", phase, &seconds) == 2) {
+            // /metrics has millisecond resolution
+            printf("phase %s %.1f\n", phase, std::max(0.0, (seconds * 1e6 - start) / 1000.0));
+        }
+    }
+    fflush(stdout);
+    // The firmware's tasks never return
+    _exit(0);
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    if (bench_flag(argc, argv, "--once")) {
+        return boot_once(argc, argv);
+    }
+    int boots = atoi(bench_arg(argc, argv, "--boots", "5"));
+    const char *nvs = bench_arg(argc, argv, "--nvs", "/tmp/scout32_boot_bench.nvs");
+    const char *camera_ms = bench_arg(argc, argv, "--camera-ms", "450");
+    bool stale = bench_flag(argc, argv, "--stale");
+    unlink(nvs);
+
+    std::vector<int64_t> warm_us;
+    for (int i = 0; i < boots; i++) {
+        std::string command = std::string(argv[0]) + " --once --nvs " + nvs + " --camera-ms " + camera_ms;
+        if (i > 0) {
+            command += " --warm";
+        }
+        if (stale) {
+            command += " --stale";
+        }
+        FILE *child = popen(command.c_str(), "r");
+        if (!child) {
+            perror("popen");
+            return 1;
+        }
+        printf("boot %d (%s):", i + 1, i == 0 ? "cold" : "warm");
+        char line[128];
+        double controllable = -1;
+        while (fgets(line, sizeof(line), child)) {
+            char phase[32];
+            double ms;
+            if (sscanf(line, "controllable %lf", &ms) == 1) {
+                controllable = ms;
+            } else if (sscanf(line, "phase %31s %lf", phase, &ms) == 2) {
+                printf(" %s=%.0fms", phase, ms);
+            }
+        }
+        pclose(child);
+        printf("\n  controllable after %.0f ms\n", controllable);
+        if (i > 0) {
+            warm_us.push_back((int64_t)(controllable * 1000));
+        }
+    }
+    bench_print_latency("warm boot to controllable", warm_us);
+    return 0;
+}
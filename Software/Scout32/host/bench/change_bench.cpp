@@ -0,0 +1,114 @@
+// Change detection benchmark.
+//
+// Streams the synthesised "pattern" scene with its box moving and then
+// parked, first with change detection off and then on, and reports what
+// the client received in each phase: frames, bandwidth and the share of
+// frames left unsent as unchanged, plus what a signature costs.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_change_bench [options]\n"
+           "  --seconds S      length of each phase (default 4)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --threshold T    change threshold in luma levels (default 6)\n"
+           "  --keyframe-ms N  keyframe interval (default 1000)\n"
+           "  --grayscale      raw grayscale frames, converted by the firmware\n");
+}
+
+// A /stream client that hangs up when told to
+class phase_client : public mjpeg_client {
+public:
+    phase_client() : mjpeg_client(1000000) {}
+
+    esp_err_t on_body(const char *data, size_t len) override
+    {
+        return stop ? ESP_FAIL : mjpeg_client::on_body(data, len);
+    }
+
+    std::atomic<bool> stop{false};
+};
+
+static std::string get(const char *uri)
+{
+    mock_httpd_client client;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, uri, client);
+    return client.body;
+}
+
+// Value of a sample in /metrics text, or 0
+static double metric(const std::string &text, const char *name)
+{
+    std::string key = std::string("\n") + name + " ";
+    size_t pos = text.find(key);
+    return pos == std::string::npos ? 0 : atof(text.c_str() + pos + key.size());
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "4"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    const char *threshold = bench_arg(argc, argv, "--threshold", "6");
+    const char *keyframe_ms = bench_arg(argc, argv, "--keyframe-ms", "1000");
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    if (bench_flag(argc, argv, "--grayscale")) {
+        sensor_t *s = esp_camera_sensor_get();
+        s->set_pixformat(s, PIXFORMAT_GRAYSCALE);
+    }
+    get((std::string("/config?keyframe_ms=") + keyframe_ms).c_str());
+
+    printf("%-10s %-7s %8s %8s %10s %10s\n", "detection", "scene", "captured", "sent", "KB/s", "unchanged");
+    for (const char *level : {"0", threshold}) {
+        get((std::string("/config?change_threshold=") + level).c_str());
+        for (bool moving : {true, false}) {
+            mock_camera_set_pattern_motion(moving);
+            std::string before = get("/metrics");
+            phase_client client;
+            std::thread streamer([&client]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", client); });
+            std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+            client.stop = true;
+            streamer.join();
+            std::string after = get("/metrics");
+
+            size_t payload = 0;
+            for (const mjpeg_frame_record &rec : client.frames) {
+                payload += rec.bytes;
+            }
+            double captured = metric(after, "scout32_frames_captured_total") - metric(before, "scout32_frames_captured_total");
+            double unchanged = metric(after, "scout32_frames_unchanged_total") - metric(before, "scout32_frames_unchanged_total");
+            printf("%-10s %-7s %8.0f %8zu %10.1f %9.0f%%\n",
+                level == std::string("0") ? "off" : (std::string(">=") + level).c_str(),
+                moving ? "moving" : "parked", captured, client.frames.size(),
+                payload / seconds / 1024.0, captured ? 100.0 * unchanged / captured : 0.0);
+        }
+    }
+
+    std::string metrics = get("/metrics");
+    double count = metric(metrics, "scout32_frame_signature_seconds_count");
+    if (count) {
+        printf("\nsignature: %.0f us mean over %.0f frames (host)\n",
+            metric(metrics, "scout32_frame_signature_seconds_sum") / count * 1e6, count);
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Camera settings benchmark.
+//
+// Streams from /stream while the settings panel changes the frame size,
+// quality and lights a number of times, at moments that don't line up with
+// the sensor's frames, then resends the same settings unchanged. Reports
+// how many /config requests that took, how long the server's task spent
+// on them, how many register writes went over SCCB and how many frames a
+// resize tore (see the mock esp_camera.h).
+//
+// By default each change is one request carrying the whole panel. With
+// --single each setting is its own request, the only way the endpoint
+// could be used before it took batches.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_config_bench [options]\n"
+           "  --changes N      settings changes to make (default 20)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --single         one request per setting\n");
+}
+
+// A /stream client that hangs up when told to
+class stop_client : public mjpeg_client {
+public:
+    stop_client() : mjpeg_client(1000000) {}
+
+    esp_err_t on_body(const char *data, size_t len) override
+    {
+        return stop ? ESP_FAIL : mjpeg_client::on_body(data, len);
+    }
+
+    std::atomic<bool> stop{false};
+};
+
+struct config_run {
+    int requests = 0;
+    int failed = 0;
+    std::vector<int64_t> handler_us;
+};
+
+static void send_config(config_run &run, const std::string &query)
+{
+    mock_httpd_client client;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, ("/config?" + query).c_str(), client);
+    run.requests++;
+    run.failed += client.status.compare(0, 3, "200") != 0;
+    run.handler_us.push_back(client.handler_ns / 1000);
+}
+
+// The panel's settings, as one batch or one request each
+static void send_panel(config_run &run, bool single, int framesize, int quality, int flash)
+{
+    char framesize_str[16], quality_str[16], flash_str[16];
+    snprintf(framesize_str, sizeof(framesize_str), "framesize=%d", framesize);
+    snprintf(quality_str, sizeof(quality_str), "quality=%d", quality);
+    snprintf(flash_str, sizeof(flash_str), "flash=%d", flash);
+    if (single) {
+        send_config(run, framesize_str);
+        send_config(run, quality_str);
+        send_config(run, flash_str);
+    } else {
+        send_config(run, std::string(framesize_str) + "&" + quality_str + "&" + flash_str);
+    }
+}
+
+static void report(const char *name, const config_run &run, uint32_t sccb_writes, uint32_t torn)
+{
+    printf("%s: %d requests (%d failed), %u SCCB writes, %u torn frames\n",
+        name, run.requests, run.failed, sccb_writes, torn);
+    bench_print_latency("  /config handler", run.handler_us);
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    int changes = atoi(bench_arg(argc, argv, "--changes", "20"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    bool single = bench_flag(argc, argv, "--single");
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    config_run setup_run;
+    // Keep the bitrate controller's own changes out of the counts
+    send_config(setup_run, "adaptive=0");
+
+    stop_client stream;
+    std::thread streamer([&stream]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", stream); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // Change between two settings, at times that drift against the frames
+    config_run changed;
+    uint32_t writes_before = mock_camera_sccb_writes();
+    uint32_t torn_before = mock_camera_torn_frames();
+    for (int i = 0; i < changes; i++) {
+        bool big = i % 2 == 0;
+        send_panel(changed, single, big ? FRAMESIZE_CIF : FRAMESIZE_QVGA, big ? 12 : 10, big ? 128 : 0);
+        std::this_thread::sleep_for(std::chrono::microseconds(113000 + 7919 * i % 20000));
+    }
+    report("changing", changed, mock_camera_sccb_writes() - writes_before, mock_camera_torn_frames() - torn_before);
+
+    // The same settings again, as a panel that submits everything would
+    config_run repeated;
+    writes_before = mock_camera_sccb_writes();
+    torn_before = mock_camera_torn_frames();
+    for (int i = 0; i < changes; i++) {
+        send_panel(repeated, single, FRAMESIZE_QVGA, 10, 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    report("unchanged", repeated, mock_camera_sccb_writes() - writes_before, mock_camera_torn_frames() - torn_before);
+
+    stream.stop = true;
+    streamer.join();
+    printf("stream: %zu frames\n", stream.frames.size());
+
+    mock_httpd_client state;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/config", state);
+    printf("GET /config: %s %s\n", state.status.c_str(), state.body.c_str());
+    return 0;
+}
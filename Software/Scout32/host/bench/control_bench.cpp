@@ -0,0 +1,120 @@
+// Drive command benchmark: GET /drive versus the /ws binary control socket.
+//
+// Boots the firmware and pushes the same command sequence through both
+// paths, reporting handler time and bytes on the wire per command. With
+// --reorder, adjacent WebSocket commands are swapped to exercise stale
+// command rejection.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "control_protocol.h"
+#include "mock_httpd.h"
+
+static const uint16_t CONTROL_PORT = 80;
+
+// What a browser fetch() of /drive puts on the wire besides the URI
+static const char BROWSER_REQUEST_HEADERS[] =
+    " HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/118.0 Safari/537.36\r\n"
+    "Accept: */*\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-US,en;q=0.9\r\n\r\n";
+
+// Client to server frames carry a 4 byte mask
+static const size_t WS_CLIENT_HEADER = 2 + 4;
+
+class telemetry_client : public mock_httpd_client {
+public:
+    void on_ws_frame(httpd_ws_type_t type, const uint8_t *data, size_t len) override {
+        if (type == HTTPD_WS_TYPE_BINARY && len == sizeof(control_telemetry_msg_t)) {
+            memcpy(&last, data, len);
+            replies++;
+        }
+    }
+    control_telemetry_msg_t last = {};
+    size_t replies = 0;
+};
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        printf("usage: scout32_control_bench [--commands N] [--reorder P] [--serial]\n");
+        return 0;
+    }
+    int commands = atoi(bench_arg(argc, argv, "--commands", "10000"));
+    double reorder = atof(bench_arg(argc, argv, "--reorder", "0"));
+    mock_serial_set_realtime(false);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+
+    std::mt19937 rng(1);
+    std::vector<control_drive_msg_t> msgs(commands);
+    for (int i = 0; i < commands; i++) {
+        control_drive_msg_t &m = msgs[i];
+        memset(&m, 0, sizeof(m));
+        m.type = CONTROL_MSG_DRIVE;
+        m.flags = i == 0 ? CONTROL_FLAG_RESET : 0;
+        m.seq = (uint16_t)(i + 1);
+        m.forward = (int8_t)(rng() % 201 - 100);
+        m.steer = (int8_t)(rng() % 201 - 100);
+        m.client_ms = (uint16_t)i;
+    }
+
+    // GET /drive, one request per command
+    std::chrono::nanoseconds http_time(0);
+    size_t http_wire = 0;
+    for (const control_drive_msg_t &m : msgs) {
+        char uri[64];
+        snprintf(uri, sizeof(uri), "/drive?forward=%d&steer=%d", m.forward, m.steer);
+        mock_httpd_client client;
+        mock_httpd_request(CONTROL_PORT, HTTP_GET, uri, client);
+        http_time += std::chrono::nanoseconds(client.handler_ns);
+        http_wire += strlen("GET ") + strlen(uri) + strlen(BROWSER_REQUEST_HEADERS) + client.wire_bytes;
+    }
+
+    // Shuffle delivery order for the socket
+    std::vector<control_drive_msg_t> order = msgs;
+    std::uniform_real_distribution<double> coin(0, 1);
+    for (int i = 1; i + 1 < commands; i++) {
+        if (coin(rng) < reorder) {
+            std::swap(order[i], order[i + 1]);
+            i++;
+        }
+    }
+
+    telemetry_client ws;
+    if (mock_httpd_ws_connect(CONTROL_PORT, "/ws", ws) != ESP_OK) {
+        fprintf(stderr, "could not open /ws\n");
+        return 1;
+    }
+    size_t ws_up = 0;
+    size_t wire_before = ws.wire_bytes;
+    int64_t handler_before = ws.handler_ns;
+    for (const control_drive_msg_t &m : order) {
+        mock_httpd_ws_send(ws, HTTPD_WS_TYPE_BINARY, &m, sizeof(m));
+        ws_up += WS_CLIENT_HEADER + sizeof(m);
+    }
+    std::chrono::nanoseconds ws_time(ws.handler_ns - handler_before);
+    size_t ws_wire = ws_up + ws.wire_bytes - wire_before;
+
+    printf("commands: %d\n", commands);
+    // Handler time is measured on the server's task and includes the mock's
+    // response accounting
+    printf("GET /drive: %.0f ns/command in the handler, %.0f B/command on the wire (request + response)\n",
+        (double)http_time.count() / commands, (double)http_wire / commands);
+    printf("/ws:        %.0f ns/command in the handler, %.0f B/command on the wire (command + telemetry)\n",
+        (double)ws_time.count() / commands, (double)ws_wire / commands);
+    printf("/ws: %zu applied, %u discarded as stale, last ack seq %u\n",
+        ws.replies, ws.last.discarded, ws.last.ack_seq);
+    mock_httpd_ws_close(ws);
+    return 0;
+}
@@ -0,0 +1,419 @@
+// Closed-loop drive replay.
+//
+// Boots the firmware, attaches the differential-drive model (drive_sim.h)
+// to its motor outputs and plays a trace of drive commands into /drive or
+// the /ws control socket twice: once over a clean link, once with network
+// delay, jitter and loss. Both runs go through the real motor task, slew
+// limit and watchdog, so the difference between the two paths the model
+// drives is what the link costs: pose error along the way, and how far
+// the rover goes after the operator lets go when the stop is late or lost.
+//
+// Traces are the control page's own sender (a 50 ms tick that sends on a
+// change and resends every 500 ms) working a synthetic stick, or a
+// recording: the CSV /recording?format=csv returns, whose drive rows are
+// the commands as the robot received them.
+//
+// Over HTTP every command is its own request, so a late one can land after
+// a newer one and undo it. The WebSocket delivers in order.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "control_protocol.h"
+#include "drive_sim.h"
+#include "esp_timer.h"
+#include "mock_httpd.h"
+#include "motor_control.h"
+
+static const uint16_t CONTROL_PORT = 80;
+static const int64_t SAMPLE_PERIOD_US = 10000;
+
+// control.js
+static const int UI_TICK_MS = 50;
+static const int UI_RESEND_MS = 500;
+static const double UI_CHANGE = 0.1;
+static const double UI_MIN = 0.15;
+
+struct drive_command {
+    int64_t t_us;   // from the start of the trace
+    int forward;
+    int steer;
+};
+
+struct link_model {
+    double delay_ms = 0;
+    double jitter_ms = 0;       // mean of an exponential on top of the delay
+    double loss = 0;            // chance each command is lost
+    double outage_at_ms = -1;   // everything sent in this window is lost
+    double outage_ms = 0;
+    bool drop_stop = false;     // lose the first stop command
+    bool in_order = false;      // one TCP connection: nothing overtakes
+    uint32_t seed = 1;
+};
+
+struct delivery {
+    size_t command;
+    int64_t at_us;  // from the start of the trace
+};
+
+struct run_result {
+    std::vector<drive_sample> samples;
+    int64_t rest_us = -1;   // at rest after the stop, from the start; -1 if it never was
+};
+
+static void usage()
+{
+    printf("usage: scout32_drive_replay [options]\n"
+           "  --trace T         step, square, slalom or a /recording CSV file (default square)\n"
+           "  --ws              send over the /ws control socket rather than /drive\n"
+           "  --delay-ms D      one-way link delay (default 30)\n"
+           "  --jitter-ms J     mean extra delay, exponentially distributed (default 20)\n"
+           "  --loss P          chance each command is lost, 0 to 1 (default 0.05)\n"
+           "  --outage AT:MS    lose everything sent from AT ms into the trace for MS ms\n"
+           "  --drop-stop       lose the first stop command\n"
+           "  --seed N          for the delay and loss draws (default 1)\n"
+           "  --motor-hz N      motor control rate (default %d)\n"
+           "  --max-speed M     track speed at full duty, m/s (default 0.5)\n"
+           "  --track-width M   between the track centres, m (default 0.16)\n"
+           "  --deadband F      duty below which a track doesn't move, 0 to 1 (default 0.15)\n"
+           "  --lag-ms MS       motor time constant (default 80)\n"
+           "  --max-error CM    objective for the worst pose error\n"
+           "  --max-stop CM     objective for the stop distance with the link impaired\n"
+           "  --csv FILE        write both paths, every 10 ms\n",
+        MOTOR_CONTROL_RATE_HZ);
+}
+
+// What the control page sends for a stick position over time, `stick`
+// giving forward and steer from -1 to 1
+template <typename Stick>
+static std::vector<drive_command> ui_trace(int64_t length_ms, Stick stick)
+{
+    std::vector<drive_command> trace;
+    double sent_forward = 0, sent_steer = 0;
+    int64_t sent_ms = -UI_RESEND_MS;
+    for (int64_t t = 0; t <= length_ms; t += UI_TICK_MS) {
+        double forward, steer;
+        stick(t, &forward, &steer);
+        if (forward * forward + steer * steer < UI_MIN * UI_MIN) {
+            forward = steer = 0;
+        }
+        forward = std::max(-1.0, std::min(1.0, forward));
+        steer = std::max(-1.0, std::min(1.0, steer));
+        bool changed = fabs(forward - sent_forward) > UI_CHANGE || fabs(steer - sent_steer) > UI_CHANGE;
+        if (changed || t - sent_ms > UI_RESEND_MS) {
+            trace.push_back({t * 1000, (int)lround(forward * 100), (int)lround(steer * 100)});
+            sent_forward = forward;
+            sent_steer = steer;
+            sent_ms = t;
+        }
+    }
+    return trace;
+}
+
+// The drive rows of a /recording?format=csv download
+static std::vector<drive_command> csv_trace(const char *path)
+{
+    std::vector<drive_command> trace;
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return trace;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        long long t;
+        int forward, steer;
+        if (sscanf(line, "%lld,drive,,,%d,%d", &t, &forward, &steer) == 3) {
+            trace.push_back({t, forward, steer});
+        }
+    }
+    fclose(f);
+    if (!trace.empty()) {
+        int64_t first = trace[0].t_us;
+        for (drive_command &c : trace) {
+            c.t_us -= first;
+        }
+    }
+    return trace;
+}
+
+static std::vector<drive_command> make_trace(const char *name)
+{
+    if (strcmp(name, "step") == 0) {
+        // Straight ahead, let go
+        return ui_trace(3000, [](int64_t t, double *f, double *s) { *f = t < 2000 ? 0.8 : 0; *s = 0; });
+    }
+    if (strcmp(name, "square") == 0) {
+        // Four sides, turning on the spot at each corner
+        return ui_trace(8500, [](int64_t t, double *f, double *s) {
+            bool driving = t < 7500;
+            bool side = t % 2000 < 1500;
+            *f = driving && side ? 0.6 : 0;
+            *s = driving && !side ? 0.6 : 0;
+        });
+    }
+    if (strcmp(name, "slalom") == 0) {
+        return ui_trace(9000, [](int64_t t, double *f, double *s) {
+            bool driving = t < 8000;
+            *f = driving ? 0.6 : 0;
+            *s = driving ? 0.5 * sin(2 * M_PI * t / 2000.0) : 0;
+        });
+    }
+    return csv_trace(name);
+}
+
+// When the operator let go: the first stop after the last command that moved
+static size_t stop_index(const std::vector<drive_command> &trace)
+{
+    size_t stop = trace.size();
+    for (size_t i = trace.size(); i-- > 0;) {
+        if (trace[i].forward || trace[i].steer) {
+            break;
+        }
+        stop = i;
+    }
+    return stop;
+}
+
+static std::vector<delivery> schedule(const std::vector<drive_command> &trace, const link_model &link, size_t stop,
+    int *lost)
+{
+    std::mt19937 rng(link.seed);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::exponential_distribution<double> jitter(link.jitter_ms > 0 ? 1 / link.jitter_ms : 1);
+    std::vector<delivery> out;
+    int64_t last_at = 0;
+    *lost = 0;
+    for (size_t i = 0; i < trace.size(); i++) {
+        // Draw for every command, so the same seed gives the same delays
+        // whatever else is lost
+        double delay = link.delay_ms + (link.jitter_ms > 0 ? jitter(rng) : 0);
+        bool dropped = uniform(rng) < link.loss;
+        double sent_ms = trace[i].t_us / 1000.0;
+        dropped = dropped || (sent_ms >= link.outage_at_ms && sent_ms < link.outage_at_ms + link.outage_ms);
+        dropped = dropped || (link.drop_stop && i == stop);
+        if (dropped) {
+            (*lost)++;
+            continue;
+        }
+        int64_t at = trace[i].t_us + (int64_t)(delay * 1000);
+        if (link.in_order) {
+            at = std::max(at, last_at);
+        }
+        last_at = at;
+        out.push_back({i, at});
+    }
+    std::stable_sort(out.begin(), out.end(), [](const delivery &a, const delivery &b) { return a.at_us < b.at_us; });
+    return out;
+}
+
+static run_result run(drive_sim &sim, const std::vector<drive_command> &trace, const std::vector<delivery> &deliveries,
+    bool ws, int64_t stop_us)
+{
+    mock_httpd_client socket;
+    if (ws && mock_httpd_ws_connect(CONTROL_PORT, "/ws", socket) != ESP_OK) {
+        fprintf(stderr, "can't open /ws\n");
+        exit(1);
+    }
+    auto start = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+    std::this_thread::sleep_until(start);
+    int64_t start_us = esp_timer_get_time();
+    sim.reset(start_us, SAMPLE_PERIOD_US);
+
+    bool first = true;
+    for (const delivery &d : deliveries) {
+        std::this_thread::sleep_until(start + std::chrono::microseconds(d.at_us));
+        const drive_command &c = trace[d.command];
+        if (ws) {
+            // Numbered in the order sent, as control.js does
+            control_drive_msg_t msg = {CONTROL_MSG_DRIVE, (uint8_t)(first ? CONTROL_FLAG_RESET : 0),
+                (uint16_t)(d.command + 1), (int8_t)c.forward, (int8_t)c.steer, 0};
+            mock_httpd_ws_send(socket, HTTPD_WS_TYPE_BINARY, &msg, sizeof(msg));
+            first = false;
+        } else {
+            char uri[64];
+            snprintf(uri, sizeof(uri), "/drive?forward=%d&steer=%d", c.forward, c.steer);
+            mock_httpd_client client;
+            mock_httpd_request(CONTROL_PORT, HTTP_GET, uri, client);
+        }
+    }
+
+    // At rest after the stop, or after the watchdog if that never came
+    run_result result;
+    int64_t last_us = deliveries.empty() ? 0 : deliveries.back().at_us;
+    int64_t give_up = std::max(last_us, stop_us) + (MOTOR_COMMAND_TIMEOUT_MS + 3000) * 1000LL;
+    while (esp_timer_get_time() - start_us < give_up) {
+        int64_t now = esp_timer_get_time();
+        if (now - start_us > std::max(stop_us, last_us) && sim.at_rest(now)) {
+            result.rest_us = now - start_us;
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    sim.sample(esp_timer_get_time());
+    result.samples = sim.samples();
+    if (ws) {
+        mock_httpd_ws_close(socket);
+    }
+    // Let the watchdog fire, so the next run starts from the same state
+    std::this_thread::sleep_for(std::chrono::milliseconds(MOTOR_COMMAND_TIMEOUT_MS + 100));
+    return result;
+}
+
+static const drive_sample &at(const run_result &r, int64_t t_us)
+{
+    size_t i = std::min((size_t)std::max<int64_t>(t_us / SAMPLE_PERIOD_US, 0), r.samples.size() - 1);
+    return r.samples[i];
+}
+
+// Path length from the stop command being sent until at rest
+static double stop_distance(const run_result &r, int64_t stop_us)
+{
+    return r.samples.back().odometer_m - at(r, stop_us).odometer_m;
+}
+
+static double wrap(double angle)
+{
+    return remainder(angle, 2 * M_PI);
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    const char *trace_name = bench_arg(argc, argv, "--trace", "square");
+    std::vector<drive_command> trace = make_trace(trace_name);
+    if (trace.empty()) {
+        fprintf(stderr, "no drive commands in %s\n", trace_name);
+        return 1;
+    }
+    bool ws = bench_flag(argc, argv, "--ws");
+    link_model link;
+    link.delay_ms = atof(bench_arg(argc, argv, "--delay-ms", "30"));
+    link.jitter_ms = atof(bench_arg(argc, argv, "--jitter-ms", "20"));
+    link.loss = atof(bench_arg(argc, argv, "--loss", "0.05"));
+    const char *outage = bench_arg(argc, argv, "--outage", NULL);
+    if (outage && sscanf(outage, "%lf:%lf", &link.outage_at_ms, &link.outage_ms) != 2) {
+        usage();
+        return 2;
+    }
+    link.drop_stop = bench_flag(argc, argv, "--drop-stop");
+    link.in_order = ws;
+    link.seed = atoi(bench_arg(argc, argv, "--seed", "1"));
+    drive_sim_params params;
+    params.max_speed_mps = atof(bench_arg(argc, argv, "--max-speed", "0.5"));
+    params.track_width_m = atof(bench_arg(argc, argv, "--track-width", "0.16"));
+    params.deadband = atof(bench_arg(argc, argv, "--deadband", "0.15"));
+    params.lag_ms = atof(bench_arg(argc, argv, "--lag-ms", "80"));
+    double max_error_cm = atof(bench_arg(argc, argv, "--max-error", "0"));
+    double max_stop_cm = atof(bench_arg(argc, argv, "--max-stop", "0"));
+
+    mock_serial_set_realtime(false);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+    motorSetRate(atoi(bench_arg(argc, argv, "--motor-hz", "200")));
+    drive_sim sim(params);
+    sim.attach();
+
+    size_t stop = stop_index(trace);
+    int64_t stop_us = stop < trace.size() ? trace[stop].t_us : trace.back().t_us;
+    printf("trace %s: %zu commands over %.1f s, stop sent at %.2f s, over %s\n", trace_name, trace.size(),
+        trace.back().t_us / 1e6, stop_us / 1e6, ws ? "/ws" : "/drive");
+    printf("link: %.0f ms + %.0f ms mean jitter, %.0f%% loss", link.delay_ms, link.jitter_ms, link.loss * 100);
+    if (link.outage_ms > 0) {
+        printf(", out from %.0f ms for %.0f ms", link.outage_at_ms, link.outage_ms);
+    }
+    printf("%s\n", link.drop_stop ? ", stop lost" : "");
+    printf("model: %.2f m/s at full duty, %.0f%% deadband, %.0f ms lag, %.2f m track width\n\n", params.max_speed_mps,
+        params.deadband * 100, params.lag_ms, params.track_width_m);
+
+    int lost;
+    std::vector<delivery> clean_schedule = schedule(trace, link_model(), stop, &lost);
+    std::vector<delivery> impaired_schedule = schedule(trace, link, stop, &lost);
+    std::vector<int64_t> delays;
+    int overtaken = 0;
+    size_t newest = 0;
+    for (const delivery &d : impaired_schedule) {
+        delays.push_back(d.at_us - trace[d.command].t_us);
+        if (d.command < newest) {
+            overtaken++;
+        }
+        newest = std::max(newest, d.command);
+    }
+    printf("delivered %zu of %zu, %d lost, %d arrived after a newer one\n", impaired_schedule.size(), trace.size(),
+        lost, overtaken);
+    bench_print_latency("link delay", delays);
+
+    run_result clean = run(sim, trace, clean_schedule, ws, stop_us);
+    run_result impaired = run(sim, trace, impaired_schedule, ws, stop_us);
+    sim.detach();
+
+    size_t n = std::min(clean.samples.size(), impaired.samples.size());
+    std::vector<double> errors;
+    double heading_max = 0;
+    for (size_t i = 0; i < n; i++) {
+        const drive_pose &a = clean.samples[i].pose;
+        const drive_pose &b = impaired.samples[i].pose;
+        errors.push_back(hypot(a.x - b.x, a.y - b.y));
+        heading_max = std::max(heading_max, fabs(wrap(a.heading - b.heading)));
+    }
+    double final_error = errors.back();
+    std::vector<double> sorted = errors;
+    std::sort(sorted.begin(), sorted.end());
+    double mean = 0;
+    for (double e : sorted) {
+        mean += e / sorted.size();
+    }
+    printf("\n%-10s %22s %10s %10s %12s\n", "run", "end pose x,y,heading", "path", "stop", "at rest");
+    for (const run_result *r : {&clean, &impaired}) {
+        const drive_sample &end = r->samples.back();
+        char rest[32] = "never";
+        if (r->rest_us >= 0) {
+            snprintf(rest, sizeof(rest), "+%.0f ms", (r->rest_us - stop_us) / 1000.0);
+        }
+        printf("%-10s %7.2f,%6.2f,%5.0f deg %8.2f m %7.1f cm %12s\n", r == &clean ? "clean" : "impaired", end.pose.x,
+            end.pose.y, end.pose.heading * 180 / M_PI, end.odometer_m, stop_distance(*r, stop_us) * 100, rest);
+    }
+    printf("pose error against the clean run: mean %.1f cm, p95 %.1f cm, max %.1f cm, at the end %.1f cm; "
+           "heading up to %.1f deg\n", mean * 100, sorted[(size_t)(0.95 * (sorted.size() - 1))] * 100,
+        sorted.back() * 100, final_error * 100, heading_max * 180 / M_PI);
+
+    const char *csv = bench_arg(argc, argv, "--csv", NULL);
+    if (csv) {
+        FILE *f = fopen(csv, "w");
+        if (!f) {
+            fprintf(stderr, "can't write %s\n", csv);
+            return 1;
+        }
+        fprintf(f, "t_ms,clean_x,clean_y,clean_heading,impaired_x,impaired_y,impaired_heading,error_m\n");
+        for (size_t i = 0; i < n; i++) {
+            const drive_pose &a = clean.samples[i].pose;
+            const drive_pose &b = impaired.samples[i].pose;
+            fprintf(f, "%.0f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n", clean.samples[i].t_us / 1000.0, a.x, a.y,
+                a.heading, b.x, b.y, b.heading, errors[i]);
+        }
+        fclose(f);
+    }
+
+    bool ok = true;
+    if (max_error_cm > 0 && sorted.back() * 100 > max_error_cm) {
+        printf("pose error objective missed: %.1f cm > %.1f cm\n", sorted.back() * 100, max_error_cm);
+        ok = false;
+    }
+    double impaired_stop_cm = stop_distance(impaired, stop_us) * 100;
+    if (max_stop_cm > 0 && (impaired.rest_us < 0 || impaired_stop_cm > max_stop_cm)) {
+        printf("stop distance objective missed: %.1f cm > %.1f cm\n", impaired_stop_cm, max_stop_cm);
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+#include <math.h>
+
+#include <algorithm>
+
+#include "chassis.h"
+#include "drive_sim.h"
+#include "esp32-hal-ledc.h"
+#include "esp_timer.h"
+
+// Largest step the model takes, so a long gap between writes still turns
+// a smooth arc
+static const int64_t MAX_STEP_US = 1000;
+static const double FULL_DUTY = (1 << PWM_MOTOR_RESOLUTION) - 1;
+// Slower than this is stopped
+static const double REST_MPS = 1e-3;
+// In channel order, PWM_CHANNEL_LEFT_1 first
+static const uint8_t MOTOR_PINS[4] = {PIN_LEFT_1, PIN_LEFT_2, PIN_RIGHT_1, PIN_RIGHT_2};
+
+static void on_ledc_write(uint8_t channel, uint32_t duty, void *arg)
+{
+    static_cast<drive_sim *>(arg)->on_write(channel, duty, esp_timer_get_time());
+}
+
+drive_sim::drive_sim(const drive_sim_params &params) : params_(params)
+{
+    reset(esp_timer_get_time(), period_us_);
+}
+
+drive_sim::~drive_sim()
+{
+    detach();
+}
+
+// The hook goes in first and outside lock_, which on_write() takes with the
+// hook's lock held. A write that lands between the two is read back here:
+// ledcRead() already has it.
+void drive_sim::attach()
+{
+    mock_ledc_set_write_hook(on_ledc_write, this);
+    std::lock_guard<std::mutex> guard(lock_);
+    for (int i = 0; i < 4; i++) {
+        channel_duty_[i] = ledcRead(MOTOR_PINS[i]);
+    }
+}
+
+void drive_sim::detach()
+{
+    mock_ledc_set_write_hook(nullptr, nullptr);
+}
+
+void drive_sim::reset(int64_t now_us, int64_t sample_period_us)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    start_us_ = now_us;
+    now_us_ = now_us;
+    period_us_ = std::max(sample_period_us, (int64_t)1);
+    next_sample_us_ = now_us + period_us_;
+    state_ = drive_sample();
+    samples_.assign(1, state_);
+}
+
+// chassis.cpp runs the left motor reversed: its forward is channel 1
+void drive_sim::decode(double *left, double *right) const
+{
+    *left = ((double)channel_duty_[0] - channel_duty_[1]) / FULL_DUTY;
+    *right = ((double)channel_duty_[3] - channel_duty_[2]) / FULL_DUTY;
+}
+
+void drive_sim::duty(double *left, double *right)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    decode(left, right);
+}
+
+double drive_sim::track_target(double duty) const
+{
+    double magnitude = fabs(duty);
+    if (magnitude <= params_.deadband) {
+        return 0;
+    }
+    double speed = params_.max_speed_mps * (magnitude - params_.deadband) / (1 - params_.deadband);
+    return duty < 0 ? -speed : speed;
+}
+
+void drive_sim::advance(int64_t now_us)
+{
+    double left_duty, right_duty;
+    decode(&left_duty, &right_duty);
+    double target_left = track_target(left_duty);
+    double target_right = track_target(right_duty);
+    while (now_us_ < now_us) {
+        int64_t end = std::min({now_us, now_us_ + MAX_STEP_US, next_sample_us_});
+        double dt = (end - now_us_) / 1e6;
+        double follow = params_.lag_ms > 0 ? 1 - exp(-dt * 1000 / params_.lag_ms) : 1;
+        double left = state_.left + (target_left - state_.left) * follow;
+        double right = state_.right + (target_right - state_.right) * follow;
+
+        // Speeds at the middle of the step
+        double v = (state_.left + left + state_.right + right) / 4;
+        double w = ((state_.right + right) - (state_.left + left)) / 2 / params_.track_width_m;
+        double heading = state_.pose.heading + w * dt / 2;
+        state_.pose.x += v * cos(heading) * dt;
+        state_.pose.y += v * sin(heading) * dt;
+        state_.pose.heading += w * dt;
+        state_.odometer_m += fabs(v) * dt;
+        state_.left = left;
+        state_.right = right;
+        now_us_ = end;
+        state_.t_us = end - start_us_;
+
+        if (end == next_sample_us_) {
+            samples_.push_back(state_);
+            next_sample_us_ += period_us_;
+        }
+    }
+}
+
+void drive_sim::on_write(uint8_t channel, uint32_t duty, int64_t now_us)
+{
+    if (channel < PWM_CHANNEL_LEFT_1 || channel > PWM_CHANNEL_RIGHT_2) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    // The old duty held until now
+    advance(now_us);
+    channel_duty_[channel - PWM_CHANNEL_LEFT_1] = duty;
+}
+
+drive_sample drive_sim::sample(int64_t now_us)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    advance(now_us);
+    return state_;
+}
+
+bool drive_sim::at_rest(int64_t now_us)
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    advance(now_us);
+    double left, right;
+    decode(&left, &right);
+    bool driven = track_target(left) != 0 || track_target(right) != 0;
+    return !driven && fabs(state_.left) < REST_MPS && fabs(state_.right) < REST_MPS;
+}
+
+std::vector<drive_sample> drive_sim::samples()
+{
+    std::lock_guard<std::mutex> guard(lock_);
+    return samples_;
+}
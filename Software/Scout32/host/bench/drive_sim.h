@@ -0,0 +1,84 @@
+// Differential-drive model of the rover, driven by the firmware's own
+// motor outputs.
+//
+// attach() hooks the mock ledcWrite(), so every duty the firmware writes
+// through chassis.cpp moves the model: each track's duty is decoded back
+// from its two H-bridge channels, goes through a deadband (a track doesn't
+// turn until the motor overcomes static friction) and a first-order lag
+// (motor and track inertia) to a track speed, and the two speeds move a
+// pose: forward at their mean, turning at their difference over the track
+// width. The model is integrated on the esp_timer clock whenever it's
+// asked for the pose or a duty changes, and records the pose on a fixed
+// time grid so two runs can be compared point for point.
+#ifndef DRIVE_SIM_H
+#define DRIVE_SIM_H
+
+#include <stdint.h>
+
+#include <mutex>
+#include <vector>
+
+struct drive_sim_params {
+    double max_speed_mps = 0.5;  // track speed at full duty
+    double track_width_m = 0.16; // between the track centres
+    double deadband = 0.15;      // duty, as a fraction, below which a track doesn't move
+    double lag_ms = 80;          // time constant from duty to track speed
+};
+
+struct drive_pose {
+    double x = 0;        // m, forward at the start
+    double y = 0;        // m, to the left
+    double heading = 0;  // rad, anticlockwise
+};
+
+struct drive_sample {
+    int64_t t_us;        // since reset()
+    drive_pose pose;
+    double odometer_m;   // path length of the rover's centre
+    double left;         // track speeds, m/s
+    double right;
+};
+
+class drive_sim {
+public:
+    explicit drive_sim(const drive_sim_params &params);
+    ~drive_sim();
+
+    // Take ledcWrite() calls from the firmware; only one sim at a time.
+    // detach() returns once no write is still going into the model.
+    void attach();
+    void detach();
+
+    // Back to the origin, at rest, with the clock for samples starting now.
+    // Duty the firmware is still writing is kept.
+    void reset(int64_t now_us, int64_t sample_period_us);
+
+    // Integrate up to `now_us` (esp_timer clock)
+    drive_sample sample(int64_t now_us);
+    // Both tracks stopped and nothing driving them
+    bool at_rest(int64_t now_us);
+    std::vector<drive_sample> samples();
+
+    // Duty as the firmware wrote it, -1 to 1 per track, forward positive
+    void duty(double *left, double *right);
+
+    // Called from the ledcWrite() hook
+    void on_write(uint8_t channel, uint32_t duty, int64_t now_us);
+
+private:
+    void decode(double *left, double *right) const;
+    double track_target(double duty) const;
+    void advance(int64_t now_us);
+
+    drive_sim_params params_;
+    std::mutex lock_;
+    uint32_t channel_duty_[4] = {};
+    int64_t start_us_ = 0;
+    int64_t now_us_ = 0;
+    int64_t period_us_ = 10000;
+    int64_t next_sample_us_ = 0;
+    drive_sample state_;
+    std::vector<drive_sample> samples_;
+};
+
+#endif
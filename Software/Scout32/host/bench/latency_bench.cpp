@@ -0,0 +1,134 @@
+// Latency probe against the simulated robot.
+//
+// Runs what scout32_latency_probe does on the network, with the firmware
+// in-process: one /stream client and timed /drive commands, all on the
+// host's own clock. The mock esp_timer counts from boot, so the probe has
+// a real offset to find; its estimate is printed next to the true one.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "latency_probe.h"
+#include "mock_httpd.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_latency_bench [options]\n"
+           "  --seconds S      how long to measure (default 5)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --rate HZ        drive probes a second (default 20)\n"
+           "  --framesize N    sensor frame size (default 8, VGA)\n"
+           "  --exposure N     manual exposure (aec_value) rather than auto\n"
+           "  --tcp            carry the stream over loopback TCP\n");
+}
+
+static int64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// A /stream client feeding the probe until told to hang up
+class probe_client : public mock_httpd_client {
+public:
+    explicit probe_client(latency_probe *probe) : probe_(probe) {}
+
+    esp_err_t on_body(const char *data, size_t len) override
+    {
+        if (stop) {
+            return ESP_FAIL;
+        }
+        if (!started_) {
+            const char *b = strstr(content_type.c_str(), "boundary=");
+            if (!b) {
+                return ESP_FAIL;
+            }
+            probe_->set_boundary(b + strlen("boundary="));
+            started_ = true;
+        }
+        probe_->on_stream(data, len, now_us());
+        return ESP_OK;
+    }
+
+    std::atomic<bool> stop{false};
+
+private:
+    latency_probe *probe_;
+    bool started_ = false;
+};
+
+static std::string header(const mock_httpd_client &client, const char *name)
+{
+    const char *value = client.header(name);
+    return value ? value : "";
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "5"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    double rate = atof(bench_arg(argc, argv, "--rate", "20"));
+    int framesize = atoi(bench_arg(argc, argv, "--framesize", "8"));
+    const char *exposure = bench_arg(argc, argv, "--exposure", NULL);
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    mock_httpd_client config;
+    std::string settings = "/config?adaptive=0&framesize=" + std::to_string(framesize);
+    if (exposure) {
+        settings += std::string("&aec=0&aec_value=") + exposure;
+    }
+    mock_httpd_request(HTTP_PORT, HTTP_GET, settings.c_str(), config);
+
+    latency_probe probe;
+    probe_client stream(&probe);
+    stream.tcp = bench_flag(argc, argv, "--tcp");
+    std::thread streamer([&stream]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", stream); });
+
+    uint32_t untimed = 0;
+    auto period = std::chrono::microseconds((int64_t)(1e6 / rate));
+    auto next = std::chrono::steady_clock::now();
+    auto deadline = next + std::chrono::duration<double>(seconds);
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_until(next);
+        next += period;
+        int64_t sent = now_us();
+        mock_httpd_client drive;
+        mock_httpd_request(HTTP_PORT, HTTP_GET,
+            ("/drive?forward=0&steer=0&t=" + std::to_string(sent)).c_str(), drive);
+        if (!probe.on_drive(sent, now_us(), header(drive, "X-Client-Time").c_str(),
+                header(drive, "X-Receive-Time").c_str(), header(drive, "X-Actuate-Time").c_str())) {
+            untimed++;
+        }
+    }
+    stream.stop = true;
+    streamer.join();
+
+    int64_t true_offset = esp_timer_get_time() - now_us();
+    int64_t offset = 0, rtt = 0;
+    probe.clock_offset(&offset, &rtt);
+    printf("true clock offset %+.3fms, probe off by %.3fms\n", true_offset / 1000.0,
+        (offset - true_offset) / 1000.0);
+    if (untimed) {
+        printf("%u /drive responses without timing headers\n", untimed);
+    }
+    probe.print_report(0, 0);
+    return 0;
+}
@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <algorithm>
+
+#include "bench_util.h"
+#include "latency_probe.h"
+
+int64_t latency_parse_time(const char *text)
+{
+    if (!text) {
+        return -1;
+    }
+    char *end;
+    long long seconds = strtoll(text, &end, 10);
+    if (end == text || *end != '.' || strlen(end + 1) != 6) {
+        return -1;
+    }
+    long long micros = strtoll(end + 1, &end, 10);
+    if (*end) {
+        return -1;
+    }
+    return seconds * 1000000 + micros;
+}
+
+// Value of header `name` in a part's header block, or ""
+static std::string part_header(const char *headers, size_t len, const char *name)
+{
+    size_t name_len = strlen(name);
+    const char *end = headers + len;
+    for (const char *line = headers; line < end; ) {
+        const char *eol = (const char *)memmem(line, end - line, "\r\n", 2);
+        if (!eol) {
+            eol = end;
+        }
+        if ((size_t)(eol - line) > name_len && line[name_len] == ':' && strncasecmp(line, name, name_len) == 0) {
+            const char *value = line + name_len + 1;
+            while (value < eol && *value == ' ') {
+                value++;
+            }
+            return std::string(value, eol - value);
+        }
+        line = eol + 2;
+    }
+    return "";
+}
+
+// A sensor setting header: a number, or -1 for "auto"
+static int setting_value(const std::string &value)
+{
+    return value.empty() || value == "auto" ? -1 : atoi(value.c_str());
+}
+
+void latency_probe::set_boundary(const std::string &boundary)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    boundary_ = "\r\n--" + boundary + "\r\n";
+    pending_.clear();
+    scanned_ = 0;
+}
+
+void latency_probe::on_stream(const char *data, size_t len, int64_t now_us)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.append(data, len);
+    size_t pos;
+    while ((pos = pending_.find(boundary_, scanned_)) != std::string::npos) {
+        finish_part(pending_.data(), pos, now_us);
+        pending_.erase(0, pos + boundary_.size());
+        scanned_ = 0;
+    }
+    scanned_ = pending_.size() > boundary_.size() ? pending_.size() - boundary_.size() : 0;
+}
+
+void latency_probe::finish_part(const char *part, size_t len, int64_t now_us)
+{
+    const char *end = (const char *)memmem(part, len, "\r\n\r\n", 4);
+    if (!end) {
+        return;
+    }
+    size_t headers_len = end - part;
+    latency_frame_record rec = {};
+    rec.seq = strtoul(part_header(part, headers_len, "X-Frame-Seq").c_str(), NULL, 10);
+    rec.capture_us = latency_parse_time(part_header(part, headers_len, "X-Timestamp").c_str());
+    rec.sent_us = latency_parse_time(part_header(part, headers_len, "X-Send-Time").c_str());
+    rec.received_us = now_us;
+    rec.exposure = setting_value(part_header(part, headers_len, "X-Exposure"));
+    rec.gain = setting_value(part_header(part, headers_len, "X-Gain"));
+    if (rec.capture_us < 0 || rec.sent_us < 0) {
+        untimed_parts_++;
+        return;
+    }
+    frames_.push_back(rec);
+}
+
+bool latency_probe::on_drive(int64_t sent_us, int64_t answered_us, const char *client_time,
+    const char *receive_time, const char *actuate_time)
+{
+    latency_drive_record rec = {};
+    // The echo is what ties a response to its request
+    rec.sent_us = client_time ? strtoll(client_time, NULL, 10) : -1;
+    rec.answered_us = answered_us;
+    rec.received_us = latency_parse_time(receive_time);
+    rec.actuate_us = latency_parse_time(actuate_time);
+    if (rec.sent_us != sent_us || rec.received_us < 0 || rec.actuate_us < 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    drives_.push_back(rec);
+    return true;
+}
+
+std::vector<latency_frame_record> latency_probe::frames() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frames_;
+}
+
+std::vector<latency_drive_record> latency_probe::drives() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return drives_;
+}
+
+bool latency_probe::clock_offset(int64_t *offset_us, int64_t *rtt_us) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const latency_drive_record *best = NULL;
+    for (const latency_drive_record &d : drives_) {
+        if (!best || d.answered_us - d.sent_us < best->answered_us - best->sent_us) {
+            best = &d;
+        }
+    }
+    if (!best) {
+        return false;
+    }
+    // The robot's receive time is assumed halfway through the round trip
+    *offset_us = best->received_us - (best->sent_us + best->answered_us) / 2;
+    *rtt_us = best->answered_us - best->sent_us;
+    return true;
+}
+
+static double p99_ms(std::vector<int64_t> samples_us)
+{
+    if (samples_us.empty()) {
+        return 0;
+    }
+    std::sort(samples_us.begin(), samples_us.end());
+    return samples_us[std::min(samples_us.size() - 1, (size_t)(samples_us.size() * 0.99))] / 1000.0;
+}
+
+static bool check_slo(const char *name, const std::vector<int64_t> &samples_us, double slo_ms)
+{
+    if (slo_ms <= 0 || samples_us.empty()) {
+        return true;
+    }
+    double p99 = p99_ms(samples_us);
+    bool met = p99 <= slo_ms;
+    printf("SLO %s p99 <= %.1fms: %s (%.2fms)\n", name, slo_ms, met ? "met" : "MISSED", p99);
+    return met;
+}
+
+bool latency_probe::print_report(double camera_slo_ms, double motor_slo_ms) const
+{
+    std::vector<latency_frame_record> frames = this->frames();
+    std::vector<latency_drive_record> drives = this->drives();
+    uint32_t untimed;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        untimed = untimed_parts_;
+    }
+    int64_t offset = 0, rtt = 0;
+    bool synced = clock_offset(&offset, &rtt);
+
+    uint32_t skipped = 0;
+    for (size_t i = 1; i < frames.size(); i++) {
+        if (frames[i].seq > frames[i - 1].seq) {
+            skipped += frames[i].seq - frames[i - 1].seq - 1;
+        }
+    }
+    printf("frames: %zu timed, %u untimed, %u skipped by sequence number\n", frames.size(), untimed,
+        skipped);
+    if (!frames.empty()) {
+        const latency_frame_record &last = frames.back();
+        std::string exposure = last.exposure < 0 ? "auto" : std::to_string(last.exposure);
+        std::string gain = last.gain < 0 ? "auto" : std::to_string(last.gain);
+        printf("sensor: exposure %s, gain %s\n", exposure.c_str(), gain.c_str());
+    }
+    if (!synced) {
+        printf("clock offset: unknown, no timed /drive responses\n");
+    } else {
+        printf("clock offset: robot = ours %+.3fms, +-%.2fms\n", offset / 1000.0, rtt / 2000.0);
+    }
+
+    std::vector<int64_t> on_robot, network, camera_to_client;
+    for (const latency_frame_record &f : frames) {
+        on_robot.push_back(f.sent_us - f.capture_us);
+        if (synced) {
+            network.push_back(f.received_us - (f.sent_us - offset));
+            camera_to_client.push_back(f.received_us - (f.capture_us - offset));
+        }
+    }
+    std::vector<int64_t> round_trip, client_to_robot, client_to_motor;
+    for (const latency_drive_record &d : drives) {
+        round_trip.push_back(d.answered_us - d.sent_us);
+        client_to_robot.push_back(d.received_us - offset - d.sent_us);
+        client_to_motor.push_back(d.actuate_us - offset - d.sent_us);
+    }
+
+    bench_print_latency("camera->client", camera_to_client);
+    bench_print_latency("  capture->send, on the robot", on_robot);
+    bench_print_latency("  send->client", network);
+    bench_print_latency("client->motor", client_to_motor);
+    bench_print_latency("  client->robot", client_to_robot);
+    bench_print_latency("drive round trip", round_trip);
+
+    bool met = check_slo("camera->client", camera_to_client, camera_slo_ms);
+    return check_slo("client->motor", client_to_motor, motor_slo_ms) && met;
+}
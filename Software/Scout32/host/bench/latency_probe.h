@@ -0,0 +1,79 @@
+// End-to-end latency from the timing the firmware puts on the wire.
+//
+// Every /stream part carries X-Frame-Seq, X-Timestamp (capture) and
+// X-Send-Time, and /drive?...&t=<our clock> answers with X-Client-Time,
+// X-Receive-Time and X-Actuate-Time, all on the robot's esp_timer clock.
+// The drive round trips give the offset between the two clocks (taken
+// from the fastest exchange, NTP style, so it's good to half its round
+// trip), and with that every frame and command gets an absolute
+// camera->client and client->motor time.
+//
+// Clock drift isn't corrected for; over a run of a few minutes the
+// crystals drift apart by well under a millisecond.
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct latency_frame_record {
+    uint32_t seq;
+    int64_t capture_us;   // robot clock
+    int64_t sent_us;      // robot clock
+    int64_t received_us;  // our clock, when the part's last byte arrived
+    int exposure;         // -1 for auto
+    int gain;             // -1 for auto
+};
+
+struct latency_drive_record {
+    int64_t sent_us;      // our clock
+    int64_t answered_us;  // our clock
+    int64_t received_us;  // robot clock
+    int64_t actuate_us;   // robot clock
+};
+
+class latency_probe {
+public:
+    // Stream side: the multipart body, as it arrives, after the HTTP
+    // response header. `boundary` is from its Content-Type.
+    void set_boundary(const std::string &boundary);
+    void on_stream(const char *data, size_t len, int64_t now_us);
+
+    // Control side: one /drive response's headers. Returns false if they
+    // don't carry the timing (older firmware, or no t sent).
+    bool on_drive(int64_t sent_us, int64_t answered_us, const char *client_time, const char *receive_time,
+        const char *actuate_time);
+
+    std::vector<latency_frame_record> frames() const;
+    std::vector<latency_drive_record> drives() const;
+
+    // Robot clock minus ours, from the fastest round trip, and that round
+    // trip. False with no drive responses.
+    bool clock_offset(int64_t *offset_us, int64_t *rtt_us) const;
+
+    // The distributions, printed with bench_print_latency(). Checks p99
+    // against the objectives given (0 for none) and returns false if
+    // either is missed.
+    bool print_report(double camera_slo_ms, double motor_slo_ms) const;
+
+private:
+    void finish_part(const char *part, size_t len, int64_t now_us);
+
+    mutable std::mutex mutex_;
+    std::string boundary_;
+    std::string pending_;
+    size_t scanned_ = 0;
+    std::vector<latency_frame_record> frames_;
+    std::vector<latency_drive_record> drives_;
+    uint32_t untimed_parts_ = 0;
+};
+
+// "seconds.micros" as the firmware writes it, in microseconds; -1 if it
+// isn't one
+int64_t latency_parse_time(const char *text);
+
+#endif
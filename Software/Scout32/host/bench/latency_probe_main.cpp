@@ -0,0 +1,217 @@
+// Glass-to-glass latency probe for a robot on the network.
+//
+// Opens /stream and sends /drive?forward=0&steer=0&t=<our clock> at a fixed
+// rate on a second, kept-alive connection, then reports camera->client and
+// client->motor latency from the timing headers (see latency_probe.h).
+// The commands are stops: the robot holds still while it's measured.
+// Exits 1 if a latency objective given with --camera-slo or --motor-slo is
+// missed, so it can gate a fleet check.
+#include <errno.h>
+#include <netdb.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "bench_util.h"
+#include "latency_probe.h"
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_signal(int)
+{
+    interrupted = 1;
+}
+
+static void usage()
+{
+    printf("usage: scout32_latency_probe --host ADDRESS [options]\n"
+           "  --port N         HTTP port (default 80)\n"
+           "  --stream PATH    stream to open (default /stream)\n"
+           "  --seconds S      how long to measure, 0 = until Ctrl-C (default 10)\n"
+           "  --rate HZ        drive probes a second (default 10)\n"
+           "  --camera-slo MS  camera->client p99 objective\n"
+           "  --motor-slo MS   client->motor p99 objective\n");
+}
+
+static int64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int connect_to(const char *host, const char *port)
+{
+    struct addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo *addrs;
+    if (getaddrinfo(host, port, &hints, &addrs) != 0) {
+        return -1;
+    }
+    int fd = -1;
+    for (struct addrinfo *a = addrs; a; a = a->ai_next) {
+        fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (fd >= 0 && connect(fd, a->ai_addr, a->ai_addrlen) == 0) {
+            break;
+        }
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(addrs);
+    if (fd >= 0) {
+        // Don't sit in recv() past the end of the run
+        struct timeval timeout = {1, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+    return fd;
+}
+
+static bool send_request(int fd, const char *host, const std::string &path)
+{
+    std::string request = "GET " + path + " HTTP/1.1\r\nHost: " + host + "\r\n\r\n";
+    return send(fd, request.data(), request.size(), MSG_NOSIGNAL) == (ssize_t)request.size();
+}
+
+// Read up to the end of a response header into `head`; anything after it
+// is left in `rest`
+static bool read_head(int fd, std::string *head, std::string *rest)
+{
+    std::string buf = *rest;
+    size_t end;
+    while ((end = buf.find("\r\n\r\n")) == std::string::npos) {
+        char chunk[1024];
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0 || interrupted) {
+            return false;
+        }
+        buf.append(chunk, n);
+    }
+    *head = buf.substr(0, end + 2);
+    *rest = buf.substr(end + 4);
+    return true;
+}
+
+static std::string head_value(const std::string &head, const char *name)
+{
+    std::string key = std::string("\r\n") + name + ":";
+    size_t pos = head.find(key);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += key.size();
+    while (pos < head.size() && head[pos] == ' ') {
+        pos++;
+    }
+    return head.substr(pos, head.find("\r\n", pos) - pos);
+}
+
+static void read_stream(const char *host, const char *port, const char *path, latency_probe *probe,
+    std::atomic<bool> *running)
+{
+    int fd = connect_to(host, port);
+    std::string head, rest;
+    if (fd < 0 || !send_request(fd, host, path) || !read_head(fd, &head, &rest)) {
+        fprintf(stderr, "can't open %s\n", path);
+        *running = false;
+        return;
+    }
+    size_t b = head.find("boundary=");
+    if (head.compare(0, 12, "HTTP/1.1 200") || b == std::string::npos) {
+        fprintf(stderr, "%s: %s\n", path, head.substr(0, head.find("\r\n")).c_str());
+        close(fd);
+        *running = false;
+        return;
+    }
+    b += strlen("boundary=");
+    probe->set_boundary(head.substr(b, head.find("\r\n", b) - b));
+    // Parts end with the boundary rather than start with it
+    probe->on_stream(rest.data(), rest.size(), now_us());
+    char buf[4096];
+    while (*running && !interrupted) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            fprintf(stderr, "stream closed\n");
+            break;
+        }
+        if (n > 0) {
+            probe->on_stream(buf, n, now_us());
+        }
+    }
+    close(fd);
+}
+
+int main(int argc, char **argv)
+{
+    const char *host = bench_arg(argc, argv, "--host", NULL);
+    if (bench_flag(argc, argv, "--help") || !host) {
+        usage();
+        return host ? 0 : 2;
+    }
+    const char *port = bench_arg(argc, argv, "--port", "80");
+    const char *stream_path = bench_arg(argc, argv, "--stream", "/stream");
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "10"));
+    double rate = atof(bench_arg(argc, argv, "--rate", "10"));
+    double camera_slo = atof(bench_arg(argc, argv, "--camera-slo", "0"));
+    double motor_slo = atof(bench_arg(argc, argv, "--motor-slo", "0"));
+
+    signal(SIGINT, on_signal);
+    latency_probe probe;
+    std::atomic<bool> running{true};
+    std::thread streamer(read_stream, host, port, stream_path, &probe, &running);
+
+    int fd = -1;
+    std::string rest;
+    uint32_t untimed = 0;
+    auto period = std::chrono::microseconds((int64_t)(1e6 / std::max(rate, 0.1)));
+    auto next = std::chrono::steady_clock::now();
+    auto deadline = next + std::chrono::duration<double>(seconds);
+    while (running && !interrupted && (seconds <= 0 || std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_until(next);
+        next += period;
+        if (fd < 0) {
+            fd = connect_to(host, port);
+            rest.clear();
+            if (fd < 0) {
+                continue;
+            }
+        }
+        int64_t sent = now_us();
+        std::string head;
+        if (!send_request(fd, host, "/drive?forward=0&steer=0&t=" + std::to_string(sent)) ||
+                !read_head(fd, &head, &rest)) {
+            close(fd);
+            fd = -1;
+            continue;
+        }
+        int64_t answered = now_us();
+        // The firmware answers /drive with no body
+        if (!probe.on_drive(sent, answered, head_value(head, "X-Client-Time").c_str(),
+                head_value(head, "X-Receive-Time").c_str(), head_value(head, "X-Actuate-Time").c_str())) {
+            untimed++;
+        }
+    }
+    running = false;
+    streamer.join();
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (untimed) {
+        printf("%u /drive responses without timing headers\n", untimed);
+    }
+    if (probe.frames().empty() && probe.drives().empty()) {
+        fprintf(stderr, "nothing measured\n");
+        return 1;
+    }
+    return probe.print_report(camera_slo, motor_slo) ? 0 : 1;
+}
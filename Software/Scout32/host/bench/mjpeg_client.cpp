@@ -0,0 +1,68 @@
+#include <string.h>
+
+#include <chrono>
+#include <thread>
+
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "mjpeg_client.h"
+
+mjpeg_client::mjpeg_client(size_t max_frames, double link_kbps)
+    : max_frames_(max_frames), link_bytes_per_us_(link_kbps * 1000.0 / 8.0 / 1e6)
+{
+}
+
+void mjpeg_client::set_link_kbps(double link_kbps)
+{
+    link_bytes_per_us_ = link_kbps * 1000.0 / 8.0 / 1e6;
+}
+
+esp_err_t mjpeg_client::on_body(const char *data, size_t len)
+{
+    int64_t now = esp_timer_get_time();
+    if (!first_byte_us) {
+        first_byte_us = now;
+    }
+    double link_bytes_per_us = link_bytes_per_us_;
+    if (link_bytes_per_us > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(len / link_bytes_per_us)));
+    }
+    if (boundary_.empty()) {
+        const char *b = strstr(content_type.c_str(), "boundary=");
+        if (!b) {
+            return ESP_FAIL;
+        }
+        boundary_ = std::string("\r\n--") + (b + strlen("boundary=")) + "\r\n";
+    }
+
+    pending_.append(data, len);
+    size_t pos;
+    while ((pos = pending_.find(boundary_, scanned_)) != std::string::npos) {
+        finish_part(pending_.data(), pos);
+        pending_.erase(0, pos + boundary_.size());
+        scanned_ = 0;
+        if (frames.size() >= max_frames_) {
+            return ESP_FAIL;
+        }
+    }
+    scanned_ = pending_.size() > boundary_.size() ? pending_.size() - boundary_.size() : 0;
+    last_byte_us = esp_timer_get_time();
+    return ESP_OK;
+}
+
+void mjpeg_client::finish_part(const char *part, size_t len)
+{
+    mjpeg_frame_record rec = {};
+    rec.received_us = esp_timer_get_time();
+    last_byte_us = rec.received_us;
+    const char *end = (const char *)memmem(part, len, "\r\n\r\n", 4);
+    if (!end) {
+        return;
+    }
+    const uint8_t *jpg = (const uint8_t *)end + 4;
+    rec.bytes = len - (jpg - (const uint8_t *)part);
+    if (!mock_camera_parse_stamp(jpg, rec.bytes, &rec.seq, &rec.capture_us)) {
+        rec.capture_us = rec.received_us;
+    }
+    frames.push_back(rec);
+}
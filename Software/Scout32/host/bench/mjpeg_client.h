@@ -0,0 +1,46 @@
+// A /stream client for the mock httpd that splits the multipart response
+// back into JPEG frames and times each one.
+#ifndef MJPEG_CLIENT_H
+#define MJPEG_CLIENT_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "mock_httpd.h"
+
+struct mjpeg_frame_record {
+    uint32_t seq;         // mock camera sequence number, if stamped
+    int64_t capture_us;   // when the mock sensor captured it
+    int64_t received_us;  // when its closing boundary arrived
+    size_t bytes;         // JPEG payload size
+};
+
+class mjpeg_client : public mock_httpd_client {
+public:
+    // Disconnects after `max_frames` frames. A non-zero `link_kbps` paces
+    // delivery like a link of that throughput.
+    mjpeg_client(size_t max_frames, double link_kbps = 0);
+
+    esp_err_t on_body(const char *data, size_t len) override;
+
+    // Change the paced link throughput mid-stream
+    void set_link_kbps(double link_kbps);
+
+    std::vector<mjpeg_frame_record> frames;
+    int64_t first_byte_us = 0;
+    int64_t last_byte_us = 0;
+
+private:
+    void finish_part(const char *part, size_t len);
+
+    size_t max_frames_;
+    std::atomic<double> link_bytes_per_us_;
+    std::string boundary_;
+    std::string pending_;
+    size_t scanned_ = 0;
+};
+
+#endif
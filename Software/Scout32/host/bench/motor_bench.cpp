@@ -0,0 +1,99 @@
+// Motor control benchmark.
+//
+// Boots the firmware and sends /drive commands at random moments, timing
+// how long each takes to reach the LEDC outputs, then stops sending and
+// times how long the command watchdog takes to bring the motors to rest.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "chassis.h"
+#include "esp32-hal-ledc.h"
+#include "esp_timer.h"
+#include "mock_httpd.h"
+#include "motor_control.h"
+
+static const uint16_t CONTROL_PORT = 80;
+
+static std::atomic<int64_t> first_write_us(0);
+static std::atomic<int64_t> last_write_us(0);
+
+static void on_ledc_write(uint8_t channel, uint32_t duty, void *arg)
+{
+    if (channel < PWM_CHANNEL_LEFT_1 || channel > PWM_CHANNEL_RIGHT_2) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    int64_t expected = 0;
+    first_write_us.compare_exchange_strong(expected, now);
+    last_write_us = now;
+}
+
+static void drive(int forward, int steer)
+{
+    char uri[64];
+    snprintf(uri, sizeof(uri), "/drive?forward=%d&steer=%d", forward, steer);
+    mock_httpd_client client;
+    mock_httpd_request(CONTROL_PORT, HTTP_GET, uri, client);
+}
+
+static bool stopped()
+{
+    return ledcRead(PIN_LEFT_1) == 0 && ledcRead(PIN_LEFT_2) == 0 && ledcRead(PIN_RIGHT_1) == 0 &&
+           ledcRead(PIN_RIGHT_2) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        printf("usage: scout32_motor_bench [--commands N] [--rate HZ] [--serial]\n");
+        return 0;
+    }
+    int commands = atoi(bench_arg(argc, argv, "--commands", "200"));
+    int rate = atoi(bench_arg(argc, argv, "--rate", "200"));
+    mock_serial_set_realtime(false);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+    motorSetRate(rate);
+    mock_ledc_set_write_hook(on_ledc_write, NULL);
+
+    // Settle at 50%, then alternate either side of it: the output always
+    // sits between the two, so every command changes it
+    drive(50, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    std::mt19937 rng(1);
+    std::vector<int64_t> latency;
+    for (int i = 0; i < commands; i++) {
+        std::this_thread::sleep_for(std::chrono::microseconds(2000 + rng() % 20000));
+        first_write_us = 0;
+        int64_t sent = esp_timer_get_time();
+        drive(i % 2 ? 60 : 40, 0);
+        while (!first_write_us) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        latency.push_back(first_write_us - sent);
+    }
+
+    // Full speed, then the link goes quiet
+    drive(100, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    int64_t silent = esp_timer_get_time();
+    while (!stopped()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    int64_t rest = last_write_us;
+
+    motor_state_t state;
+    motorGetState(&state);
+    printf("control loop %d Hz, %u ticks, %u late\n", rate, state.ticks, state.late_ticks);
+    bench_print_latency("command-to-LEDC latency", latency);
+    printf("watchdog: motors at rest %.0f ms after the last command (timeout %d ms), %u timeouts\n",
+        (rest - silent) / 1000.0 + 500, MOTOR_COMMAND_TIMEOUT_MS, state.timeouts);
+    return state.timeouts == 1 ? 0 : 1;
+}
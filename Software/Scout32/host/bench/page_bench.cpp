@@ -0,0 +1,51 @@
+// Page load benchmark: what a browser moves over the air to open the UI,
+// first with an empty cache and then revalidating with If-None-Match.
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "mock_httpd.h"
+
+static const uint16_t CONTROL_PORT = 80;
+static const char *PAGE_ASSETS[] = { "/", "/style.css", "/control.js", "/loading.jpg" };
+
+int main(int argc, char **argv)
+{
+    mock_serial_set_realtime(false);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+
+    std::vector<std::string> etags;
+    size_t cold = 0;
+    printf("%-14s %-8s %-9s %10s %10s\n", "asset", "status", "encoding", "cold B", "warm B");
+    for (const char *uri : PAGE_ASSETS) {
+        mock_httpd_client first;
+        first.request_headers.emplace_back("Accept-Encoding", "gzip, deflate");
+        mock_httpd_request(CONTROL_PORT, HTTP_GET, uri, first);
+        const char *etag = first.header("ETag");
+        const char *encoding = first.header("Content-Encoding");
+
+        mock_httpd_client again;
+        again.request_headers.emplace_back("Accept-Encoding", "gzip, deflate");
+        if (etag) {
+            again.request_headers.emplace_back("If-None-Match", etag);
+        }
+        mock_httpd_request(CONTROL_PORT, HTTP_GET, uri, again);
+
+        printf("%-14s %-8.3s %-9s %10zu %10zu  (%s)\n", uri, first.status.c_str(),
+            encoding ? encoding : "identity", first.wire_bytes, again.wire_bytes, again.status.c_str());
+        cold += first.wire_bytes;
+        etags.push_back(etag ? etag : "");
+    }
+    size_t warm = 0;
+    for (size_t i = 0; i < sizeof(PAGE_ASSETS) / sizeof(PAGE_ASSETS[0]); i++) {
+        mock_httpd_client again;
+        again.request_headers.emplace_back("If-None-Match", etags[i]);
+        mock_httpd_request(CONTROL_PORT, HTTP_GET, PAGE_ASSETS[i], again);
+        warm += again.wire_bytes;
+    }
+    printf("page load: %zu B cold, %zu B revalidated\n", cold, warm);
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Heap churn benchmark for the buffer pools.
+//
+// Boots the firmware with the sensor in grayscale, so every streamed frame
+// goes through the JPEG conversion path, and sends /drive and /config
+// requests alongside. Reports how many heap allocations the firmware made
+// per frame and per request once warmed up (frame2jpg()'s output buffer and
+// anything through heap_caps_malloc(); see the mock esp_heap_caps.h), the
+// pool counters from /metrics, and what a pool block costs against the
+// host's malloc.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "buffer_pool.h"
+#include "esp_camera.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_pool_bench [options]\n"
+           "  --frames N       frames to stream (default 200)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --request-hz F   /drive and /config requests a second (default 50)\n"
+           "  --jpeg           leave the sensor in JPEG mode\n"
+           "  --framesize N    sensor frame size; from 9 (SVGA) up, converted frames\n"
+           "                   outgrow a pool block\n"
+           "  --metrics        print the firmware's /metrics afterwards\n");
+}
+
+// Host cost of `rounds` allocate/free pairs of `size` bytes
+static double pair_ns(void *(*alloc)(size_t), void (*release)(void *), size_t size, int rounds)
+{
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < rounds; i++) {
+        void *p = alloc(size);
+        ((volatile uint8_t *)p)[0] = (uint8_t)i;
+        release(p);
+    }
+    return (esp_timer_get_time() - start) * 1000.0 / rounds;
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    size_t frame_count = atoi(bench_arg(argc, argv, "--frames", "200"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    double request_hz = atof(bench_arg(argc, argv, "--request-hz", "50"));
+    bool jpeg = bench_flag(argc, argv, "--jpeg");
+    const char *framesize = bench_arg(argc, argv, "--framesize", NULL);
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    // /config only takes a frame size in JPEG mode
+    if (framesize) {
+        mock_httpd_client config;
+        mock_httpd_request(HTTP_PORT, HTTP_GET, (std::string("/config?adaptive=0&framesize=") + framesize).c_str(), config);
+    }
+    if (!jpeg) {
+        sensor_t *s = esp_camera_sensor_get();
+        s->set_pixformat(s, PIXFORMAT_GRAYSCALE);
+    }
+
+    mjpeg_client stream(frame_count);
+    std::atomic<bool> stream_done(false);
+    std::thread streamer([&stream, &stream_done]() {
+        mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", stream);
+        stream_done = true;
+    });
+
+    // Count from the second frame and request on, once the pools are in place
+    while (stream.frames.size() < 2 && !stream_done) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    mock_httpd_client warm_up;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/drive?forward=0&steer=0", warm_up);
+    uint64_t heap_before = mock_heap_allocations();
+    size_t frames_before = stream.frames.size();
+    int requests = 0;
+    auto period = std::chrono::microseconds((int64_t)(1e6 / request_hz));
+    auto next = std::chrono::steady_clock::now();
+    while (!stream_done) {
+        std::this_thread::sleep_until(next);
+        next += period;
+        mock_httpd_client request;
+        mock_httpd_request(HTTP_PORT, HTTP_GET, requests % 2 ? "/config?flash=0" : "/drive?forward=40&steer=-10", request);
+        requests++;
+    }
+    streamer.join();
+    uint64_t heap_allocs = mock_heap_allocations() - heap_before;
+    size_t frames = stream.frames.size() - frames_before;
+
+    mock_httpd_client metrics;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/metrics", metrics);
+
+    size_t payload = 0;
+    for (const mjpeg_frame_record &rec : stream.frames) {
+        payload += rec.bytes;
+    }
+    printf("%s frames: %zu received (%.0f B JPEG average), %d requests alongside\n",
+        jpeg ? "jpeg" : "grayscale", stream.frames.size(),
+        stream.frames.empty() ? 0.0 : (double)payload / stream.frames.size(), requests);
+    printf("heap allocations after warm-up: %llu (%.2f per frame)\n",
+        (unsigned long long)heap_allocs, frames ? (double)heap_allocs / frames : 0.0);
+
+    const char *text = metrics.body.c_str();
+    for (const char *line = text; *line; ) {
+        const char *end = strchr(line, '\n');
+        size_t len = end ? end - line : strlen(line);
+        if ((!strncmp(line, "scout32_pool_", 13) || !strncmp(line, "scout32_heap_", 13) ||
+                !strncmp(line, "scout32_psram_", 14)) && line[0] != '#') {
+            printf("  %.*s\n", (int)len, line);
+        }
+        line += len + (end ? 1 : 0);
+    }
+
+    const int rounds = 1000000;
+    printf("\nhost cost of an allocate/free pair:\n");
+    printf("  %6zu B: pool %.0f ns, malloc %.0f ns\n", POOL_REQUEST_BLOCK / 2,
+        pair_ns(poolAlloc, poolFree, POOL_REQUEST_BLOCK / 2, rounds), pair_ns(malloc, free, POOL_REQUEST_BLOCK / 2, rounds));
+    printf("  %6zu B: pool %.0f ns, malloc %.0f ns\n", POOL_FRAME_BLOCK,
+        pair_ns(poolAlloc, poolFree, POOL_FRAME_BLOCK, rounds / 10), pair_ns(malloc, free, POOL_FRAME_BLOCK, rounds / 10));
+
+    if (bench_flag(argc, argv, "--metrics")) {
+        printf("\n%s", metrics.body.c_str());
+    }
+    // A frame the firmware couldn't convert ends the stream early
+    if (stream.frames.size() < frame_count) {
+        printf("stream ended after %zu of %zu frames: %s\n", stream.frames.size(), frame_count, stream.status.c_str());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+// Power management benchmark.
+//
+// Boots the firmware with a short idle timeout and lets it go idle
+// (CPU stepped down, modem sleep, camera in standby) over and over. Each
+// time, a /stream client connects to the idle rover and the wait for its
+// first frame is compared with a client connecting to an awake one; then
+// the same for a /drive command. At the end, the time spent in each power
+// state and what that would draw on the board, from datasheet figures.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "mjpeg_client.h"
+#include "mock_httpd.h"
+#include "power_manager.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+// Ballpark supply current in mA at 3.3V: the ESP32 datasheet's modem-sleep
+// rows for the CPU, its receive current for a radio that's listening, and
+// modem sleep at DTIM 1 averaged over a beacon interval. The OV2640 draws
+// about 40 mA running and well under 1 mA in standby.
+static const double CPU_240_MA = 50;
+static const double CPU_80_MA = 22;
+static const double RADIO_AWAKE_MA = 95;
+static const double RADIO_MODEM_SLEEP_MA = 10;
+static const double CAMERA_ON_MA = 40;
+static const double CAMERA_STANDBY_MA = 0.6;
+
+extern bool ap;
+
+static void usage()
+{
+    printf("usage: scout32_power_bench [options]\n"
+           "  --cycles N       times to let it go idle and wake it (default 3)\n"
+           "  --idle-ms N      idle timeout (default 1500)\n"
+           "  --idle-for MS    how long to leave it idle each time (default 3000)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --ap             run as an access point (no modem sleep)\n"
+           "  --serial         echo firmware Serial output to stderr\n");
+}
+
+static power_stats_t stats()
+{
+    power_stats_t s;
+    powerGetStats(&s);
+    return s;
+}
+
+// Time until the power manager goes idle, or -1 if it doesn't within `limit_ms`
+static int64_t wait_idle(uint32_t limit_ms)
+{
+    int64_t start = esp_timer_get_time();
+    while (stats().state != POWER_IDLE) {
+        if (esp_timer_get_time() - start > limit_ms * 1000LL) {
+            return -1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return esp_timer_get_time() - start;
+}
+
+// Request to first frame received, for a new /stream client
+static int64_t first_frame_us()
+{
+    mjpeg_client client(1);
+    int64_t start = esp_timer_get_time();
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", client);
+    return client.frames.empty() ? -1 : client.frames[0].received_us - start;
+}
+
+static int64_t drive_us()
+{
+    mock_httpd_client client;
+    int64_t start = esp_timer_get_time();
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/drive?forward=0&steer=0", client);
+    return esp_timer_get_time() - start;
+}
+
+static double modelled_ma(bool idle, bool modem_sleep)
+{
+    if (!idle) {
+        return CPU_240_MA + RADIO_AWAKE_MA + CAMERA_ON_MA;
+    }
+    return CPU_80_MA + (modem_sleep ? RADIO_MODEM_SLEEP_MA : RADIO_AWAKE_MA) + CAMERA_STANDBY_MA;
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    int cycles = atoi(bench_arg(argc, argv, "--cycles", "3"));
+    uint32_t idle_ms = atoi(bench_arg(argc, argv, "--idle-ms", "1500"));
+    uint32_t idle_for_ms = atoi(bench_arg(argc, argv, "--idle-for", "3000"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+
+    ap = bench_flag(argc, argv, "--ap");
+    mock_serial_set_realtime(false);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+    int64_t frame_interval_us = (int64_t)(1e6 / fps);
+    mock_camera_set_frame_interval_us(frame_interval_us);
+    // The black box recorder holds the camera for ten seconds after every
+    // drive command: off, so the cycles don't wait on it
+    mock_httpd_client config;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, ("/config?record=0&idle_ms=" + std::to_string(idle_ms)).c_str(), config);
+    printf("%s mode, idle after %u ms, sensor at %.0ffps (%.1f ms a frame)\n", ap ? "AP" : "station", idle_ms, fps,
+        frame_interval_us / 1000.0);
+
+    // Housekeeping looks once a second, and the motor watchdog holds it
+    // awake for a second after a drive command
+    uint32_t limit_ms = idle_ms + 3000;
+    std::vector<int64_t> to_idle, cold_frame, warm_frame, cold_drive, warm_drive, wake;
+    bool idle_ok = true;
+    int status = 0;
+    for (int i = 0; i < cycles; i++) {
+        int64_t waited = wait_idle(limit_ms);
+        if (waited < 0) {
+            fprintf(stderr, "didn't go idle within %u ms\n", limit_ms);
+            return 1;
+        }
+        to_idle.push_back(waited);
+        idle_ok = idle_ok && getCpuFrequencyMhz() == POWER_IDLE_MHZ && mock_camera_standby() && (ap || WiFi.getSleep());
+        std::this_thread::sleep_for(std::chrono::milliseconds(idle_for_ms));
+
+        cold_frame.push_back(first_frame_us());
+        wake.push_back(stats().wake_us_last);
+        // Once the capture task has let the last stream's frame go
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        warm_frame.push_back(first_frame_us());
+
+        if (wait_idle(limit_ms) < 0) {
+            fprintf(stderr, "didn't go idle after streaming\n");
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(idle_for_ms));
+        cold_drive.push_back(drive_us());
+        wake.push_back(stats().wake_us_last);
+        warm_drive.push_back(drive_us());
+    }
+
+    printf("idle: CPU at %u MHz, camera standby, modem sleep %s: %s\n", POWER_IDLE_MHZ, ap ? "off (AP)" : "on",
+        idle_ok ? "every time" : "NOT every time");
+    if (!idle_ok) {
+        status = 1;
+    }
+    bench_print_latency("time to idle after the last activity (polled)", to_idle);
+    bench_print_latency("wake (CPU, modem, camera)", wake);
+    bench_print_latency("first frame, idle rover", cold_frame);
+    bench_print_latency("first frame, awake rover", warm_frame);
+    bench_print_latency("/drive, idle rover", cold_drive);
+    bench_print_latency("/drive, awake rover", warm_drive);
+    // Awake, the driver has a frame waiting. Out of standby the sensor's
+    // first one takes a frame period: a client should wait no longer than
+    // that and the wake.
+    for (size_t i = 0; i < cold_frame.size(); i++) {
+        if (cold_frame[i] < 0 || cold_frame[i] > frame_interval_us + wake[2 * i] + 5000) {
+            printf("wake %zu: first frame after %.1f ms, more than one frame interval\n", i, cold_frame[i] / 1000.0);
+            status = 1;
+        }
+    }
+
+    power_stats_t s = stats();
+    double total = s.seconds[POWER_ACTIVE] + s.seconds[POWER_IDLE];
+    printf("\n%-8s %8s %6s %10s\n", "state", "seconds", "share", "model mA");
+    for (int i = 0; i < POWER_STATE_COUNT; i++) {
+        printf("%-8s %8.2f %5.0f%% %10.1f\n", powerStateName((power_state_t)i), s.seconds[i],
+            100 * s.seconds[i] / total, modelled_ma(i == POWER_IDLE, !ap));
+    }
+    printf("went idle %u times; woken by", s.idles);
+    for (int i = 0; i < POWER_SOURCE_COUNT; i++) {
+        printf(" %s %u%s", powerSourceName((power_source_t)i), s.wakes[i], i + 1 < POWER_SOURCE_COUNT ? "," : "\n");
+    }
+    double average = (s.seconds[POWER_ACTIVE] * modelled_ma(false, !ap) + s.seconds[POWER_IDLE] * modelled_ma(true, !ap)) /
+        total;
+    printf("modelled average %.1f mA over this run, against %.1f mA never idle\n", average, modelled_ma(false, !ap));
+    return status;
+}
@@ -0,0 +1,199 @@
+// Query string parsing benchmark.
+//
+// Times queryParse() against the way /drive and /config read their queries
+// before it: a copy of the query into a pool block, then for /drive one
+// httpd_query_key_value() rescan per key and atoi(), for /config a split
+// into pairs and a name search per pair. Both run on the same queries, in
+// a tight loop, so the numbers are parsing alone. Then the handlers
+// themselves, through the mock server, for the whole request.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "buffer_pool.h"
+#include "esp_http_server.h"
+#include "mock_httpd.h"
+#include "query_parser.h"
+#include "sensor_config.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static volatile int sink;
+
+static void usage()
+{
+    printf("usage: scout32_query_bench [options]\n"
+           "  --iterations N   parses per case (default 200000)\n"
+           "  --requests N     requests per handler case (default 2000)\n");
+}
+
+// /drive as it was: pool copy, a rescan per key, atoi, no range check
+static bool old_drive(const char *query)
+{
+    size_t len = strlen(query) + 1;
+    char *buf = (char *)poolAlloc(len);
+    memcpy(buf, query, len);
+    char forward[32], steer[32], t[24];
+    bool ok = httpd_query_key_value(buf, "forward", forward, sizeof(forward)) == ESP_OK &&
+        httpd_query_key_value(buf, "steer", steer, sizeof(steer)) == ESP_OK;
+    if (ok) {
+        sink = atoi(forward) + atoi(steer);
+        if (httpd_query_key_value(buf, "t", t, sizeof(t)) == ESP_OK) {
+            sink = t[0];
+        }
+    }
+    poolFree(buf);
+    return ok;
+}
+
+static const char *const old_stream_settings[] = {
+    "adaptive", "target_fps", "capture_max_age", "change_threshold", "keyframe_ms", "nodelay", "sndbuf",
+    "record", "record_fps",
+};
+
+// /config as it was: pool copy, split in place, a name search per pair
+static bool old_config(const char *query)
+{
+    size_t len = strlen(query) + 1;
+    char *buf = (char *)poolAlloc(len);
+    memcpy(buf, query, len);
+    bool ok = true;
+    for (char *key = strtok(buf, "&"); key && ok; key = strtok(NULL, "&")) {
+        char *value = strchr(key, '=');
+        value = value ? (*value = 0, value + 1) : key + strlen(key);
+        int setting = -1;
+        for (int i = 0; i < SENSOR_SETTING_COUNT && setting < 0; i++) {
+            if (strcmp(key, sensorConfigKey(i)) == 0) {
+                setting = i;
+            }
+        }
+        if (setting >= 0) {
+            ok = sensorConfigValid(setting, atoi(value));
+            sink = atoi(value);
+        } else {
+            ok = false;
+            for (const char *name : old_stream_settings) {
+                if (strcmp(key, name) == 0) {
+                    ok = true;
+                    sink = atof(value);
+                }
+            }
+        }
+    }
+    poolFree(buf);
+    return ok;
+}
+
+struct drive_query {
+    int forward;
+    int steer;
+    char client_time[24];
+};
+
+static const query_param_t drive_params[] = {
+    {"forward", QUERY_INT, offsetof(drive_query, forward), -100, 100, 0, true},
+    {"steer", QUERY_INT, offsetof(drive_query, steer), -100, 100, 0, true},
+    {"t", QUERY_STRING, offsetof(drive_query, client_time), 0, 23, 0, false},
+};
+
+static bool new_drive(const char *uri)
+{
+    drive_query query;
+    query_target_t target = {drive_params, 3, &query, 0};
+    query_result_t result;
+    bool ok = queryParse(uri, &target, 1, &result);
+    sink = query.forward + query.steer;
+    return ok;
+}
+
+// Only the camera's settings: the stream ones live in app_server.cpp
+static bool new_config(const char *uri)
+{
+    sensor_settings_t settings;
+    query_target_t target = {sensorConfigParams(), SENSOR_SETTING_COUNT, &settings, 0};
+    query_result_t result;
+    bool ok = queryParse(uri, &target, 1, &result);
+    sink = target.seen;
+    return ok;
+}
+
+static double ns_per_call(bool (*parse)(const char *), const char *input, int iterations, bool *ok)
+{
+    *ok = parse(input);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        parse(input);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static void compare(const char *name, bool (*old_parse)(const char *), bool (*new_parse)(const char *),
+    const char *query, int iterations)
+{
+    std::string uri = std::string("/x?") + query;
+    bool old_ok, new_ok;
+    double old_ns = ns_per_call(old_parse, query, iterations, &old_ok);
+    double new_ns = ns_per_call(new_parse, uri.c_str(), iterations, &new_ok);
+    printf("%-22s before %6.0f ns%s  queryParse %6.0f ns%s  (%.1fx)\n", name, old_ns, old_ok ? "" : " (rejected)",
+        new_ns, new_ok ? "" : " (rejected)", old_ns / new_ns);
+}
+
+// Median time in the handler over `requests` requests
+static double handler_ns(const char *uri, int requests, std::string *status)
+{
+    std::vector<int64_t> ns;
+    for (int i = 0; i < requests; i++) {
+        mock_httpd_client client;
+        mock_httpd_request(HTTP_PORT, HTTP_GET, uri, client);
+        ns.push_back(client.handler_ns);
+        *status = client.status + (client.body.empty() ? "" : ", " + client.body.substr(0, 60));
+    }
+    std::sort(ns.begin(), ns.end());
+    return ns[ns.size() / 2];
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    int iterations = atoi(bench_arg(argc, argv, "--iterations", "200000"));
+    int requests = atoi(bench_arg(argc, argv, "--requests", "2000"));
+
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+
+    printf("parsing alone, per request:\n");
+    compare("/drive", old_drive, new_drive, "forward=57&steer=-12", iterations);
+    compare("/drive with t", old_drive, new_drive, "forward=57&steer=-12&t=1718000000123456", iterations);
+    compare("/drive out of range", old_drive, new_drive, "forward=900&steer=0", iterations);
+    compare("/config, 1 setting", old_config, new_config, "framesize=8", iterations);
+    compare("/config, 3 settings", old_config, new_config, "framesize=8&quality=12&flash=0", iterations);
+    compare("/config, 8 settings", old_config, new_config,
+        "framesize=8&quality=12&brightness=1&contrast=-1&saturation=0&aec=0&aec_value=300&flash=40", iterations);
+
+    printf("whole handler, median:\n");
+    const char *const uris[] = {
+        "/drive?forward=57&steer=-12",
+        "/drive?forward=900&steer=0",
+        "/drive?forward=57",
+        "/config?framesize=8&quality=12&flash=0",
+        "/config?framesize=8&quality=99",
+        "/config?nodelay=yes",
+        "/config?fps=10",
+    };
+    for (const char *uri : uris) {
+        std::string status;
+        double ns = handler_ns(uri, requests, &status);
+        printf("%-42s %7.0f ns  %s\n", uri, ns, status.c_str());
+    }
+    return 0;
+}
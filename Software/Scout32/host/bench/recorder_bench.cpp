@@ -0,0 +1,222 @@
+// Black box recorder benchmark.
+//
+// Streams to one /stream client, first parked and then while driving at
+// 20 commands a second (which starts the recorder), and compares the live
+// frame rate in the two phases. Then downloads /recording, checks the AVI
+// (RIFF sizes, idx1 entries pointing at whole JPEGs, the event chunk) and
+// reports its size, how long it took and what the buffer held.
+//
+// --no-record turns the recorder off, for comparison.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_recorder_bench [options]\n"
+           "  --seconds S      length of each phase (default 4)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --record-fps F   recorder frame rate (default: the firmware's)\n"
+           "  --framesize N    sensor frame size (default 8, VGA)\n"
+           "  --no-record      recorder off\n");
+}
+
+// A /stream client that hangs up when told to
+class stop_client : public mjpeg_client {
+public:
+    stop_client() : mjpeg_client(1000000) {}
+
+    esp_err_t on_body(const char *data, size_t len) override
+    {
+        return stop ? ESP_FAIL : mjpeg_client::on_body(data, len);
+    }
+
+    std::atomic<bool> stop{false};
+};
+
+static int64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string get(const char *uri)
+{
+    mock_httpd_client client;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, uri, client);
+    return client.body;
+}
+
+// Value of a sample in /metrics text, or 0
+static double metric(const std::string &text, const char *name)
+{
+    std::string key = std::string("\n") + name + " ";
+    size_t pos = text.find(key);
+    return pos == std::string::npos ? 0 : atof(text.c_str() + pos + key.size());
+}
+
+// Frames the client received in a phase of `seconds`, with drive commands
+// going if `drive`
+static double stream_phase(double seconds, bool drive)
+{
+    stop_client stream;
+    std::thread streamer([&stream]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", stream); });
+    std::atomic<bool> driving{drive};
+    std::thread driver([&driving]() {
+        for (int i = 0; driving; i++) {
+            char uri[64];
+            snprintf(uri, sizeof(uri), "/drive?forward=%d&steer=%d", 40 + i % 20, i % 7 - 3);
+            get(uri);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    });
+    // Skip the start-up
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    size_t start = stream.frames.size();
+    std::this_thread::sleep_for(std::chrono::milliseconds((int64_t)(seconds * 1000)));
+    size_t frames = stream.frames.size() - start;
+    driving = false;
+    driver.join();
+    stream.stop = true;
+    streamer.join();
+    return frames / seconds;
+}
+
+static uint32_t le32(const std::string &s, size_t pos)
+{
+    const uint8_t *p = (const uint8_t *)s.data() + pos;
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Walk the AVI the way a player would. Returns an error, or "" if it's good.
+static std::string check_avi(const std::string &avi, uint32_t *frames, uint32_t *width, uint32_t *height,
+    double *fps, std::string *events)
+{
+    if (avi.size() < 12 || avi.compare(0, 4, "RIFF") || avi.compare(8, 4, "AVI ")) {
+        return "not a RIFF AVI";
+    }
+    if (le32(avi, 4) + 8 != avi.size()) {
+        return "RIFF size doesn't match the download";
+    }
+    size_t movi = 0, idx = 0, idx_len = 0;
+    for (size_t pos = 12; pos + 8 <= avi.size(); ) {
+        uint32_t len = le32(avi, pos + 4);
+        if (!avi.compare(pos, 4, "LIST") && !avi.compare(pos + 8, 4, "hdrl")) {
+            // avih is the first thing in hdrl
+            *fps = 1e6 / le32(avi, pos + 20);
+            *frames = le32(avi, pos + 20 + 16);
+            *width = le32(avi, pos + 20 + 32);
+            *height = le32(avi, pos + 20 + 36);
+        } else if (!avi.compare(pos, 4, "LIST") && !avi.compare(pos + 8, 4, "movi")) {
+            movi = pos + 8;
+        } else if (!avi.compare(pos, 4, "idx1")) {
+            idx = pos + 8;
+            idx_len = len;
+        } else if (!avi.compare(pos, 4, "s32e")) {
+            *events = avi.substr(pos + 8, len);
+        }
+        pos += 8 + len + (len & 1);
+        if (pos > avi.size()) {
+            return "chunk runs past the end";
+        }
+    }
+    if (!movi || !idx) {
+        return "no movi list or idx1";
+    }
+    if (idx_len / 16 != *frames) {
+        return "idx1 and avih disagree on the frame count";
+    }
+    for (uint32_t i = 0; i < *frames; i++) {
+        size_t entry = idx + 16 * i;
+        size_t chunk = movi + le32(avi, entry + 8);
+        uint32_t len = le32(avi, entry + 12);
+        if (avi.compare(entry, 4, "00dc") || chunk + 8 + len > avi.size() || avi.compare(chunk, 4, "00dc") ||
+                le32(avi, chunk + 4) != len) {
+            return "idx1 entry " + std::to_string(i) + " doesn't point at its chunk";
+        }
+        const uint8_t *jpg = (const uint8_t *)avi.data() + chunk + 8;
+        if (len < 4 || jpg[0] != 0xFF || jpg[1] != 0xD8 || jpg[len - 2] != 0xFF || jpg[len - 1] != 0xD9) {
+            return "frame " + std::to_string(i) + " isn't a whole JPEG";
+        }
+    }
+    return "";
+}
+
+// Lines of `event` in the CSV, past its header
+static int count_lines(const std::string &text, const char *event)
+{
+    int n = 0;
+    for (size_t pos = text.find(event, text.find('\n')); pos != std::string::npos; pos = text.find(event, pos + 1)) {
+        n++;
+    }
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "4"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    const char *record_fps = bench_arg(argc, argv, "--record-fps", NULL);
+    int framesize = atoi(bench_arg(argc, argv, "--framesize", "8"));
+    bool record = !bench_flag(argc, argv, "--no-record");
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    get((std::string("/config?adaptive=0&framesize=") + std::to_string(framesize) +
+        "&record=" + (record ? "1" : "0")).c_str());
+    if (record_fps) {
+        get((std::string("/config?record_fps=") + record_fps).c_str());
+    }
+
+    double parked = stream_phase(seconds, false);
+    double driving = stream_phase(seconds, true);
+    printf("recorder %s, sensor %.0ffps\n", record ? "on" : "off", fps);
+    printf("live stream: %.1ffps parked, %.1ffps driving\n", parked, driving);
+
+    std::string metrics = get("/metrics");
+    printf("recorder: %.0f frames, %.0f commands recorded; holds %.0f frames, %.0f KB, %.1fs\n",
+        metric(metrics, "scout32_recorder_frames_total"), metric(metrics, "scout32_recorder_commands_total"),
+        metric(metrics, "scout32_recorder_held_frames"), metric(metrics, "scout32_recorder_held_bytes") / 1024,
+        metric(metrics, "scout32_recorder_held_seconds"));
+
+    mock_httpd_client download;
+    int64_t start = now_us();
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/recording", download);
+    int64_t took_us = now_us() - start;
+    printf("/recording: %s, %zu bytes in %.0fms\n", download.status.c_str(), download.body.size(), took_us / 1e3);
+    if (download.status.compare(0, 3, "200") == 0) {
+        uint32_t frames = 0, width = 0, height = 0;
+        double avi_fps = 0;
+        std::string events;
+        std::string error = check_avi(download.body, &frames, &width, &height, &avi_fps, &events);
+        if (!error.empty()) {
+            printf("  AVI: BAD, %s\n", error.c_str());
+            return 1;
+        }
+        printf("  AVI: %u frames %ux%u at %.1ffps, %d frame and %d drive events\n",
+            frames, width, height, avi_fps, count_lines(events, ",frame,"), count_lines(events, ",drive,"));
+    }
+    mock_httpd_client csv;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/recording?format=csv", csv);
+    printf("/recording?format=csv: %s, %zu bytes\n", csv.status.c_str(), csv.body.size());
+    return 0;
+}
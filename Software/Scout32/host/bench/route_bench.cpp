@@ -0,0 +1,218 @@
+// Route lookup benchmark.
+//
+// Times findRoute(), the generated perfect-hash table, against the linear
+// walk esp_http_server does over its registered handlers (the way every
+// path was found before the table): a strlen() and strncmp() per handler
+// until one matches. First the firmware's own paths, in the order they
+// used to be registered, then synthetic tables as endpoints are added,
+// hashed here the same way generate_pages.py does it. Then whole requests
+// through the mock server, dispatcher included.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "mock_httpd.h"
+#include "pages.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static volatile uintptr_t sink;
+
+// The handlers as they were registered: pages first, then the endpoints
+static const char *const registered[] = {
+    "/control.js", "/index.html", "/loading.jpg", "/style.css", "/",
+    "/capture", "/config", "/drive", "/ws", "/metrics", "/rtp", "/stream", "/recording",
+};
+
+static void usage()
+{
+    printf("usage: scout32_route_bench [options]\n"
+           "  --iterations N   lookups per case (default 2000000)\n"
+           "  --requests N     requests per handler case (default 2000)\n");
+}
+
+// esp_http_server's lookup: the path ends at '?', then each handler in turn
+static int linear_find(const char *const *paths, int count, const char *uri)
+{
+    const char *query = strchr(uri, '?');
+    size_t len = query ? (size_t)(query - uri) : strlen(uri);
+    for (int i = 0; i < count; i++) {
+        if (strlen(paths[i]) == len && strncmp(paths[i], uri, len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+template <typename F> static double ns_per_lookup(F lookup, int iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        sink = lookup();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static uint32_t route_hash(const char *path, uint32_t seed)
+{
+    uint32_t h = seed;
+    for (const char *p = path; *p && *p != '?'; p++) {
+        h = (h ^ (uint8_t)*p) * 16777619u;
+    }
+    return h;
+}
+
+static uint32_t route_slot(uint32_t h, uint8_t displace, int bits)
+{
+    return ((h ^ displace) * 0x9e3779b1u) >> (32 - bits);
+}
+
+// What generate_pages.py emits, built at run time for `paths`
+struct hashed_table {
+    uint32_t seed = 1;
+    int bits = 1;
+    uint32_t buckets = 1;
+    std::vector<uint8_t> displace;
+    std::vector<int8_t> slots;
+    std::vector<const char *> paths;
+
+    explicit hashed_table(const std::vector<const char *> &p) : paths(p)
+    {
+        while ((1u << bits) < 2 * paths.size()) {
+            bits++;
+        }
+        while (buckets < paths.size() / 2) {
+            buckets *= 2;
+        }
+        while (!place()) {
+            seed++;
+        }
+    }
+
+    bool place()
+    {
+        std::vector<std::vector<int>> members(buckets);
+        for (size_t i = 0; i < paths.size(); i++) {
+            members[route_hash(paths[i], seed) & (buckets - 1)].push_back(i);
+        }
+        std::vector<uint32_t> order(buckets);
+        for (uint32_t b = 0; b < buckets; b++) {
+            order[b] = b;
+        }
+        std::stable_sort(order.begin(), order.end(),
+            [&](uint32_t a, uint32_t b) { return members[a].size() > members[b].size(); });
+        displace.assign(buckets, 0);
+        slots.assign(1u << bits, -1);
+        for (uint32_t b : order) {
+            bool placed = false;
+            for (int d = 0; d < 256 && !placed; d++) {
+                std::set<uint32_t> taken;
+                for (int i : members[b]) {
+                    uint32_t slot = route_slot(route_hash(paths[i], seed), d, bits);
+                    if (slots[slot] >= 0 || !taken.insert(slot).second) {
+                        break;
+                    }
+                }
+                if (taken.size() == members[b].size()) {
+                    for (int i : members[b]) {
+                        slots[route_slot(route_hash(paths[i], seed), d, bits)] = i;
+                    }
+                    displace[b] = d;
+                    placed = true;
+                }
+            }
+            if (!placed) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int find(const char *uri) const
+    {
+        uint32_t h = seed;
+        const char *p = uri;
+        for (; *p && *p != '?'; p++) {
+            h = (h ^ (uint8_t)*p) * 16777619u;
+        }
+        int slot = slots[route_slot(h, displace[h & (buckets - 1)], bits)];
+        size_t len = p - uri;
+        return slot >= 0 && strncmp(paths[slot], uri, len) == 0 && paths[slot][len] == 0 ? slot : -1;
+    }
+};
+
+static double handler_ns(const char *uri, int requests, std::string *status)
+{
+    std::vector<int64_t> ns;
+    for (int i = 0; i < requests; i++) {
+        mock_httpd_client client;
+        mock_httpd_request(HTTP_PORT, HTTP_GET, uri, client);
+        ns.push_back(client.handler_ns);
+        *status = client.status;
+    }
+    std::sort(ns.begin(), ns.end());
+    return ns[ns.size() / 2];
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    int iterations = atoi(bench_arg(argc, argv, "--iterations", "2000000"));
+    int requests = atoi(bench_arg(argc, argv, "--requests", "2000"));
+    int registered_count = sizeof(registered) / sizeof(registered[0]);
+
+    printf("firmware routes, per lookup:\n");
+    const char *const uris[] = {
+        "/control.js", "/", "/drive?forward=57&steer=-12", "/stream", "/recording?seconds=10", "/missing",
+    };
+    for (const char *uri : uris) {
+        double linear = ns_per_lookup([&]() { return (uintptr_t)linear_find(registered, registered_count, uri); },
+            iterations);
+        double hashed = ns_per_lookup([&]() { return (uintptr_t)findRoute(uri); }, iterations);
+        printf("%-28s linear %6.1f ns  findRoute %6.1f ns%s\n", uri, linear, hashed,
+            findRoute(uri) ? "" : "  (no route)");
+    }
+
+    printf("synthetic tables, last registered path:\n");
+    for (int count : {13, 32, 64, 127}) {
+        std::vector<std::string> names;
+        for (int i = 0; i < count; i++) {
+            names.push_back("/api/endpoint" + std::to_string(i));
+        }
+        std::vector<const char *> paths;
+        for (const std::string &name : names) {
+            paths.push_back(name.c_str());
+        }
+        hashed_table table(paths);
+        const char *uri = paths.back();
+        double linear = ns_per_lookup([&]() { return (uintptr_t)linear_find(paths.data(), count, uri); },
+            iterations);
+        double hashed = ns_per_lookup([&]() { return (uintptr_t)table.find(uri); }, iterations);
+        printf("%4d routes in %4zu slots    linear %6.1f ns  hashed %6.1f ns\n", count, table.slots.size(), linear,
+            hashed);
+    }
+
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    printf("whole handler, median:\n");
+    const char *const requests_uris[] = {
+        "/", "/style.css", "/drive?forward=0&steer=0", "/config?quality=12", "/metrics", "/missing",
+    };
+    for (const char *uri : requests_uris) {
+        std::string status;
+        double ns = handler_ns(uri, requests, &status);
+        printf("%-28s %8.0f ns  %s\n", uri, ns, status.c_str());
+    }
+    return 0;
+}
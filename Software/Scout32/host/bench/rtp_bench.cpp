@@ -0,0 +1,98 @@
+// RTP/JPEG streaming benchmark.
+//
+// Boots the firmware, starts a receiver on a local UDP port and asks the
+// firmware to stream to it through /rtp. The firmware and receiver share
+// a clock here, so latency is capture to complete frame received. Fails
+// if no frame arrives whole, or if any datagram would be IP fragmented.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "mock_httpd.h"
+#include "rtp_receiver.h"
+#include "rtp_stream.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_rtp_bench [options]\n"
+           "  --seconds S      how long to stream (default 5)\n"
+           "  --fps F          simulated sensor frame rate, 0 = unthrottled (default 25)\n"
+           "  --source PATH    baseline JPEG file or directory to replay, or \"pattern\"\n"
+           "                   for synthesised frames (default pattern)\n"
+           "  --loss P         drop a fraction P of packets on arrival (default 0)\n"
+           "  --out DIR        write received frames to DIR as JPEG files\n"
+           "  --port N         stream to a receiver already listening on 127.0.0.1:N,\n"
+           "                   e.g. scout32_rtp_receiver, instead of the built-in one\n"
+           "  --serial         echo firmware Serial output to stderr\n");
+}
+
+static std::string rtp_request(const std::string &query)
+{
+    mock_httpd_client client;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, ("/rtp?" + query).c_str(), client);
+    return client.status + " " + client.body;
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "5"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    const char *source = bench_arg(argc, argv, "--source", "pattern");
+    const char *out = bench_arg(argc, argv, "--out", NULL);
+
+    // loading.jpg is progressive, which RFC 2435 can't carry
+    if (mock_camera_load_frames(source) == 0 && strcmp(source, "pattern") != 0) {
+        fprintf(stderr, "no JPEG frames found in %s\n", source);
+        return 1;
+    }
+    mock_serial_set_realtime(false);
+    bench_boot(bench_flag(argc, argv, "--serial"));
+    mock_camera_set_frame_interval_us(fps > 0 ? (int64_t)(1e6 / fps) : 0);
+
+    uint16_t port = atoi(bench_arg(argc, argv, "--port", "0"));
+    rtp_receiver receiver(atof(bench_arg(argc, argv, "--loss", "0")), true);
+    if (out) {
+        mkdir(out, 0755);
+        receiver.save_frames(out, 100);
+    }
+    bool external = port != 0;
+    if (!external && !(port = receiver.start(0))) {
+        perror("bind");
+        return 1;
+    }
+
+    printf("start: %s\n", rtp_request("start=1&host=127.0.0.1&port=" + std::to_string(port)).c_str());
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    printf("stop: %s\n", rtp_request("stop=1").c_str());
+    // Let the sender finish its frame and the last packets land
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    if (external) {
+        return 0;
+    }
+    receiver.stop();
+
+    printf("\nsensor %s, %u frames captured\n",
+        fps > 0 ? (String((int)fps) + "fps").c_str() : "unthrottled", mock_camera_frames_captured());
+    rtp_print_report(receiver, true);
+    int status = receiver.frames().empty();
+    if (receiver.largest_packet() > (size_t)RTP_MAX_DATAGRAM) {
+        printf("datagram of %zu bytes is over the %d a 1500 byte MTU takes unfragmented\n",
+            receiver.largest_packet(), RTP_MAX_DATAGRAM);
+        status = 1;
+    }
+    return status;
+}
@@ -0,0 +1,425 @@
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+
+#include "bench_util.h"
+#include "esp_timer.h"
+#include "jpeg_encoder.h"
+#include "rtp_receiver.h"
+
+static const uint8_t RTP_PAYLOAD_JPEG = 26;
+static const uint8_t RTCP_SENDER_REPORT = 200;
+
+static uint16_t read16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t read32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put16(std::vector<uint8_t> &out, uint16_t v)
+{
+    out.push_back(v >> 8);
+    out.push_back(v & 0xFF);
+}
+
+static int bind_udp(uint16_t port)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        return -1;
+    }
+    // Room for a few frames' worth of packets if the receive thread lags
+    int rcvbuf = 4 << 20;
+    setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+static uint16_t bound_port(int sock)
+{
+    struct sockaddr_in addr = {};
+    socklen_t len = sizeof(addr);
+    getsockname(sock, (struct sockaddr *)&addr, &len);
+    return ntohs(addr.sin_port);
+}
+
+// RFC 2435 section 3.1.3 and appendix B: rebuild the headers the sender
+// stripped. The firmware sends its own tables in-band and the OV2640 uses
+// the standard Huffman tables, so the result matches what it captured.
+static void make_jpeg(uint8_t type, uint16_t width, uint16_t height, uint16_t restart,
+    const uint8_t tables[128], const std::vector<uint8_t> &scan, std::vector<uint8_t> &out)
+{
+    out.clear();
+    out.insert(out.end(), {0xFF, 0xD8});
+    out.insert(out.end(), {0xFF, 0xDB});
+    put16(out, 2 + 2 * 65);
+    for (int t = 0; t < 2; t++) {
+        out.push_back(t);
+        out.insert(out.end(), tables + t * 64, tables + t * 64 + 64);
+    }
+    out.insert(out.end(), {0xFF, 0xC0});
+    put16(out, 17);
+    out.push_back(8);
+    put16(out, height);
+    put16(out, width);
+    out.push_back(3);
+    out.insert(out.end(), {1, (uint8_t)((type & 63) == 0 ? 0x21 : 0x22), 0});
+    out.insert(out.end(), {2, 0x11, 1});
+    out.insert(out.end(), {3, 0x11, 1});
+    mock_jpeg_append_std_huffman(out);
+    if (restart) {
+        out.insert(out.end(), {0xFF, 0xDD});
+        put16(out, 4);
+        put16(out, restart);
+    }
+    out.insert(out.end(), {0xFF, 0xDA, 0x00, 0x0C, 3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0});
+    out.insert(out.end(), scan.begin(), scan.end());
+    out.insert(out.end(), {0xFF, 0xD9});
+}
+
+rtp_receiver::rtp_receiver(double loss, bool shared_clock)
+    : loss_(loss), shared_clock_(shared_clock), rng_(2435)
+{
+}
+
+rtp_receiver::~rtp_receiver()
+{
+    stop();
+}
+
+uint16_t rtp_receiver::start(uint16_t port)
+{
+    if (port) {
+        rtp_sock_ = bind_udp(port);
+        rtcp_sock_ = rtp_sock_ >= 0 ? bind_udp(port + 1) : -1;
+    } else {
+        // RTP on an even port with RTCP right above it
+        for (int attempt = 0; attempt < 32 && rtcp_sock_ < 0; attempt++) {
+            if (rtp_sock_ >= 0) {
+                close(rtp_sock_);
+            }
+            rtp_sock_ = bind_udp(0);
+            if (rtp_sock_ < 0) {
+                break;
+            }
+            port = bound_port(rtp_sock_);
+            if (port % 2 == 0 && port < 0xFFFF) {
+                rtcp_sock_ = bind_udp(port + 1);
+            }
+        }
+    }
+    if (rtp_sock_ < 0 || rtcp_sock_ < 0) {
+        stop();
+        return 0;
+    }
+    running_ = true;
+    thread_ = std::thread(&rtp_receiver::run, this);
+    return bound_port(rtp_sock_);
+}
+
+void rtp_receiver::stop()
+{
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (have_frame_) {
+        finish_frame(frame_last_us_);
+    }
+    if (rtp_sock_ >= 0) {
+        close(rtp_sock_);
+        rtp_sock_ = -1;
+    }
+    if (rtcp_sock_ >= 0) {
+        close(rtcp_sock_);
+        rtcp_sock_ = -1;
+    }
+}
+
+void rtp_receiver::save_frames(const std::string &dir, size_t max)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    save_dir_ = dir;
+    save_max_ = max;
+}
+
+void rtp_receiver::run()
+{
+    struct pollfd fds[2] = {{rtp_sock_, POLLIN, 0}, {rtcp_sock_, POLLIN, 0}};
+    uint8_t packet[2048];
+    while (running_) {
+        if (poll(fds, 2, 50) <= 0) {
+            continue;
+        }
+        for (int i = 0; i < 2; i++) {
+            if (!(fds[i].revents & POLLIN)) {
+                continue;
+            }
+            ssize_t len = recv(fds[i].fd, packet, sizeof(packet), MSG_DONTWAIT);
+            if (len <= 0) {
+                continue;
+            }
+            int64_t now = esp_timer_get_time();
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (i == 0) {
+                on_rtp(packet, len, now);
+            } else {
+                on_rtcp(packet, len);
+            }
+        }
+    }
+}
+
+void rtp_receiver::on_rtcp(const uint8_t *data, size_t len)
+{
+    if (len < 28 || (data[0] >> 6) != 2 || data[1] != RTCP_SENDER_REPORT) {
+        return;
+    }
+    uint32_t sec = read32(data + 8);
+    uint32_t frac = read32(data + 12);
+    report_us_ = (int64_t)sec * 1000000 + (((uint64_t)frac * 1000000) >> 32);
+    report_rtp_ = read32(data + 16);
+    have_report_ = true;
+    sender_reports_++;
+}
+
+void rtp_receiver::on_rtp(const uint8_t *data, size_t len, int64_t now)
+{
+    if (len < 20 || (data[0] >> 6) != 2 || (data[1] & 0x7F) != RTP_PAYLOAD_JPEG) {
+        return;
+    }
+    largest_packet_ = std::max(largest_packet_, len);
+    if (loss_ > 0 && std::uniform_real_distribution<double>(0, 1)(rng_) < loss_) {
+        packets_dropped_++;
+        return;
+    }
+    packets_received_++;
+    bool marker = data[1] & 0x80;
+    uint16_t seq = read16(data + 2);
+    uint32_t ts = read32(data + 4);
+
+    if (have_seq_) {
+        int16_t gap = seq - expected_seq_;
+        if (gap > 0) {
+            packets_lost_ += gap;
+        } else if (gap < 0) {
+            return; // late or duplicate, its frame is gone
+        }
+    }
+    have_seq_ = true;
+    expected_seq_ = seq + 1;
+
+    // RFC 3550 interarrival jitter, in RTP timestamp units
+    int64_t transit = now * 9 / 100 - ts;
+    if (have_transit_) {
+        int64_t d = std::abs(transit - last_transit_);
+        jitter_ += (d - jitter_) / 16.0;
+    }
+    have_transit_ = true;
+    last_transit_ = transit;
+
+    if (have_frame_ && ts != frame_ts_) {
+        finish_frame(frame_last_us_);
+    }
+    if (!have_frame_) {
+        have_frame_ = true;
+        frame_ts_ = ts;
+        frame_has_first_ = frame_has_last_ = false;
+        frame_received_ = frame_len_ = 0;
+        frame_scan_.clear();
+    }
+    frame_last_us_ = now;
+
+    const uint8_t *p = data + 12;
+    const uint8_t *end = data + len;
+    uint32_t offset = (p[1] << 16) | (p[2] << 8) | p[3];
+    frame_type_ = p[4];
+    uint8_t q = p[5];
+    frame_width_ = p[6] * 8;
+    frame_height_ = p[7] * 8;
+    p += 8;
+    if (frame_type_ >= 64) {
+        if (end - p < 4) {
+            return;
+        }
+        frame_restart_ = read16(p);
+        p += 4;
+    } else {
+        frame_restart_ = 0;
+    }
+    if (offset == 0 && q >= 128) {
+        if (end - p < 4 || read16(p + 2) != 128 || end - p < 4 + 128) {
+            return;
+        }
+        memcpy(frame_tables_, p + 4, 128);
+        p += 4 + 128;
+        frame_has_first_ = true;
+    }
+    size_t payload = end - p;
+    if (frame_scan_.size() < offset + payload) {
+        frame_scan_.resize(offset + payload);
+    }
+    memcpy(frame_scan_.data() + offset, p, payload);
+    frame_received_ += payload;
+    if (marker) {
+        frame_has_last_ = true;
+        frame_len_ = offset + payload;
+        finish_frame(now);
+    }
+}
+
+void rtp_receiver::finish_frame(int64_t now)
+{
+    have_frame_ = false;
+    bool complete = frame_has_first_ && frame_has_last_ && frame_received_ == frame_len_;
+    if (!complete) {
+        frames_incomplete_++;
+        return;
+    }
+    rtp_frame_record rec = {};
+    rec.timestamp = frame_ts_;
+    rec.received_us = now;
+    if (have_report_) {
+        rec.timed = true;
+        int64_t capture_us = report_us_ + (int64_t)(int32_t)(frame_ts_ - report_rtp_) * 100 / 9;
+        rec.latency_us = now - capture_us;
+    }
+    rec.bytes = frame_len_;
+    rec.width = frame_width_;
+    rec.height = frame_height_;
+    frames_.push_back(rec);
+
+    if (saved_ < save_max_) {
+        std::vector<uint8_t> jpg;
+        make_jpeg(frame_type_, frame_width_, frame_height_, frame_restart_, frame_tables_, frame_scan_, jpg);
+        char path[512];
+        snprintf(path, sizeof(path), "%s/rtp_%04zu.jpg", save_dir_.c_str(), saved_++);
+        FILE *f = fopen(path, "wb");
+        if (f) {
+            fwrite(jpg.data(), 1, jpg.size(), f);
+            fclose(f);
+        }
+    }
+}
+
+std::vector<rtp_frame_record> rtp_receiver::frames() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frames_;
+}
+
+uint32_t rtp_receiver::packets_received() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return packets_received_;
+}
+
+uint32_t rtp_receiver::packets_lost() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return packets_lost_;
+}
+
+uint32_t rtp_receiver::packets_dropped() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return packets_dropped_;
+}
+
+uint32_t rtp_receiver::frames_incomplete() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return frames_incomplete_;
+}
+
+uint32_t rtp_receiver::sender_reports() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sender_reports_;
+}
+
+size_t rtp_receiver::largest_packet() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return largest_packet_;
+}
+
+double rtp_receiver::jitter_ms() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return jitter_ / 90.0;
+}
+
+std::vector<int64_t> rtp_frame_latencies(const std::vector<rtp_frame_record> &frames, bool shared_clock)
+{
+    std::vector<int64_t> latency;
+    for (const rtp_frame_record &rec : frames) {
+        if (rec.timed) {
+            latency.push_back(rec.latency_us);
+        }
+    }
+    if (!shared_clock && !latency.empty()) {
+        int64_t fastest = *std::min_element(latency.begin(), latency.end());
+        for (int64_t &l : latency) {
+            l -= fastest;
+        }
+    }
+    return latency;
+}
+
+void rtp_print_report(const rtp_receiver &receiver, bool shared_clock)
+{
+    std::vector<rtp_frame_record> frames = receiver.frames();
+    uint32_t received = receiver.packets_received();
+    uint32_t lost = receiver.packets_lost();
+    printf("packets: %u received, %u lost (%.2f%%)", received, lost,
+        received + lost ? 100.0 * lost / (received + lost) : 0.0);
+    if (receiver.packets_dropped()) {
+        printf(", %u dropped by simulated loss", receiver.packets_dropped());
+    }
+    printf(", largest %zu bytes\n", receiver.largest_packet());
+    if (frames.empty()) {
+        printf("frames: none complete, %u incomplete\n", receiver.frames_incomplete());
+        return;
+    }
+
+    size_t bytes = 0;
+    std::vector<int64_t> interval;
+    for (size_t f = 0; f < frames.size(); f++) {
+        bytes += frames[f].bytes;
+        if (f > 0) {
+            interval.push_back(frames[f].received_us - frames[f - 1].received_us);
+        }
+    }
+    double elapsed_s = frames.size() > 1 ? (frames.back().received_us - frames.front().received_us) / 1e6 : 0;
+    printf("frames: %zu complete, %u incomplete (%.2f%% lost), %ux%u\n",
+        frames.size(), receiver.frames_incomplete(),
+        100.0 * receiver.frames_incomplete() / (frames.size() + receiver.frames_incomplete()),
+        frames.back().width, frames.back().height);
+    if (elapsed_s > 0) {
+        printf("throughput: %.1f fps, %.1f KB/s JPEG data\n", (frames.size() - 1) / elapsed_s, bytes / elapsed_s / 1024.0);
+    }
+    printf("jitter: %.2fms (RFC 3550), %u sender reports\n", receiver.jitter_ms(), receiver.sender_reports());
+    bench_print_latency(shared_clock ? "capture-to-receive latency" : "latency over fastest frame",
+        rtp_frame_latencies(frames, shared_clock));
+    bench_print_latency("frame interval", interval);
+}
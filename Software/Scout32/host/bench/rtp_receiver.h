@@ -0,0 +1,116 @@
+// An RTP/JPEG (RFC 2435) receiver for the firmware's /rtp sessions.
+//
+// Listens on a UDP port (RTCP on the next one), reassembles frames and
+// keeps the numbers a lossy transport is judged by: packets and frames
+// lost, interarrival jitter and capture-to-receive latency.
+#ifndef RTP_RECEIVER_H
+#define RTP_RECEIVER_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct rtp_frame_record {
+    uint32_t timestamp;   // RTP timestamp, 90kHz
+    int64_t received_us;  // when its last packet arrived
+    bool timed;           // false before the first sender report
+    int64_t latency_us;   // capture to receive, if timed
+    size_t bytes;         // entropy coded data
+    uint16_t width;
+    uint16_t height;
+};
+
+class rtp_receiver {
+public:
+    // `loss` drops that fraction of incoming RTP packets at random, like a
+    // lossy link would. With `shared_clock` the sender reports esp_timer
+    // time on this process' clock, so latency is absolute rather than
+    // relative to the fastest frame.
+    rtp_receiver(double loss = 0, bool shared_clock = false);
+    ~rtp_receiver();
+
+    // Bind `port` and `port` + 1, or a free even/odd pair if `port` is 0.
+    // Returns the RTP port, or 0 on failure.
+    uint16_t start(uint16_t port);
+    void stop();
+
+    // Complete frames rebuilt as JPEG files in `dir`, until `max` written
+    void save_frames(const std::string &dir, size_t max);
+
+    // All counters are read under the receiver's lock
+    std::vector<rtp_frame_record> frames() const;
+    uint32_t packets_received() const;
+    uint32_t packets_lost() const;        // from sequence number gaps
+    uint32_t packets_dropped() const;     // by the simulated loss
+    uint32_t frames_incomplete() const;   // some packets arrived, not all
+    uint32_t sender_reports() const;
+    size_t largest_packet() const;        // RTP datagram, bytes
+    double jitter_ms() const;
+
+private:
+    void run();
+    void on_rtp(const uint8_t *data, size_t len, int64_t now);
+    void on_rtcp(const uint8_t *data, size_t len);
+    void finish_frame(int64_t now);
+
+    int rtp_sock_ = -1;
+    int rtcp_sock_ = -1;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+    mutable std::mutex mutex_;
+
+    double loss_;
+    bool shared_clock_;
+    std::mt19937 rng_;
+
+    // Frame being reassembled
+    bool have_frame_ = false;
+    uint32_t frame_ts_ = 0;
+    bool frame_has_first_ = false;
+    bool frame_has_last_ = false;
+    size_t frame_received_ = 0;
+    size_t frame_len_ = 0;
+    uint8_t frame_type_ = 0;
+    uint16_t frame_width_ = 0;
+    uint16_t frame_height_ = 0;
+    uint16_t frame_restart_ = 0;
+    uint8_t frame_tables_[128];
+    std::vector<uint8_t> frame_scan_;
+    int64_t frame_last_us_ = 0;
+
+    bool have_seq_ = false;
+    uint16_t expected_seq_ = 0;
+    bool have_transit_ = false;
+    int64_t last_transit_ = 0;
+    double jitter_ = 0; // 90kHz units
+
+    bool have_report_ = false;
+    uint32_t report_rtp_ = 0;
+    int64_t report_us_ = 0;
+
+    std::string save_dir_;
+    size_t save_max_ = 0;
+    size_t saved_ = 0;
+
+    std::vector<rtp_frame_record> frames_;
+    uint32_t packets_received_ = 0;
+    uint32_t packets_lost_ = 0;
+    uint32_t packets_dropped_ = 0;
+    uint32_t frames_incomplete_ = 0;
+    uint32_t sender_reports_ = 0;
+    size_t largest_packet_ = 0;
+};
+
+// Latency is only absolute with a shared clock; otherwise make it relative
+// to the fastest frame, i.e. delay variation
+std::vector<int64_t> rtp_frame_latencies(const std::vector<rtp_frame_record> &frames, bool shared_clock);
+
+// Prints frame rate, loss, jitter and latency
+void rtp_print_report(const rtp_receiver &receiver, bool shared_clock);
+
+#endif
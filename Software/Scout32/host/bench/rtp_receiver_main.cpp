@@ -0,0 +1,64 @@
+// Standalone RTP/JPEG receiver.
+//
+// Point the robot at this machine with /rtp?start=1 (the sender defaults
+// to the address the request came from) and this reports what arrived.
+// The robot's clock isn't ours, so latency is given relative to the
+// fastest frame.
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include <chrono>
+#include <thread>
+
+#include "bench_util.h"
+#include "rtp_receiver.h"
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_signal(int)
+{
+    interrupted = 1;
+}
+
+static void usage()
+{
+    printf("usage: scout32_rtp_receiver [options]\n"
+           "  --port N         RTP port, RTCP on N+1 (default 5004)\n"
+           "  --seconds S      how long to listen, 0 = until Ctrl-C (default 10)\n"
+           "  --loss P         drop a fraction P of packets on arrival (default 0)\n"
+           "  --out DIR        write complete frames to DIR as JPEG files\n"
+           "  --save N         at most N frames to write (default 100)\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    uint16_t port = atoi(bench_arg(argc, argv, "--port", "5004"));
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "10"));
+    const char *out = bench_arg(argc, argv, "--out", NULL);
+
+    rtp_receiver receiver(atof(bench_arg(argc, argv, "--loss", "0")));
+    if (out) {
+        mkdir(out, 0755);
+        receiver.save_frames(out, atoi(bench_arg(argc, argv, "--save", "100")));
+    }
+    if (!receiver.start(port)) {
+        perror("bind");
+        return 1;
+    }
+    printf("listening on udp port %u\n", port);
+
+    signal(SIGINT, on_signal);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(seconds);
+    while (!interrupted && (seconds <= 0 || std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    receiver.stop();
+    rtp_print_report(receiver, false);
+    return receiver.frames().empty();
+}
@@ -0,0 +1,374 @@
+// Preview scaling benchmark.
+//
+// Takes "pattern" frames at a few frame sizes and crops and/or scales them
+// the way /stream?scale=&roi= does (jpeg_scale.h, in the DCT domain), and
+// for comparison the obvious way: decode every block to pixels, box filter
+// and encode again. Reports bytes and CPU time per frame for each. Then
+// streams to a full-size and a 1/8 client at once and reports what each
+// received.
+//
+// --dump DIR writes the first source frame and its output for each case,
+// to check by eye.
+//
+// Frames with corrupt headers (an over-full Huffman table, a cut short
+// DRI or SOS segment) must be turned away by the parser; the bench fails
+// if any gets through.
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "buffer_pool.h"
+#include "esp_camera.h"
+#include "jpeg_encoder.h"
+#include "jpeg_reader.h"
+#include "jpeg_scale.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_scale_bench [options]\n"
+           "  --frames N       frames per case (default 20)\n"
+           "  --quality Q      sensor JPEG quality, 0-63 (default 10)\n"
+           "  --seconds S      length of the two-client stream (default 3)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --dump DIR       write each case's output frame to DIR\n");
+}
+
+struct scale_case {
+    const char *name;
+    jpeg_scale_t opts;
+};
+
+static const scale_case cases[] = {
+    {"crop 1/2", {1, 0.25f, 0.25f, 0.5f, 0.5f}},
+    {"scale 1/2", {2, 0, 0, 1, 1}},
+    {"scale 1/4", {4, 0, 0, 1, 1}},
+    {"scale 1/8", {8, 0, 0, 1, 1}},
+    {"crop 1/2 + scale 1/4", {4, 0.25f, 0.25f, 0.5f, 0.5f}},
+};
+
+static const framesize_t sizes[] = {FRAMESIZE_QVGA, FRAMESIZE_VGA, FRAMESIZE_SVGA};
+
+static int64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// The pixel-domain way: full decode (dequantize and 8x8 IDCT every block
+// into YCbCr planes), box filter the crop down, encode from scratch
+static bool pixel_scale(const uint8_t *src, size_t len, const jpeg_scale_t &opts, int quality,
+    std::vector<uint8_t> &out)
+{
+    static jpeg_reader_t jpeg;
+    if (!jpegParse(&jpeg, src, len) || jpeg.ncomps != 3) {
+        return false;
+    }
+    float basis[8][8];
+    for (int x = 0; x < 8; x++) {
+        for (int u = 0; u < 8; u++) {
+            basis[x][u] = (u ? 0.5f : 0.5f * M_SQRT1_2) * cosf((2 * x + 1) * u * M_PI / 16);
+        }
+    }
+    std::vector<uint8_t> planes[3];
+    int plane_w[3];
+    for (int c = 0; c < 3; c++) {
+        plane_w[c] = jpeg.mcus_x * 8 * jpeg.comps[c].h;
+        planes[c].resize(plane_w[c] * jpeg.mcus_y * 8 * jpeg.comps[c].v);
+    }
+    int16_t zz[64];
+    for (int my = 0; my < jpeg.mcus_y; my++) {
+        for (int mx = 0; mx < jpeg.mcus_x; mx++) {
+            if (!jpegStartMcu(&jpeg, my * jpeg.mcus_x + mx)) {
+                return false;
+            }
+            for (int c = 0; c < 3; c++) {
+                jpeg_component_t *comp = &jpeg.comps[c];
+                for (int b = 0; b < comp->h * comp->v; b++) {
+                    if (!jpegDecodeBlock(&jpeg, comp, zz)) {
+                        return false;
+                    }
+                    float coef[64];
+                    for (int k = 0; k < 64; k++) {
+                        coef[jpeg_zigzag[k]] = zz[k] * (float)jpeg.quant[comp->tq][k];
+                    }
+                    float rows[8][8];
+                    for (int v = 0; v < 8; v++) {
+                        for (int x = 0; x < 8; x++) {
+                            float sum = 0;
+                            for (int u = 0; u < 8; u++) {
+                                sum += basis[x][u] * coef[v * 8 + u];
+                            }
+                            rows[v][x] = sum;
+                        }
+                    }
+                    int px = (mx * comp->h + b % comp->h) * 8;
+                    int py = (my * comp->v + b / comp->h) * 8;
+                    for (int y = 0; y < 8; y++) {
+                        for (int x = 0; x < 8; x++) {
+                            float sum = 0;
+                            for (int v = 0; v < 8; v++) {
+                                sum += basis[y][v] * rows[v][x];
+                            }
+                            planes[c][(py + y) * plane_w[c] + px + x] = constrain(lroundf(sum) + 128, 0, 255);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    int s = opts.scale;
+    int x0 = (int)(opts.roi_x * jpeg.width) & ~1;
+    int y0 = (int)(opts.roi_y * jpeg.height);
+    int out_w = std::max(1, (int)(opts.roi_w * jpeg.width) / s);
+    int out_h = std::max(1, (int)(opts.roi_h * jpeg.height) / s);
+    int chroma_w = (out_w + 1) / 2;
+    std::vector<uint8_t> y(out_w * out_h), cb(chroma_w * out_h), cr(chroma_w * out_h);
+    for (int oy = 0; oy < out_h; oy++) {
+        for (int ox = 0; ox < out_w; ox++) {
+            int sum = 0;
+            for (int dy = 0; dy < s; dy++) {
+                for (int dx = 0; dx < s; dx++) {
+                    sum += planes[0][(y0 + oy * s + dy) * plane_w[0] + x0 + ox * s + dx];
+                }
+            }
+            y[oy * out_w + ox] = sum / (s * s);
+        }
+        for (int ox = 0; ox < chroma_w; ox++) {
+            int sum_b = 0, sum_r = 0;
+            for (int dy = 0; dy < s; dy++) {
+                for (int dx = 0; dx < s; dx++) {
+                    int at = (y0 + oy * s + dy) * plane_w[1] + (x0 / 2 + ox * s + dx);
+                    sum_b += planes[1][at];
+                    sum_r += planes[2][at];
+                }
+            }
+            cb[oy * chroma_w + ox] = sum_b / (s * s);
+            cr[oy * chroma_w + ox] = sum_r / (s * s);
+        }
+    }
+    out.clear();
+    mock_jpeg_encode_422(y.data(), cb.data(), cr.data(), out_w, out_h, quality, out);
+    return true;
+}
+
+static void dump(const char *dir, const char *size, const char *name, const uint8_t *data, size_t len)
+{
+    std::string path = std::string(dir) + "/" + size;
+    for (const char *c = name; *c; c++) {
+        if (isalnum((unsigned char)*c)) {
+            path += *c;
+        } else if (path.back() != '-') {
+            path += '-';
+        }
+    }
+    path += ".jpg";
+    FILE *f = fopen(path.c_str(), "wb");
+    if (f) {
+        fwrite(data, 1, len, f);
+        fclose(f);
+    }
+}
+
+// Where the first `marker` segment starts (its 0xFF), or 0 if there isn't one
+static size_t find_segment(const std::vector<uint8_t> &jpg, uint8_t marker)
+{
+    size_t i = 2;
+    while (i + 4 <= jpg.size() && jpg[i] == 0xFF) {
+        if (jpg[i + 1] == marker) {
+            return i;
+        }
+        if (jpg[i + 1] == 0xDA) {
+            break;
+        }
+        i += 2 + ((jpg[i + 2] << 8) | jpg[i + 3]);
+    }
+    return 0;
+}
+
+struct malformed_case {
+    const char *name;
+    std::vector<uint8_t> frame;
+};
+
+// `good` broken in ways a parser that trusts its headers would read or
+// write out of bounds on
+static std::vector<malformed_case> malformed(const std::vector<uint8_t> &good)
+{
+    std::vector<malformed_case> out;
+
+    // Three 1-bit codes, where there is room for two. The symbol count
+    // stays the same, so only the code lengths are wrong.
+    size_t dht = find_segment(good, 0xC4);
+    if (dht) {
+        std::vector<uint8_t> frame = good;
+        uint8_t *counts = &frame[dht + 5];
+        for (int c = 1; c < 16; c++) {
+            if (counts[c] >= 3) {
+                counts[c] -= 3;
+                counts[0] += 3;
+                out.push_back({"DHT over-full", frame});
+                break;
+            }
+        }
+    }
+
+    std::vector<uint8_t> dri = {0xFF, 0xD8, 0xFF, 0xDD, 0x00, 0x02};
+    dri.insert(dri.end(), good.begin() + 2, good.end());
+    out.push_back({"DRI without a body", dri});
+
+    size_t sos = find_segment(good, 0xDA);
+    if (sos) {
+        std::vector<uint8_t> frame = good;
+        frame[sos + 2] = 0;
+        frame[sos + 3] = 3; // the component count and nothing else
+        out.push_back({"SOS cut short", frame});
+    }
+    return out;
+}
+
+// A /stream client that hangs up when told to
+class stop_client : public mjpeg_client {
+public:
+    stop_client() : mjpeg_client(1000000) {}
+
+    esp_err_t on_body(const char *data, size_t len) override
+    {
+        return stop ? ESP_FAIL : mjpeg_client::on_body(data, len);
+    }
+
+    std::atomic<bool> stop{false};
+};
+
+static void report_stream(const char *name, const stop_client &client)
+{
+    size_t bytes = 0;
+    for (const auto &frame : client.frames) {
+        bytes += frame.bytes;
+    }
+    printf("  %-10s %4zu frames, %7.0f B/frame\n", name, client.frames.size(),
+        client.frames.empty() ? 0.0 : (double)bytes / client.frames.size());
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    int frames = atoi(bench_arg(argc, argv, "--frames", "20"));
+    int quality = atoi(bench_arg(argc, argv, "--quality", "10"));
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "3"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    const char *dump_dir = bench_arg(argc, argv, "--dump", NULL);
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    sensor_t *sensor = esp_camera_sensor_get();
+    sensor->set_quality(sensor, quality);
+
+    std::vector<uint8_t> work(POOL_FRAME_BLOCK);
+    std::vector<uint8_t> pixel_out;
+    printf("%-22s %-9s %10s %10s %10s %10s\n", "", "", "DCT B", "DCT us", "pixel B", "pixel us");
+    for (framesize_t size : sizes) {
+        sensor->set_framesize(sensor, size);
+        char size_name[16];
+        snprintf(size_name, sizeof(size_name), "%dx%d", resolution[size].width, resolution[size].height);
+
+        // The source frames, for every case to work on
+        std::vector<std::vector<uint8_t>> source;
+        size_t source_bytes = 0;
+        for (int i = 0; i < frames; i++) {
+            camera_fb_t *fb = esp_camera_fb_get();
+            source.emplace_back(fb->buf, fb->buf + fb->len);
+            source_bytes += fb->len;
+            esp_camera_fb_return(fb);
+        }
+        printf("%-22s %-9s %10zu\n", "full frame", size_name, source_bytes / frames);
+        if (dump_dir) {
+            dump(dump_dir, size_name, " source", source.front().data(), source.front().size());
+        }
+
+        for (const scale_case &c : cases) {
+            size_t dct_bytes = 0, pixel_bytes = 0;
+            int64_t dct_us = 0, pixel_us = 0;
+            int failed = 0;
+            for (const auto &frame : source) {
+                uint8_t *out = NULL;
+                size_t out_len = 0;
+                int64_t start = now_us();
+                bool ok = jpegScale(frame.data(), frame.size(), &c.opts, work.data(), work.size(), &out, &out_len);
+                dct_us += now_us() - start;
+                dct_bytes += out_len;
+                failed += !ok;
+                if (ok && dump_dir && &frame == &source.front()) {
+                    dump(dump_dir, size_name, (std::string(" ") + c.name).c_str(), out, out_len);
+                }
+
+                start = now_us();
+                failed += !pixel_scale(frame.data(), frame.size(), c.opts, quality, pixel_out);
+                pixel_us += now_us() - start;
+                pixel_bytes += pixel_out.size();
+            }
+            printf("%-22s %-9s %10zu %10lld %10zu %10lld%s\n", c.name, size_name,
+                dct_bytes / frames, (long long)(dct_us / frames),
+                pixel_bytes / frames, (long long)(pixel_us / frames),
+                failed ? " (failures)" : "");
+        }
+    }
+
+    int status = 0;
+    sensor->set_framesize(sensor, FRAMESIZE_QVGA);
+    camera_fb_t *fb = esp_camera_fb_get();
+    std::vector<uint8_t> good(fb->buf, fb->buf + fb->len);
+    esp_camera_fb_return(fb);
+    std::vector<malformed_case> bad = malformed(good);
+    int rejected = 0;
+    for (const malformed_case &c : bad) {
+        jpeg_reader_t jpeg;
+        uint8_t *out = NULL;
+        size_t out_len = 0;
+        jpeg_scale_t opts = {2, 0, 0, 1, 1};
+        bool parsed = jpegParse(&jpeg, c.frame.data(), c.frame.size());
+        bool scaled = jpegScale(c.frame.data(), c.frame.size(), &opts, work.data(), work.size(), &out, &out_len);
+        if (parsed || scaled) {
+            printf("malformed frame accepted: %s\n", c.name);
+        } else {
+            rejected++;
+        }
+    }
+    printf("malformed headers: %d of %zu rejected\n", rejected, bad.size());
+    if (bad.size() < 3 || rejected != (int)bad.size()) {
+        status = 1;
+    }
+
+    // A driver at full size and a monitor at 1/8, side by side
+    sensor->set_framesize(sensor, FRAMESIZE_VGA);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    stop_client full, thumb;
+    std::thread full_thread([&full]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", full); });
+    std::thread thumb_thread([&thumb]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream?scale=8", thumb); });
+    std::this_thread::sleep_for(std::chrono::milliseconds((int64_t)(seconds * 1000)));
+    full.stop = true;
+    thumb.stop = true;
+    full_thread.join();
+    thumb_thread.join();
+    printf("stream, 640x480 at %.0ffps:\n", fps);
+    report_stream("/stream", full);
+    report_stream("?scale=8", thumb);
+    return status;
+}
@@ -0,0 +1,116 @@
+// Web server resource benchmark.
+//
+// Boots the firmware, then runs /stream clients while sending /drive
+// commands at a fixed rate. Reports internal RAM (modelled, see the mock
+// esp_heap_caps.h) idle and while streaming, the stack high-water marks of
+// the server and stream sender tasks, and how long /drive took to answer
+// while streams were running.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_server_bench [options]\n"
+           "  --streams N      concurrent /stream clients (default 2)\n"
+           "  --seconds S      how long to stream (default 3)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --drive-hz F     /drive commands a second while streaming (default 50)\n"
+           "  --stream-port P  port /stream is served on (default 80)\n");
+}
+
+// Value of a sample in /metrics text, or -1
+static double metric(const std::string &text, const char *name)
+{
+    std::string key = std::string("\n") + name + " ";
+    size_t pos = text.find(key);
+    return pos == std::string::npos ? -1 : atof(text.c_str() + pos + key.size());
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    int stream_count = atoi(bench_arg(argc, argv, "--streams", "2"));
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "3"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    double drive_hz = atof(bench_arg(argc, argv, "--drive-hz", "50"));
+    uint16_t stream_port = atoi(bench_arg(argc, argv, "--stream-port", "80"));
+
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+    // Let boot-time tasks settle
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    size_t heap_idle = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+
+    std::vector<std::unique_ptr<mjpeg_client>> clients;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < stream_count; i++) {
+        clients.emplace_back(new mjpeg_client((size_t)(seconds * fps)));
+        mjpeg_client *c = clients.back().get();
+        threads.emplace_back([c, stream_port]() { mock_httpd_request(stream_port, HTTP_GET, "/stream", *c); });
+    }
+
+    // Drive at a steady rate while the streams run
+    std::vector<int64_t> drive_latency;
+    size_t heap_streaming = heap_idle;
+    auto period = std::chrono::microseconds((int64_t)(1e6 / drive_hz));
+    auto next = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    auto end = next + std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::duration<double>(seconds * 0.9));
+    while (next < end) {
+        std::this_thread::sleep_until(next);
+        next += period;
+        mock_httpd_client drive;
+        int64_t start = esp_timer_get_time();
+        mock_httpd_request(HTTP_PORT, HTTP_GET, "/drive?forward=50&steer=0", drive);
+        drive_latency.push_back(esp_timer_get_time() - start);
+        heap_streaming = std::min(heap_streaming, heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    mock_httpd_client metrics;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/metrics", metrics);
+
+    printf("%d stream(s) on port %u for %.1fs\n", stream_count, stream_port, seconds);
+    for (int i = 0; i < stream_count; i++) {
+        printf("stream %d: status %s, %zu frames\n", i, clients[i]->status.c_str(), clients[i]->frames.size());
+    }
+    bench_print_latency("/drive while streaming", drive_latency);
+    printf("internal RAM free: %zu B idle, %zu B streaming, %zu B after (model, %zu B budget)\n",
+        heap_idle, heap_streaming, heap_caps_get_free_size(MALLOC_CAP_INTERNAL), MOCK_INTERNAL_HEAP_BYTES);
+    // Host (x86-64) stack use of the same code paths; the firmware sizes
+    // stacks for the ESP32
+    for (uint16_t port : {HTTP_PORT, (uint16_t)(HTTP_PORT + 1)}) {
+        int stack_free = mock_httpd_stack_free(port);
+        if (stack_free >= 0) {
+            printf("httpd task on port %u: %d B stack never used\n", port, stack_free);
+        }
+    }
+    double sender_free = metric(metrics.body, "scout32_stream_sender_stack_free_min_bytes");
+    if (sender_free >= 0) {
+        printf("stream sender tasks: %.0f B stack never used (lowest)\n", sender_free);
+    }
+    return 0;
+}
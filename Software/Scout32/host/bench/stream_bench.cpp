@@ -0,0 +1,177 @@
+// MJPEG throughput benchmark.
+//
+// Boots the firmware, opens /stream on the stream server from one or more
+// clients at once and reports frame rate, throughput and capture-to-client
+// latency for the frames each of them received.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "mjpeg_client.h"
+
+static const uint16_t HTTP_PORT = 80;
+static const uint16_t STREAM_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_stream_bench [options]\n"
+           "  --frames N       frames to receive (default 300)\n"
+           "  --fps F          simulated sensor frame rate, 0 = unthrottled (default 25)\n"
+           "  --source PATH    JPEG file or directory to replay (default serve/loading.jpg)\n"
+           "  --clients N      concurrent /stream clients (default 1)\n"
+           "  --link-kbps K    pace the client like a link of K kbit/s (default unlimited)\n"
+           "  --slow-kbps K    pace the last client at K kbit/s instead\n"
+           "  --no-uart        don't pace Serial output at 115200 baud\n"
+           "  --capture-hz F   also request /capture F times a second while streaming\n"
+           "  --tcp            carry the stream over loopback TCP and count segments\n"
+           "  --nodelay 0|1    set TCP_NODELAY through /config first\n"
+           "  --sndbuf N       set the socket send buffer through /config first\n"
+           "  --metrics        print the firmware's /metrics afterwards\n"
+           "  --serial         echo firmware Serial output to stderr\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    size_t frame_count = atoi(bench_arg(argc, argv, "--frames", "300"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    double link_kbps = atof(bench_arg(argc, argv, "--link-kbps", "0"));
+    const char *source = bench_arg(argc, argv, "--source", NULL);
+
+    if (source && mock_camera_load_frames(source) == 0) {
+        fprintf(stderr, "no JPEG frames found in %s\n", source);
+        return 1;
+    }
+    mock_serial_set_realtime(!bench_flag(argc, argv, "--no-uart"));
+    bench_boot(bench_flag(argc, argv, "--serial"));
+    mock_camera_set_frame_interval_us(fps > 0 ? (int64_t)(1e6 / fps) : 0);
+
+    int client_count = atoi(bench_arg(argc, argv, "--clients", "1"));
+    double slow_kbps = atof(bench_arg(argc, argv, "--slow-kbps", "0"));
+
+    for (const char *option : {"nodelay", "sndbuf"}) {
+        const char *value = bench_arg(argc, argv, (std::string("--") + option).c_str(), NULL);
+        if (value) {
+            mock_httpd_client config;
+            mock_httpd_request(HTTP_PORT, HTTP_GET, (std::string("/config?") + option + "=" + value).c_str(), config);
+        }
+    }
+
+    std::vector<std::unique_ptr<mjpeg_client>> clients;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < client_count; i++) {
+        bool slow = slow_kbps > 0 && i == client_count - 1;
+        clients.emplace_back(new mjpeg_client(frame_count, slow ? slow_kbps : link_kbps));
+        clients.back()->tcp = bench_flag(argc, argv, "--tcp");
+    }
+    uint32_t captured_before = mock_camera_frames_captured();
+    for (auto &client : clients) {
+        mjpeg_client *c = client.get();
+        threads.emplace_back([c]() { mock_httpd_request(STREAM_PORT, HTTP_GET, "/stream", *c); });
+    }
+
+    // Snapshots taken alongside the stream, like the UI's capture link
+    double capture_hz = atof(bench_arg(argc, argv, "--capture-hz", "0"));
+    std::atomic<bool> streaming(true);
+    std::vector<int64_t> capture_latency;
+    std::vector<int64_t> capture_age;
+    int capture_failures = 0;
+    std::thread capturer;
+    if (capture_hz > 0) {
+        capturer = std::thread([&]() {
+            auto period = std::chrono::microseconds((int64_t)(1e6 / capture_hz));
+            auto next = std::chrono::steady_clock::now() + period;
+            while (streaming) {
+                std::this_thread::sleep_until(next);
+                next += period;
+                mock_httpd_client capture;
+                int64_t start = esp_timer_get_time();
+                mock_httpd_request(HTTP_PORT, HTTP_GET, "/capture", capture);
+                capture_latency.push_back(esp_timer_get_time() - start);
+                const char *age = capture.header("X-Frame-Age-Ms");
+                if (capture.status != "200 OK" || capture.body.size() < 4) {
+                    capture_failures++;
+                } else if (age) {
+                    capture_age.push_back(atoll(age) * 1000);
+                }
+            }
+        });
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+    streaming = false;
+    if (capturer.joinable()) {
+        capturer.join();
+    }
+
+    printf("sensor %s, %d client(s), %u frames captured\n",
+        fps > 0 ? (String((int)fps) + "fps").c_str() : "unthrottled",
+        client_count, mock_camera_frames_captured() - captured_before);
+    int status = 0;
+    for (int i = 0; i < client_count; i++) {
+        mjpeg_client &client = *clients[i];
+        printf("\nclient %d%s: status %s\n", i, slow_kbps > 0 && i == client_count - 1 ? " (slow)" : "", client.status.c_str());
+        if (client.frames.size() < 2) {
+            fprintf(stderr, "client %d received %zu frames\n", i, client.frames.size());
+            status = 1;
+            continue;
+        }
+
+        std::vector<int64_t> latency;
+        std::vector<int64_t> interval;
+        size_t payload = 0;
+        for (size_t f = 0; f < client.frames.size(); f++) {
+            const mjpeg_frame_record &rec = client.frames[f];
+            latency.push_back(rec.received_us - rec.capture_us);
+            payload += rec.bytes;
+            if (f > 0) {
+                interval.push_back(rec.received_us - client.frames[f - 1].received_us);
+            }
+        }
+        double elapsed_s = (client.frames.back().received_us - client.first_byte_us) / 1e6;
+        uint32_t skipped = client.frames.back().seq - client.frames.front().seq + 1 - client.frames.size();
+
+        printf("frames: %zu in %.2fs, %u skipped\n", client.frames.size(), elapsed_s, skipped);
+        printf("throughput: %.1f fps, %.1f KB/s payload, %.1f KB/s on the wire\n",
+            client.frames.size() / elapsed_s, payload / elapsed_s / 1024.0, client.wire_bytes / elapsed_s / 1024.0);
+        printf("per frame: %.0f B payload, %.0f B on the wire, %.1f socket writes\n",
+            (double)payload / client.frames.size(),
+            (double)client.wire_bytes / client.frames.size(),
+            (double)client.socket_writes / client.frames.size());
+        if (client.tcp) {
+            printf("tcp: %.1f segments per frame, %.0f B per segment, nodelay %d, sndbuf %s\n",
+                (double)client.tcp_segments / client.frames.size(),
+                (double)client.wire_bytes / client.tcp_segments, client.nodelay,
+                client.sndbuf ? String(client.sndbuf).c_str() : "default");
+        }
+        bench_print_latency("capture-to-client latency", latency);
+        bench_print_latency("frame interval", interval);
+    }
+
+    if (capture_hz > 0) {
+        printf("\n/capture at %.1f Hz: %d failed\n", capture_hz, capture_failures);
+        bench_print_latency("capture request time", capture_latency);
+        bench_print_latency("captured frame age", capture_age);
+    }
+
+    if (bench_flag(argc, argv, "--metrics")) {
+        mock_httpd_client metrics;
+        mock_httpd_request(HTTP_PORT, HTTP_GET, "/metrics", metrics);
+        printf("\n%s", metrics.body.c_str());
+    }
+    return status;
+}
@@ -0,0 +1,154 @@
+// Task layout benchmark.
+//
+// Boots the firmware with one of the task presets (task_config.h), runs
+// /stream clients and a /drive command stream against it, then prints the
+// task report from /metrics: where each task runs, at what priority, its
+// CPU use over the last second and how much of its stack it never used.
+// The host doesn't schedule by core or priority, so the CPU and stack
+// figures are the part to read; the /drive times are for reference.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "bench_util.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "mjpeg_client.h"
+#include "task_config.h"
+
+extern task_preset_t task_preset;
+
+static const uint16_t HTTP_PORT = 80;
+
+static void usage()
+{
+    printf("usage: scout32_task_bench [options]\n"
+           "  --preset NAME    low_latency or max_throughput (default low_latency)\n"
+           "  --streams N      concurrent /stream clients (default 2)\n"
+           "  --seconds S      how long to run (default 4)\n"
+           "  --fps F          simulated sensor frame rate (default 25)\n"
+           "  --drive-hz F     /drive commands a second (default 50)\n");
+}
+
+// Samples of a labelled series in /metrics text, by task
+static std::map<std::string, std::string> task_series(const std::string &text, const char *name)
+{
+    std::map<std::string, std::string> values;
+    std::string key = std::string("\n") + name + "{task=\"";
+    for (size_t pos = text.find(key); pos != std::string::npos; pos = text.find(key, pos + 1)) {
+        size_t start = pos + key.size();
+        size_t quote = text.find('"', start);
+        size_t space = text.find(' ', quote);
+        std::string labels = text.substr(start, space - start);
+        values[text.substr(start, quote - start)] = labels.substr(quote - start) + text.substr(space, text.find('\n', space) - space);
+    }
+    return values;
+}
+
+static std::string field(const std::string &labels, const char *name)
+{
+    std::string key = std::string(name) + "=\"";
+    size_t pos = labels.find(key);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += key.size();
+    return labels.substr(pos, labels.find('"', pos) - pos);
+}
+
+static std::string sample(const std::map<std::string, std::string> &series, const std::string &task)
+{
+    auto it = series.find(task);
+    if (it == series.end()) {
+        return "-";
+    }
+    return it->second.substr(it->second.rfind(' ') + 1);
+}
+
+int main(int argc, char **argv)
+{
+    if (bench_flag(argc, argv, "--help")) {
+        usage();
+        return 0;
+    }
+    std::string preset = bench_arg(argc, argv, "--preset", "low_latency");
+    int stream_count = atoi(bench_arg(argc, argv, "--streams", "2"));
+    double seconds = atof(bench_arg(argc, argv, "--seconds", "4"));
+    double fps = atof(bench_arg(argc, argv, "--fps", "25"));
+    double drive_hz = atof(bench_arg(argc, argv, "--drive-hz", "50"));
+    task_preset = TASK_PRESET_COUNT;
+    for (int i = 0; i < TASK_PRESET_COUNT; i++) {
+        if (preset == taskConfigPresetName((task_preset_t)i)) {
+            task_preset = (task_preset_t)i;
+        }
+    }
+    if (task_preset == TASK_PRESET_COUNT) {
+        usage();
+        return 2;
+    }
+
+    mock_camera_load_frames("pattern");
+    mock_serial_set_realtime(false);
+    bench_boot(false);
+    mock_camera_set_frame_interval_us((int64_t)(1e6 / fps));
+
+    std::vector<std::unique_ptr<mjpeg_client>> clients;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < stream_count; i++) {
+        // Runs past the end of the drive loop so the last sample has them
+        clients.emplace_back(new mjpeg_client((size_t)((seconds + 1) * fps)));
+        mjpeg_client *c = clients.back().get();
+        threads.emplace_back([c]() { mock_httpd_request(HTTP_PORT, HTTP_GET, "/stream", *c); });
+    }
+
+    std::vector<int64_t> drive_latency;
+    auto period = std::chrono::microseconds((int64_t)(1e6 / drive_hz));
+    auto next = std::chrono::steady_clock::now();
+    auto end = next + std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::duration<double>(seconds));
+    while (next < end) {
+        std::this_thread::sleep_until(next);
+        next += period;
+        mock_httpd_client drive;
+        int64_t start = esp_timer_get_time();
+        mock_httpd_request(HTTP_PORT, HTTP_GET, "/drive?forward=50&steer=0", drive);
+        drive_latency.push_back(esp_timer_get_time() - start);
+    }
+    mock_httpd_client metrics;
+    mock_httpd_request(HTTP_PORT, HTTP_GET, "/metrics", metrics);
+    for (std::thread &t : threads) {
+        t.join();
+    }
+
+    printf("preset %s, %d stream(s) for %.1fs\n", preset.c_str(), stream_count, seconds);
+    for (int i = 0; i < stream_count; i++) {
+        printf("stream %d: status %s, %zu frames\n", i, clients[i]->status.c_str(), clients[i]->frames.size());
+    }
+    bench_print_latency("/drive while streaming", drive_latency);
+
+    auto info = task_series(metrics.body, "scout32_task_info");
+    auto cpu = task_series(metrics.body, "scout32_task_cpu_percent");
+    auto stack_free = task_series(metrics.body, "scout32_task_stack_free_bytes");
+    auto stack = task_series(metrics.body, "scout32_task_stack_bytes");
+    printf("%-16s %5s %5s %4s %7s %11s %7s\n", "task", "core", "prio", "n", "cpu %", "stack free", "stack");
+    for (const auto &task : info) {
+        std::string cpu_percent = sample(cpu, task.first);
+        if (cpu_percent != "-") {
+            char buf[16];
+            snprintf(buf, sizeof(buf), "%.2f", atof(cpu_percent.c_str()));
+            cpu_percent = buf;
+        }
+        printf("%-16s %5s %5s %4s %7s %11s %7s\n", task.first.c_str(), field(task.second, "core").c_str(),
+            field(task.second, "priority").c_str(), sample(info, task.first).c_str(), cpu_percent.c_str(),
+            sample(stack_free, task.first).c_str(), sample(stack, task.first).c_str());
+    }
+    printf("(host stacks are x86-64 frames; cpu is of one host core)\n");
+    return 0;
+}
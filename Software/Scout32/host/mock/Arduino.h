@@ -0,0 +1,125 @@
+// Host stand-in for the parts of the Arduino-ESP32 core Scout32 uses.
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+
+#include <algorithm>
+#include <string>
+
+#include "esp32-hal-ledc.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define PROGMEM
+#define IRAM_ATTR
+
+// esp_arduino_version.h: the core the firmware is written against
+#define ESP_ARDUINO_VERSION_MAJOR 3
+#define ESP_ARDUINO_VERSION_MINOR 0
+#define ESP_ARDUINO_VERSION_PATCH 0
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield(void);
+
+// esp32-hal-cpu. 240, 160 or 80 with the radio on; the host doesn't slow down.
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz);
+uint32_t getCpuFrequencyMhz(void);
+
+bool psramFound(void);
+void *ps_malloc(size_t size);
+
+class String {
+public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") {}
+    String(const std::string &s) : s_(s) {}
+    explicit String(int v) : s_(std::to_string(v)) {}
+    explicit String(unsigned int v) : s_(std::to_string(v)) {}
+    explicit String(long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long v) : s_(std::to_string(v)) {}
+
+    const char *c_str() const { return s_.c_str(); }
+    unsigned int length() const { return s_.length(); }
+
+    String &operator+=(const String &o) { s_ += o.s_; return *this; }
+    String &operator+=(const char *o) { s_ += o; return *this; }
+    friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+    friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.s_); }
+    bool operator==(const String &o) const { return s_ == o.s_; }
+
+private:
+    std::string s_;
+};
+
+class Print;
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(const uint8_t *buf, size_t len) = 0;
+
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v) { return printf("%d", v); }
+    size_t print(unsigned int v) { return printf("%u", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+    size_t print(const Printable &x) { return x.printTo(*this); }
+    size_t println() { return print("\r\n"); }
+    template <typename T>
+    size_t println(const T &v) { size_t n = print(v); return n + println(); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// UART0. Output goes to the host's stderr. Writes are paced like the real
+// TX FIFO draining at the configured baud rate, so logging on a hot path
+// costs about what it does on the board.
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud);
+    void end() {}
+    void setDebugOutput(bool enable) { debug_output_ = enable; }
+    void flush();
+    using Print::write;
+    size_t write(const uint8_t *buf, size_t len) override;
+
+private:
+    unsigned long baud_ = 0;
+    bool debug_output_ = false;
+    double fifo_bytes_ = 0;
+    int64_t fifo_updated_us_ = 0;
+};
+
+extern HardwareSerial Serial;
+
+// Host only: where Serial output goes (NULL discards it) and whether writes
+// are paced at the baud rate.
+void mock_serial_set_output(FILE *out);
+void mock_serial_set_realtime(bool realtime);
+
+#endif
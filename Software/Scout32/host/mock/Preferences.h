@@ -0,0 +1,35 @@
+// Host stand-in for the Arduino-ESP32 Preferences library (key-value
+// storage in the NVS flash partition). Values live in memory, and in the
+// file set with mock_nvs_set_path() if there is one, so a host tool can
+// "reboot" by running the firmware again in a new process.
+#ifndef Preferences_h
+#define Preferences_h
+
+#include <stddef.h>
+
+#include <string>
+
+class Preferences {
+public:
+    bool begin(const char *name, bool readOnly = false);
+    void end();
+    size_t putBytes(const char *key, const void *value, size_t len);
+    size_t getBytes(const char *key, void *buf, size_t maxLen);
+    size_t getBytesLength(const char *key);
+    bool remove(const char *key);
+    bool clear();
+
+private:
+    std::string name_;
+    bool open_ = false;
+    bool read_only_ = false;
+};
+
+// Host only: back the store with this file, loading it now. NULL keeps it
+// in memory.
+void mock_nvs_set_path(const char *path);
+
+// Host only: number of writes that reached the store
+unsigned mock_nvs_writes(void);
+
+#endif
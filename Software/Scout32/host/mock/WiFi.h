@@ -0,0 +1,80 @@
+// Host stand-in for the Arduino-ESP32 WiFi library. There is no radio:
+// station connects succeed after a configurable delay, quicker when given
+// the access point's channel and BSSID and quicker again with a static IP,
+// and RSSI is whatever the host tool says it is.
+#ifndef WiFi_h
+#define WiFi_h
+
+#include <stdint.h>
+
+#include "Arduino.h"
+
+typedef enum {
+    WIFI_MODE_NULL = 0,
+    WIFI_MODE_STA,
+    WIFI_MODE_AP,
+    WIFI_MODE_APSTA,
+} wifi_mode_t;
+
+#define WIFI_OFF WIFI_MODE_NULL
+#define WIFI_STA WIFI_MODE_STA
+#define WIFI_AP WIFI_MODE_AP
+#define WIFI_AP_STA WIFI_MODE_APSTA
+
+typedef enum {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL,
+    WL_SCAN_COMPLETED,
+    WL_CONNECTED,
+    WL_CONNECT_FAILED,
+    WL_CONNECTION_LOST,
+    WL_DISCONNECTED
+} wl_status_t;
+
+class IPAddress : public Printable {
+public:
+    IPAddress() : addr_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_{a, b, c, d} {}
+    explicit IPAddress(uint32_t address);
+    uint8_t operator[](int index) const { return addr_[index]; }
+    operator uint32_t() const;
+    bool operator==(const IPAddress &o) const { return (uint32_t)*this == (uint32_t)o; }
+    String toString() const;
+    size_t printTo(Print &p) const override;
+
+private:
+    uint8_t addr_[4];
+};
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t mode);
+    wifi_mode_t getMode();
+    wl_status_t begin(const char *ssid, const char *passphrase = NULL, int32_t channel = 0, const uint8_t *bssid = NULL, bool connect = true);
+    bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+    bool disconnect(bool wifioff = false);
+    wl_status_t status();
+    bool softAP(const char *ssid, const char *passphrase = NULL, int channel = 1, int ssid_hidden = 0, int max_connection = 4);
+    IPAddress localIP();
+    IPAddress gatewayIP();
+    IPAddress subnetMask();
+    IPAddress dnsIP(uint8_t dns_no = 0);
+    IPAddress softAPIP();
+    uint8_t *BSSID();
+    int32_t channel();
+    int8_t RSSI();
+    bool setSleep(bool enable);
+    bool getSleep();
+};
+
+extern WiFiClass WiFi;
+
+// Host only
+void mock_wifi_set_connect_time_ms(uint32_t full_scan_ms, uint32_t fast_ms);
+// Move the access point to another channel (and radio, so a new BSSID).
+// A begin() with the old channel and BSSID then never connects.
+void mock_wifi_move_ap(int32_t channel);
+void mock_wifi_set_rssi(int8_t rssi);
+
+#endif
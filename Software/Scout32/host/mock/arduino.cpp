@@ -0,0 +1,159 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "Arduino.h"
+#include "esp_timer.h"
+
+HardwareSerial Serial;
+
+static FILE *serial_out = stderr;
+static bool serial_realtime = true;
+static std::mutex serial_lock;
+static std::atomic<uint32_t> cpu_mhz(240);
+
+// The ESP32 UART TX FIFO. Writes only block once it is full.
+static const double UART_FIFO_SIZE = 128;
+
+unsigned long millis(void)
+{
+    return (unsigned long)(esp_timer_get_time() / 1000);
+}
+
+unsigned long micros(void)
+{
+    return (unsigned long)esp_timer_get_time();
+}
+
+void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield(void)
+{
+    std::this_thread::yield();
+}
+
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz)
+{
+    if (cpu_freq_mhz != 240 && cpu_freq_mhz != 160 && cpu_freq_mhz != 80) {
+        return false;
+    }
+    cpu_mhz = cpu_freq_mhz;
+    return true;
+}
+
+uint32_t getCpuFrequencyMhz(void)
+{
+    return cpu_mhz;
+}
+
+bool psramFound(void)
+{
+    return true;
+}
+
+void *ps_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char loc_buf[64];
+    char *temp = loc_buf;
+    va_list arg;
+    va_list copy;
+    va_start(arg, format);
+    va_copy(copy, arg);
+    int len = vsnprintf(temp, sizeof(loc_buf), format, copy);
+    va_end(copy);
+    if (len < 0) {
+        va_end(arg);
+        return 0;
+    }
+    if ((size_t)len >= sizeof(loc_buf)) {
+        temp = (char *)malloc(len + 1);
+        if (temp == NULL) {
+            va_end(arg);
+            return 0;
+        }
+        len = vsnprintf(temp, len + 1, format, arg);
+    }
+    va_end(arg);
+    len = write((uint8_t *)temp, len);
+    if (temp != loc_buf) {
+        free(temp);
+    }
+    return len;
+}
+
+void HardwareSerial::begin(unsigned long baud)
+{
+    std::lock_guard<std::mutex> guard(serial_lock);
+    baud_ = baud;
+    fifo_bytes_ = 0;
+    fifo_updated_us_ = esp_timer_get_time();
+}
+
+void HardwareSerial::flush()
+{
+    if (serial_out) {
+        fflush(serial_out);
+    }
+    if (!serial_realtime || baud_ == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(serial_lock);
+    // 10 bits per byte on the wire (start + 8 data + stop)
+    double bytes_per_us = baud_ / 10.0 / 1e6;
+    int64_t now = esp_timer_get_time();
+    fifo_bytes_ = std::max(0.0, fifo_bytes_ - (now - fifo_updated_us_) * bytes_per_us);
+    fifo_updated_us_ = now;
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(fifo_bytes_ / bytes_per_us)));
+    fifo_bytes_ = 0;
+    fifo_updated_us_ = esp_timer_get_time();
+}
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t len)
+{
+    std::lock_guard<std::mutex> guard(serial_lock);
+    if (serial_out) {
+        fwrite(buf, 1, len, serial_out);
+    }
+    if (!serial_realtime || baud_ == 0) {
+        return len;
+    }
+    double bytes_per_us = baud_ / 10.0 / 1e6;
+    int64_t now = esp_timer_get_time();
+    fifo_bytes_ = std::max(0.0, fifo_bytes_ - (now - fifo_updated_us_) * bytes_per_us);
+    fifo_updated_us_ = now;
+    fifo_bytes_ += len;
+    if (fifo_bytes_ > UART_FIFO_SIZE) {
+        // Block until the overflow has drained, like uartWrite() spinning on the FIFO
+        double excess = fifo_bytes_ - UART_FIFO_SIZE;
+        std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(excess / bytes_per_us)));
+        fifo_bytes_ = UART_FIFO_SIZE;
+        fifo_updated_us_ = esp_timer_get_time();
+    }
+    return len;
+}
+
+void mock_serial_set_output(FILE *out)
+{
+    std::lock_guard<std::mutex> guard(serial_lock);
+    serial_out = out;
+}
+
+void mock_serial_set_realtime(bool realtime)
+{
+    std::lock_guard<std::mutex> guard(serial_lock);
+    serial_realtime = realtime;
+}
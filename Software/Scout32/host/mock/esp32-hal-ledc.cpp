@@ -0,0 +1,93 @@
+#include <atomic>
+#include <mutex>
+
+#include "esp32-hal-ledc.h"
+
+static std::atomic<uint32_t> channel_duty[LEDC_CHANNELS];
+static std::atomic<uint32_t> channel_writes[LEDC_CHANNELS];
+static std::atomic<uint32_t> channel_freq[LEDC_CHANNELS];
+static std::atomic<bool> channel_used[LEDC_CHANNELS];
+// One more than the channel each pin is attached to, 0 if none
+static std::atomic<int> pin_channel[LEDC_PINS];
+// The hook and its argument change together, and never while it's running
+static std::mutex write_hook_lock;
+static mock_ledc_write_hook_t write_hook = nullptr;
+static void *write_hook_arg = nullptr;
+
+// -1 if the pin isn't attached
+static int channel_of(uint8_t pin)
+{
+    return pin < LEDC_PINS ? pin_channel[pin].load() - 1 : -1;
+}
+
+bool ledcAttachChannel(uint8_t pin, uint32_t freq, uint8_t resolution, uint8_t channel)
+{
+    if (pin >= LEDC_PINS || channel >= LEDC_CHANNELS || resolution > 20 || pin_channel[pin]) {
+        return false;
+    }
+    channel_used[channel] = true;
+    channel_freq[channel] = freq;
+    channel_duty[channel] = 0;
+    pin_channel[pin] = channel + 1;
+    return true;
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution)
+{
+    for (uint8_t channel = 0; channel < LEDC_CHANNELS; channel++) {
+        if (!channel_used[channel]) {
+            return ledcAttachChannel(pin, freq, resolution, channel);
+        }
+    }
+    return false;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty)
+{
+    int channel = channel_of(pin);
+    if (channel < 0) {
+        return false;
+    }
+    channel_duty[channel] = duty;
+    channel_writes[channel]++;
+    std::lock_guard<std::mutex> guard(write_hook_lock);
+    if (write_hook) {
+        write_hook(channel, duty, write_hook_arg);
+    }
+    return true;
+}
+
+uint32_t ledcRead(uint8_t pin)
+{
+    int channel = channel_of(pin);
+    return channel >= 0 ? channel_duty[channel].load() : 0;
+}
+
+uint32_t ledcReadFreq(uint8_t pin)
+{
+    int channel = channel_of(pin);
+    return channel >= 0 ? channel_freq[channel].load() : 0;
+}
+
+bool ledcDetach(uint8_t pin)
+{
+    int channel = channel_of(pin);
+    if (channel < 0) {
+        return false;
+    }
+    pin_channel[pin] = 0;
+    channel_used[channel] = false;
+    return true;
+}
+
+void mock_ledc_set_write_hook(mock_ledc_write_hook_t hook, void *arg)
+{
+    std::lock_guard<std::mutex> guard(write_hook_lock);
+    write_hook_arg = arg;
+    write_hook = hook;
+}
+
+uint32_t mock_ledc_write_count(uint8_t channel)
+{
+    return channel < LEDC_CHANNELS ? channel_writes[channel].load() : 0;
+}
@@ -0,0 +1,29 @@
+// Host stand-in for the Arduino-ESP32 3.x LEDC (PWM) API, which is keyed
+// by pin: ledcAttach() picks a free channel, ledcAttachChannel() names one.
+// Duty writes are recorded per channel so host tools can see what the
+// firmware would have put on the motor pins.
+#ifndef ESP32_HAL_LEDC_H
+#define ESP32_HAL_LEDC_H
+
+#include <stdint.h>
+
+#define LEDC_CHANNELS 16
+#define LEDC_PINS 40
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcAttachChannel(uint8_t pin, uint32_t freq, uint8_t resolution, uint8_t channel);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+uint32_t ledcRead(uint8_t pin);
+uint32_t ledcReadFreq(uint8_t pin);
+bool ledcDetach(uint8_t pin);
+
+// Host only: called (from the writing thread) after every ledcWrite, with
+// the channel the pin is attached to. Setting the hook waits for any call
+// to the old one to return, so its `arg` can go away as soon as a
+// mock_ledc_set_write_hook(nullptr, nullptr) does; a hook mustn't set the
+// hook itself.
+typedef void (*mock_ledc_write_hook_t)(uint8_t channel, uint32_t duty, void *arg);
+void mock_ledc_set_write_hook(mock_ledc_write_hook_t hook, void *arg);
+uint32_t mock_ledc_write_count(uint8_t channel);
+
+#endif
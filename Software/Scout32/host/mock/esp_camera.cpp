@@ -0,0 +1,619 @@
+#include <dirent.h>
+#include <string.h>
+#include <strings.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "jpeg_encoder.h"
+
+#ifndef SCOUT32_DEFAULT_FRAMES
+#define SCOUT32_DEFAULT_FRAMES "serve/loading.jpg"
+#endif
+
+#define STAMP_PREFIX "SCOUT32 "
+// Same as FB_GET_TIMEOUT in the esp32-camera driver
+static const auto FB_GET_TIMEOUT = std::chrono::milliseconds(4000);
+
+const resolution_info_t resolution[FRAMESIZE_INVALID] = {
+    {   96,   96 },
+    {  160,  120 },
+    {  176,  144 },
+    {  240,  176 },
+    {  240,  240 },
+    {  320,  240 },
+    {  400,  296 },
+    {  480,  320 },
+    {  640,  480 },
+    {  800,  600 },
+    { 1024,  768 },
+    { 1280,  720 },
+    { 1280, 1024 },
+    { 1600, 1200 },
+};
+
+struct mock_frame {
+    std::vector<uint8_t> jpg;
+    size_t width;
+    size_t height;
+};
+
+struct mock_fb {
+    camera_fb_t fb;
+    std::vector<uint8_t> storage;
+    bool in_use;
+};
+
+static std::mutex cam_lock;
+static std::condition_variable cam_cond;
+static std::vector<mock_frame> frames;
+static std::vector<mock_fb> fbs;
+static bool initialised = false;
+static int64_t frame_interval_us = 40000; // OV2640 at QVGA, roughly 25fps
+static int64_t start_us = 0;
+static int64_t last_frame = -1;
+static uint32_t frames_captured = 0;
+static uint32_t sccb_writes = 0;
+// A resize written while a frame is being read out tears that frame. Only
+// the blanking interval just after a frame completes is safe.
+static const double BLANKING_FRACTION = 0.1;
+static int64_t torn_frame = -1;
+static uint32_t torn_frames = 0;
+static bool size_model = false;
+static bool pattern = false;
+// The pattern's box only moves while this is set; its position is counted
+// in frames rendered while moving
+static bool pattern_motion = true;
+static uint32_t init_time_ms = 0;
+static int64_t pattern_position = 0;
+static sensor_t sensor;
+// Software standby (COM2 bit 4): no frames until it's released, and then
+// the first one a frame period later
+static bool standby = false;
+
+
+static bool jpeg_dimensions(const std::vector<uint8_t> &jpg, size_t *width, size_t *height)
+{
+    size_t i = 2;
+    while (i + 9 < jpg.size() && jpg[i] == 0xFF) {
+        uint8_t marker = jpg[i + 1];
+        size_t seg_len = (jpg[i + 2] << 8) | jpg[i + 3];
+        // Any SOF marker (baseline, extended, progressive...)
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) {
+            *height = (jpg[i + 5] << 8) | jpg[i + 6];
+            *width = (jpg[i + 7] << 8) | jpg[i + 8];
+            return true;
+        }
+        if (marker == 0xDA) {
+            break;
+        }
+        i += 2 + seg_len;
+    }
+    return false;
+}
+
+static bool load_file(const std::string &path)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    mock_frame frame;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        frame.jpg.insert(frame.jpg.end(), buf, buf + n);
+    }
+    fclose(f);
+    if (frame.jpg.size() < 4 || frame.jpg[0] != 0xFF || frame.jpg[1] != 0xD8) {
+        return false;
+    }
+    if (!jpeg_dimensions(frame.jpg, &frame.width, &frame.height)) {
+        frame.width = resolution[FRAMESIZE_QVGA].width;
+        frame.height = resolution[FRAMESIZE_QVGA].height;
+    }
+    frames.push_back(std::move(frame));
+    return true;
+}
+
+static bool is_jpeg_name(const char *name)
+{
+    const char *ext = strrchr(name, '.');
+    return ext && (strcasecmp(ext, ".jpg") == 0 || strcasecmp(ext, ".jpeg") == 0);
+}
+
+// Synthesised scene: a textured gradient with sensor noise and a box
+// sliding across it, so consecutive frames differ the way a real view does.
+// `cb` and `cr` are horizontally subsampled, as the sensor's 4:2:2 output.
+static void render_planes(int64_t index, int64_t position, int width, int height,
+    std::vector<uint8_t> &y, std::vector<uint8_t> &cb, std::vector<uint8_t> &cr)
+{
+    int chroma_width = (width + 1) / 2;
+    y.resize(width * height);
+    cb.resize(chroma_width * height);
+    cr.resize(chroma_width * height);
+    int box = std::max(8, width / 5);
+    int box_x = (int)(position * 4 % (width + box)) - box;
+    int box_y = (height - box) / 2;
+    uint32_t noise = (uint32_t)index * 2654435761u;
+    for (int py = 0; py < height; py++) {
+        for (int px = 0; px < width; px++) {
+            noise = noise * 1664525u + 1013904223u;
+            bool in_box = px >= box_x && px < box_x + box && py >= box_y && py < box_y + box;
+            int value = in_box ? 210 : 50 + px * 100 / width + (int)(18 * sinf(px * 0.35f) * sinf(py * 0.27f));
+            value += (int)(noise >> 29) - 4; // +-4 of sensor noise
+            y[py * width + px] = (uint8_t)std::min(255, std::max(0, value));
+            if ((px & 1) == 0) {
+                cb[py * chroma_width + px / 2] = in_box ? 90 : (uint8_t)(108 + py * 40 / height);
+                cr[py * chroma_width + px / 2] = in_box ? 180 : (uint8_t)(128 + 10 * sinf(px * 0.05f));
+            }
+        }
+    }
+}
+
+// The scene as a JPEG frame, or just its luma for PIXFORMAT_GRAYSCALE
+static void render_pattern(int64_t index, int64_t position, int width, int height, int quality, bool grayscale,
+    std::vector<uint8_t> &out)
+{
+    thread_local std::vector<uint8_t> y, cb, cr;
+    render_planes(index, position, width, height, y, cb, cr);
+    if (grayscale) {
+        out = y;
+    } else {
+        mock_jpeg_encode_422(y.data(), cb.data(), cr.data(), width, height, quality, out);
+    }
+}
+
+int mock_camera_load_frames(const char *path)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    if (strcmp(path, "pattern") == 0) {
+        pattern = true;
+        return 1;
+    }
+    size_t before = frames.size();
+    DIR *dir = opendir(path);
+    if (dir) {
+        std::vector<std::string> names;
+        struct dirent *ent;
+        while ((ent = readdir(dir)) != NULL) {
+            if (is_jpeg_name(ent->d_name)) {
+                names.push_back(ent->d_name);
+            }
+        }
+        closedir(dir);
+        std::sort(names.begin(), names.end());
+        for (const std::string &name : names) {
+            load_file(std::string(path) + "/" + name);
+        }
+    } else {
+        load_file(path);
+    }
+    return (int)(frames.size() - before);
+}
+
+void mock_camera_set_pattern_motion(bool moving)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    pattern_motion = moving;
+}
+
+void mock_camera_set_frame_interval_us(int64_t interval_us)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    frame_interval_us = interval_us;
+    start_us = esp_timer_get_time();
+    last_frame = -1;
+}
+
+bool mock_camera_standby(void)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    return standby;
+}
+
+uint32_t mock_camera_frames_captured(void)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    return frames_captured;
+}
+
+void mock_camera_set_size_model(bool enabled)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    size_model = enabled;
+}
+
+// Bytes an OV2640 JPEG of this frame would take at the sensor's current
+// frame size and quality: scales with pixel count, and roughly linearly
+// from 100% at quality 10 down to 15% at the bottom of the range.
+static size_t modelled_size(const mock_frame &frame, size_t *width, size_t *height)
+{
+    const resolution_info_t &res = resolution[sensor.status.framesize];
+    *width = res.width;
+    *height = res.height;
+    double pixels = (double)(res.width * res.height) / (frame.width * frame.height);
+    double quality = std::min(1.0, std::max(0.15, (64.0 - sensor.status.quality) / 54.0));
+    return (size_t)(frame.jpg.size() * pixels * quality);
+}
+
+uint32_t mock_camera_torn_frames(void)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    return torn_frames;
+}
+
+uint32_t mock_camera_sccb_writes(void)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    return sccb_writes;
+}
+
+bool mock_camera_parse_stamp(const uint8_t *jpg, size_t len, uint32_t *seq, int64_t *capture_us)
+{
+    if (len < 6 || jpg[0] != 0xFF || jpg[1] != 0xD8 || jpg[2] != 0xFF || jpg[3] != 0xFE) {
+        return false;
+    }
+    size_t seg_len = (jpg[4] << 8) | jpg[5];
+    if (seg_len < 2 || 4 + seg_len > len) {
+        return false;
+    }
+    std::string text((const char *)jpg + 6, seg_len - 2);
+    unsigned int s;
+    long long t;
+    if (sscanf(text.c_str(), STAMP_PREFIX "seq=%u t=%lld", &s, &t) != 2) {
+        return false;
+    }
+    *seq = s;
+    *capture_us = t;
+    return true;
+}
+
+
+// Sensor setters: record the value and count the register writes
+static int count_write(sensor_t *s)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    sccb_writes++;
+    return 0;
+}
+#define SETTER(name, field, type)                       \
+    static int name(sensor_t *s, type value) {          \
+        s->status.field = value;                        \
+        return count_write(s);                          \
+    }
+SETTER(set_contrast, contrast, int)
+SETTER(set_brightness, brightness, int)
+SETTER(set_saturation, saturation, int)
+SETTER(set_sharpness, sharpness, int)
+SETTER(set_denoise, denoise, int)
+SETTER(set_gainceiling, gainceiling, gainceiling_t)
+SETTER(set_quality, quality, int)
+SETTER(set_colorbar, colorbar, int)
+SETTER(set_whitebal, awb, int)
+SETTER(set_gain_ctrl, agc, int)
+SETTER(set_exposure_ctrl, aec, int)
+SETTER(set_hmirror, hmirror, int)
+SETTER(set_vflip, vflip, int)
+SETTER(set_aec2, aec2, int)
+SETTER(set_awb_gain, awb_gain, int)
+SETTER(set_agc_gain, agc_gain, int)
+SETTER(set_aec_value, aec_value, int)
+SETTER(set_special_effect, special_effect, int)
+SETTER(set_wb_mode, wb_mode, int)
+SETTER(set_ae_level, ae_level, int)
+SETTER(set_dcw, dcw, int)
+SETTER(set_bpc, bpc, int)
+SETTER(set_wpc, wpc, int)
+SETTER(set_raw_gma, raw_gma, int)
+SETTER(set_lenc, lenc, int)
+#undef SETTER
+
+static int set_framesize(sensor_t *s, framesize_t framesize)
+{
+    if (framesize >= FRAMESIZE_INVALID) {
+        return -1;
+    }
+    s->status.framesize = framesize;
+    {
+        std::lock_guard<std::mutex> guard(cam_lock);
+        int64_t since_start = esp_timer_get_time() - start_us;
+        if (initialised && frame_interval_us > 0 && since_start % frame_interval_us > frame_interval_us * BLANKING_FRACTION) {
+            torn_frame = since_start / frame_interval_us + 1;
+        }
+    }
+    // The OV2640 driver rewrites the whole window/scaler block for a resize
+    for (int i = 0; i < 20; i++) {
+        count_write(s);
+    }
+    return 0;
+}
+
+static int set_pixformat(sensor_t *s, pixformat_t pixformat)
+{
+    s->pixformat = pixformat;
+    return count_write(s);
+}
+
+static int reset(sensor_t *s)
+{
+    return count_write(s);
+}
+
+static int init_status(sensor_t *s)
+{
+    return 0;
+}
+
+static int get_reg(sensor_t *s, int reg, int mask)
+{
+    return 0;
+}
+
+static int set_reg(sensor_t *s, int reg, int mask, int value)
+{
+    if (reg == 0x109 && (mask & 0x10)) {
+        std::lock_guard<std::mutex> guard(cam_lock);
+        bool now_standby = value & 0x10;
+        if (standby && !now_standby) {
+            start_us = esp_timer_get_time() + frame_interval_us;
+            last_frame = -1;
+        }
+        standby = now_standby;
+        cam_cond.notify_all();
+    }
+    return count_write(s);
+}
+
+
+void mock_camera_set_init_time_ms(uint32_t ms)
+{
+    init_time_ms = ms;
+}
+
+esp_err_t esp_camera_init(const camera_config_t *config)
+{
+    if (init_time_ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(init_time_ms));
+    }
+    if (frames.empty() && !pattern) {
+        const char *env = getenv("SCOUT32_FRAMES");
+        if (!(env && mock_camera_load_frames(env) > 0)) {
+            mock_camera_load_frames(SCOUT32_DEFAULT_FRAMES);
+        }
+    }
+    std::lock_guard<std::mutex> guard(cam_lock);
+    if (initialised) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if ((frames.empty() && !pattern) || config->fb_count < 1) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    size_t largest = 0;
+    for (const mock_frame &frame : frames) {
+        largest = std::max(largest, frame.jpg.size());
+    }
+    fbs.assign(config->fb_count, mock_fb());
+    for (mock_fb &fb : fbs) {
+        // Room for the stamp segment
+        fb.storage.resize(largest + 64);
+        fb.in_use = false;
+    }
+
+    memset(&sensor, 0, sizeof(sensor));
+    sensor.id.PID = 0x26; // OV2640
+    sensor.slv_addr = 0x30;
+    sensor.pixformat = config->pixel_format;
+    sensor.xclk_freq_hz = config->xclk_freq_hz;
+    sensor.status.framesize = config->frame_size;
+    sensor.status.quality = config->jpeg_quality;
+    sensor.status.awb = 1;
+    sensor.status.awb_gain = 1;
+    sensor.status.aec = 1;
+    sensor.status.agc = 1;
+    sensor.status.bpc = 0;
+    sensor.status.wpc = 1;
+    sensor.status.raw_gma = 1;
+    sensor.status.lenc = 1;
+    sensor.status.dcw = 1;
+    sensor.init_status = init_status;
+    sensor.reset = reset;
+    sensor.set_pixformat = set_pixformat;
+    sensor.set_framesize = set_framesize;
+    sensor.set_contrast = set_contrast;
+    sensor.set_brightness = set_brightness;
+    sensor.set_saturation = set_saturation;
+    sensor.set_sharpness = set_sharpness;
+    sensor.set_denoise = set_denoise;
+    sensor.set_gainceiling = set_gainceiling;
+    sensor.set_quality = set_quality;
+    sensor.set_colorbar = set_colorbar;
+    sensor.set_whitebal = set_whitebal;
+    sensor.set_gain_ctrl = set_gain_ctrl;
+    sensor.set_exposure_ctrl = set_exposure_ctrl;
+    sensor.set_hmirror = set_hmirror;
+    sensor.set_vflip = set_vflip;
+    sensor.set_aec2 = set_aec2;
+    sensor.set_awb_gain = set_awb_gain;
+    sensor.set_agc_gain = set_agc_gain;
+    sensor.set_aec_value = set_aec_value;
+    sensor.set_special_effect = set_special_effect;
+    sensor.set_wb_mode = set_wb_mode;
+    sensor.set_ae_level = set_ae_level;
+    sensor.set_dcw = set_dcw;
+    sensor.set_bpc = set_bpc;
+    sensor.set_wpc = set_wpc;
+    sensor.set_raw_gma = set_raw_gma;
+    sensor.set_lenc = set_lenc;
+    sensor.get_reg = get_reg;
+    sensor.set_reg = set_reg;
+
+    start_us = esp_timer_get_time();
+    standby = false;
+    last_frame = -1;
+    initialised = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_deinit(void)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    if (!initialised) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    initialised = false;
+    fbs.clear();
+    return ESP_OK;
+}
+
+camera_fb_t *esp_camera_fb_get(void)
+{
+    std::unique_lock<std::mutex> guard(cam_lock);
+    if (!initialised) {
+        return NULL;
+    }
+
+    mock_fb *slot = NULL;
+    auto free_slot = [&slot]() {
+        if (standby) {
+            return false;
+        }
+        for (mock_fb &fb : fbs) {
+            if (!fb.in_use) {
+                slot = &fb;
+                return true;
+            }
+        }
+        return false;
+    };
+    if (!cam_cond.wait_for(guard, FB_GET_TIMEOUT, free_slot)) {
+        guard.unlock();
+        Serial.println("Failed to get the frame on time!");
+        return NULL;
+    }
+    slot->in_use = true;
+
+    // The sensor runs continuously: hand out the most recently completed
+    // frame, or wait for the next one if that was already taken.
+    int64_t now = esp_timer_get_time();
+    int64_t index = last_frame + 1;
+    int64_t capture_us = now;
+    if (frame_interval_us > 0) {
+        int64_t completed = (now - start_us) / frame_interval_us;
+        index = std::max(index, completed);
+        capture_us = start_us + index * frame_interval_us;
+    }
+    last_frame = index;
+    uint32_t seq = frames_captured++;
+    size_t width, height, body_len;
+    const uint8_t *src;
+    size_t src_len;
+    thread_local std::vector<uint8_t> rendered;
+    bool grayscale = pattern && sensor.pixformat == PIXFORMAT_GRAYSCALE;
+    if (pattern) {
+        const resolution_info_t &res = resolution[sensor.status.framesize];
+        int quality = sensor.status.quality;
+        int64_t position = pattern_motion ? pattern_position++ : pattern_position;
+        guard.unlock();
+        width = res.width;
+        height = res.height;
+        render_pattern(index, position, width, height, quality, grayscale, rendered);
+        src = rendered.data();
+        src_len = rendered.size();
+        body_len = src_len - 2;
+        if (slot->storage.size() < src_len + 64) {
+            slot->storage.resize(src_len + 64);
+        }
+    } else {
+        const mock_frame &frame = frames[index % frames.size()];
+        width = frame.width;
+        height = frame.height;
+        src = frame.jpg.data();
+        src_len = frame.jpg.size();
+        body_len = src_len - 2;
+        if (size_model) {
+            body_len = std::min(body_len, std::max((size_t)64, modelled_size(frame, &width, &height)));
+        }
+        guard.unlock();
+    }
+    // Rendering the pattern took some of the wait
+    now = esp_timer_get_time();
+    if (capture_us > now) {
+        std::this_thread::sleep_for(std::chrono::microseconds(capture_us - now));
+    }
+    guard.lock();
+    bool torn = index == torn_frame;
+    torn_frames += torn;
+    guard.unlock();
+    if (torn) {
+        // The rest of the frame never arrives
+        body_len = std::max((size_t)64, body_len / 2);
+    }
+
+    camera_fb_t *fb = &slot->fb;
+    if (grayscale) {
+        // Raw pixels have nowhere to carry a stamp
+        memcpy(slot->storage.data(), src, src_len);
+        fb->buf = slot->storage.data();
+        fb->len = src_len;
+        fb->width = width;
+        fb->height = height;
+        fb->format = PIXFORMAT_GRAYSCALE;
+        fb->timestamp.tv_sec = capture_us / 1000000;
+        fb->timestamp.tv_usec = capture_us % 1000000;
+        return fb;
+    }
+
+    // SOI, then our COM segment, then the rest of the file
+    char stamp[48];
+    int stamp_len = snprintf(stamp, sizeof(stamp), STAMP_PREFIX "seq=%u t=%lld", seq, (long long)capture_us);
+    uint8_t *out = slot->storage.data();
+    out[0] = 0xFF;
+    out[1] = 0xD8;
+    out[2] = 0xFF;
+    out[3] = 0xFE;
+    out[4] = (stamp_len + 2) >> 8;
+    out[5] = (stamp_len + 2) & 0xFF;
+    memcpy(out + 6, stamp, stamp_len);
+    memcpy(out + 6 + stamp_len, src + 2, body_len);
+    if (body_len < src_len - 2) {
+        // Cut short by the size model or a tear: still end with EOI
+        out[6 + stamp_len + body_len - 2] = 0xFF;
+        out[6 + stamp_len + body_len - 1] = 0xD9;
+    }
+
+    fb->buf = out;
+    fb->len = body_len + 6 + stamp_len;
+    fb->width = width;
+    fb->height = height;
+    fb->format = PIXFORMAT_JPEG;
+    fb->timestamp.tv_sec = capture_us / 1000000;
+    fb->timestamp.tv_usec = capture_us % 1000000;
+    return fb;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    for (mock_fb &slot : fbs) {
+        if (&slot.fb == fb) {
+            slot.in_use = false;
+        }
+    }
+    cam_cond.notify_all();
+}
+
+sensor_t *esp_camera_sensor_get(void)
+{
+    std::lock_guard<std::mutex> guard(cam_lock);
+    return initialised ? &sensor : NULL;
+}
@@ -0,0 +1,128 @@
+// Host stand-in for esp32-camera's esp_camera.h.
+//
+// Instead of a sensor this replays JPEG files from disk. Each frame handed
+// out by esp_camera_fb_get() is a real JPEG with a COM segment inserted
+// after SOI carrying the mock sequence number and capture time, so host
+// tools can measure capture-to-client latency on the far side of whatever
+// transport the firmware uses.
+#ifndef ESP_CAMERA_H
+#define ESP_CAMERA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+#include "esp_err.h"
+#include "sensor.h"
+
+typedef enum {
+    LEDC_TIMER_0,
+    LEDC_TIMER_1,
+    LEDC_TIMER_2,
+    LEDC_TIMER_3,
+} ledc_timer_t;
+
+typedef enum {
+    LEDC_CHANNEL_0,
+    LEDC_CHANNEL_1,
+    LEDC_CHANNEL_2,
+    LEDC_CHANNEL_3,
+    LEDC_CHANNEL_4,
+    LEDC_CHANNEL_5,
+    LEDC_CHANNEL_6,
+    LEDC_CHANNEL_7,
+} ledc_channel_t;
+
+typedef struct {
+    int pin_pwdn;
+    int pin_reset;
+    int pin_xclk;
+    int pin_sscb_sda;
+    int pin_sscb_scl;
+    int pin_d7;
+    int pin_d6;
+    int pin_d5;
+    int pin_d4;
+    int pin_d3;
+    int pin_d2;
+    int pin_d1;
+    int pin_d0;
+    int pin_vsync;
+    int pin_href;
+    int pin_pclk;
+
+    int xclk_freq_hz;
+    ledc_timer_t ledc_timer;
+    ledc_channel_t ledc_channel;
+
+    pixformat_t pixel_format;
+    framesize_t frame_size;
+    int jpeg_quality;
+    size_t fb_count;
+} camera_config_t;
+
+typedef struct {
+    uint8_t *buf;
+    size_t len;
+    size_t width;
+    size_t height;
+    pixformat_t format;
+    struct timeval timestamp;
+} camera_fb_t;
+
+esp_err_t esp_camera_init(const camera_config_t *config);
+esp_err_t esp_camera_deinit(void);
+camera_fb_t *esp_camera_fb_get(void);
+void esp_camera_fb_return(camera_fb_t *fb);
+sensor_t *esp_camera_sensor_get(void);
+
+// Host only ---------------------------------------------------------------
+
+// Load replay frames from a JPEG file or a directory of them. Returns the
+// number of frames loaded. If nothing is loaded before esp_camera_init(),
+// $SCOUT32_FRAMES and then the sketch's serve/loading.jpg are tried.
+//
+// The path "pattern" instead synthesises every frame: a moving scene
+// encoded as baseline 4:2:2 JPEG, like the OV2640's output, at the
+// sensor's current frame size and quality. With the sensor's pixformat set
+// to PIXFORMAT_GRAYSCALE the frames are raw 8-bit luma instead, for
+// exercising the firmware's JPEG conversion paths.
+int mock_camera_load_frames(const char *path);
+
+// Stop or restart the "pattern" scene's moving box. Stopped, consecutive
+// frames differ only by sensor noise, like a parked rover's view.
+void mock_camera_set_pattern_motion(bool moving);
+
+// How long esp_camera_init() takes: probing the sensor over SCCB, loading
+// its register tables and allocating frame buffers. 0 by default.
+void mock_camera_set_init_time_ms(uint32_t ms);
+
+// Simulated sensor frame period. 0 means frames are produced on demand.
+void mock_camera_set_frame_interval_us(int64_t interval_us);
+
+// Scale frame sizes with the sensor's frame size and JPEG quality, as the
+// real encoder would. Frames are truncated (and re-terminated with EOI) to
+// the modelled size, so only use this where the byte count matters and the
+// image doesn't. Off by default: frames are replayed unchanged.
+void mock_camera_set_size_model(bool enabled);
+
+// Whether the sensor is in software standby. esp_camera_fb_get() waits
+// for it to be released, up to the driver's timeout.
+bool mock_camera_standby(void);
+
+// Number of frames esp_camera_fb_get() has handed out.
+uint32_t mock_camera_frames_captured(void);
+
+// Number of register writes the sensor setters would have made over SCCB.
+uint32_t mock_camera_sccb_writes(void);
+
+// Number of frames torn by a frame size change written mid-frame (outside
+// the blanking interval after a frame completes). A torn JPEG frame is cut
+// short, ending with EOI.
+uint32_t mock_camera_torn_frames(void);
+
+// Recover the stamp written by the mock camera from a JPEG it produced.
+// Returns false if the frame does not carry one.
+bool mock_camera_parse_stamp(const uint8_t *jpg, size_t len, uint32_t *seq, int64_t *capture_us);
+
+#endif
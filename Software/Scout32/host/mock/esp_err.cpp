@@ -0,0 +1,26 @@
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_HTTPD_HANDLERS_FULL: return "ESP_ERR_HTTPD_HANDLERS_FULL";
+    case ESP_ERR_HTTPD_HANDLER_EXISTS: return "ESP_ERR_HTTPD_HANDLER_EXISTS";
+    case ESP_ERR_HTTPD_INVALID_REQ: return "ESP_ERR_HTTPD_INVALID_REQ";
+    case ESP_ERR_HTTPD_RESULT_TRUNC: return "ESP_ERR_HTTPD_RESULT_TRUNC";
+    case ESP_ERR_HTTPD_RESP_HDR: return "ESP_ERR_HTTPD_RESP_HDR";
+    case ESP_ERR_HTTPD_RESP_SEND: return "ESP_ERR_HTTPD_RESP_SEND";
+    case ESP_ERR_HTTPD_ALLOC_MEM: return "ESP_ERR_HTTPD_ALLOC_MEM";
+    case ESP_ERR_HTTPD_TASK: return "ESP_ERR_HTTPD_TASK";
+    }
+    return "UNKNOWN ERROR";
+}
@@ -0,0 +1,88 @@
+#include <stdlib.h>
+
+#include <atomic>
+
+#include "esp_heap_caps.h"
+
+struct mock_heap {
+    size_t budget;
+    std::atomic<int64_t> used;
+    std::atomic<int64_t> peak;
+};
+
+static mock_heap internal = {MOCK_INTERNAL_HEAP_BYTES, {0}, {0}};
+static mock_heap psram = {MOCK_PSRAM_HEAP_BYTES, {0}, {0}};
+static std::atomic<uint64_t> allocations(0);
+
+// Each block remembers its size and heap so heap_caps_free() can refund it
+struct alignas(16) block_header {
+    size_t size;
+    uint32_t caps;
+};
+
+static mock_heap &heap_for(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? psram : internal;
+}
+
+void mock_heap_charge(int64_t bytes, uint32_t caps)
+{
+    mock_heap &heap = heap_for(caps);
+    int64_t used = heap.used += bytes;
+    int64_t peak = heap.peak;
+    while (used > peak && !heap.peak.compare_exchange_weak(peak, used)) {
+    }
+}
+
+void mock_heap_note_allocation(void)
+{
+    allocations++;
+}
+
+uint64_t mock_heap_allocations(void)
+{
+    return allocations;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    allocations++;
+    if (size > heap_caps_get_free_size(caps)) {
+        return NULL;
+    }
+    block_header *header = (block_header *)malloc(sizeof(block_header) + size);
+    if (!header) {
+        return NULL;
+    }
+    header->size = size;
+    header->caps = caps;
+    mock_heap_charge(size, caps);
+    return header + 1;
+}
+
+void heap_caps_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    block_header *header = (block_header *)ptr - 1;
+    mock_heap_charge(-(int64_t)header->size, header->caps);
+    free(header);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    mock_heap &heap = heap_for(caps);
+    return heap.budget - heap.used;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    mock_heap &heap = heap_for(caps);
+    return heap.budget - heap.peak;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
@@ -0,0 +1,42 @@
+// Host stand-in for ESP-IDF's esp_heap_caps.h.
+//
+// The host heap says nothing about the ESP32's internal RAM, so this is a
+// model: a fixed budget for what's left once WiFi and the camera driver are
+// up, less the long-lived allocations the mocks know the size of on the
+// device (task stacks and TCBs, httpd server instances) and whatever the
+// firmware takes through heap_caps_malloc(). Plain malloc() is not counted.
+// PSRAM is modelled the same way. Neither models fragmentation: the largest
+// free block is always everything that's free.
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+// Free internal RAM on an AI-Thinker ESP32-CAM after WiFi and camera init
+const size_t MOCK_INTERNAL_HEAP_BYTES = 160 * 1024;
+// Its 4 MB PSRAM, less the camera's frame buffers
+const size_t MOCK_PSRAM_HEAP_BYTES = 4 * 1024 * 1024 - 2 * 96 * 1024;
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+
+// Record a modelled allocation (negative to free it)
+void mock_heap_charge(int64_t bytes, uint32_t caps = MALLOC_CAP_INTERNAL);
+
+// Count an allocation a mock makes with plain malloc() where the device
+// library would take it from the heap (frame2jpg()'s output buffer)
+void mock_heap_note_allocation(void);
+
+// Number of heap allocations so far, noted or through heap_caps_malloc()
+uint64_t mock_heap_allocations(void);
+
+#endif
@@ -0,0 +1,1175 @@
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <linux/tcp.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp_heap_caps.h"
+#include "esp_http_server.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "mock_httpd.h"
+
+struct mock_server {
+    httpd_config_t config;
+    std::vector<httpd_uri_t> handlers;
+    std::vector<std::string> uris; // owned copies of handlers[i].uri
+    size_t heap_bytes;
+    // The server's one task runs every handler, so a handler that doesn't
+    // return holds up every other request to this server, as on the device
+    TaskHandle_t task;
+    std::mutex jobs_lock;
+    std::condition_variable jobs_cond;
+    std::deque<std::function<void()>> jobs;
+    bool stopping;
+    bool stopped;
+};
+
+struct mock_ws_session {
+    mock_server *server;
+    httpd_uri_t handler;
+    int fd;
+    mock_httpd_client *client;
+    void *sess_ctx;
+    httpd_free_ctx_fn_t free_ctx;
+    std::mutex send_lock;
+    // The frame being delivered to the handler
+    httpd_ws_type_t pending_type;
+    std::string pending;
+};
+
+// Splits raw response bytes back into status, headers and (de-chunked)
+// body for the client
+struct wire_parser {
+    mock_httpd_client *client = nullptr;
+    bool in_body = false;
+    bool chunked = false;
+    bool done = false;
+    std::string head;
+    enum { CHUNK_SIZE, CHUNK_DATA, CHUNK_END } state = CHUNK_SIZE;
+    size_t chunk_left = 0;
+    std::string line;
+
+    esp_err_t feed(const char *data, size_t len);
+
+private:
+    void parse_head();
+    esp_err_t body(const char *data, size_t len);
+};
+
+struct mock_req_ctx {
+    mock_httpd_client *client;
+    mock_ws_session *ws;
+    int fd;
+    bool tcp;           // fd is a real socket, the client reads the other end
+    wire_parser raw;    // for bytes written straight to a fake fd
+    std::string query;
+    bool has_query;
+    size_t recv_offset;
+    std::string status;
+    std::string type;
+    std::vector<std::pair<std::string, std::string>> resp_headers;
+    bool headers_sent;
+    bool failed;
+    // Handed off with httpd_req_async_handler_begin()
+    bool async;
+    bool async_done;
+    std::mutex async_lock;
+    std::condition_variable async_cond;
+};
+
+static std::mutex servers_lock;
+static std::vector<mock_server *> servers;
+static std::vector<mock_ws_session *> ws_sessions;
+static std::map<int, mock_req_ctx *> connections;
+// Descriptors for connections without a real socket behind them
+static int next_fd = 100;
+
+// lwIP's default TCP_MSS on the ESP32
+static const int MOCK_TCP_MSS = 1440;
+
+static esp_err_t ws_deliver(mock_ws_session *ws, httpd_ws_type_t type, const uint8_t *payload, size_t len);
+
+// Internal RAM httpd_start() takes on the device besides its task, after
+// esp_http_server's httpd_create(): server and request structures
+// including the 512 byte scratch buffer, the session and handler tables,
+// and the listening and control sockets
+static const size_t HTTPD_DATA_BYTES = 1100;
+static const size_t HTTPD_SESSION_BYTES = 176;
+static const size_t HTTPD_SOCKET_BYTES = 400;
+
+static size_t httpd_instance_bytes(const httpd_config_t *config)
+{
+    return HTTPD_DATA_BYTES
+        + config->max_open_sockets * HTTPD_SESSION_BYTES
+        + config->max_uri_handlers * sizeof(uint32_t)
+        + config->max_resp_headers * 2 * sizeof(uint32_t)
+        + 2 * HTTPD_SOCKET_BYTES;
+}
+
+static void server_task(void *arg)
+{
+    mock_server *server = (mock_server *)arg;
+    std::unique_lock<std::mutex> guard(server->jobs_lock);
+    while (true) {
+        server->jobs_cond.wait(guard, [server]() { return server->stopping || !server->jobs.empty(); });
+        if (server->jobs.empty()) {
+            break;
+        }
+        std::function<void()> job = std::move(server->jobs.front());
+        server->jobs.pop_front();
+        guard.unlock();
+        job();
+        guard.lock();
+    }
+    server->stopped = true;
+    server->jobs_cond.notify_all();
+    guard.unlock();
+    vTaskDelete(NULL);
+}
+
+// Run `job` on the server's task and wait for it
+static void run_on_server(mock_server *server, std::function<void()> job)
+{
+    std::promise<void> done;
+    {
+        std::lock_guard<std::mutex> guard(server->jobs_lock);
+        server->jobs.push_back([&job, &done]() {
+            job();
+            done.set_value();
+        });
+    }
+    server->jobs_cond.notify_all();
+    done.get_future().wait();
+}
+
+static mock_req_ctx *ctx_of(httpd_req_t *r)
+{
+    return (mock_req_ctx *)r->aux;
+}
+
+static mock_server *find_server(uint16_t port)
+{
+    for (mock_server *server : servers) {
+        if (server->config.server_port == port) {
+            return server;
+        }
+    }
+    return NULL;
+}
+
+const char *mock_httpd_client::header(const char *name) const
+{
+    for (const auto &h : headers) {
+        if (strcasecmp(h.first.c_str(), name) == 0) {
+            return h.second.c_str();
+        }
+    }
+    return NULL;
+}
+
+
+static void wire_parser_reset(wire_parser &parser, mock_httpd_client *client)
+{
+    parser = wire_parser();
+    parser.client = client;
+}
+
+void wire_parser::parse_head()
+{
+    size_t eol = head.find("\r\n");
+    size_t sp = head.find(' ');
+    if (sp < eol) {
+        client->status = head.substr(sp + 1, eol - sp - 1);
+    }
+    client->headers.clear();
+    size_t pos = eol + 2;
+    while (pos < head.size()) {
+        eol = head.find("\r\n", pos);
+        if (eol == std::string::npos || eol == pos) {
+            break;
+        }
+        std::string line = head.substr(pos, eol - pos);
+        pos = eol + 2;
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string name = line.substr(0, colon);
+        std::string value = line.substr(line.find_first_not_of(' ', colon + 1));
+        if (strcasecmp(name.c_str(), "Content-Type") == 0) {
+            client->content_type = value;
+        } else if (strcasecmp(name.c_str(), "Transfer-Encoding") == 0) {
+            chunked = strcasecmp(value.c_str(), "chunked") == 0;
+            client->chunked = chunked;
+        } else if (strcasecmp(name.c_str(), "Content-Length") != 0) {
+            client->headers.emplace_back(name, value);
+        }
+    }
+}
+
+esp_err_t wire_parser::body(const char *data, size_t len)
+{
+    if (!len) {
+        return ESP_OK;
+    }
+    client->body_bytes += len;
+    return client->on_body(data, len);
+}
+
+esp_err_t wire_parser::feed(const char *data, size_t len)
+{
+    if (!in_body) {
+        size_t before = head.size();
+        head.append(data, len);
+        size_t end = head.find("\r\n\r\n");
+        if (end == std::string::npos) {
+            return ESP_OK;
+        }
+        size_t used = end + 4 - before;
+        head.resize(end + 4);
+        parse_head();
+        in_body = true;
+        data += used;
+        len -= used;
+    }
+    if (!chunked) {
+        return body(data, len);
+    }
+    while (len && !done) {
+        if (state == CHUNK_SIZE) {
+            const char *nl = (const char *)memchr(data, '\n', len);
+            size_t n = nl ? nl - data + 1 : len;
+            line.append(data, n);
+            data += n;
+            len -= n;
+            if (nl) {
+                chunk_left = strtoul(line.c_str(), NULL, 16);
+                line.clear();
+                state = CHUNK_DATA;
+                done = chunk_left == 0;
+            }
+        } else if (state == CHUNK_DATA) {
+            size_t n = std::min(len, chunk_left);
+            if (body(data, n) != ESP_OK) {
+                return ESP_FAIL;
+            }
+            data += n;
+            len -= n;
+            chunk_left -= n;
+            if (!chunk_left) {
+                state = CHUNK_END;
+                chunk_left = 2;
+            }
+        } else {
+            size_t n = std::min(len, chunk_left);
+            data += n;
+            len -= n;
+            chunk_left -= n;
+            if (!chunk_left) {
+                state = CHUNK_SIZE;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+// Write everything to a real socket, as the server's blocking send would
+static bool tcp_send(int fd, const char *data, size_t len)
+{
+    while (len) {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Bytes the handler wrote to the socket itself, bypassing the response API
+static esp_err_t raw_send(mock_req_ctx *ctx, const char *data, size_t len)
+{
+    if (ctx->failed) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    ctx->headers_sent = true;
+    mock_httpd_client *client = ctx->client;
+    client->socket_writes++;
+    if (ctx->tcp) {
+        if (!tcp_send(ctx->fd, data, len)) {
+            ctx->failed = true;
+        }
+    } else {
+        client->wire_bytes += len;
+        if (ctx->raw.feed(data, len) != ESP_OK) {
+            ctx->failed = true;
+        }
+    }
+    return ctx->failed ? ESP_ERR_HTTPD_RESP_SEND : ESP_OK;
+}
+
+// One socket write. Payload bytes are handed to the client, framing is only
+// counted.
+static esp_err_t sock_send(mock_req_ctx *ctx, const char *data, size_t len, bool payload)
+{
+    if (ctx->failed) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    if (ctx->tcp) {
+        // The client's reader parses it all off the wire
+        return raw_send(ctx, data, len);
+    }
+    mock_httpd_client *client = ctx->client;
+    client->socket_writes++;
+    client->wire_bytes += len;
+    if (payload && len) {
+        client->body_bytes += len;
+        if (client->on_body(data, len) != ESP_OK) {
+            ctx->failed = true;
+            return ESP_ERR_HTTPD_RESP_SEND;
+        }
+    }
+    return ESP_OK;
+}
+
+static esp_err_t send_headers(mock_req_ctx *ctx, const char *length_line)
+{
+    mock_httpd_client *client = ctx->client;
+    if (!ctx->tcp) {
+        client->status = ctx->status;
+        client->content_type = ctx->type;
+        client->headers = ctx->resp_headers;
+    }
+
+    std::string head = "HTTP/1.1 " + ctx->status + "\r\nContent-Type: " + ctx->type + "\r\n" + length_line;
+    if (sock_send(ctx, head.data(), head.size(), false) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    // Like the real server: name, ": ", value and CRLF are separate writes
+    for (const auto &h : ctx->resp_headers) {
+        if (sock_send(ctx, h.first.data(), h.first.size(), false) != ESP_OK ||
+            sock_send(ctx, ": ", 2, false) != ESP_OK ||
+            sock_send(ctx, h.second.data(), h.second.size(), false) != ESP_OK ||
+            sock_send(ctx, "\r\n", 2, false) != ESP_OK) {
+            return ESP_ERR_HTTPD_RESP_SEND;
+        }
+    }
+    if (sock_send(ctx, "\r\n", 2, false) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    ctx->headers_sent = true;
+    return ESP_OK;
+}
+
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
+{
+    if (handle == NULL || config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> guard(servers_lock);
+    if (find_server(config->server_port)) {
+        return ESP_ERR_HTTPD_TASK;
+    }
+    mock_server *server = new mock_server();
+    server->config = *config;
+    server->heap_bytes = httpd_instance_bytes(config);
+    server->stopping = false;
+    server->stopped = false;
+    if (xTaskCreatePinnedToCore(server_task, "httpd", config->stack_size, server,
+            config->task_priority, &server->task, config->core_id) != pdPASS) {
+        delete server;
+        return ESP_ERR_HTTPD_TASK;
+    }
+    mock_heap_charge(server->heap_bytes);
+    servers.push_back(server);
+    *handle = server;
+    return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle)
+{
+    mock_server *server = (mock_server *)handle;
+    {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        auto it = std::find(servers.begin(), servers.end(), server);
+        if (it == servers.end()) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        servers.erase(it);
+    }
+    {
+        std::unique_lock<std::mutex> guard(server->jobs_lock);
+        server->stopping = true;
+        server->jobs_cond.notify_all();
+        server->jobs_cond.wait(guard, [server]() { return server->stopped; });
+    }
+    mock_heap_charge(-(int64_t)server->heap_bytes);
+    delete server;
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler)
+{
+    if (handle == NULL || uri_handler == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    std::lock_guard<std::mutex> guard(servers_lock);
+    mock_server *server = (mock_server *)handle;
+    for (size_t i = 0; i < server->handlers.size(); i++) {
+        if (server->handlers[i].method == uri_handler->method && server->uris[i] == uri_handler->uri) {
+            return ESP_ERR_HTTPD_HANDLER_EXISTS;
+        }
+    }
+    if (server->handlers.size() >= server->config.max_uri_handlers) {
+        return ESP_ERR_HTTPD_HANDLERS_FULL;
+    }
+    server->uris.push_back(uri_handler->uri);
+    server->handlers.push_back(*uri_handler);
+    for (size_t i = 0; i < server->handlers.size(); i++) {
+        server->handlers[i].uri = server->uris[i].c_str();
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_unregister_uri_handler(httpd_handle_t handle, const char *uri, httpd_method_t method)
+{
+    std::lock_guard<std::mutex> guard(servers_lock);
+    mock_server *server = (mock_server *)handle;
+    for (size_t i = 0; i < server->handlers.size(); i++) {
+        if (server->handlers[i].method == method && server->uris[i] == uri) {
+            server->handlers.erase(server->handlers.begin() + i);
+            server->uris.erase(server->uris.begin() + i);
+            for (size_t j = 0; j < server->handlers.size(); j++) {
+                server->handlers[j].uri = server->uris[j].c_str();
+            }
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+bool httpd_uri_match_wildcard(const char *template_uri, const char *uri_to_match, size_t match_upto)
+{
+    const size_t tpl_len = strlen(template_uri);
+    size_t exact_match_chars = tpl_len;
+    const char last = tpl_len > 0 ? template_uri[tpl_len - 1] : 0;
+    const char prevlast = tpl_len > 1 ? template_uri[tpl_len - 2] : 0;
+    const bool asterisk = last == '*' || (prevlast == '*' && last == '?');
+    const bool quest = last == '?' || (prevlast == '?' && last == '*');
+
+    if (exact_match_chars < (size_t)(asterisk + quest * 2)) {
+        return false;
+    }
+    exact_match_chars -= asterisk + quest * 2;
+    if (match_upto < exact_match_chars) {
+        return false;
+    }
+    if (!quest) {
+        if (!asterisk && match_upto != exact_match_chars) {
+            return false;
+        }
+        return strncmp(template_uri, uri_to_match, exact_match_chars) == 0;
+    }
+    if (match_upto > exact_match_chars && template_uri[exact_match_chars] != uri_to_match[exact_match_chars]) {
+        return false;
+    }
+    if (strncmp(template_uri, uri_to_match, exact_match_chars) != 0) {
+        return false;
+    }
+    return asterisk || match_upto <= exact_match_chars + 1;
+}
+
+
+size_t httpd_req_get_url_query_len(httpd_req_t *r)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    return ctx->has_query ? ctx->query.size() : 0;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    if (!ctx->has_query) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (buf_len == 0) {
+        return ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+    size_t n = std::min(ctx->query.size(), buf_len - 1);
+    memcpy(buf, ctx->query.data(), n);
+    buf[n] = '\0';
+    return ctx->query.size() + 1 > buf_len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t httpd_query_key_value(const char *qry_str, const char *key, char *val, size_t val_size)
+{
+    if (qry_str == NULL || key == NULL || val == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const char *qry_ptr = qry_str;
+    const size_t buf_len = val_size;
+    while (strlen(qry_ptr)) {
+        const char *val_ptr = strchr(qry_ptr, '=');
+        if (!val_ptr) {
+            break;
+        }
+        size_t offset = val_ptr - qry_ptr;
+        if (offset != strlen(key) || strncasecmp(qry_ptr, key, offset)) {
+            qry_ptr = strchr(val_ptr, '&');
+            if (!qry_ptr) {
+                break;
+            }
+            qry_ptr++;
+            continue;
+        }
+        qry_ptr = strchr(++val_ptr, '&');
+        if (!qry_ptr) {
+            qry_ptr = val_ptr + strlen(val_ptr);
+        }
+        val_size = qry_ptr - val_ptr + 1;
+        size_t n = std::min(val_size, buf_len);
+        if (n) {
+            memcpy(val, val_ptr, n - 1);
+            val[n - 1] = '\0';
+        }
+        if (buf_len < val_size) {
+            return ESP_ERR_HTTPD_RESULT_TRUNC;
+        }
+        return ESP_OK;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+static const std::string *find_req_header(httpd_req_t *r, const char *field)
+{
+    for (const auto &h : ctx_of(r)->client->request_headers) {
+        if (strcasecmp(h.first.c_str(), field) == 0) {
+            return &h.second;
+        }
+    }
+    return NULL;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field)
+{
+    const std::string *value = find_req_header(r, field);
+    return value ? value->size() : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size)
+{
+    const std::string *value = find_req_header(r, field);
+    if (!value) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (val_size == 0) {
+        return ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+    size_t n = std::min(value->size(), val_size - 1);
+    memcpy(val, value->data(), n);
+    val[n] = '\0';
+    return value->size() + 1 > val_size ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+int httpd_req_recv(httpd_req_t *r, char *buf, size_t buf_len)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    const std::string &body = ctx->client->request_body;
+    size_t n = std::min(buf_len, body.size() - ctx->recv_offset);
+    memcpy(buf, body.data() + ctx->recv_offset, n);
+    ctx->recv_offset += n;
+    return (int)n;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    return ctx->ws ? ctx->ws->fd : ctx->fd;
+}
+
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+    ctx_of(r)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+    ctx_of(r)->type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    mock_server *server = (mock_server *)r->handle;
+    if (ctx->resp_headers.size() >= server->config.max_resp_headers) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    ctx->resp_headers.emplace_back(field, value);
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    char length_line[48];
+    snprintf(length_line, sizeof(length_line), "Content-Length: %d\r\n", (int)buf_len);
+    if (send_headers(ctx, length_line) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    if (buf && buf_len && sock_send(ctx, buf, buf_len, true) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    mock_req_ctx *ctx = ctx_of(r);
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    if (!ctx->headers_sent) {
+        ctx->client->chunked = true;
+        if (send_headers(ctx, "Transfer-Encoding: chunked\r\n") != ESP_OK) {
+            return ESP_ERR_HTTPD_RESP_SEND;
+        }
+    }
+    char len_str[10];
+    snprintf(len_str, sizeof(len_str), "%x\r\n", (unsigned)buf_len);
+    if (sock_send(ctx, len_str, strlen(len_str), false) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    if (buf && buf_len && sock_send(ctx, buf, buf_len, true) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    if (sock_send(ctx, "\r\n", 2, false) != ESP_OK) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg)
+{
+    const char *status;
+    const char *text;
+    switch (error) {
+    case HTTPD_400_BAD_REQUEST:
+        status = HTTPD_400;
+        text = "Bad request syntax";
+        break;
+    case HTTPD_404_NOT_FOUND:
+        status = HTTPD_404;
+        text = "This URI does not exist";
+        break;
+    case HTTPD_408_REQ_TIMEOUT:
+        status = HTTPD_408;
+        text = "Server closed this connection";
+        break;
+    default:
+        status = HTTPD_500;
+        text = "Server has encountered an unexpected error";
+        break;
+    }
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "text/html");
+    return httpd_resp_send(req, msg ? msg : text, HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *pkt, size_t max_len)
+{
+    mock_ws_session *ws = ctx_of(req)->ws;
+    if (!ws || !pkt) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pkt->final = true;
+    pkt->fragmented = false;
+    pkt->type = ws->pending_type;
+    pkt->len = ws->pending.size();
+    if (max_len == 0) {
+        return ESP_OK;
+    }
+    if (pkt->len > max_len || !pkt->payload) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(pkt->payload, ws->pending.data(), pkt->len);
+    return ESP_OK;
+}
+
+esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *pkt)
+{
+    mock_ws_session *ws = ctx_of(req)->ws;
+    if (!ws || !pkt) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ws_deliver(ws, pkt->type, pkt->payload, pkt->len);
+}
+
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame)
+{
+    mock_ws_session *ws = NULL;
+    {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        for (mock_ws_session *s : ws_sessions) {
+            if (s->fd == fd && s->server == hd) {
+                ws = s;
+            }
+        }
+    }
+    if (!ws) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ws_deliver(ws, frame->type, frame->payload, frame->len);
+}
+
+int httpd_send(httpd_req_t *r, const char *buf, size_t buf_len)
+{
+    if (raw_send(ctx_of(r), buf, buf_len) != ESP_OK) {
+        return HTTPD_SOCK_ERR_FAIL;
+    }
+    return (int)buf_len;
+}
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out)
+{
+    if (r == NULL || out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mock_req_ctx *ctx = ctx_of(r);
+    if (ctx->ws) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    httpd_req_t *copy = new httpd_req_t(*r);
+    ctx->async = true;
+    *out = copy;
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t *r)
+{
+    if (r == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    mock_req_ctx *ctx = ctx_of(r);
+    delete r;
+    std::lock_guard<std::mutex> guard(ctx->async_lock);
+    ctx->async_done = true;
+    ctx->async_cond.notify_all();
+    return ESP_OK;
+}
+
+
+static void init_ctx(mock_req_ctx &ctx, mock_httpd_client &client)
+{
+    ctx.client = &client;
+    ctx.ws = NULL;
+    ctx.fd = -1;
+    ctx.tcp = false;
+    wire_parser_reset(ctx.raw, &client);
+    ctx.has_query = false;
+    ctx.recv_offset = 0;
+    ctx.status = HTTPD_200;
+    ctx.type = "text/html";
+    ctx.headers_sent = false;
+    ctx.failed = false;
+    ctx.async = false;
+    ctx.async_done = false;
+}
+
+// Look up the handler for `path` on the server at `port`
+static mock_server *find_handler(uint16_t port, httpd_method_t method, const std::string &path, httpd_uri_t *handler)
+{
+    std::lock_guard<std::mutex> guard(servers_lock);
+    mock_server *server = find_server(port);
+    if (!server) {
+        return NULL;
+    }
+    for (const httpd_uri_t &h : server->handlers) {
+        if (h.method != method) {
+            continue;
+        }
+        bool match = server->config.uri_match_fn
+            ? server->config.uri_match_fn(h.uri, path.c_str(), path.size())
+            : strcmp(h.uri, path.c_str()) == 0;
+        if (match) {
+            *handler = h;
+            break;
+        }
+    }
+    return server;
+}
+
+// A real loopback TCP connection for a request: the handler writes to one
+// end, a thread reads the other end into the client.
+struct mock_tcp_conn {
+    int peer = -1;
+    std::thread reader;
+};
+
+static void tcp_read(int fd, mock_httpd_client *client)
+{
+    wire_parser parser;
+    wire_parser_reset(parser, client);
+    char buf[16384];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) {
+        client->wire_bytes += n;
+        if (parser.feed(buf, n) != ESP_OK) {
+            // Hang up: with data unread this resets the connection, and
+            // the server's next send fails as it would on the device
+            break;
+        }
+    }
+    close(fd);
+}
+
+static bool tcp_open(mock_req_ctx &ctx, mock_tcp_conn &conn)
+{
+    // A client hanging up mid-send must fail the send, not kill the bench
+    signal(SIGPIPE, SIG_IGN);
+    int mss = MOCK_TCP_MSS;
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    setsockopt(listener, IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    if (listener < 0 || bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(listener, 1) != 0 || getsockname(listener, (struct sockaddr *)&addr, &addr_len) != 0) {
+        close(listener);
+        return false;
+    }
+    conn.peer = socket(AF_INET, SOCK_STREAM, 0);
+    setsockopt(conn.peer, IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    if (connect(conn.peer, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(conn.peer);
+        close(listener);
+        return false;
+    }
+    ctx.fd = accept(listener, NULL, NULL);
+    close(listener);
+    if (ctx.fd < 0) {
+        close(conn.peer);
+        return false;
+    }
+    // Like the server's send_wait_timeout
+    struct timeval timeout = {5, 0};
+    setsockopt(ctx.fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    ctx.tcp = true;
+    conn.reader = std::thread(tcp_read, conn.peer, ctx.client);
+    return true;
+}
+
+static void tcp_close(mock_req_ctx &ctx, mock_tcp_conn &conn)
+{
+    struct tcp_info info = {};
+    socklen_t info_len = sizeof(info);
+    shutdown(ctx.fd, SHUT_WR);
+    conn.reader.join();
+    if (getsockopt(ctx.fd, IPPROTO_TCP, TCP_INFO, &info, &info_len) == 0) {
+        ctx.client->tcp_segments = info.tcpi_data_segs_out;
+    }
+    close(ctx.fd);
+}
+
+esp_err_t mock_httpd_request(uint16_t port, httpd_method_t method, const char *uri, mock_httpd_client &client)
+{
+    std::string path = uri;
+    mock_req_ctx ctx;
+    init_ctx(ctx, client);
+    size_t q = path.find('?');
+    if (q != std::string::npos) {
+        ctx.query = path.substr(q + 1);
+        ctx.has_query = true;
+        path.resize(q);
+    }
+
+    httpd_uri_t handler = {};
+    mock_server *server = find_handler(port, method, path, &handler);
+    if (!server) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    httpd_req_t req = {};
+    req.handle = server;
+    req.method = method;
+    strncpy((char *)req.uri, uri, HTTPD_MAX_URI_LEN);
+    req.content_len = client.request_body.size();
+    req.aux = &ctx;
+
+    mock_tcp_conn conn;
+    if (client.tcp && !tcp_open(ctx, conn)) {
+        return ESP_FAIL;
+    }
+    if (!client.tcp) {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        ctx.fd = next_fd++;
+    }
+    {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        connections[ctx.fd] = &ctx;
+    }
+    client.sockfd = ctx.fd;
+
+    esp_err_t res;
+    run_on_server(server, [&]() {
+        auto start = std::chrono::steady_clock::now();
+        if (!handler.handler) {
+            httpd_resp_send_404(&req);
+            res = ESP_ERR_NOT_FOUND;
+        } else {
+            req.user_ctx = handler.user_ctx;
+            res = handler.handler(&req);
+        }
+        client.handler_ns += (std::chrono::steady_clock::now() - start).count();
+    });
+    if (ctx.async) {
+        // The connection stays open until the async handler completes
+        std::unique_lock<std::mutex> guard(ctx.async_lock);
+        ctx.async_cond.wait(guard, [&ctx]() { return ctx.async_done; });
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        connections.erase(ctx.fd);
+    }
+    if (client.tcp) {
+        tcp_close(ctx, conn);
+    }
+    return res;
+}
+
+
+// Frame header as the server writes it (no mask on server frames)
+static size_t ws_header_len(size_t len)
+{
+    return len < 126 ? 2 : (len < 65536 ? 4 : 10);
+}
+
+static esp_err_t ws_deliver(mock_ws_session *ws, httpd_ws_type_t type, const uint8_t *payload, size_t len)
+{
+    std::lock_guard<std::mutex> guard(ws->send_lock);
+    mock_httpd_client *client = ws->client;
+    client->socket_writes += len ? 2 : 1;
+    client->wire_bytes += ws_header_len(len) + len;
+    client->body_bytes += len;
+    client->on_ws_frame(type, payload, len);
+    return ESP_OK;
+}
+
+static void ws_close(mock_ws_session *ws)
+{
+    {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        ws_sessions.erase(std::remove(ws_sessions.begin(), ws_sessions.end(), ws), ws_sessions.end());
+    }
+    if (ws->free_ctx && ws->sess_ctx) {
+        ws->free_ctx(ws->sess_ctx);
+    } else if (ws->sess_ctx) {
+        free(ws->sess_ctx);
+    }
+    ws->client->ws_session = nullptr;
+    delete ws;
+}
+
+// Run the handler for one call on a WebSocket session
+static esp_err_t ws_call(mock_ws_session *ws, int method)
+{
+    mock_req_ctx ctx;
+    init_ctx(ctx, *ws->client);
+    ctx.ws = ws;
+    ctx.headers_sent = true;
+
+    httpd_req_t req = {};
+    req.handle = ws->server;
+    req.method = method;
+    strncpy((char *)req.uri, ws->handler.uri, HTTPD_MAX_URI_LEN);
+    req.aux = &ctx;
+    req.user_ctx = ws->handler.user_ctx;
+    req.sess_ctx = ws->sess_ctx;
+    req.free_ctx = ws->free_ctx;
+    esp_err_t res;
+    run_on_server(ws->server, [&]() {
+        auto start = std::chrono::steady_clock::now();
+        res = ws->handler.handler(&req);
+        ws->client->handler_ns += (std::chrono::steady_clock::now() - start).count();
+    });
+    ws->sess_ctx = req.sess_ctx;
+    ws->free_ctx = req.free_ctx;
+    return res;
+}
+
+esp_err_t mock_httpd_ws_connect(uint16_t port, const char *uri, mock_httpd_client &client)
+{
+    httpd_uri_t handler = {};
+    mock_server *server = find_handler(port, HTTP_GET, uri, &handler);
+    if (!server) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!handler.handler || !handler.is_websocket) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    mock_ws_session *ws = new mock_ws_session();
+    ws->server = server;
+    ws->handler = handler;
+    ws->client = &client;
+    ws->sess_ctx = NULL;
+    ws->free_ctx = NULL;
+    {
+        std::lock_guard<std::mutex> guard(servers_lock);
+        ws->fd = next_fd++;
+        ws_sessions.push_back(ws);
+    }
+    client.ws_session = ws;
+    client.status = "101 Switching Protocols";
+    static const char handshake[] =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n\r\n";
+    client.socket_writes++;
+    client.wire_bytes += sizeof(handshake) - 1;
+
+    esp_err_t res = ws_call(ws, HTTP_GET);
+    if (res != ESP_OK) {
+        ws_close(ws);
+    }
+    return res;
+}
+
+esp_err_t mock_httpd_ws_send(mock_httpd_client &client, httpd_ws_type_t type, const void *data, size_t len)
+{
+    mock_ws_session *ws = (mock_ws_session *)client.ws_session;
+    if (!ws) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (type >= HTTPD_WS_TYPE_CLOSE && !ws->handler.handle_ws_control_frames) {
+        // The server answers control frames itself
+        if (type == HTTPD_WS_TYPE_PING) {
+            ws_deliver(ws, HTTPD_WS_TYPE_PONG, (const uint8_t *)data, len);
+        } else if (type == HTTPD_WS_TYPE_CLOSE) {
+            ws_deliver(ws, HTTPD_WS_TYPE_CLOSE, NULL, 0);
+            ws_close(ws);
+        }
+        return ESP_OK;
+    }
+    ws->pending_type = type;
+    ws->pending.assign((const char *)data, len);
+    // Data frames reach the handler with a zeroed method, never HTTP_GET
+    esp_err_t res = ws_call(ws, 0);
+    if (res != ESP_OK) {
+        ws_close(ws);
+    }
+    return res;
+}
+
+void mock_httpd_ws_close(mock_httpd_client &client)
+{
+    if (client.ws_session) {
+        ws_close((mock_ws_session *)client.ws_session);
+    }
+}
+
+int mock_httpd_handler_count(uint16_t port)
+{
+    std::lock_guard<std::mutex> guard(servers_lock);
+    mock_server *server = find_server(port);
+    return server ? (int)server->handlers.size() : -1;
+}
+
+
+// lwIP socket calls from the firmware. Descriptors of mock connections are
+// handled here, anything else (e.g. a UDP socket) is a real host socket.
+static mock_req_ctx *find_connection(int s)
+{
+    std::lock_guard<std::mutex> guard(servers_lock);
+    auto it = connections.find(s);
+    return it == connections.end() ? NULL : it->second;
+}
+
+ssize_t lwip_sendmsg(int s, const struct msghdr *msg, int flags)
+{
+    mock_req_ctx *ctx = find_connection(s);
+    if (!ctx) {
+        return sendmsg(s, msg, flags);
+    }
+    if (ctx->tcp) {
+        ctx->client->socket_writes++;
+        return sendmsg(s, msg, flags | MSG_NOSIGNAL);
+    }
+    std::string data;
+    for (size_t i = 0; i < msg->msg_iovlen; i++) {
+        data.append((const char *)msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+    }
+    if (raw_send(ctx, data.data(), data.size()) != ESP_OK) {
+        errno = ECONNRESET;
+        return -1;
+    }
+    return data.size();
+}
+
+int lwip_setsockopt(int s, int level, int optname, const void *optval, socklen_t optlen)
+{
+    mock_req_ctx *ctx = find_connection(s);
+    if (ctx && optlen == sizeof(int)) {
+        if (level == IPPROTO_TCP && optname == TCP_NODELAY) {
+            ctx->client->nodelay = *(const int *)optval;
+        } else if (level == SOL_SOCKET && optname == SO_SNDBUF) {
+            ctx->client->sndbuf = *(const int *)optval;
+        }
+    }
+    if (ctx && !ctx->tcp) {
+        return 0;
+    }
+    return setsockopt(s, level, optname, optval, optlen);
+}
+
+int lwip_getpeername(int s, struct sockaddr *name, socklen_t *namelen)
+{
+    mock_req_ctx *ctx = find_connection(s);
+    if (!ctx || ctx->tcp) {
+        return getpeername(s, name, namelen);
+    }
+    // Fake connections come from the loopback address
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(40000 + s);
+    memcpy(name, &addr, std::min((size_t)*namelen, sizeof(addr)));
+    *namelen = sizeof(addr);
+    return 0;
+}
+
+int mock_httpd_stack_free(uint16_t port)
+{
+    std::lock_guard<std::mutex> guard(servers_lock);
+    mock_server *server = find_server(port);
+    return server ? (int)uxTaskGetStackHighWaterMark(server->task) : -1;
+}
@@ -0,0 +1,13 @@
+#include "esp_system.h"
+
+static esp_reset_reason_t reset_reason = ESP_RST_POWERON;
+
+esp_reset_reason_t esp_reset_reason(void)
+{
+    return reset_reason;
+}
+
+void mock_set_reset_reason(esp_reset_reason_t reason)
+{
+    reset_reason = reason;
+}
@@ -0,0 +1,24 @@
+// Host stand-in for ESP-IDF's esp_system.h
+#ifndef __ESP_SYSTEM_H__
+#define __ESP_SYSTEM_H__
+
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO,
+} esp_reset_reason_t;
+
+esp_reset_reason_t esp_reset_reason(void);
+
+// Host only: what esp_reset_reason() reports (ESP_RST_POWERON by default)
+void mock_set_reset_reason(esp_reset_reason_t reason);
+
+#endif
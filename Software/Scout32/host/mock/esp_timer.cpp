@@ -0,0 +1,11 @@
+#include <chrono>
+
+#include "esp_timer.h"
+
+static const auto boot_time = std::chrono::steady_clock::now();
+
+int64_t esp_timer_get_time(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - boot_time).count();
+}
@@ -0,0 +1,10 @@
+// Host stand-in for ESP-IDF's esp_timer.h
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microseconds since the (host) process started, like the ESP32 boot clock.
+int64_t esp_timer_get_time(void);
+
+#endif
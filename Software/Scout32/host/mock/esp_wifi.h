@@ -0,0 +1,33 @@
+// Host stand-in for ESP-IDF's esp_wifi.h
+#ifndef __ESP_WIFI_H__
+#define __ESP_WIFI_H__
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef enum {
+    WIFI_PS_NONE,
+    WIFI_PS_MIN_MODEM,
+    WIFI_PS_MAX_MODEM,
+} wifi_ps_type_t;
+
+#define ESP_WIFI_MAX_CONN_NUM 10
+
+typedef struct {
+    uint8_t mac[6];
+    int8_t rssi;
+} wifi_sta_info_t;
+
+typedef struct {
+    wifi_sta_info_t sta[ESP_WIFI_MAX_CONN_NUM];
+    int num;
+} wifi_sta_list_t;
+
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type);
+esp_err_t esp_wifi_get_ps(wifi_ps_type_t *type);
+// Stations associated with our soft AP. The mock reports one, at the
+// RSSI set with mock_wifi_set_rssi().
+esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t *sta);
+
+#endif
@@ -0,0 +1,485 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// Each task runs on a host stack painted with a pattern, so its real peak
+// usage can be read back. x86-64 frames aren't Xtensa frames, but the
+// same code paths are measured.
+static const size_t HOST_STACK_BYTES = 256 * 1024;
+static const uint8_t STACK_PAINT = 0xA5;
+// What a task costs in internal RAM besides its stack
+static const size_t TCB_BYTES = 344;
+
+struct mock_task {
+    std::string name;
+    uint32_t stack_depth;
+    uint8_t *stack;      // NULL for threads the host created
+    uint8_t *stack_top;  // where the task function's frames start
+    TaskFunction_t entry;
+    void *arg;
+    UBaseType_t priority;
+    BaseType_t core_id;
+    UBaseType_t number;
+    pthread_t thread;
+    std::mutex lock;
+    std::condition_variable cond;
+    uint32_t notify_value;
+    bool notify_pending;
+};
+
+struct mock_queue {
+    std::mutex lock;
+    std::condition_variable cond;
+    size_t item_size;
+    size_t length;
+    std::deque<std::vector<uint8_t>> items;
+    size_t count; // semaphores carry no data, just a count
+    bool is_semaphore;
+};
+
+static thread_local mock_task *current_task = NULL;
+
+// Live tasks, for uxTaskGetSystemState(). A task leaves before its thread
+// exits, so every thread in here can be asked for its CPU clock.
+static std::mutex tasks_lock;
+static std::vector<mock_task *> tasks;
+static UBaseType_t task_count = 0;
+
+template <typename Pred>
+static bool wait_ticks(std::condition_variable &cond, std::unique_lock<std::mutex> &guard, TickType_t ticks, Pred pred)
+{
+    if (ticks == portMAX_DELAY) {
+        cond.wait(guard, pred);
+        return true;
+    }
+    return cond.wait_for(guard, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), pred);
+}
+
+
+void vPortEnterCritical(portMUX_TYPE *mux)
+{
+    int expected = 0;
+    while (!mux->owner.compare_exchange_weak(expected, 1, std::memory_order_acquire)) {
+        expected = 0;
+        std::this_thread::yield();
+    }
+}
+
+void vPortExitCritical(portMUX_TYPE *mux)
+{
+    mux->owner.store(0, std::memory_order_release);
+}
+
+BaseType_t xPortGetCoreID(void)
+{
+    mock_task *task = xTaskGetCurrentTaskHandle();
+    return task->core_id == tskNO_AFFINITY ? 0 : task->core_id;
+}
+
+
+static void *task_main(void *arg)
+{
+    mock_task *task = (mock_task *)arg;
+    {
+        std::lock_guard<std::mutex> guard(tasks_lock);
+        task->thread = pthread_self();
+        tasks.push_back(task);
+    }
+    // glibc keeps the thread descriptor and TLS at the top of the stack:
+    // only count from here down
+    uint8_t marker;
+    task->stack_top = &marker;
+    current_task = task;
+    pthread_setname_np(pthread_self(), task->name.substr(0, 15).c_str());
+    task->entry(task->arg);
+    // Returning from a task function is a bug on FreeRTOS too
+    fprintf(stderr, "task %s returned without vTaskDelete\n", task->name.c_str());
+    abort();
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char *pcName, uint32_t usStackDepth,
+    void *pvParameters, UBaseType_t uxPriority, TaskHandle_t *pvCreatedTask, BaseType_t xCoreID)
+{
+    mock_task *task = new mock_task();
+    task->name = pcName ? pcName : "";
+    task->stack_depth = usStackDepth;
+    task->priority = uxPriority;
+    task->core_id = xCoreID;
+    task->notify_value = 0;
+    task->notify_pending = false;
+    task->entry = pvTaskCode;
+    task->arg = pvParameters;
+    {
+        std::lock_guard<std::mutex> guard(tasks_lock);
+        task->number = ++task_count;
+    }
+    // Stacks of deleted tasks aren't reclaimed: the thread may still be
+    // on it while it exits
+    if (posix_memalign((void **)&task->stack, 4096, HOST_STACK_BYTES) != 0) {
+        delete task;
+        return pdFAIL;
+    }
+    memset(task->stack, STACK_PAINT, HOST_STACK_BYTES);
+    task->stack_top = task->stack + HOST_STACK_BYTES;
+    if (pvCreatedTask) {
+        *pvCreatedTask = task;
+    }
+    mock_heap_charge(usStackDepth + TCB_BYTES);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, task->stack, HOST_STACK_BYTES);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_t thread;
+    int err = pthread_create(&thread, &attr, task_main, task);
+    pthread_attr_destroy(&attr);
+    return err == 0 ? pdPASS : pdFAIL;
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete)
+{
+    if (xTaskToDelete == NULL || xTaskToDelete == current_task) {
+        if (current_task && current_task->stack) {
+            mock_heap_charge(-(int64_t)(current_task->stack_depth + TCB_BYTES));
+            std::lock_guard<std::mutex> guard(tasks_lock);
+            tasks.erase(std::remove(tasks.begin(), tasks.end(), current_task), tasks.end());
+        }
+        pthread_exit(NULL);
+    }
+    fprintf(stderr, "vTaskDelete of another task is not supported on the host\n");
+    abort();
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay * portTICK_PERIOD_MS));
+}
+
+void vTaskDelayUntil(TickType_t *const pxPreviousWakeTime, const TickType_t xTimeIncrement)
+{
+    *pxPreviousWakeTime += xTimeIncrement;
+    int64_t wake_us = (int64_t)*pxPreviousWakeTime * portTICK_PERIOD_MS * 1000;
+    int64_t now = esp_timer_get_time();
+    if (wake_us > now) {
+        std::this_thread::sleep_for(std::chrono::microseconds(wake_us - now));
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (!current_task) {
+        // A thread the host tool created, e.g. one running an httpd handler
+        current_task = new mock_task();
+        current_task->name = "host";
+        current_task->stack_depth = 0;
+        current_task->stack = NULL;
+        current_task->priority = 1;
+        current_task->core_id = tskNO_AFFINITY;
+        current_task->notify_value = 0;
+        current_task->notify_pending = false;
+    }
+    return current_task;
+}
+
+char *pcTaskGetTaskName(TaskHandle_t xTaskToQuery)
+{
+    mock_task *task = xTaskToQuery ? xTaskToQuery : xTaskGetCurrentTaskHandle();
+    return (char *)task->name.c_str();
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask)
+{
+    mock_task *task = xTask ? xTask : xTaskGetCurrentTaskHandle();
+    return task->priority;
+}
+
+void vTaskPrioritySet(TaskHandle_t xTask, UBaseType_t uxNewPriority)
+{
+    mock_task *task = xTask ? xTask : xTaskGetCurrentTaskHandle();
+    task->priority = uxNewPriority;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask)
+{
+    mock_task *task = xTask ? xTask : xTaskGetCurrentTaskHandle();
+    if (!task->stack) {
+        return task->stack_depth;
+    }
+    // Stacks grow down: the paint left at the bottom was never touched
+    size_t untouched = 0;
+    while (untouched < HOST_STACK_BYTES && task->stack[untouched] == STACK_PAINT) {
+        untouched++;
+    }
+    size_t used = task->stack_top - (task->stack + untouched);
+    return used < task->stack_depth ? task->stack_depth - used : 0;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void)
+{
+    std::lock_guard<std::mutex> guard(tasks_lock);
+    return tasks.size();
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *const pxTaskStatusArray, const UBaseType_t uxArraySize,
+    uint32_t *const pulTotalRunTime)
+{
+    std::lock_guard<std::mutex> guard(tasks_lock);
+    if (tasks.size() > uxArraySize) {
+        return 0;
+    }
+    for (size_t i = 0; i < tasks.size(); i++) {
+        mock_task *task = tasks[i];
+        TaskStatus_t *status = &pxTaskStatusArray[i];
+        clockid_t clock;
+        struct timespec cpu = {0, 0};
+        if (pthread_getcpuclockid(task->thread, &clock) == 0) {
+            clock_gettime(clock, &cpu);
+        }
+        status->xHandle = task;
+        status->pcTaskName = task->name.c_str();
+        status->xTaskNumber = task->number;
+        status->eCurrentState = task == current_task ? eRunning : eReady;
+        status->uxCurrentPriority = task->priority;
+        status->uxBasePriority = task->priority;
+        status->ulRunTimeCounter = (uint32_t)(cpu.tv_sec * 1000000LL + cpu.tv_nsec / 1000);
+        status->pxStackBase = (StackType_t *)task->stack;
+        status->usStackHighWaterMark = uxTaskGetStackHighWaterMark(task);
+        status->xCoreID = task->core_id;
+    }
+    if (pulTotalRunTime) {
+        *pulTotalRunTime = (uint32_t)esp_timer_get_time();
+    }
+    return tasks.size();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+    mock_task *task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->lock);
+    wait_ticks(task->cond, guard, xTicksToWait, [task]() { return task->notify_value != 0; });
+    uint32_t value = task->notify_value;
+    if (value) {
+        task->notify_value = xClearCountOnExit ? 0 : value - 1;
+    }
+    task->notify_pending = false;
+    return value;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction)
+{
+    mock_task *task = xTaskToNotify;
+    std::lock_guard<std::mutex> guard(task->lock);
+    switch (eAction) {
+    case eNoAction:
+        break;
+    case eSetBits:
+        task->notify_value |= ulValue;
+        break;
+    case eIncrement:
+        task->notify_value++;
+        break;
+    case eSetValueWithOverwrite:
+        task->notify_value = ulValue;
+        break;
+    case eSetValueWithoutOverwrite:
+        if (task->notify_pending) {
+            return pdFAIL;
+        }
+        task->notify_value = ulValue;
+        break;
+    }
+    task->notify_pending = true;
+    task->cond.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+    return xTaskNotify(xTaskToNotify, 0, eIncrement);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait)
+{
+    mock_task *task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> guard(task->lock);
+    if (!task->notify_pending) {
+        task->notify_value &= ~ulBitsToClearOnEntry;
+    }
+    bool got = wait_ticks(task->cond, guard, xTicksToWait, [task]() { return task->notify_pending; });
+    if (pulNotificationValue) {
+        *pulNotificationValue = task->notify_value;
+    }
+    if (!got) {
+        return pdFALSE;
+    }
+    task->notify_value &= ~ulBitsToClearOnExit;
+    task->notify_pending = false;
+    return pdTRUE;
+}
+
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+    mock_queue *q = new mock_queue();
+    q->item_size = uxItemSize;
+    q->length = uxQueueLength;
+    q->count = 0;
+    q->is_semaphore = false;
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t xQueue)
+{
+    delete xQueue;
+}
+
+static size_t queue_fill(QueueHandle_t q)
+{
+    return q->is_semaphore ? q->count : q->items.size();
+}
+
+static BaseType_t queue_send(QueueHandle_t q, const void *item, TickType_t ticks, bool front)
+{
+    std::unique_lock<std::mutex> guard(q->lock);
+    if (!wait_ticks(q->cond, guard, ticks, [q]() { return queue_fill(q) < q->length; })) {
+        return errQUEUE_FULL;
+    }
+    if (q->is_semaphore) {
+        q->count++;
+    } else {
+        std::vector<uint8_t> data((const uint8_t *)item, (const uint8_t *)item + q->item_size);
+        if (front) {
+            q->items.push_front(std::move(data));
+        } else {
+            q->items.push_back(std::move(data));
+        }
+    }
+    q->cond.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait)
+{
+    return queue_send(xQueue, pvItemToQueue, xTicksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait)
+{
+    return queue_send(xQueue, pvItemToQueue, xTicksToWait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t xQueue, const void *pvItemToQueue)
+{
+    std::lock_guard<std::mutex> guard(xQueue->lock);
+    xQueue->items.clear();
+    xQueue->items.emplace_back((const uint8_t *)pvItemToQueue, (const uint8_t *)pvItemToQueue + xQueue->item_size);
+    xQueue->cond.notify_all();
+    return pdPASS;
+}
+
+static BaseType_t queue_receive(QueueHandle_t q, void *buffer, TickType_t ticks, bool peek)
+{
+    std::unique_lock<std::mutex> guard(q->lock);
+    if (!wait_ticks(q->cond, guard, ticks, [q]() { return queue_fill(q) > 0; })) {
+        return pdFALSE;
+    }
+    if (q->is_semaphore) {
+        if (!peek) {
+            q->count--;
+        }
+    } else {
+        memcpy(buffer, q->items.front().data(), q->item_size);
+        if (!peek) {
+            q->items.pop_front();
+        }
+    }
+    q->cond.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait)
+{
+    return queue_receive(xQueue, pvBuffer, xTicksToWait, false);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait)
+{
+    return queue_receive(xQueue, pvBuffer, xTicksToWait, true);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t xQueue)
+{
+    std::lock_guard<std::mutex> guard(xQueue->lock);
+    return queue_fill(xQueue);
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t xQueue)
+{
+    std::lock_guard<std::mutex> guard(xQueue->lock);
+    return xQueue->length - queue_fill(xQueue);
+}
+
+BaseType_t xQueueReset(QueueHandle_t xQueue)
+{
+    std::lock_guard<std::mutex> guard(xQueue->lock);
+    xQueue->items.clear();
+    xQueue->count = 0;
+    xQueue->cond.notify_all();
+    return pdPASS;
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount)
+{
+    mock_queue *q = xQueueCreate(uxMaxCount, 0);
+    q->is_semaphore = true;
+    q->count = uxInitialCount;
+    return q;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return xSemaphoreCreateCounting(1, 1);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+    return xQueueReceive(xSemaphore, NULL, xBlockTime);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    return xQueueSend(xSemaphore, NULL, 0);
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t xSemaphore)
+{
+    return uxQueueMessagesWaiting(xSemaphore);
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "esp_heap_caps.h"
+#include "img_converters.h"
+#include "jpeg_encoder.h"
+
+// Encode `src` into `jpg`. Grayscale frames go through the mock encoder;
+// for other raw formats there's no encoder on the host, so they become a
+// minimal, valid-looking JPEG shell.
+static bool encode(const uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality,
+    std::vector<uint8_t> &jpg)
+{
+    if (format == PIXFORMAT_GRAYSCALE) {
+        if (src_len < (size_t)width * height) {
+            return false;
+        }
+        // Converter quality is 0-100, higher is better; the sensor's 0-63
+        // scale runs the other way
+        std::vector<uint8_t> chroma(((width + 1) / 2) * height, 128);
+        mock_jpeg_encode_422(src, chroma.data(), chroma.data(), width, height, (100 - quality) * 63 / 100, jpg);
+        return true;
+    }
+    static const uint8_t shell[] = { 0xFF, 0xD8, 0xFF, 0xD9 };
+    jpg.assign(shell, shell + sizeof(shell));
+    return true;
+}
+
+bool fmt2jpg_cb(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, jpg_out_cb cb, void *arg)
+{
+    if (format == PIXFORMAT_JPEG) {
+        return cb(arg, 0, src, src_len) == src_len;
+    }
+    thread_local std::vector<uint8_t> jpg;
+    if (!encode(src, src_len, width, height, format, quality, jpg)) {
+        return false;
+    }
+    return cb(arg, 0, jpg.data(), jpg.size()) == jpg.size();
+}
+
+bool frame2jpg_cb(camera_fb_t *fb, uint8_t quality, jpg_out_cb cb, void *arg)
+{
+    return fmt2jpg_cb(fb->buf, fb->len, fb->width, fb->height, fb->format, quality, cb, arg);
+}
+
+bool fmt2jpg(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, uint8_t **out, size_t *out_len)
+{
+    thread_local std::vector<uint8_t> jpg;
+    const uint8_t *data = src;
+    size_t len = src_len;
+    if (format != PIXFORMAT_JPEG) {
+        if (!encode(src, src_len, width, height, format, quality, jpg)) {
+            return false;
+        }
+        data = jpg.data();
+        len = jpg.size();
+    }
+    // The device library mallocs a fresh output buffer every call
+    mock_heap_note_allocation();
+    *out = (uint8_t *)malloc(len);
+    if (!*out) {
+        return false;
+    }
+    memcpy(*out, data, len);
+    *out_len = len;
+    return true;
+}
+
+bool frame2jpg(camera_fb_t *fb, uint8_t quality, uint8_t **out, size_t *out_len)
+{
+    return fmt2jpg(fb->buf, fb->len, fb->width, fb->height, fb->format, quality, out, out_len);
+}
+
+bool fmt2rgb888(const uint8_t *src_buf, size_t src_len, pixformat_t format, uint8_t *rgb_buf)
+{
+    // Callers size rgb_buf from the frame dimensions, which we don't have here
+    rgb_buf[0] = 0x80;
+    return true;
+}
@@ -0,0 +1,325 @@
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "jpeg_encoder.h"
+
+// Natural (row-major) index of each zig-zag position
+const uint8_t mock_jpeg_zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// ITU T.81 Annex K tables, natural order
+static const uint8_t std_luma_quant[64] = {
+    16, 11, 10, 16,  24,  40,  51,  61,
+    12, 12, 14, 19,  26,  58,  60,  55,
+    14, 13, 16, 24,  40,  57,  69,  56,
+    14, 17, 22, 29,  51,  87,  80,  62,
+    18, 22, 37, 56,  68, 109, 103,  77,
+    24, 35, 55, 64,  81, 104, 113,  92,
+    49, 64, 78, 87, 103, 121, 120, 101,
+    72, 92, 95, 98, 112, 100, 103,  99,
+};
+
+static const uint8_t std_chroma_quant[64] = {
+    17, 18, 24, 47, 99, 99, 99, 99,
+    18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99,
+    47, 66, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+};
+
+static const uint8_t dc_luma_bits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t dc_chroma_bits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t dc_values[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t ac_luma_bits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+static const uint8_t ac_luma_values[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static const uint8_t ac_chroma_bits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t ac_chroma_values[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+struct huffman_table {
+    uint16_t code[256];
+    uint8_t length[256];
+};
+
+static void build_table(const uint8_t bits[16], const uint8_t *values, huffman_table &table)
+{
+    memset(&table, 0, sizeof(table));
+    uint16_t code = 0;
+    int k = 0;
+    for (int len = 1; len <= 16; len++) {
+        for (int i = 0; i < bits[len - 1]; i++, k++) {
+            table.code[values[k]] = code++;
+            table.length[values[k]] = len;
+        }
+        code <<= 1;
+    }
+}
+
+struct bit_writer {
+    std::vector<uint8_t> &out;
+    uint32_t buffer = 0;
+    int count = 0;
+
+    explicit bit_writer(std::vector<uint8_t> &o) : out(o) {}
+
+    void put(uint32_t bits, int len)
+    {
+        buffer = (buffer << len) | (bits & ((1u << len) - 1));
+        count += len;
+        while (count >= 8) {
+            uint8_t byte = (buffer >> (count - 8)) & 0xFF;
+            out.push_back(byte);
+            if (byte == 0xFF) {
+                out.push_back(0x00); // byte stuffing
+            }
+            count -= 8;
+        }
+    }
+
+    void flush()
+    {
+        if (count > 0) {
+            put(0x7F, 8 - count); // pad with ones
+        }
+    }
+};
+
+static int magnitude_category(int value)
+{
+    int v = value < 0 ? -value : value;
+    int bits = 0;
+    while (v) {
+        bits++;
+        v >>= 1;
+    }
+    return bits;
+}
+
+static void put_value(bit_writer &w, int value, int category)
+{
+    if (value < 0) {
+        value += (1 << category) - 1;
+    }
+    w.put(value, category);
+}
+
+// Forward DCT of one level-shifted 8x8 block, quantised into zig-zag order
+static void fdct_quantise(const float block[64], const uint8_t quant_zz[64], int out_zz[64])
+{
+    struct cosine_table {
+        float c[8][8];
+        cosine_table()
+        {
+            for (int x = 0; x < 8; x++) {
+                for (int u = 0; u < 8; u++) {
+                    c[x][u] = cosf((2 * x + 1) * u * (float)M_PI / 16);
+                }
+            }
+        }
+    };
+    static const cosine_table table;
+    const auto &cosines = table.c;
+    float rows[64];
+    for (int y = 0; y < 8; y++) {
+        for (int u = 0; u < 8; u++) {
+            float sum = 0;
+            for (int x = 0; x < 8; x++) {
+                sum += block[y * 8 + x] * cosines[x][u];
+            }
+            rows[y * 8 + u] = sum * (u == 0 ? (float)M_SQRT1_2 : 1.0f) / 2;
+        }
+    }
+    for (int k = 0; k < 64; k++) {
+        int u = mock_jpeg_zigzag[k] % 8;
+        int v = mock_jpeg_zigzag[k] / 8;
+        float sum = 0;
+        for (int y = 0; y < 8; y++) {
+            sum += rows[y * 8 + u] * cosines[y][v];
+        }
+        sum *= (v == 0 ? (float)M_SQRT1_2 : 1.0f) / 2;
+        out_zz[k] = (int)lroundf(sum / quant_zz[k]);
+    }
+}
+
+static void encode_block(bit_writer &w, const int zz[64], int &prev_dc,
+    const huffman_table &dc, const huffman_table &ac)
+{
+    int diff = zz[0] - prev_dc;
+    prev_dc = zz[0];
+    int category = magnitude_category(diff);
+    w.put(dc.code[category], dc.length[category]);
+    put_value(w, diff, category);
+
+    int run = 0;
+    for (int k = 1; k < 64; k++) {
+        if (zz[k] == 0) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            w.put(ac.code[0xF0], ac.length[0xF0]);
+            run -= 16;
+        }
+        category = magnitude_category(zz[k]);
+        int symbol = (run << 4) | category;
+        w.put(ac.code[symbol], ac.length[symbol]);
+        put_value(w, zz[k], category);
+        run = 0;
+    }
+    if (run > 0) {
+        w.put(ac.code[0x00], ac.length[0x00]);
+    }
+}
+
+void mock_jpeg_quant_tables(int quality, uint8_t luma[64], uint8_t chroma[64])
+{
+    // Map the sensor's 0 (best) to 63 (worst) onto the libjpeg 1-100 scale
+    int q = std::min(95, std::max(5, 100 - quality * 3 / 2));
+    int scale = q < 50 ? 5000 / q : 200 - 2 * q;
+    for (int k = 0; k < 64; k++) {
+        int n = mock_jpeg_zigzag[k];
+        luma[k] = std::min(255, std::max(1, (std_luma_quant[n] * scale + 50) / 100));
+        chroma[k] = std::min(255, std::max(1, (std_chroma_quant[n] * scale + 50) / 100));
+    }
+}
+
+static void append_segment(std::vector<uint8_t> &out, uint8_t marker, const std::vector<uint8_t> &body)
+{
+    out.push_back(0xFF);
+    out.push_back(marker);
+    out.push_back((body.size() + 2) >> 8);
+    out.push_back((body.size() + 2) & 0xFF);
+    out.insert(out.end(), body.begin(), body.end());
+}
+
+static void append_huffman(std::vector<uint8_t> &body, uint8_t id, const uint8_t bits[16], const uint8_t *values)
+{
+    body.push_back(id);
+    body.insert(body.end(), bits, bits + 16);
+    int n = 0;
+    for (int i = 0; i < 16; i++) {
+        n += bits[i];
+    }
+    body.insert(body.end(), values, values + n);
+}
+
+void mock_jpeg_append_std_huffman(std::vector<uint8_t> &out)
+{
+    std::vector<uint8_t> body;
+    append_huffman(body, 0x00, dc_luma_bits, dc_values);
+    append_huffman(body, 0x10, ac_luma_bits, ac_luma_values);
+    append_huffman(body, 0x01, dc_chroma_bits, dc_values);
+    append_huffman(body, 0x11, ac_chroma_bits, ac_chroma_values);
+    append_segment(out, 0xC4, body);
+}
+
+void mock_jpeg_encode_422(const uint8_t *y, const uint8_t *cb, const uint8_t *cr,
+    int width, int height, int quality, std::vector<uint8_t> &out)
+{
+    uint8_t luma_q[64], chroma_q[64];
+    mock_jpeg_quant_tables(quality, luma_q, chroma_q);
+
+    out.clear();
+    out.push_back(0xFF);
+    out.push_back(0xD8);
+
+    std::vector<uint8_t> body;
+    body.push_back(0x00);
+    body.insert(body.end(), luma_q, luma_q + 64);
+    body.push_back(0x01);
+    body.insert(body.end(), chroma_q, chroma_q + 64);
+    append_segment(out, 0xDB, body);
+
+    body = {
+        8, (uint8_t)(height >> 8), (uint8_t)height, (uint8_t)(width >> 8), (uint8_t)width, 3,
+        1, 0x21, 0, // Y: 2x1 sampling, table 0
+        2, 0x11, 1, // Cb
+        3, 0x11, 1, // Cr
+    };
+    append_segment(out, 0xC0, body);
+    mock_jpeg_append_std_huffman(out);
+    body = { 3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0 };
+    append_segment(out, 0xDA, body);
+
+    struct std_tables {
+        huffman_table dc_luma, ac_luma, dc_chroma, ac_chroma;
+        std_tables()
+        {
+            build_table(dc_luma_bits, dc_values, dc_luma);
+            build_table(ac_luma_bits, ac_luma_values, ac_luma);
+            build_table(dc_chroma_bits, dc_values, dc_chroma);
+            build_table(ac_chroma_bits, ac_chroma_values, ac_chroma);
+        }
+    };
+    static const std_tables tables;
+    const huffman_table &dc_luma = tables.dc_luma, &ac_luma = tables.ac_luma;
+    const huffman_table &dc_chroma = tables.dc_chroma, &ac_chroma = tables.ac_chroma;
+
+    bit_writer w(out);
+    int chroma_width = (width + 1) / 2;
+    int prev_y = 0, prev_cb = 0, prev_cr = 0;
+    float block[64];
+    int zz[64];
+    // Edge pixels are repeated to fill partial MCUs
+    auto sample = [](const uint8_t *plane, int stride, int w, int h, int px, int py) {
+        return (float)plane[std::min(py, h - 1) * stride + std::min(px, w - 1)] - 128;
+    };
+    for (int my = 0; my < height; my += 8) {
+        for (int mx = 0; mx < width; mx += 16) {
+            for (int half = 0; half < 2; half++) {
+                for (int i = 0; i < 64; i++) {
+                    block[i] = sample(y, width, width, height, mx + half * 8 + i % 8, my + i / 8);
+                }
+                fdct_quantise(block, luma_q, zz);
+                encode_block(w, zz, prev_y, dc_luma, ac_luma);
+            }
+            for (int i = 0; i < 64; i++) {
+                block[i] = sample(cb, chroma_width, chroma_width, height, mx / 2 + i % 8, my + i / 8);
+            }
+            fdct_quantise(block, chroma_q, zz);
+            encode_block(w, zz, prev_cb, dc_chroma, ac_chroma);
+            for (int i = 0; i < 64; i++) {
+                block[i] = sample(cr, chroma_width, chroma_width, height, mx / 2 + i % 8, my + i / 8);
+            }
+            fdct_quantise(block, chroma_q, zz);
+            encode_block(w, zz, prev_cr, dc_chroma, ac_chroma);
+        }
+    }
+    w.flush();
+    out.push_back(0xFF);
+    out.push_back(0xD9);
+}
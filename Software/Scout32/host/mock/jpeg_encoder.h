@@ -0,0 +1,28 @@
+// Minimal baseline JPEG encoder for synthesised mock camera frames.
+//
+// Produces what the OV2640 does: YCbCr 4:2:2 (two 8x8 luma blocks per
+// chroma pair), the standard Annex K Huffman tables and quantisation
+// tables scaled by the sensor's 0-63 quality setting (lower is better).
+#ifndef MOCK_JPEG_ENCODER_H
+#define MOCK_JPEG_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+// Planes are row-major. `cb` and `cr` are horizontally subsampled: each is
+// (width + 1) / 2 samples wide and `height` rows high.
+void mock_jpeg_encode_422(const uint8_t *y, const uint8_t *cb, const uint8_t *cr,
+    int width, int height, int quality, std::vector<uint8_t> &out);
+
+// Luma and chroma quantisation tables for a sensor quality, zig-zag order
+void mock_jpeg_quant_tables(int quality, uint8_t luma[64], uint8_t chroma[64]);
+
+// Append a DHT segment holding the four standard tables, as RFC 2435
+// receivers have to when rebuilding a JPEG header
+void mock_jpeg_append_std_huffman(std::vector<uint8_t> &out);
+
+extern const uint8_t mock_jpeg_zigzag[64];
+
+#endif
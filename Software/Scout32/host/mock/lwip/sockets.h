@@ -0,0 +1,24 @@
+// Host stand-in for lwIP's BSD socket API: the host's own sockets, so UDP
+// senders in the firmware put real datagrams on the loopback interface.
+// Calls that can reach an httpd connection go through the mock server,
+// which owns those descriptors, the way lwIP maps them to lwip_*() names.
+#ifndef LWIP_HDR_SOCKETS_H
+#define LWIP_HDR_SOCKETS_H
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+ssize_t lwip_sendmsg(int s, const struct msghdr *msg, int flags);
+int lwip_setsockopt(int s, int level, int optname, const void *optval, socklen_t optlen);
+int lwip_getpeername(int s, struct sockaddr *name, socklen_t *namelen);
+
+#define sendmsg(s, message, flags) lwip_sendmsg(s, message, flags)
+#define setsockopt(s, level, optname, opval, optlen) lwip_setsockopt(s, level, optname, opval, optlen)
+#define getpeername(s, name, namelen) lwip_getpeername(s, name, namelen)
+
+#endif
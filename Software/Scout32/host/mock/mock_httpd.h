@@ -0,0 +1,77 @@
+// Host-only client side of the mock esp_http_server.
+#ifndef MOCK_HTTPD_H
+#define MOCK_HTTPD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "esp_http_server.h"
+
+// Receives a handler's response. Override on_body() to consume streaming
+// responses; returning anything but ESP_OK makes the pending send fail, as
+// if the client had disconnected.
+class mock_httpd_client {
+public:
+    virtual ~mock_httpd_client() {}
+    virtual esp_err_t on_body(const char *data, size_t len) {
+        body.append(data, len);
+        return ESP_OK;
+    }
+    // WebSocket frames sent by the server
+    virtual void on_ws_frame(httpd_ws_type_t type, const uint8_t *data, size_t len) {}
+
+    // Request side
+    std::vector<std::pair<std::string, std::string>> request_headers;
+    std::string request_body;
+    // Carry the response over a real loopback TCP connection (MSS as on
+    // the ESP32) rather than handing it over in-process
+    bool tcp = false;
+
+    // Response side, filled in by the server
+    std::string status;
+    std::string content_type;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    bool chunked = false;
+    size_t body_bytes = 0;   // payload bytes handed to the client
+    size_t wire_bytes = 0;   // payload plus status line, headers and chunk framing
+    size_t socket_writes = 0; // send() calls the server would have made
+    size_t tcp_segments = 0;  // data segments on the wire, with `tcp`
+    int64_t handler_ns = 0;   // time in the handler on the server's task
+    int sockfd = -1;          // what httpd_req_to_sockfd() reported
+    bool nodelay = false;     // TCP_NODELAY as set by the handler
+    int sndbuf = 0;           // SO_SNDBUF as set by the handler
+
+    const char *header(const char *name) const;
+
+    void *ws_session = nullptr; // set by mock_httpd_ws_connect()
+};
+
+// Run the handler registered for `uri` (which may carry a ?query) on the
+// task of the server listening on `port` and wait for it. Returns ESP_ERR_NOT_FOUND
+// if nothing matches (the client then sees a 404 like on the device),
+// otherwise what the handler returned.
+esp_err_t mock_httpd_request(uint16_t port, httpd_method_t method, const char *uri, mock_httpd_client &client);
+
+// Open a WebSocket to `uri`: runs the handshake call of its handler. The
+// session lives until mock_httpd_ws_close().
+esp_err_t mock_httpd_ws_connect(uint16_t port, const char *uri, mock_httpd_client &client);
+
+// Deliver one client-to-server frame, running the handler in the calling
+// thread. Returns what the handler returned; on error the server closes the
+// session, as it would on the device.
+esp_err_t mock_httpd_ws_send(mock_httpd_client &client, httpd_ws_type_t type, const void *data, size_t len);
+void mock_httpd_ws_close(mock_httpd_client &client);
+
+// Number of handlers registered on the server listening on `port`.
+int mock_httpd_handler_count(uint16_t port);
+
+// Stack high-water mark of the task of the server on `port`, in bytes
+// (see uxTaskGetStackHighWaterMark), or -1 if there's no such server.
+int mock_httpd_stack_free(uint16_t port);
+
+#endif
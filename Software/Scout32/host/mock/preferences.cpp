@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Preferences.h"
+
+static std::mutex nvs_lock;
+static std::map<std::string, std::vector<uint8_t>> store; // "namespace/key"
+static std::string nvs_path;
+static unsigned writes = 0;
+
+// File format: repeated [u32 name length][name][u32 value length][value]
+static void load()
+{
+    store.clear();
+    FILE *f = fopen(nvs_path.c_str(), "rb");
+    if (!f) {
+        return;
+    }
+    uint32_t len;
+    while (fread(&len, sizeof(len), 1, f) == 1) {
+        std::string name(len, '\0');
+        std::vector<uint8_t> value;
+        if (fread(&name[0], 1, len, f) != len || fread(&len, sizeof(len), 1, f) != 1) {
+            break;
+        }
+        value.resize(len);
+        if (fread(value.data(), 1, len, f) != len) {
+            break;
+        }
+        store[name] = value;
+    }
+    fclose(f);
+}
+
+static void save()
+{
+    writes++;
+    if (nvs_path.empty()) {
+        return;
+    }
+    FILE *f = fopen(nvs_path.c_str(), "wb");
+    if (!f) {
+        return;
+    }
+    for (const auto &entry : store) {
+        uint32_t len = entry.first.size();
+        fwrite(&len, sizeof(len), 1, f);
+        fwrite(entry.first.data(), 1, len, f);
+        len = entry.second.size();
+        fwrite(&len, sizeof(len), 1, f);
+        fwrite(entry.second.data(), 1, len, f);
+    }
+    fclose(f);
+}
+
+void mock_nvs_set_path(const char *path)
+{
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    nvs_path = path ? path : "";
+    if (path) {
+        load();
+    }
+}
+
+unsigned mock_nvs_writes(void)
+{
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    return writes;
+}
+
+bool Preferences::begin(const char *name, bool readOnly)
+{
+    name_ = name;
+    open_ = true;
+    read_only_ = readOnly;
+    return true;
+}
+
+void Preferences::end()
+{
+    open_ = false;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len)
+{
+    if (!open_ || read_only_) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    store[name_ + "/" + key].assign((const uint8_t *)value, (const uint8_t *)value + len);
+    save();
+    return len;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen)
+{
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    auto it = store.find(name_ + "/" + key);
+    if (!open_ || it == store.end() || it->second.size() > maxLen) {
+        return 0;
+    }
+    std::copy(it->second.begin(), it->second.end(), (uint8_t *)buf);
+    return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    auto it = store.find(name_ + "/" + key);
+    return open_ && it != store.end() ? it->second.size() : 0;
+}
+
+bool Preferences::remove(const char *key)
+{
+    if (!open_ || read_only_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    bool removed = store.erase(name_ + "/" + key) > 0;
+    if (removed) {
+        save();
+    }
+    return removed;
+}
+
+bool Preferences::clear()
+{
+    if (!open_ || read_only_) {
+        return false;
+    }
+    std::lock_guard<std::mutex> guard(nvs_lock);
+    std::string prefix = name_ + "/";
+    for (auto it = store.begin(); it != store.end();) {
+        it = it->first.compare(0, prefix.size(), prefix) == 0 ? store.erase(it) : std::next(it);
+    }
+    save();
+    return true;
+}
@@ -0,0 +1,8 @@
+// Host stand-in for ESP-IDF's soc/rtc_cntl_reg.h
+#ifndef _SOC_RTC_CNTL_REG_H_
+#define _SOC_RTC_CNTL_REG_H_
+
+#define DR_REG_RTCCNTL_BASE 0x3ff48000
+#define RTC_CNTL_BROWN_OUT_REG (DR_REG_RTCCNTL_BASE + 0xd4)
+
+#endif
@@ -0,0 +1,11 @@
+// Host stand-in for ESP-IDF's soc/soc.h
+#ifndef _SOC_SOC_H_
+#define _SOC_SOC_H_
+
+#include <stdint.h>
+
+// There are no peripheral registers on the host; writes are dropped.
+#define WRITE_PERI_REG(addr, val) ((void)(addr), (void)(val))
+#define READ_PERI_REG(addr) ((void)(addr), 0u)
+
+#endif
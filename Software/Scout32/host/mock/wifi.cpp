@@ -0,0 +1,196 @@
+#include <atomic>
+#include <string.h>
+
+#include "WiFi.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+
+WiFiClass WiFi;
+
+static std::atomic<int> wifi_mode(WIFI_MODE_NULL);
+static std::atomic<int64_t> connect_at_us(-1);
+static std::atomic<int8_t> rssi(-60);
+static std::atomic<bool> sleep_enabled(true);
+static std::atomic<int> power_save(WIFI_PS_MIN_MODEM);
+static uint32_t full_connect_ms = 1500; // scan every channel, associate, DHCP
+static uint32_t fast_connect_ms = 250;  // known BSSID/channel and static IP
+static uint8_t bssid[6] = { 0x24, 0x0a, 0xc4, 0x00, 0x00, 0x01 };
+static int32_t ap_channel = 6;
+static IPAddress static_ip;
+
+IPAddress::IPAddress(uint32_t address)
+{
+    addr_[0] = address & 0xFF;
+    addr_[1] = (address >> 8) & 0xFF;
+    addr_[2] = (address >> 16) & 0xFF;
+    addr_[3] = (address >> 24) & 0xFF;
+}
+
+IPAddress::operator uint32_t() const
+{
+    return addr_[0] | (addr_[1] << 8) | (addr_[2] << 16) | ((uint32_t)addr_[3] << 24);
+}
+
+String IPAddress::toString() const
+{
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr_[0], addr_[1], addr_[2], addr_[3]);
+    return String(buf);
+}
+
+size_t IPAddress::printTo(Print &p) const
+{
+    return p.print(toString());
+}
+
+bool WiFiClass::mode(wifi_mode_t mode)
+{
+    wifi_mode = mode;
+    return true;
+}
+
+wifi_mode_t WiFiClass::getMode()
+{
+    return (wifi_mode_t)wifi_mode.load();
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase, int32_t channel, const uint8_t *bssid_hint, bool connect)
+{
+    bool fast = channel > 0 && bssid_hint != NULL;
+    uint32_t ms = fast ? fast_connect_ms : full_connect_ms;
+    if (!static_ip) {
+        ms += fast ? 150 : 0; // DHCP round trip on top of the fast path
+    }
+    if (fast && (channel != ap_channel || memcmp(bssid_hint, bssid, sizeof(bssid)) != 0)) {
+        // Waiting for an access point that isn't there any more
+        connect_at_us = -1;
+        return WL_DISCONNECTED;
+    }
+    if (connect) {
+        connect_at_us = esp_timer_get_time() + (int64_t)ms * 1000;
+    }
+    return WL_DISCONNECTED;
+}
+
+bool WiFiClass::config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2)
+{
+    static_ip = local_ip;
+    return true;
+}
+
+bool WiFiClass::disconnect(bool wifioff)
+{
+    connect_at_us = -1;
+    return true;
+}
+
+wl_status_t WiFiClass::status()
+{
+    int64_t at = connect_at_us;
+    if (at < 0) {
+        return WL_DISCONNECTED;
+    }
+    return esp_timer_get_time() >= at ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+bool WiFiClass::softAP(const char *ssid, const char *passphrase, int channel, int ssid_hidden, int max_connection)
+{
+    return true;
+}
+
+IPAddress WiFiClass::localIP()
+{
+    if (status() != WL_CONNECTED) {
+        return IPAddress();
+    }
+    return static_ip ? static_ip : IPAddress(192, 168, 1, 50);
+}
+
+IPAddress WiFiClass::gatewayIP()
+{
+    return status() == WL_CONNECTED ? IPAddress(192, 168, 1, 1) : IPAddress();
+}
+
+IPAddress WiFiClass::subnetMask()
+{
+    return status() == WL_CONNECTED ? IPAddress(255, 255, 255, 0) : IPAddress();
+}
+
+IPAddress WiFiClass::dnsIP(uint8_t dns_no)
+{
+    return status() == WL_CONNECTED && dns_no == 0 ? IPAddress(192, 168, 1, 1) : IPAddress();
+}
+
+IPAddress WiFiClass::softAPIP()
+{
+    return IPAddress(192, 168, 4, 1);
+}
+
+uint8_t *WiFiClass::BSSID()
+{
+    return bssid;
+}
+
+int32_t WiFiClass::channel()
+{
+    return ap_channel;
+}
+
+int8_t WiFiClass::RSSI()
+{
+    return rssi;
+}
+
+bool WiFiClass::setSleep(bool enable)
+{
+    sleep_enabled = enable;
+    power_save = enable ? WIFI_PS_MIN_MODEM : WIFI_PS_NONE;
+    return true;
+}
+
+bool WiFiClass::getSleep()
+{
+    return sleep_enabled;
+}
+
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type)
+{
+    power_save = type;
+    sleep_enabled = type != WIFI_PS_NONE;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_ps(wifi_ps_type_t *type)
+{
+    *type = (wifi_ps_type_t)power_save.load();
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t *sta)
+{
+    memset(sta, 0, sizeof(*sta));
+    if (wifi_mode != WIFI_MODE_AP && wifi_mode != WIFI_MODE_APSTA) {
+        return ESP_FAIL;
+    }
+    sta->num = 1;
+    sta->sta[0].mac[0] = 0x02;
+    sta->sta[0].rssi = rssi;
+    return ESP_OK;
+}
+
+void mock_wifi_set_connect_time_ms(uint32_t full_scan_ms, uint32_t fast_ms)
+{
+    full_connect_ms = full_scan_ms;
+    fast_connect_ms = fast_ms;
+}
+
+void mock_wifi_move_ap(int32_t channel)
+{
+    ap_channel = channel;
+    bssid[5]++;
+}
+
+void mock_wifi_set_rssi(int8_t value)
+{
+    rssi = value;
+}
@@ -0,0 +1,288 @@
+#include <Arduino.h>
+#include "jpeg_reader.h"
+
+const uint8_t jpeg_zigzag[64] = {
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static uint16_t read16(const uint8_t * p){
+    return (p[0] << 8) | p[1];
+}
+
+static bool build_huffman(jpeg_huffman_t * t, const uint8_t * counts, const uint8_t * symbols, int nsymbols){
+    memcpy(t->symbols, symbols, nsymbols);
+    memset(t->lookup_len, 0, sizeof(t->lookup_len));
+    int32_t code = 0;
+    int k = 0;
+    for(int len = 1; len <= 16; len++){
+        t->valptr[len] = k;
+        t->mincode[len] = code;
+        for(int i = 0; i < counts[len - 1]; i++, k++, code++){
+            // More codes than this length has room for: a corrupt table
+            if(code >= (1 << len)){
+                return false;
+            }
+            if(len <= JPEG_LOOKUP_BITS){
+                int shift = JPEG_LOOKUP_BITS - len;
+                for(int fill = 0; fill < (1 << shift); fill++){
+                    t->lookup_len[(code << shift) | fill] = len;
+                    t->lookup_sym[(code << shift) | fill] = symbols[k];
+                }
+            }
+        }
+        t->maxcode[len] = counts[len - 1] ? code - 1 : -1;
+        code <<= 1;
+    }
+    t->maxcode[17] = 0x7FFFFFFF;
+    t->present = true;
+    return true;
+}
+
+bool jpegParse(jpeg_reader_t * jpeg, const uint8_t * buf, size_t len){
+    memset(jpeg, 0, sizeof(*jpeg));
+    if(len < 4 || buf[0] != 0xFF || buf[1] != 0xD8){
+        return false;
+    }
+    size_t i = 2;
+    while(i + 4 <= len){
+        if(buf[i] != 0xFF){
+            return false;
+        }
+        uint8_t marker = buf[i + 1];
+        if(marker == 0xFF){
+            i++;
+            continue;
+        }
+        size_t seg_len = read16(buf + i + 2);
+        const uint8_t * seg = buf + i + 4;
+        if(seg_len < 2 || i + 2 + seg_len > len){
+            return false;
+        }
+        size_t body_len = seg_len - 2;
+
+        if(marker == 0xDB){
+            for(size_t t = 0; t < body_len; ){
+                bool wide = seg[t] >> 4;
+                uint8_t id = seg[t] & 0x03;
+                if(t + (wide ? 129 : 65) > body_len){
+                    return false;
+                }
+                for(int k = 0; k < 64; k++){
+                    jpeg->quant[id][k] = wide ? read16(seg + t + 1 + 2 * k) : seg[t + 1 + k];
+                }
+                jpeg->quant_16bit[id] = wide;
+                t += wide ? 129 : 65;
+            }
+        } else if(marker == 0xC4){
+            for(size_t t = 0; t + 17 <= body_len; ){
+                uint8_t table_class = seg[t] >> 4;
+                uint8_t id = seg[t] & 0x0F;
+                const uint8_t * counts = seg + t + 1;
+                int nsymbols = 0;
+                for(int c = 0; c < 16; c++){
+                    nsymbols += counts[c];
+                }
+                if(id >= JPEG_HUFFMAN_TABLES || nsymbols > 256 || t + 17 + nsymbols > body_len ||
+                        !build_huffman(table_class ? &jpeg->ac[id] : &jpeg->dc[id], counts, seg + t + 17, nsymbols)){
+                    return false;
+                }
+                t += 17 + nsymbols;
+            }
+        } else if(marker == 0xC0 || marker == 0xC1){
+            if(body_len < 6 || seg[0] != 8){
+                return false;
+            }
+            jpeg->height = read16(seg + 1);
+            jpeg->width = read16(seg + 3);
+            jpeg->ncomps = seg[5];
+            if(jpeg->ncomps < 1 || jpeg->ncomps > JPEG_MAX_COMPONENTS || body_len < 6 + 3 * (size_t)jpeg->ncomps){
+                return false;
+            }
+            jpeg->hmax = 1;
+            jpeg->vmax = 1;
+            for(int c = 0; c < jpeg->ncomps; c++){
+                jpeg_component_t * comp = &jpeg->comps[c];
+                comp->id = seg[6 + 3 * c];
+                comp->h = seg[7 + 3 * c] >> 4;
+                comp->v = seg[7 + 3 * c] & 0x0F;
+                comp->tq = seg[8 + 3 * c] & 0x03;
+                if(comp->h < 1 || comp->h > 2 || comp->v < 1 || comp->v > 2){
+                    return false;
+                }
+                jpeg->hmax = max(jpeg->hmax, (int)comp->h);
+                jpeg->vmax = max(jpeg->vmax, (int)comp->v);
+            }
+        } else if(marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC){
+            // Progressive, lossless, arithmetic coded...
+            return false;
+        } else if(marker == 0xDD){
+            if(body_len < 2){
+                return false;
+            }
+            jpeg->restart_interval = read16(seg);
+        } else if(marker == 0xDA){
+            // Only single-scan interleaved images, which is what the OV2640
+            // produces
+            // Count, a selector pair per component, then Ss, Se and Ah/Al
+            if(!jpeg->ncomps || body_len < 4 + 2 * (size_t)jpeg->ncomps || seg[0] != jpeg->ncomps){
+                return false;
+            }
+            for(int s = 0; s < jpeg->ncomps; s++){
+                jpeg_component_t * comp = NULL;
+                for(int c = 0; c < jpeg->ncomps; c++){
+                    if(jpeg->comps[c].id == seg[1 + 2 * s]){
+                        comp = &jpeg->comps[c];
+                    }
+                }
+                if(!comp){
+                    return false;
+                }
+                comp->td = seg[2 + 2 * s] >> 4;
+                comp->ta = seg[2 + 2 * s] & 0x0F;
+                if(comp->td >= JPEG_HUFFMAN_TABLES || comp->ta >= JPEG_HUFFMAN_TABLES ||
+                        !jpeg->dc[comp->td].present || !jpeg->ac[comp->ta].present){
+                    return false;
+                }
+            }
+            jpeg->scan = buf + i + 2 + seg_len;
+            jpeg->end = buf + len;
+            break;
+        }
+        i += 2 + seg_len;
+    }
+    if(!jpeg->scan || !jpeg->width || !jpeg->height){
+        return false;
+    }
+    jpeg->mcus_x = (jpeg->width + 8 * jpeg->hmax - 1) / (8 * jpeg->hmax);
+    jpeg->mcus_y = (jpeg->height + 8 * jpeg->vmax - 1) / (8 * jpeg->vmax);
+    jpeg->br.p = jpeg->scan;
+    jpeg->br.end = jpeg->end;
+    return true;
+}
+
+static void fill(jpeg_bit_reader_t * br){
+    while(br->count <= 24){
+        uint8_t byte = 0;
+        if(!br->marker && br->p < br->end){
+            byte = *br->p;
+            if(byte == 0xFF){
+                if(br->p + 1 < br->end && br->p[1] == 0x00){
+                    br->p += 2;
+                } else {
+                    br->marker = true;
+                    byte = 0;
+                }
+            } else {
+                br->p++;
+            }
+        }
+        br->bits |= (uint32_t)byte << (24 - br->count);
+        br->count += 8;
+    }
+}
+
+static uint32_t get_bits(jpeg_bit_reader_t * br, int n){
+    if(!n){
+        return 0;
+    }
+    fill(br);
+    uint32_t value = br->bits >> (32 - n);
+    br->bits <<= n;
+    br->count -= n;
+    return value;
+}
+
+static int decode(jpeg_bit_reader_t * br, const jpeg_huffman_t * t){
+    fill(br);
+    uint32_t peek = br->bits >> (32 - JPEG_LOOKUP_BITS);
+    int len = t->lookup_len[peek];
+    if(len){
+        br->bits <<= len;
+        br->count -= len;
+        return t->lookup_sym[peek];
+    }
+    int32_t code = br->bits >> (32 - (JPEG_LOOKUP_BITS + 1));
+    for(len = JPEG_LOOKUP_BITS + 1; len <= 16; len++){
+        if(code <= t->maxcode[len]){
+            br->bits <<= len;
+            br->count -= len;
+            return t->symbols[t->valptr[len] + code - t->mincode[len]];
+        }
+        code = br->bits >> (32 - (len + 1));
+    }
+    return -1;
+}
+
+static int extend(uint32_t value, int size){
+    return value < (1u << (size - 1)) ? (int)value - (1 << size) + 1 : (int)value;
+}
+
+// Skip to just past the next RSTn marker and reset the DC predictors
+static bool restart(jpeg_reader_t * jpeg){
+    jpeg_bit_reader_t * br = &jpeg->br;
+    const uint8_t * p = br->p;
+    while(p + 1 < br->end && !(p[0] == 0xFF && p[1] >= 0xD0 && p[1] <= 0xD7)){
+        p++;
+    }
+    if(p + 1 >= br->end){
+        return false;
+    }
+    br->p = p + 2;
+    br->bits = 0;
+    br->count = 0;
+    br->marker = false;
+    for(int c = 0; c < jpeg->ncomps; c++){
+        jpeg->comps[c].pred = 0;
+    }
+    return true;
+}
+
+bool jpegStartMcu(jpeg_reader_t * jpeg, int mcu){
+    if(jpeg->restart_interval && mcu && mcu % jpeg->restart_interval == 0){
+        return restart(jpeg);
+    }
+    return true;
+}
+
+bool jpegDecodeBlock(jpeg_reader_t * jpeg, jpeg_component_t * comp, int16_t * coefs){
+    jpeg_bit_reader_t * br = &jpeg->br;
+    int size = decode(br, &jpeg->dc[comp->td]);
+    if(size < 0 || size > 11){
+        return false;
+    }
+    if(size){
+        comp->pred += extend(get_bits(br, size), size);
+    }
+    if(coefs){
+        memset(coefs, 0, 64 * sizeof(int16_t));
+        coefs[0] = comp->pred;
+    }
+    const jpeg_huffman_t * ac = &jpeg->ac[comp->ta];
+    for(int k = 1; k < 64; ){
+        int rs = decode(br, ac);
+        if(rs < 0){
+            return false;
+        }
+        int bits = rs & 0x0F;
+        if(bits == 0){
+            if(rs != 0xF0){
+                break;
+            }
+            k += 16;
+            continue;
+        }
+        k += rs >> 4;
+        if(k > 63){
+            return false;
+        }
+        uint32_t value = get_bits(br, bits);
+        if(coefs){
+            coefs[k] = extend(value, bits);
+        }
+        k++;
+    }
+    return true;
+}
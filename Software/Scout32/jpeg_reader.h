@@ -0,0 +1,78 @@
+#ifndef jpeg_reader_h
+#define jpeg_reader_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Baseline JPEG entropy decoding, down to quantized DCT coefficients and no
+// further: no IDCT, no colour conversion. Takes single-scan, Huffman coded
+// frames with up to three components sampled at most 2x2, which covers the
+// OV2640's output. Used where a frame only needs looking at in the DCT
+// domain (change detection, preview scaling).
+
+// Huffman codes up to this long are decoded with one table lookup
+const int JPEG_LOOKUP_BITS = 8;
+// The OV2640 uses tables 0 and 1, as does every other baseline encoder we'd
+// meet
+const int JPEG_HUFFMAN_TABLES = 2;
+const int JPEG_MAX_COMPONENTS = 3;
+
+// Natural (row-major) index of each zig-zag position
+extern const uint8_t jpeg_zigzag[64];
+
+typedef struct {
+    bool present;
+    uint8_t lookup_len[1 << JPEG_LOOKUP_BITS];  // 0: longer than JPEG_LOOKUP_BITS
+    uint8_t lookup_sym[1 << JPEG_LOOKUP_BITS];
+    int32_t maxcode[18];                        // largest code of each length, -1 if none
+    int32_t valptr[17];                         // index of its first symbol
+    int32_t mincode[17];
+    uint8_t symbols[256];
+} jpeg_huffman_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t h, v;
+    uint8_t tq;
+    uint8_t td, ta;
+    int pred;       // DC predictor: the last block's DC coefficient
+} jpeg_component_t;
+
+typedef struct {
+    const uint8_t * p;
+    const uint8_t * end;
+    uint32_t bits;
+    int count;
+    bool marker;    // hit a marker: feed zeros from here on
+} jpeg_bit_reader_t;
+
+typedef struct {
+    uint16_t quant[4][64];      // zig-zag order
+    bool quant_16bit[4];
+    jpeg_huffman_t dc[JPEG_HUFFMAN_TABLES];
+    jpeg_huffman_t ac[JPEG_HUFFMAN_TABLES];
+    jpeg_component_t comps[JPEG_MAX_COMPONENTS];
+    int ncomps;
+    int width, height;
+    int hmax, vmax;             // largest sampling factors: an MCU is 8*hmax x 8*vmax pixels
+    int mcus_x, mcus_y;
+    int restart_interval;
+    const uint8_t * scan;
+    const uint8_t * end;
+    jpeg_bit_reader_t br;
+} jpeg_reader_t;
+
+// Read the headers up to the start of the scan. False for anything but a
+// baseline, single-scan frame.
+bool jpegParse(jpeg_reader_t * jpeg, const uint8_t * buf, size_t len);
+
+// Call before each MCU, in order: handles restart markers. False if the
+// data is corrupt.
+bool jpegStartMcu(jpeg_reader_t * jpeg, int mcu);
+
+// Decode the next block of `comp`, leaving its DC coefficient (predictor
+// applied) in comp->pred. With `coefs`, also fills in all 64 quantized
+// coefficients, zig-zag order; without, the AC coefficients are skipped.
+bool jpegDecodeBlock(jpeg_reader_t * jpeg, jpeg_component_t * comp, int16_t * coefs);
+
+#endif
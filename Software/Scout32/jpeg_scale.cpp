@@ -0,0 +1,505 @@
+#include <Arduino.h>
+#include <math.h>
+#include "jpeg_reader.h"
+#include "jpeg_scale.h"
+
+// ITU T.81 Annex K tables. Blocks are re-quantized, so they can use
+// symbols the source's own tables (possibly trimmed to what the source
+// needed) don't have.
+static const uint8_t dc_luma_bits[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+static const uint8_t dc_chroma_bits[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+static const uint8_t dc_values[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+static const uint8_t ac_luma_bits[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d};
+static const uint8_t ac_luma_values[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static const uint8_t ac_chroma_bits[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+static const uint8_t ac_chroma_values[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+typedef struct {
+    uint16_t code[256];
+    uint8_t size[256];
+} huffman_code_t;
+
+typedef struct {
+    huffman_code_t dc[2];       // luma, chroma
+    huffman_code_t ac[2];
+    float idct[3][4][4];        // 8/n-point reduced IDCT for n = 1, 2, 4: [log2 n][x][u]
+    uint8_t low[3][16];         // zig-zag positions of the lowest n x n frequencies, row-major
+} scale_tables_t;
+
+typedef struct {
+    uint8_t * p;
+    uint8_t * end;
+    uint32_t bits;
+    int count;
+    bool full;
+} bit_writer_t;
+
+static void build_code(huffman_code_t * t, const uint8_t * bits, const uint8_t * values){
+    memset(t, 0, sizeof(*t));
+    uint16_t code = 0;
+    int k = 0;
+    for(int len = 1; len <= 16; len++){
+        for(int i = 0; i < bits[len - 1]; i++, k++, code++){
+            t->code[values[k]] = code;
+            t->size[values[k]] = len;
+        }
+        code <<= 1;
+    }
+}
+
+static bool build_tables(scale_tables_t * t){
+    build_code(&t->dc[0], dc_luma_bits, dc_values);
+    build_code(&t->dc[1], dc_chroma_bits, dc_values);
+    build_code(&t->ac[0], ac_luma_bits, ac_luma_values);
+    build_code(&t->ac[1], ac_chroma_bits, ac_chroma_values);
+    // The 8-point basis sampled at n evenly spaced points, keeping its
+    // scale: a 1-point "IDCT" gives the block's mean
+    for(int shift = 0; shift < 3; shift++){
+        int n = 1 << shift;
+        for(int x = 0; x < n; x++){
+            for(int u = 0; u < n; u++){
+                float c = u ? 0.5f : 0.5f * M_SQRT1_2;
+                t->idct[shift][x][u] = c * cosf((2 * x + 1) * u * M_PI / (2 * n));
+            }
+        }
+        for(int k = 0; k < 64; k++){
+            int u = jpeg_zigzag[k] & 7;
+            int v = jpeg_zigzag[k] >> 3;
+            if(u < n && v < n){
+                t->low[shift][v * n + u] = k;
+            }
+        }
+    }
+    return true;
+}
+
+// Built on first use, by whichever sender task gets there first
+static const scale_tables_t * tables(){
+    static scale_tables_t t;
+    static bool built = build_tables(&t);
+    (void)built;
+    return &t;
+}
+
+static void put_byte(bit_writer_t * w, uint8_t byte){
+    if(w->p < w->end){
+        *w->p++ = byte;
+    } else {
+        w->full = true;
+    }
+}
+
+static void put_bits(bit_writer_t * w, uint32_t value, int size){
+    w->bits = (w->bits << size) | (value & ((1u << size) - 1));
+    w->count += size;
+    while(w->count >= 8){
+        uint8_t byte = w->bits >> (w->count - 8);
+        w->count -= 8;
+        put_byte(w, byte);
+        if(byte == 0xFF){
+            put_byte(w, 0x00);
+        }
+    }
+    w->bits &= (1u << w->count) - 1;
+}
+
+static void flush_bits(bit_writer_t * w){
+    if(w->count){
+        put_bits(w, 0x7F, 8 - w->count);
+    }
+}
+
+static void put16(bit_writer_t * w, uint16_t value){
+    put_byte(w, value >> 8);
+    put_byte(w, value & 0xFF);
+}
+
+static int bit_size(int value){
+    value = abs(value);
+    int size = 0;
+    while(value){
+        size++;
+        value >>= 1;
+    }
+    return size;
+}
+
+static void encode_block(bit_writer_t * w, const int16_t * zz, int * pred, const huffman_code_t * dc, const huffman_code_t * ac){
+    int diff = zz[0] - *pred;
+    *pred = zz[0];
+    int size = bit_size(diff);
+    put_bits(w, dc->code[size], dc->size[size]);
+    if(size){
+        put_bits(w, diff < 0 ? diff - 1 : diff, size);
+    }
+    int run = 0;
+    for(int k = 1; k < 64; k++){
+        int value = zz[k];
+        if(!value){
+            run++;
+            continue;
+        }
+        for(; run > 15; run -= 16){
+            put_bits(w, ac->code[0xF0], ac->size[0xF0]);
+        }
+        size = bit_size(value);
+        int symbol = (run << 4) | size;
+        put_bits(w, ac->code[symbol], ac->size[symbol]);
+        put_bits(w, value < 0 ? value - 1 : value, size);
+        run = 0;
+    }
+    if(run){
+        put_bits(w, ac->code[0x00], ac->size[0x00]);
+    }
+}
+
+static void put_huffman(bit_writer_t * w, uint8_t id, const uint8_t * bits, const uint8_t * values){
+    int count = 0;
+    for(int i = 0; i < 16; i++){
+        count += bits[i];
+    }
+    put_byte(w, id);
+    for(int i = 0; i < 16; i++){
+        put_byte(w, bits[i]);
+    }
+    for(int i = 0; i < count; i++){
+        put_byte(w, values[i]);
+    }
+}
+
+static void put_headers(bit_writer_t * w, const jpeg_reader_t * jpeg, int width, int height){
+    put16(w, 0xFFD8);
+
+    // The source's quantization tables, for the ones its components use
+    for(int id = 0; id < 4; id++){
+        bool used = false;
+        for(int c = 0; c < jpeg->ncomps; c++){
+            used |= jpeg->comps[c].tq == id;
+        }
+        if(!used){
+            continue;
+        }
+        bool wide = jpeg->quant_16bit[id];
+        put16(w, 0xFFDB);
+        put16(w, 2 + 1 + (wide ? 128 : 64));
+        put_byte(w, (wide << 4) | id);
+        for(int k = 0; k < 64; k++){
+            if(wide){
+                put16(w, jpeg->quant[id][k]);
+            } else {
+                put_byte(w, jpeg->quant[id][k]);
+            }
+        }
+    }
+
+    put16(w, 0xFFC0);
+    put16(w, 8 + 3 * jpeg->ncomps);
+    put_byte(w, 8);
+    put16(w, height);
+    put16(w, width);
+    put_byte(w, jpeg->ncomps);
+    for(int c = 0; c < jpeg->ncomps; c++){
+        put_byte(w, jpeg->comps[c].id);
+        put_byte(w, (jpeg->comps[c].h << 4) | jpeg->comps[c].v);
+        put_byte(w, jpeg->comps[c].tq);
+    }
+
+    // Luma uses tables 0, chroma tables 1
+    bool chroma = jpeg->ncomps > 1;
+    int dht_len = 2 + (17 + 12) + (17 + 162) + (chroma ? (17 + 12) + (17 + 162) : 0);
+    put16(w, 0xFFC4);
+    put16(w, dht_len);
+    put_huffman(w, 0x00, dc_luma_bits, dc_values);
+    put_huffman(w, 0x10, ac_luma_bits, ac_luma_values);
+    if(chroma){
+        put_huffman(w, 0x01, dc_chroma_bits, dc_values);
+        put_huffman(w, 0x11, ac_chroma_bits, ac_chroma_values);
+    }
+
+    put16(w, 0xFFDA);
+    put16(w, 6 + 2 * jpeg->ncomps);
+    put_byte(w, jpeg->ncomps);
+    for(int c = 0; c < jpeg->ncomps; c++){
+        put_byte(w, jpeg->comps[c].id);
+        put_byte(w, c ? 0x11 : 0x00);
+    }
+    put_byte(w, 0);
+    put_byte(w, 63);
+    put_byte(w, 0);
+}
+
+static int round_int(float x){
+    return (int)(x < 0 ? x - 0.5f : x + 0.5f);
+}
+
+// Dequantize the lowest n x n frequencies of a block and sample them at n x n
+// points into `out` (level shifted, stride `stride`)
+static void reduced_idct(const scale_tables_t * t, int shift, const int16_t * zz, const uint16_t * quant,
+        int16_t * out, int stride){
+    if(!shift){
+        out[0] = constrain(round_int(zz[0] * quant[0] * 0.125f), -128, 127);
+        return;
+    }
+    // Fixed 4x4 loops, which the compiler unrolls; the basis is zero
+    // past n, so smaller n just sum some zeros
+    int n = 1 << shift;
+    const float (* basis)[4] = t->idct[shift];
+    float coef[4][4] = {};
+    for(int i = 0; i < n * n; i++){
+        int k = t->low[shift][i];
+        coef[i >> shift][i & (n - 1)] = zz[k] * (float)quant[k];
+    }
+    float rows[4][4];
+    for(int v = 0; v < 4; v++){
+        for(int x = 0; x < 4; x++){
+            rows[v][x] = basis[x][0] * coef[v][0] + basis[x][1] * coef[v][1] +
+                basis[x][2] * coef[v][2] + basis[x][3] * coef[v][3];
+        }
+    }
+    for(int y = 0; y < n; y++){
+        for(int x = 0; x < n; x++){
+            float sum = basis[y][0] * rows[0][x] + basis[y][1] * rows[1][x] +
+                basis[y][2] * rows[2][x] + basis[y][3] * rows[3][x];
+            out[y * stride + x] = constrain(round_int(sum), -128, 127);
+        }
+    }
+}
+
+// One 8-point pass of the Arai-Agui-Nakajima DCT (as libjpeg's jfdctflt.c).
+// Its outputs are scaled per frequency; quant_divisors() folds that in.
+static void aan_fdct_8(float * d, int step){
+    float tmp0 = d[0] + d[7 * step];
+    float tmp7 = d[0] - d[7 * step];
+    float tmp1 = d[step] + d[6 * step];
+    float tmp6 = d[step] - d[6 * step];
+    float tmp2 = d[2 * step] + d[5 * step];
+    float tmp5 = d[2 * step] - d[5 * step];
+    float tmp3 = d[3 * step] + d[4 * step];
+    float tmp4 = d[3 * step] - d[4 * step];
+
+    float tmp10 = tmp0 + tmp3;
+    float tmp13 = tmp0 - tmp3;
+    float tmp11 = tmp1 + tmp2;
+    float tmp12 = tmp1 - tmp2;
+    d[0] = tmp10 + tmp11;
+    d[4 * step] = tmp10 - tmp11;
+    float z1 = (tmp12 + tmp13) * 0.707106781f;
+    d[2 * step] = tmp13 + z1;
+    d[6 * step] = tmp13 - z1;
+
+    tmp10 = tmp4 + tmp5;
+    tmp11 = tmp5 + tmp6;
+    tmp12 = tmp6 + tmp7;
+    float z5 = (tmp10 - tmp12) * 0.382683433f;
+    float z2 = 0.541196100f * tmp10 + z5;
+    float z4 = 1.306562965f * tmp12 + z5;
+    float z3 = tmp11 * 0.707106781f;
+    float z11 = tmp7 + z3;
+    float z13 = tmp7 - z3;
+    d[5 * step] = z13 + z2;
+    d[3 * step] = z13 - z2;
+    d[step] = z11 + z4;
+    d[7 * step] = z11 - z4;
+}
+
+// Reciprocals to multiply the AAN outputs by, zig-zag order: the
+// quantization step with the AAN scale factors folded in
+static void quant_divisors(const uint16_t * quant, float * divisors){
+    static const float aan_scale[8] = {
+        1.0f, 1.387039845f, 1.306562965f, 1.175875602f, 1.0f, 0.785694958f, 0.541196100f, 0.275899379f,
+    };
+    for(int k = 0; k < 64; k++){
+        int natural = jpeg_zigzag[k];
+        divisors[k] = 1.0f / (quant[k] * aan_scale[natural >> 3] * aan_scale[natural & 7] * 8);
+    }
+}
+
+// Transform and quantize the 8x8 pixels at `in` into zig-zag coefficients
+static void forward_dct(const int16_t * in, int stride, const float * divisors, int16_t * zz){
+    float d[64];
+    for(int y = 0; y < 8; y++){
+        for(int x = 0; x < 8; x++){
+            d[y * 8 + x] = in[y * stride + x];
+        }
+        aan_fdct_8(d + y * 8, 1);
+    }
+    for(int x = 0; x < 8; x++){
+        aan_fdct_8(d + x, 8);
+    }
+    for(int k = 0; k < 64; k++){
+        // Baseline AC coefficients are at most 10 bits
+        zz[k] = constrain(round_int(d[jpeg_zigzag[k]] * divisors[k]), -1023, 1023);
+    }
+}
+
+static size_t align(size_t n){
+    return (n + 7) & ~(size_t)7;
+}
+
+bool jpegScaleActive(const jpeg_scale_t * opts){
+    return opts->scale > 1 || opts->roi_x > 0 || opts->roi_y > 0 || opts->roi_w < 1 || opts->roi_h < 1;
+}
+
+bool jpegScale(const uint8_t * src, size_t src_len, const jpeg_scale_t * opts,
+        uint8_t * work, size_t work_size, uint8_t ** out, size_t * out_len){
+    int shift;
+    switch(opts->scale){
+        case 1: shift = 3; break;
+        case 2: shift = 2; break;
+        case 4: shift = 1; break;
+        case 8: shift = 0; break;
+        default: return false;
+    }
+    int n = 1 << shift;     // pixels each source block becomes, across
+    int s = opts->scale;
+    const scale_tables_t * t = tables();
+
+    size_t used = align(sizeof(jpeg_reader_t));
+    if(used > work_size){
+        return false;
+    }
+    jpeg_reader_t * jpeg = (jpeg_reader_t *)work;
+    if(!jpegParse(jpeg, src, src_len)){
+        return false;
+    }
+
+    // The crop, in MCUs, snapped outwards
+    int x0 = constrain((int)floorf(opts->roi_x * jpeg->mcus_x), 0, jpeg->mcus_x - 1);
+    int y0 = constrain((int)floorf(opts->roi_y * jpeg->mcus_y), 0, jpeg->mcus_y - 1);
+    int x1 = constrain((int)ceilf((opts->roi_x + opts->roi_w) * jpeg->mcus_x), x0 + 1, jpeg->mcus_x);
+    int y1 = constrain((int)ceilf((opts->roi_y + opts->roi_h) * jpeg->mcus_y), y0 + 1, jpeg->mcus_y);
+    int mcu_w = 8 * jpeg->hmax;
+    int mcu_h = 8 * jpeg->vmax;
+    int crop_w = min(x1 * mcu_w, jpeg->width) - x0 * mcu_w;
+    int crop_h = min(y1 * mcu_h, jpeg->height) - y0 * mcu_h;
+    int out_w = (crop_w + s - 1) / s;
+    int out_h = (crop_h + s - 1) / s;
+    int out_mcus_x = (out_w + mcu_w - 1) / mcu_w;
+
+    // One row of output MCUs, per component, as pixels
+    int16_t * rows[JPEG_MAX_COMPONENTS] = {NULL};
+    int stride[JPEG_MAX_COMPONENTS] = {0};
+    float * divisors[JPEG_MAX_COMPONENTS] = {NULL};
+    if(s > 1){
+        for(int c = 0; c < jpeg->ncomps; c++){
+            // Wide enough for the encoder's whole MCUs and for every
+            // reduced block, whichever is more
+            stride[c] = max(out_mcus_x * 8, (x1 - x0) * n) * jpeg->comps[c].h;
+            size_t bytes = align(stride[c] * jpeg->comps[c].v * 8 * sizeof(int16_t));
+            if(used + bytes > work_size){
+                return false;
+            }
+            rows[c] = (int16_t *)(work + used);
+            used += bytes;
+            if(used + 64 * sizeof(float) > work_size){
+                return false;
+            }
+            divisors[c] = (float *)(work + used);
+            quant_divisors(jpeg->quant[jpeg->comps[c].tq], divisors[c]);
+            used += 64 * sizeof(float);
+        }
+    }
+
+    bit_writer_t w = {work + used, work + work_size, 0, 0, false};
+    put_headers(&w, jpeg, out_w, out_h);
+    int pred[JPEG_MAX_COMPONENTS] = {0};
+    int16_t zz[64];
+
+    for(int my = 0; my < y1; my++){
+        for(int mx = 0; mx < jpeg->mcus_x; mx++){
+            if(!jpegStartMcu(jpeg, my * jpeg->mcus_x + mx)){
+                return false;
+            }
+            bool keep = my >= y0 && mx >= x0 && mx < x1;
+            for(int c = 0; c < jpeg->ncomps; c++){
+                jpeg_component_t * comp = &jpeg->comps[c];
+                for(int b = 0; b < comp->h * comp->v; b++){
+                    if(!jpegDecodeBlock(jpeg, comp, keep ? zz : NULL)){
+                        return false;
+                    }
+                    if(!keep){
+                        continue;
+                    }
+                    if(s == 1){
+                        encode_block(&w, zz, &pred[c], &t->dc[c > 0], &t->ac[c > 0]);
+                        continue;
+                    }
+                    // Where this block's n x n pixels land in the row
+                    int bx = (mx - x0) * comp->h + b % comp->h;
+                    int by = ((my - y0) % s) * comp->v + b / comp->h;
+                    reduced_idct(t, shift, zz, jpeg->quant[comp->tq], rows[c] + by * n * stride[c] + bx * n, stride[c]);
+                }
+            }
+        }
+        if(s == 1 || my < y0 || ((my - y0) % s != s - 1 && my != y1 - 1)){
+            continue;
+        }
+
+        // A row of output MCUs is complete: fill in past the edge of the
+        // crop by repeating its last pixels, then encode it
+        int source_rows = (my - y0) % s + 1;
+        for(int c = 0; c < jpeg->ncomps; c++){
+            const jpeg_component_t * comp = &jpeg->comps[c];
+            int valid_w = (x1 - x0) * comp->h * n;
+            int valid_h = source_rows * comp->v * n;
+            int height = comp->v * 8;
+            for(int y = 0; y < valid_h; y++){
+                int16_t * row = rows[c] + y * stride[c];
+                for(int x = valid_w; x < stride[c]; x++){
+                    row[x] = row[valid_w - 1];
+                }
+            }
+            for(int y = valid_h; y < height; y++){
+                memcpy(rows[c] + y * stride[c], rows[c] + (valid_h - 1) * stride[c], stride[c] * sizeof(int16_t));
+            }
+        }
+        for(int ox = 0; ox < out_mcus_x; ox++){
+            for(int c = 0; c < jpeg->ncomps; c++){
+                const jpeg_component_t * comp = &jpeg->comps[c];
+                for(int b = 0; b < comp->h * comp->v; b++){
+                    int bx = ox * comp->h + b % comp->h;
+                    int by = b / comp->h;
+                    forward_dct(rows[c] + by * 8 * stride[c] + bx * 8, stride[c], divisors[c], zz);
+                    encode_block(&w, zz, &pred[c], &t->dc[c > 0], &t->ac[c > 0]);
+                }
+            }
+        }
+        if(w.full){
+            return false;
+        }
+    }
+    flush_bits(&w);
+    put16(&w, 0xFFD9);
+    if(w.full){
+        return false;
+    }
+    *out = work + used;
+    *out_len = w.p - *out;
+    return true;
+}
@@ -0,0 +1,38 @@
+#ifndef jpeg_scale_h
+#define jpeg_scale_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Crop and downscale a baseline JPEG without decoding it to pixels. The
+// entropy-coded blocks are read back to DCT coefficients (jpeg_reader.h);
+// blocks outside the crop are skipped. Cropped at full scale, the kept
+// blocks' coefficients are re-encoded unchanged, so there's no further
+// loss. Scaled by 1/2, 1/4 or 1/8, each block is reduced to its lowest
+// 4x4, 2x2 or 1x1 frequencies (a 1/8 block is just its DC term), those are
+// put back together into 8x8 blocks and transformed and quantized again.
+// Colour stays as YCbCr at the source's sampling throughout, and the
+// source's quantization tables are reused.
+//
+// The crop snaps outwards to whole MCUs (16x8 pixels for the OV2640's
+// 4:2:2 output).
+
+typedef struct {
+    int scale;      // 1, 2, 4 or 8
+    // Part of the frame to keep, as fractions of its width and height
+    float roi_x, roi_y, roi_w, roi_h;
+} jpeg_scale_t;
+
+const jpeg_scale_t JPEG_SCALE_NONE = {1, 0, 0, 1, 1};
+
+// False if `opts` would send frames as they are
+bool jpegScaleActive(const jpeg_scale_t * opts);
+
+// Crop and scale `src` into `work`, which is also the scratch space: a few
+// KB of decoder state and one row of MCUs of the output, plus the output.
+// `out` points into `work`. False if the frame isn't a baseline JPEG or
+// `work` is too small.
+bool jpegScale(const uint8_t * src, size_t src_len, const jpeg_scale_t * opts,
+    uint8_t * work, size_t work_size, uint8_t ** out, size_t * out_len);
+
+#endif
@@ -0,0 +1,139 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "logger.h"
+#include "task_config.h"
+
+static const char level_letter[] = { 'E', 'W', 'I', 'D' };
+
+// Writers copy whole lines in at `head` under the mux; the drain task
+// writes out [tail, head) without holding it and only takes it again to
+// move `tail`, so the UART never runs inside the critical section.
+static portMUX_TYPE log_mux = portMUX_INITIALIZER_UNLOCKED;
+static char ring[LOG_BUFFER_SIZE];
+static size_t head = 0;
+static size_t tail = 0;
+static size_t used = 0;
+static log_stats_t stats;
+static volatile log_level_t max_level = LOG_LEVEL_INFO;
+static TaskHandle_t drain_task_handle = NULL;
+
+
+void logSetLevel(log_level_t level){
+    max_level = level;
+}
+
+bool logEnabled(log_level_t level){
+    return level <= max_level;
+}
+
+void logGetStats(log_stats_t * out){
+    portENTER_CRITICAL(&log_mux);
+    *out = stats;
+    portEXIT_CRITICAL(&log_mux);
+}
+
+// Returns how many earlier lines from this site were suppressed, or -1 if
+// this one should be too
+static int rate_limit(log_site_t * site, int64_t now, uint32_t interval_ms, uint16_t burst){
+    int suppressed = -1;
+    portENTER_CRITICAL(&log_mux);
+    if(!site->window_start || now - site->window_start >= interval_ms * 1000LL){
+        site->window_start = now;
+        site->count = 0;
+    }
+    if(site->count < burst){
+        site->count++;
+        suppressed = site->suppressed;
+        site->suppressed = 0;
+    } else {
+        site->suppressed++;
+        stats.suppressed++;
+    }
+    portEXIT_CRITICAL(&log_mux);
+    return suppressed;
+}
+
+void logWrite(log_site_t * site, log_level_t level, uint32_t interval_ms, uint16_t burst, const char * format, ...){
+    int64_t now = esp_timer_get_time();
+    int suppressed = rate_limit(site, now, interval_ms, burst);
+    if(suppressed < 0){
+        return;
+    }
+
+    // Same shape as ESP-IDF's own log lines: "I (1234) message"
+    char line[LOG_LINE_MAX];
+    int len = snprintf(line, sizeof(line), "%c (%u) ", level_letter[level], (uint32_t)(now / 1000));
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(line + len, sizeof(line) - len, format, args);
+    va_end(args);
+    len = min(len + max(n, 0), (int)sizeof(line) - 1);
+    if(suppressed > 0 && len < (int)sizeof(line) - 1){
+        n = snprintf(line + len, sizeof(line) - len, " (%d suppressed)", suppressed);
+        len = min(len + max(n, 0), (int)sizeof(line) - 1);
+    }
+    // Always end on a newline, even if the message was cut short
+    if(line[len - 1] != '\n'){
+        if(len == (int)sizeof(line) - 1){
+            len--;
+        }
+        line[len++] = '\n';
+    }
+
+    bool wake = false;
+    portENTER_CRITICAL(&log_mux);
+    if(used + len > LOG_BUFFER_SIZE){
+        stats.dropped++;
+    } else {
+        size_t first = min((size_t)len, LOG_BUFFER_SIZE - head);
+        memcpy(ring + head, line, first);
+        memcpy(ring, line + first, len - first);
+        head = (head + len) % LOG_BUFFER_SIZE;
+        wake = used == 0;
+        used += len;
+        stats.written++;
+        stats.high_water = max(stats.high_water, (uint32_t)used);
+    }
+    portEXIT_CRITICAL(&log_mux);
+
+    if(wake && drain_task_handle){
+        xTaskNotifyGive(drain_task_handle);
+    }
+}
+
+static void drain_task(void * arg){
+    uint32_t reported_dropped = 0;
+    while(true){
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+
+        while(true){
+            portENTER_CRITICAL(&log_mux);
+            size_t start = tail;
+            size_t len = min(used, (size_t)LOG_BUFFER_SIZE - tail);
+            uint32_t dropped = stats.dropped;
+            portEXIT_CRITICAL(&log_mux);
+            if(!len){
+                if(dropped != reported_dropped){
+                    Serial.printf("W (%u) Log buffer full, %u lines dropped\n",
+                        (uint32_t)(esp_timer_get_time() / 1000), dropped - reported_dropped);
+                    reported_dropped = dropped;
+                }
+                break;
+            }
+
+            Serial.write((const uint8_t *)ring + start, len);
+
+            portENTER_CRITICAL(&log_mux);
+            tail = (tail + len) % LOG_BUFFER_SIZE;
+            used -= len;
+            portEXIT_CRITICAL(&log_mux);
+        }
+    }
+}
+
+void initLogger(){
+    taskCreate(TASK_LOG, drain_task, NULL, &drain_task_handle);
+}
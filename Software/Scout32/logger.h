@@ -0,0 +1,62 @@
+#ifndef logger_h
+#define logger_h
+
+#include <stdint.h>
+
+// Non-blocking logging. Lines are formatted by the caller into a
+// preallocated ring buffer and a low priority task drains it to Serial, so
+// a log call costs a snprintf rather than however long the UART takes.
+// When the buffer is full lines are dropped and counted, never waited for.
+//
+// Each call site is rate limited on its own: by default to a burst of
+// LOG_SITE_BURST lines a second, or to one line per interval with
+// LOG_EVERY. Suppressed lines are counted and reported on the next line
+// that gets through.
+
+typedef enum {
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_DEBUG,
+} log_level_t;
+
+const int LOG_BUFFER_SIZE = 4096;
+const int LOG_LINE_MAX = 160;
+const int LOG_SITE_BURST = 10;
+
+typedef struct {
+    int64_t window_start;
+    uint16_t count;
+    uint16_t suppressed;
+} log_site_t;
+
+typedef struct {
+    uint32_t written;
+    uint32_t dropped;     // Buffer full
+    uint32_t suppressed;  // Rate limited
+    uint32_t high_water;  // Most bytes ever waiting in the buffer
+} log_stats_t;
+
+void initLogger();
+void logSetLevel(log_level_t level);
+void logGetStats(log_stats_t * stats);
+
+bool logEnabled(log_level_t level);
+void logWrite(log_site_t * site, log_level_t level, uint32_t interval_ms, uint16_t burst, const char * format, ...)
+    __attribute__((format(printf, 5, 6)));
+
+#define LOG_AT(level, interval_ms, burst, format, ...) do { \
+        if(logEnabled(level)){ \
+            static log_site_t _log_site; \
+            logWrite(&_log_site, level, interval_ms, burst, format, ##__VA_ARGS__); \
+        } \
+    } while(0)
+
+#define LOG_ERROR(format, ...) LOG_AT(LOG_LEVEL_ERROR, 1000, LOG_SITE_BURST, format, ##__VA_ARGS__)
+#define LOG_WARN(format, ...) LOG_AT(LOG_LEVEL_WARN, 1000, LOG_SITE_BURST, format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...) LOG_AT(LOG_LEVEL_INFO, 1000, LOG_SITE_BURST, format, ##__VA_ARGS__)
+#define LOG_DEBUG(format, ...) LOG_AT(LOG_LEVEL_DEBUG, 1000, LOG_SITE_BURST, format, ##__VA_ARGS__)
+// At most one line per `interval_ms` from this call site
+#define LOG_EVERY(level, interval_ms, format, ...) LOG_AT(level, interval_ms, 1, format, ##__VA_ARGS__)
+
+#endif
@@ -0,0 +1,324 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include <atomic>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "adaptive_bitrate.h"
+#include "boot_timeline.h"
+#include "sensor_config.h"
+#include "recorder.h"
+#include "buffer_pool.h"
+#include "motor_control.h"
+#include "logger.h"
+#include "stream_writer.h"
+#include "task_config.h"
+#include "power_manager.h"
+#include "metrics.h"
+
+// Upper bucket bounds in microseconds, shared by every histogram. Spans a
+// motor update (tens of us) to a frame stuck behind a bad link (a second).
+static const uint32_t bucket_bounds_us[] = {
+    10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000,
+};
+const int BUCKET_COUNT = sizeof(bucket_bounds_us) / sizeof(bucket_bounds_us[0]);
+
+typedef struct {
+    const char * name;
+    const char * help;
+} metric_info_t;
+
+static const metric_info_t counter_info[METRIC_COUNTER_COUNT] = {
+    {"scout32_frames_captured_total", "Frames grabbed from the camera by the stream capture task"},
+    {"scout32_capture_failures_total", "Camera grabs that returned no frame"},
+    {"scout32_captures_cached_total", "/capture requests served from the stream's latest frame"},
+    {"scout32_captures_sensor_total", "/capture requests that grabbed a frame from the camera"},
+    {"scout32_frames_sent_total", "Frames sent to /stream clients"},
+    {"scout32_frames_skipped_total", "Frames a /stream client never saw because a newer one replaced it"},
+    {"scout32_frames_stale_total", "Frames dropped for being older than the maximum frame age"},
+    {"scout32_frames_unchanged_total", "Frames a /stream client didn't send because they showed nothing new"},
+    {"scout32_stream_bytes_total", "JPEG bytes sent to /stream clients"},
+    {"scout32_drive_commands_http_total", "Drive commands received over GET /drive"},
+    {"scout32_drive_commands_ws_total", "Drive commands received over /ws"},
+    {"scout32_drive_commands_discarded_total", "Out of order /ws drive commands ignored"},
+};
+
+static const metric_info_t histogram_info[METRIC_HISTOGRAM_COUNT] = {
+    {"scout32_camera_grab_seconds", "Time in esp_camera_fb_get"},
+    {"scout32_jpeg_encode_seconds", "Time converting non-JPEG frames to JPEG"},
+    {"scout32_jpeg_scale_seconds", "Time cropping and scaling frames for /stream?scale=&roi="},
+    {"scout32_frame_signature_seconds", "Time taking a frame's change detection signature"},
+    {"scout32_capture_chunk_send_seconds", "Time in each httpd_resp_send_chunk of a /capture converted to JPEG"},
+    {"scout32_frame_send_seconds", "Time to send one whole stream frame"},
+    {"scout32_drive_handler_seconds", "Time handling one drive command"},
+    {"scout32_motor_update_seconds", "Time for one motor control tick"},
+};
+
+// 32 bit so the adds stay lock-free on the ESP32; the sums roll over after
+// about 70 minutes of accumulated time, which Prometheus treats as a
+// counter reset.
+typedef struct {
+    std::atomic<uint32_t> buckets[BUCKET_COUNT + 1];
+    std::atomic<uint32_t> sum_us;
+} histogram_t;
+
+static std::atomic<uint32_t> counters[METRIC_COUNTER_COUNT];
+static histogram_t histograms[METRIC_HISTOGRAM_COUNT];
+
+
+void metricsCount(metric_counter_t counter, uint32_t n){
+    counters[counter].fetch_add(n, std::memory_order_relaxed);
+}
+
+void metricsObserve(metric_histogram_t histogram, int64_t us){
+    if(us < 0){
+        us = 0;
+    }
+    int bucket = 0;
+    while(bucket < BUCKET_COUNT && us > bucket_bounds_us[bucket]){
+        bucket++;
+    }
+    histogram_t * h = &histograms[histogram];
+    h->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    h->sum_us.fetch_add((uint32_t)us, std::memory_order_relaxed);
+}
+
+// Buffers output so `write` gets a few large pieces rather than one per line
+typedef struct {
+    metrics_write_cb write;
+    void * arg;
+    char buf[512];
+    size_t len;
+    bool ok;
+} metrics_out_t;
+
+static void flush(metrics_out_t * out){
+    if(out->ok && out->len){
+        out->ok = out->write(out->arg, out->buf, out->len);
+    }
+    out->len = 0;
+}
+
+static void emit(metrics_out_t * out, const char * format, ...){
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(out->buf + out->len, sizeof(out->buf) - out->len, format, args);
+    va_end(args);
+    if(n >= 0 && out->len + n >= sizeof(out->buf)){
+        // Didn't fit: send what we have and format it again at the start
+        flush(out);
+        va_start(args, format);
+        n = vsnprintf(out->buf, sizeof(out->buf), format, args);
+        va_end(args);
+    }
+    if(n > 0){
+        out->len += min((size_t)n, sizeof(out->buf) - 1);
+    }
+}
+
+static void emit_gauge(metrics_out_t * out, const char * name, const char * help, double value){
+    emit(out, "# HELP %s %s\n# TYPE %s gauge\n%s %g\n", name, help, name, name, value);
+}
+
+static void emit_counter(metrics_out_t * out, const char * name, const char * help, uint32_t value){
+    emit(out, "# HELP %s %s\n# TYPE %s counter\n%s %u\n", name, help, name, name, value);
+}
+
+static double heap_fragmentation(uint32_t caps){
+    size_t free_bytes = heap_caps_get_free_size(caps);
+    return free_bytes ? 1.0 - (double)heap_caps_get_largest_free_block(caps) / free_bytes : 0;
+}
+
+static const char * const pool_names[POOL_CLASS_COUNT] = {"request", "frame"};
+
+// One series per pool size class, labelled with the pool's name
+static void emit_pool_series(metrics_out_t * out, const char * name, const char * help, const char * type,
+        const pool_stats_t * stats, uint32_t (*value)(const pool_stats_t *)){
+    emit(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    for(int i = 0; i < POOL_CLASS_COUNT; i++){
+        emit(out, "%s{pool=\"%s\",psram=\"%d\"} %u\n", name, pool_names[i], stats[i].psram, value(&stats[i]));
+    }
+}
+
+// One series per task in the last sample, by name
+static void emit_task_series(metrics_out_t * out, const char * name, const char * help,
+        bool (*value)(const task_stats_t *, double *)){
+    emit(out, "# HELP %s %s\n# TYPE %s gauge\n", name, help, name);
+    task_stats_t task;
+    double v;
+    for(int i = 0; taskGetStats(i, &task); i++){
+        if(value(&task, &v)){
+            emit(out, "%s{task=\"%s\"} %g\n", name, task.name, v);
+        }
+    }
+}
+
+static void emit_task_stats(metrics_out_t * out){
+    emit(out, "# HELP scout32_task_preset Task layout in use\n# TYPE scout32_task_preset gauge\n"
+        "scout32_task_preset{preset=\"%s\"} 1\n", taskConfigPresetName(taskConfigPreset()));
+    emit(out, "# HELP scout32_task_info Tasks running, by name, core and priority\n# TYPE scout32_task_info gauge\n");
+    task_stats_t task;
+    for(int i = 0; taskGetStats(i, &task); i++){
+        char core[12] = "any";
+        if(task.core != tskNO_AFFINITY){
+            snprintf(core, sizeof(core), "%d", (int)task.core);
+        }
+        emit(out, "scout32_task_info{task=\"%s\",core=\"%s\",priority=\"%u\"} %u\n", task.name, core,
+            (unsigned)task.priority, task.instances);
+    }
+    emit_task_series(out, "scout32_task_cpu_percent", "CPU use over the last second, percent of one core",
+        [](const task_stats_t * t, double * v){ *v = t->cpu_percent; return t->cpu_percent >= 0; });
+    emit_task_series(out, "scout32_task_stack_free_bytes", "Lowest stack high-water mark of any instance",
+        [](const task_stats_t * t, double * v){ *v = t->stack_free; return true; });
+    emit_task_series(out, "scout32_task_stack_bytes", "Stack the task was created with, for the firmware's own tasks",
+        [](const task_stats_t * t, double * v){ *v = t->stack; return t->stack > 0; });
+}
+
+static void emit_power_stats(metrics_out_t * out){
+    power_stats_t power;
+    powerGetStats(&power);
+    emit_gauge(out, "scout32_power_idle", "1 while idle: CPU stepped down, modem sleep, camera in standby",
+        power.state == POWER_IDLE);
+    emit_gauge(out, "scout32_cpu_frequency_mhz", "CPU clock", power.cpu_mhz);
+    emit_gauge(out, "scout32_power_idle_timeout_seconds", "Time without activity before going idle, 0 for never",
+        power.idle_timeout_ms / 1000.0);
+    emit(out, "# HELP scout32_power_state_seconds_total Time spent in each power state\n"
+        "# TYPE scout32_power_state_seconds_total counter\n");
+    for(int i = 0; i < POWER_STATE_COUNT; i++){
+        emit(out, "scout32_power_state_seconds_total{state=\"%s\"} %.3f\n", powerStateName((power_state_t)i),
+            power.seconds[i]);
+    }
+    emit_counter(out, "scout32_power_idle_total", "Times it went idle", power.idles);
+    emit(out, "# HELP scout32_power_wakes_total Times it was woken, by what woke it\n# TYPE scout32_power_wakes_total counter\n");
+    for(int i = 0; i < POWER_SOURCE_COUNT; i++){
+        emit(out, "scout32_power_wakes_total{source=\"%s\"} %u\n", powerSourceName((power_source_t)i), power.wakes[i]);
+    }
+    emit_gauge(out, "scout32_power_wake_seconds", "How long the last wake took", power.wake_us_last / 1e6);
+    emit_gauge(out, "scout32_power_wake_max_seconds", "Longest wake since boot", power.wake_us_max / 1e6);
+}
+
+static void emit_pool_stats(metrics_out_t * out){
+    pool_stats_t stats[POOL_CLASS_COUNT];
+    for(int i = 0; i < POOL_CLASS_COUNT; i++){
+        poolGetStats((pool_class_t)i, &stats[i]);
+    }
+    emit_pool_series(out, "scout32_pool_blocks", "Blocks in the pool, 0 until it's first used", "gauge", stats,
+        [](const pool_stats_t * s){ return s->blocks; });
+    emit_pool_series(out, "scout32_pool_block_bytes", "Size of each pool block", "gauge", stats,
+        [](const pool_stats_t * s){ return (uint32_t)s->block_size; });
+    emit_pool_series(out, "scout32_pool_in_use", "Pool blocks handed out", "gauge", stats,
+        [](const pool_stats_t * s){ return s->in_use; });
+    emit_pool_series(out, "scout32_pool_peak_in_use", "Most pool blocks handed out at once", "gauge", stats,
+        [](const pool_stats_t * s){ return s->peak_in_use; });
+    emit_pool_series(out, "scout32_pool_largest_request_bytes", "Largest allocation asked of the pool", "gauge", stats,
+        [](const pool_stats_t * s){ return (uint32_t)s->largest_request; });
+    emit_pool_series(out, "scout32_pool_allocs_total", "Allocations served from the pool", "counter", stats,
+        [](const pool_stats_t * s){ return s->allocs; });
+    emit_pool_series(out, "scout32_pool_fallbacks_total", "Allocations the pool passed on to the heap", "counter", stats,
+        [](const pool_stats_t * s){ return s->fallbacks; });
+    emit_pool_series(out, "scout32_pool_failures_total", "Allocations neither the pool nor the heap could serve", "counter", stats,
+        [](const pool_stats_t * s){ return s->failures; });
+}
+
+bool metricsWrite(metrics_write_cb write, void * arg){
+    metrics_out_t out;
+    out.write = write;
+    out.arg = arg;
+    out.len = 0;
+    out.ok = true;
+
+    emit_gauge(&out, "scout32_uptime_seconds", "Time since boot", esp_timer_get_time() / 1e6);
+    emit_gauge(&out, "scout32_heap_free_bytes", "Free internal RAM", heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    emit_gauge(&out, "scout32_heap_min_free_bytes", "Lowest free internal RAM since boot", heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    emit_gauge(&out, "scout32_heap_largest_free_block_bytes", "Largest free block of internal RAM", heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    emit_gauge(&out, "scout32_heap_fragmentation_ratio", "Free internal RAM not in the largest free block",
+        heap_fragmentation(MALLOC_CAP_INTERNAL));
+    emit_gauge(&out, "scout32_psram_free_bytes", "Free PSRAM", heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    emit_gauge(&out, "scout32_psram_fragmentation_ratio", "Free PSRAM not in the largest free block",
+        heap_fragmentation(MALLOC_CAP_SPIRAM));
+    for(int i = 0; i < METRIC_COUNTER_COUNT; i++){
+        emit_counter(&out, counter_info[i].name, counter_info[i].help, counters[i].load(std::memory_order_relaxed));
+    }
+    uint32_t unchanged = counters[METRIC_FRAMES_UNCHANGED].load(std::memory_order_relaxed);
+    uint32_t offered = unchanged + counters[METRIC_FRAMES_SENT].load(std::memory_order_relaxed);
+    emit_gauge(&out, "scout32_frames_unchanged_ratio", "Fraction of /stream frames not sent because they showed nothing new",
+        offered ? (double)unchanged / offered : 0);
+
+    for(int i = 0; i < METRIC_HISTOGRAM_COUNT; i++){
+        const char * name = histogram_info[i].name;
+        histogram_t * h = &histograms[i];
+        emit(&out, "# HELP %s %s\n# TYPE %s histogram\n", name, histogram_info[i].help, name);
+        // Buckets are read one at a time while others may be recording, so
+        // the total is taken from the buckets we printed to stay consistent
+        uint32_t cumulative = 0;
+        for(int b = 0; b < BUCKET_COUNT; b++){
+            cumulative += h->buckets[b].load(std::memory_order_relaxed);
+            emit(&out, "%s_bucket{le=\"%g\"} %u\n", name, bucket_bounds_us[b] / 1e6, cumulative);
+        }
+        cumulative += h->buckets[BUCKET_COUNT].load(std::memory_order_relaxed);
+        emit(&out, "%s_bucket{le=\"+Inf\"} %u\n", name, cumulative);
+        emit(&out, "%s_sum %.6f\n%s_count %u\n", name, h->sum_us.load(std::memory_order_relaxed) / 1e6, name, cumulative);
+    }
+
+    motor_state_t motor;
+    motorGetState(&motor);
+    emit_gauge(&out, "scout32_motor_left_percent", "Left motor output", motor.left);
+    emit_gauge(&out, "scout32_motor_right_percent", "Right motor output", motor.right);
+    emit_counter(&out, "scout32_motor_ticks_total", "Motor control ticks", motor.ticks);
+    emit_counter(&out, "scout32_motor_late_ticks_total", "Motor control ticks that started more than a period late", motor.late_ticks);
+    emit_counter(&out, "scout32_motor_timeouts_total", "Times the command watchdog stopped the rover", motor.timeouts);
+
+    bitrate_state_t bitrate;
+    bitrateGetState(&bitrate);
+    emit_gauge(&out, "scout32_stream_framesize", "Camera frame size chosen by the bitrate controller", bitrate.framesize);
+    emit_gauge(&out, "scout32_stream_quality", "JPEG quality chosen by the bitrate controller", bitrate.quality);
+    emit_gauge(&out, "scout32_stream_link_busy_ratio", "Fraction of time the slowest stream client spent sending", bitrate.busy);
+    emit_gauge(&out, "scout32_wifi_rssi_dbm", "Signal strength of the video link", bitrate.rssi);
+    emit_counter(&out, "scout32_bitrate_changes_total", "Quality or frame size changes made by the bitrate controller", bitrate.changes);
+
+    stream_sender_stats_t senders;
+    streamWriterGetSenderStats(&senders);
+    emit_gauge(&out, "scout32_stream_senders_active", "Stream sender tasks running", senders.active);
+    emit_counter(&out, "scout32_stream_senders_started_total", "Streams handed to a sender task", senders.started);
+    emit_counter(&out, "scout32_stream_senders_busy_total", "Streams refused with every sender in use", senders.busy);
+    emit_gauge(&out, "scout32_stream_sender_stack_free_min_bytes", "Lowest stack high-water mark of a finished stream sender", senders.stack_free_min);
+
+    sensor_config_stats_t sensor;
+    sensorConfigGetStats(&sensor);
+    emit_counter(&out, "scout32_sensor_config_batches_total", "Camera setting changes applied", sensor.batches);
+    emit_counter(&out, "scout32_sensor_config_writes_total", "Camera settings written to the sensor", sensor.writes);
+    emit_counter(&out, "scout32_sensor_config_unchanged_total", "Camera settings asked for that already had that value", sensor.unchanged);
+
+    recorder_stats_t recorder;
+    recorderGetStats(&recorder);
+    emit_gauge(&out, "scout32_recorder_recording", "1 while the black box recorder is taking frames", recorder.recording);
+    emit_gauge(&out, "scout32_recorder_held_frames", "Frames in the recording", recorder.held_frames);
+    emit_gauge(&out, "scout32_recorder_held_bytes", "Bytes of frames in the recording", recorder.held_bytes);
+    emit_gauge(&out, "scout32_recorder_held_seconds", "Time span of the frames in the recording", recorder.held_ms / 1000.0);
+    emit_counter(&out, "scout32_recorder_frames_total", "Frames recorded", recorder.frames);
+    emit_counter(&out, "scout32_recorder_bytes_total", "Bytes of frames recorded", recorder.bytes);
+    emit_counter(&out, "scout32_recorder_commands_total", "Drive commands recorded", recorder.commands);
+    emit_counter(&out, "scout32_recorder_evicted_total", "Recorded frames dropped for space or age", recorder.evicted);
+    emit_counter(&out, "scout32_recorder_too_big_total", "Frames too big for the recording buffer", recorder.too_big);
+    emit_counter(&out, "scout32_recorder_paused_total", "Frames and commands not recorded during a download", recorder.paused);
+    emit_counter(&out, "scout32_recorder_downloads_total", "Recordings downloaded", recorder.downloads);
+
+    emit_pool_stats(&out);
+    emit_task_stats(&out);
+    emit_power_stats(&out);
+
+    boot_phase_t boot[BOOT_MAX_PHASES];
+    int boot_phases = bootGetTimeline(boot, BOOT_MAX_PHASES);
+    emit(&out, "# HELP scout32_boot_phase_seconds When each boot step finished\n# TYPE scout32_boot_phase_seconds gauge\n");
+    for(int i = 0; i < boot_phases; i++){
+        emit(&out, "scout32_boot_phase_seconds{phase=\"%s\"} %.3f\n", boot[i].name, boot[i].us / 1e6);
+    }
+
+    log_stats_t log;
+    logGetStats(&log);
+    emit_counter(&out, "scout32_log_lines_total", "Log lines queued for the UART", log.written);
+    emit_counter(&out, "scout32_log_dropped_total", "Log lines dropped because the buffer was full", log.dropped);
+    emit_counter(&out, "scout32_log_suppressed_total", "Log lines dropped by per call site rate limits", log.suppressed);
+
+    flush(&out);
+    return out.ok;
+}
@@ -0,0 +1,47 @@
+#ifndef metrics_h
+#define metrics_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Lock-free counters and fixed-bucket latency histograms, rendered in the
+// Prometheus text format for /metrics. Recording is a couple of relaxed
+// atomic adds, so it's fine to call from the stream and motor tasks.
+
+typedef enum {
+    METRIC_FRAMES_CAPTURED,
+    METRIC_CAPTURE_FAILURES,
+    METRIC_CAPTURES_CACHED,
+    METRIC_CAPTURES_SENSOR,
+    METRIC_FRAMES_SENT,
+    METRIC_FRAMES_SKIPPED,
+    METRIC_FRAMES_STALE,
+    METRIC_FRAMES_UNCHANGED,
+    METRIC_STREAM_BYTES,
+    METRIC_DRIVE_COMMANDS_HTTP,
+    METRIC_DRIVE_COMMANDS_WS,
+    METRIC_DRIVE_COMMANDS_DISCARDED,
+    METRIC_COUNTER_COUNT
+} metric_counter_t;
+
+typedef enum {
+    METRIC_CAMERA_GRAB,
+    METRIC_JPEG_ENCODE,
+    METRIC_JPEG_SCALE,
+    METRIC_FRAME_SIGNATURE,
+    METRIC_CAPTURE_CHUNK_SEND,
+    METRIC_FRAME_SEND,
+    METRIC_DRIVE_HANDLER,
+    METRIC_MOTOR_UPDATE,
+    METRIC_HISTOGRAM_COUNT
+} metric_histogram_t;
+
+void metricsCount(metric_counter_t counter, uint32_t n = 1);
+void metricsObserve(metric_histogram_t histogram, int64_t us);
+
+// Render everything, handing the text to `write` a few hundred bytes at a
+// time. Stops early and returns false if `write` returns false.
+typedef bool (*metrics_write_cb)(void * arg, const char * data, size_t len);
+bool metricsWrite(metrics_write_cb write, void * arg);
+
+#endif
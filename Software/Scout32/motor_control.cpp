@@ -0,0 +1,150 @@
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "chassis.h"
+#include "motor_control.h"
+#include "metrics.h"
+#include "logger.h"
+#include "task_config.h"
+#include "power_manager.h"
+
+// Single-slot mailbox: left and right setpoints plus a sequence number in
+// one word, so a post is one atomic store and the task never sees half of
+// a command. The sequence number tells the watchdog a command arrived even
+// if it's the same as the last one.
+static std::atomic<uint32_t> mailbox(0);
+static std::atomic<int> rate_hz(MOTOR_CONTROL_RATE_HZ);
+
+static portMUX_TYPE motor_mux = portMUX_INITIALIZER_UNLOCKED;
+static motor_state_t state;
+
+
+static uint32_t pack(int left, int right, uint16_t seq){
+    return (uint8_t)left | ((uint8_t)right << 8) | ((uint32_t)seq << 16);
+}
+
+void motorSetpoint(int left, int right){
+    left = max(min(left, 100), -100);
+    right = max(min(right, 100), -100);
+    powerNoteActivity(POWER_SOURCE_DRIVE);
+    // Only drive commands post, but they can come from several httpd
+    // workers at once: bump the sequence with a CAS rather than a lock
+    uint32_t old = mailbox.load(std::memory_order_relaxed);
+    while(!mailbox.compare_exchange_weak(old, pack(left, right, (old >> 16) + 1), std::memory_order_release)){
+    }
+}
+
+void motorSetRate(int hz){
+    rate_hz = max(min(hz, configTICK_RATE_HZ), 1);
+}
+
+void motorGetState(motor_state_t * out){
+    portENTER_CRITICAL(&motor_mux);
+    *out = state;
+    portEXIT_CRITICAL(&motor_mux);
+}
+
+int64_t motorActuateTime(){
+    portENTER_CRITICAL(&motor_mux);
+    int64_t next_tick = state.next_tick;
+    portEXIT_CRITICAL(&motor_mux);
+    return max(next_tick, esp_timer_get_time());
+}
+
+// Move `current` towards `target` by at most `step`
+static float slew(float current, float target, float step){
+    if(target > current + step){
+        return current + step;
+    }
+    if(target < current - step){
+        return current - step;
+    }
+    return target;
+}
+
+static void motor_task(void * arg){
+    uint16_t last_seq = 0;
+    float target_left = 0, target_right = 0;
+    float left = 0, right = 0;
+    int out_left = 0, out_right = 0;
+    int64_t last_command = esp_timer_get_time();
+    bool timed_out = true;
+    TickType_t wake = xTaskGetTickCount();
+    int64_t last_tick = esp_timer_get_time();
+
+    while(true){
+        int hz = rate_hz;
+        TickType_t period = max(configTICK_RATE_HZ / hz, 1);
+        vTaskDelayUntil(&wake, period);
+
+        int64_t now = esp_timer_get_time();
+        bool late = now - last_tick > 2 * 1000000LL / hz;
+        float dt = (now - last_tick) / 1e6;
+        last_tick = now;
+
+        uint32_t box = mailbox.load(std::memory_order_acquire);
+        uint16_t seq = box >> 16;
+        bool command = seq != last_seq;
+        if(command){
+            last_seq = seq;
+            last_command = now;
+            timed_out = false;
+            target_left = (int8_t)(box & 0xFF);
+            target_right = (int8_t)((box >> 8) & 0xFF);
+        } else if(!timed_out && now - last_command > MOTOR_COMMAND_TIMEOUT_MS * 1000LL){
+            // Link lost or the client went away: stop
+            timed_out = true;
+            target_left = 0;
+            target_right = 0;
+            LOG_WARN("Motor: command timeout, stopping");
+            portENTER_CRITICAL(&motor_mux);
+            state.timeouts++;
+            portEXIT_CRITICAL(&motor_mux);
+        }
+
+        // A late tick still only gets one period's worth of slew
+        float step = MOTOR_SLEW_PER_S * min(dt, 1.0f / hz);
+        left = slew(left, target_left, step);
+        right = slew(right, target_right, step);
+
+        // Only touch the LEDC when the output actually changes
+        int new_left = lroundf(left);
+        int new_right = lroundf(right);
+        if(new_left != out_left){
+            setLeftMotor(new_left);
+            out_left = new_left;
+        }
+        if(new_right != out_right){
+            setRightMotor(new_right);
+            out_right = new_right;
+        }
+
+        // Not idle while the rover may still be moving
+        if(!timed_out || out_left || out_right){
+            powerNoteActivity(POWER_SOURCE_MOTOR);
+        }
+
+        metricsObserve(METRIC_MOTOR_UPDATE, esp_timer_get_time() - now);
+
+        portENTER_CRITICAL(&motor_mux);
+        state.left = out_left;
+        state.right = out_right;
+        state.ticks++;
+        state.next_tick = now + period * (1000000LL / configTICK_RATE_HZ);
+        if(command){
+            state.commands++;
+        }
+        if(late){
+            state.late_ticks++;
+        }
+        portEXIT_CRITICAL(&motor_mux);
+    }
+}
+
+void initMotorControl(){
+    setLeftMotor(0);
+    setRightMotor(0);
+    taskCreate(TASK_MOTOR, motor_task, NULL, NULL);
+}
@@ -0,0 +1,39 @@
+#ifndef motor_control_h
+#define motor_control_h
+
+#include <stdint.h>
+
+// Fixed-rate motor control. Drive commands only post a setpoint; a high
+// priority task picks up the latest one each tick, slew limits towards it
+// and writes the LEDC outputs, so actuation timing doesn't depend on the
+// web server. If commands stop arriving the rover is brought to a stop.
+
+const int MOTOR_CONTROL_RATE_HZ = 200;
+// Fastest change in motor output, percent per second
+const int MOTOR_SLEW_PER_S = 500;
+// The UI resends at least every 500ms, so this is two missed commands
+const int MOTOR_COMMAND_TIMEOUT_MS = 1000;
+
+typedef struct {
+    int8_t left;        // Current output, percent
+    int8_t right;
+    uint32_t ticks;
+    uint32_t commands;  // Setpoints picked up
+    uint32_t timeouts;  // Times the watchdog stopped the rover
+    uint32_t late_ticks; // Ticks that started more than a period late
+    int64_t next_tick;  // When the task next picks up a setpoint, esp_timer clock
+} motor_state_t;
+
+void initMotorControl();
+void motorSetRate(int hz);
+
+// Post a new setpoint, percent of full speed. Safe from any task.
+void motorSetpoint(int left, int right);
+
+void motorGetState(motor_state_t * state);
+
+// When a setpoint posted now reaches the outputs (starts slewing towards
+// them), esp_timer clock: the next control tick, or now if that's late
+int64_t motorActuateTime();
+
+#endif
@@ -3,358 +3,1775 @@
 
 #include "Arduino.h"
 #include "esp_http_server.h"
+#include "pages.h"
 
+typedef struct {
+    const uint8_t * data;
+    size_t len;
+    const char * mimetype;
+    const char * etag;
+    bool gzipped;
+} static_page_t;
 
-static const char PROGMEM STYLE_CSS[] = R"rawliteral(
-#main {
-  text-align: center;
-}
-
-#control {
-  width: 300px;
-  height: 300px;
-  display: inline-block;
-  vertical-align: middle;
-}
-
-#stream-container {
-  width: auto;
-  height: 300px;
-  display: inline-block;
-  vertical-align: middle;
-}
-
-#stream {
-  width: auto;
-  height: 100%;
-  margin: auto;
-}
-
-#settings {
-  position: fixed;
-  left: calc(50% - 150px);
-  top: 0;
-  width: 300px;
-  background: white;
-  padding: 5px;
-}
-
-#settings-background {
-  position: fixed;
-  left: 0;
-  top: 0;
-  width: 100vw;
-  height: 100vh;
-  display: none;
-  background: rgba(0,0,0,0.5);
-}
-#settings {
-  margin-top: 10px;
-  display: none;
-}
-.settings-table {
-  width:100%;
-}
-
-#settings h1 {
-  border-bottom: solid black 1px;
-}
 
-#settings h2 {
-  border-bottom: solid black 1px;
-}
+// control.js: 8149 bytes, 2715 gzipped
+static const uint8_t PROGMEM CONTROL_JS[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x59, 0xff, 0x4f, 0xdb, 0xc8,
+    0x12, 0xff, 0xdd, 0x7f, 0xc5, 0x3c, 0x54, 0x5d, 0xec, 0xd6, 0x98, 0x80, 0x5e, 0xab, 0x53, 0x79,
+    0xdc, 0x29, 0x10, 0x03, 0xd6, 0x85, 0x04, 0xd9, 0xa1, 0x2d, 0x3a, 0x55, 0xd4, 0xb1, 0x37, 0xc4,
+    0x57, 0xc7, 0x9b, 0xdb, 0xdd, 0x10, 0x72, 0x3d, 0xfe, 0xf7, 0x37, 0xb3, 0xfe, 0x12, 0x3b, 0x24,
+    0x40, 0xef, 0xee, 0x49, 0x2f, 0x42, 0x22, 0xbb, 0x3b, 0xfb, 0x99, 0xaf, 0x3b, 0x3b, 0x3b, 0xd9,
+    0x99, 0x4b, 0x06, 0x52, 0x89, 0x24, 0x52, 0x3b, 0x87, 0xc6, 0xde, 0x6b, 0xe3, 0x84, 0xcf, 0x96,
+    0x22, 0xb9, 0x9d, 0x28, 0x30, 0x23, 0x0b, 0x0e, 0xda, 0x07, 0xfb, 0xe0, 0x73, 0x29, 0xe1, 0x92,
+    0x29, 0x26, 0xa4, 0x0d, 0x67, 0x8c, 0x8f, 0xc7, 0x82, 0x2d, 0xc1, 0x13, 0x3c, 0x93, 0x86, 0x71,
+    0xc9, 0xc4, 0x34, 0x91, 0x32, 0xe1, 0x19, 0x24, 0x12, 0x26, 0x4c, 0xb0, 0xd1, 0x12, 0x6e, 0x45,
+    0x98, 0x29, 0x16, 0xdb, 0x80, 0x94, 0x0c, 0xf8, 0x18, 0xa2, 0x49, 0x28, 0x6e, 0x99, 0x0d, 0x8a,
+    0x43, 0x98, 0x2d, 0x61, 0x86, 0x50, 0xb8, 0x81, 0x8f, 0x54, 0x98, 0x64, 0x49, 0x76, 0x0b, 0x21,
+    0x44, 0xc8, 0xd7, 0x40, 0x4a, 0x35, 0x41, 0x18, 0xc9, 0xc7, 0x6a, 0x11, 0x0a, 0x86, 0xc4, 0x31,
+    0x84, 0x52, 0xf2, 0x28, 0x09, 0x11, 0x0f, 0x62, 0x1e, 0xcd, 0xa7, 0x2c, 0x53, 0xa1, 0x22, 0x7e,
+    0xe3, 0x24, 0x65, 0x12, 0x4c, 0x35, 0x61, 0xb0, 0x13, 0x14, 0x3b, 0x76, 0x2c, 0xcd, 0x24, 0x66,
+    0x61, 0x6a, 0x24, 0x19, 0xd0, 0x5a, 0xb9, 0x04, 0x8b, 0x44, 0x4d, 0xf8, 0x5c, 0x81, 0x60, 0xb9,
+    0xc2, 0x88, 0x61, 0x43, 0x92, 0x45, 0xe9, 0x3c, 0x26, 0x19, 0xca, 0xe5, 0x34, 0x99, 0x26, 0x05,
+    0x07, 0xda, 0xae, 0x8d, 0x21, 0x0d, 0x04, 0x45, 0x53, 0xd9, 0x5a, 0x4e, 0x1b, 0xa6, 0x3c, 0x4e,
+    0xc6, 0xf4, 0x9f, 0x69, 0xb5, 0x66, 0xf3, 0x51, 0x9a, 0xc8, 0x89, 0x0d, 0x71, 0x42, 0xd0, 0xa3,
+    0xb9, 0xc2, 0x49, 0x49, 0x93, 0x11, 0xcb, 0x68, 0x17, 0xea, 0xb1, 0xc7, 0x05, 0x48, 0x96, 0xa6,
+    0x06, 0x22, 0x24, 0x28, 0xb7, 0xd6, 0x75, 0x25, 0x9d, 0xa6, 0x21, 0xd1, 0x67, 0x64, 0x50, 0x55,
+    0x98, 0x48, 0xd2, 0xcc, 0x62, 0xc2, 0xa7, 0x4d, 0x4d, 0x12, 0x69, 0x8c, 0xe7, 0x22, 0x43, 0x96,
+    0x4c, 0xef, 0x89, 0x39, 0x9a, 0x4c, 0x73, 0xfc, 0x8d, 0x45, 0x8a, 0x66, 0x88, 0x7c, 0xcc, 0xd3,
+    0x94, 0x2f, 0x48, 0xb5, 0x88, 0x67, 0x71, 0x42, 0x1a, 0xc9, 0xf7, 0x86, 0x31, 0xc4, 0xa5, 0x70,
+    0xc4, 0xef, 0x98, 0xd6, 0x25, 0xf7, 0x75, 0xc6, 0x15, 0x8a, 0x9a, 0x8b, 0x40, 0x0e, 0x98, 0xad,
+    0xbc, 0x5a, 0x2c, 0xc9, 0x49, 0x98, 0xa6, 0x30, 0x62, 0x85, 0xc1, 0x90, 0x2f, 0x9a, 0x37, 0xac,
+    0xa9, 0x23, 0x88, 0xbd, 0x54, 0xe8, 0xf8, 0x24, 0x4c, 0x61, 0xc6, 0x85, 0xe6, 0xb7, 0xae, 0xa6,
+    0x83, 0xfc, 0xcf, 0x5d, 0x08, 0x06, 0xa7, 0xc3, 0x8f, 0x1d, 0xdf, 0x05, 0x2f, 0x80, 0x4b, 0x7f,
+    0xf0, 0xc1, 0xeb, 0xba, 0x5d, 0xd8, 0xe9, 0x04, 0x38, 0xde, 0xb1, 0xe1, 0xa3, 0x37, 0x3c, 0x1f,
+    0x5c, 0x0d, 0x01, 0x29, 0xfc, 0x4e, 0x7f, 0x78, 0x0d, 0x83, 0x53, 0xe8, 0xf4, 0xaf, 0xe1, 0x17,
+    0xaf, 0xdf, 0xb5, 0xc1, 0xfd, 0x74, 0xe9, 0xbb, 0x41, 0x00, 0x03, 0xdf, 0xf0, 0x2e, 0x2e, 0x7b,
+    0x9e, 0x8b, 0x73, 0x5e, 0xff, 0xa4, 0x77, 0xd5, 0xf5, 0xfa, 0x67, 0x70, 0x8c, 0xfb, 0xfa, 0x83,
+    0x21, 0xf4, 0xbc, 0x0b, 0x6f, 0x88, 0xa0, 0xc3, 0x01, 0x10, 0xc3, 0x02, 0xca, 0x73, 0x03, 0x02,
+    0xbb, 0x70, 0xfd, 0x93, 0x73, 0x1c, 0x76, 0x8e, 0xbd, 0x9e, 0x37, 0xbc, 0xb6, 0x8d, 0x53, 0x6f,
+    0xd8, 0x27, 0xcc, 0xd3, 0x81, 0x0f, 0x1d, 0xb8, 0xec, 0xf8, 0x43, 0xef, 0xe4, 0xaa, 0xd7, 0xf1,
+    0xe1, 0xf2, 0xca, 0xbf, 0x1c, 0x04, 0x2e, 0xb2, 0xef, 0x22, 0x6c, 0xdf, 0xeb, 0x9f, 0xfa, 0xc8,
+    0xc5, 0xbd, 0x70, 0xfb, 0x43, 0x07, 0xb9, 0xe2, 0x1c, 0xb8, 0x1f, 0x70, 0x00, 0xc1, 0x79, 0xa7,
+    0xd7, 0x23, 0x56, 0x46, 0xe7, 0x0a, 0xa5, 0xf7, 0x49, 0x3e, 0x38, 0x19, 0x5c, 0x5e, 0xfb, 0xde,
+    0xd9, 0xf9, 0x10, 0xce, 0x07, 0xbd, 0xae, 0x8b, 0x93, 0xc7, 0x2e, 0x4a, 0xd6, 0x39, 0xee, 0xb9,
+    0x39, 0x2b, 0x54, 0xea, 0xa4, 0xd7, 0xf1, 0x2e, 0x6c, 0xe8, 0x76, 0x2e, 0x3a, 0x67, 0xae, 0xde,
+    0x35, 0x40, 0x14, 0xdf, 0x20, 0xb2, 0x5c, 0x3a, 0xf8, 0x78, 0xee, 0xd2, 0x14, 0xf1, 0xeb, 0xe0,
+    0xdf, 0xc9, 0xd0, 0x1b, 0xf4, 0x49, 0x8d, 0x93, 0x41, 0x7f, 0xe8, 0xe3, 0xd0, 0x46, 0x2d, 0xfd,
+    0x61, 0xb5, 0xf5, 0xa3, 0x17, 0xb8, 0x36, 0x74, 0x7c, 0x2f, 0x20, 0x83, 0x9c, 0xfa, 0x83, 0x0b,
+    0xdb, 0x20, 0x73, 0xe2, 0x8e, 0x81, 0x06, 0xc1, 0x7d, 0x7d, 0x37, 0x47, 0x21, 0x53, 0x43, 0xc3,
+    0x23, 0x48, 0x42, 0xe3, 0xab, 0xc0, 0xad, 0x00, 0xa1, 0xeb, 0x76, 0x7a, 0x88, 0x15, 0xd0, 0x66,
+    0x52, 0xb1, 0x24, 0x76, 0x8c, 0xd7, 0x7b, 0x06, 0x46, 0x40, 0x26, 0x15, 0x04, 0x97, 0xae, 0xdb,
+    0xbd, 0x21, 0xb3, 0x9e, 0xb9, 0x37, 0xc3, 0x73, 0x74, 0x11, 0xe9, 0x0c, 0x47, 0xd0, 0x76, 0xf6,
+    0x61, 0x6f, 0x0f, 0xce, 0xf9, 0x02, 0xa6, 0xf3, 0x68, 0xa2, 0xc3, 0x41, 0xce, 0x18, 0x46, 0xd0,
+    0x24, 0xd4, 0xf1, 0x8d, 0xc9, 0x21, 0xbb, 0x65, 0x80, 0x79, 0x03, 0x43, 0x8a, 0x8b, 0x98, 0x09,
+    0x0c, 0x5d, 0x81, 0x39, 0x21, 0x63, 0x8b, 0x82, 0x12, 0xa9, 0x30, 0xf4, 0x24, 0x1e, 0x7d, 0x07,
+    0x82, 0x09, 0x4f, 0x63, 0x3d, 0x9c, 0x62, 0xfc, 0x21, 0xb1, 0xc2, 0xfd, 0x05, 0xfb, 0x0b, 0xaf,
+    0xbf, 0xe2, 0xdd, 0x10, 0xac, 0xb1, 0x92, 0x4b, 0xf5, 0x96, 0xc4, 0x0a, 0x08, 0x5f, 0x02, 0x66,
+    0x12, 0x99, 0x03, 0xe9, 0xf8, 0xa7, 0x43, 0x26, 0xf8, 0x3c, 0x8b, 0x73, 0xde, 0x7f, 0x30, 0xc1,
+    0x9d, 0x47, 0x70, 0x81, 0xdb, 0xef, 0xde, 0x74, 0xdd, 0x5e, 0xe7, 0xfa, 0xe6, 0x22, 0x40, 0xc8,
+    0xb7, 0x6d, 0x02, 0xbc, 0xc0, 0x8c, 0x36, 0x9d, 0xe3, 0x81, 0x4d, 0xa6, 0xa8, 0x13, 0x53, 0x0b,
+    0xc6, 0x32, 0xcc, 0x13, 0x52, 0x86, 0xb7, 0x4c, 0x36, 0x31, 0x3a, 0x9f, 0x36, 0x60, 0xe4, 0x20,
+    0xe1, 0xfd, 0xb3, 0x20, 0xda, 0xfb, 0x83, 0xde, 0x8d, 0xef, 0x16, 0xfe, 0xcc, 0x11, 0xf6, 0xdb,
+    0x39, 0x44, 0x97, 0xa5, 0xe1, 0x12, 0xf7, 0xa2, 0x29, 0x51, 0x17, 0xc6, 0x67, 0xac, 0xc8, 0xb4,
+    0xb1, 0xe0, 0xb3, 0x19, 0xea, 0x85, 0x28, 0x4a, 0xf0, 0x14, 0x33, 0x47, 0xf4, 0x95, 0x29, 0xc3,
+    0xc0, 0x3d, 0xc7, 0x49, 0x16, 0x8a, 0x65, 0xb5, 0x32, 0x13, 0x5c, 0xf1, 0x88, 0xa7, 0x98, 0x59,
+    0x18, 0x2b, 0x67, 0x6f, 0xca, 0x59, 0x67, 0xb2, 0x26, 0xc8, 0x45, 0x70, 0x76, 0xd3, 0xf5, 0xbd,
+    0x0f, 0x2e, 0x49, 0xb1, 0x61, 0x6d, 0xe8, 0xf6, 0xf0, 0xe0, 0x0c, 0xfd, 0x6b, 0x5c, 0x3f, 0x58,
+    0x5b, 0x3f, 0xed, 0x75, 0xce, 0x50, 0x93, 0xc0, 0x1d, 0x92, 0x6f, 0xee, 0xdb, 0xfb, 0x5a, 0x9e,
+    0xd3, 0x79, 0x16, 0xe5, 0x69, 0x84, 0x02, 0xe2, 0x24, 0x17, 0x40, 0xc2, 0x5d, 0x12, 0xc2, 0x2f,
+    0x6c, 0x39, 0xc3, 0x44, 0x2e, 0x8d, 0xbb, 0x50, 0x14, 0x41, 0x72, 0x04, 0xdf, 0x0c, 0xc0, 0x0f,
+    0xd2, 0x62, 0xaa, 0x89, 0xdf, 0x43, 0xdb, 0xd6, 0x63, 0xa9, 0x18, 0x13, 0x7a, 0xf4, 0xa0, 0x51,
+    0xaf, 0x24, 0x12, 0x13, 0x60, 0xcc, 0x46, 0xe8, 0xe3, 0x28, 0xcf, 0x90, 0xd3, 0x29, 0x66, 0x3f,
+    0x59, 0xe6, 0x4e, 0x81, 0xf9, 0x51, 0x68, 0x6c, 0x0c, 0xb6, 0xe0, 0x85, 0xf0, 0x34, 0x22, 0x8f,
+    0x05, 0x18, 0xa7, 0x25, 0x3f, 0x82, 0x98, 0x72, 0xbc, 0x3a, 0xba, 0x7c, 0x91, 0x21, 0xc6, 0x38,
+    0x4c, 0x25, 0x3b, 0xd4, 0x72, 0xe0, 0xd5, 0x29, 0xf1, 0xbe, 0x40, 0xe2, 0x35, 0x5f, 0x38, 0x70,
+    0x8a, 0x91, 0x2d, 0x61, 0x14, 0x46, 0x5f, 0x49, 0xa0, 0x33, 0xb4, 0xca, 0x5e, 0x2c, 0x12, 0x4c,
+    0xd9, 0x8b, 0x09, 0x5e, 0x7a, 0x80, 0xf7, 0x03, 0x06, 0x69, 0x8c, 0x88, 0x8e, 0x66, 0x50, 0x6e,
+    0x2f, 0x45, 0xcc, 0x61, 0xde, 0x43, 0x36, 0x4f, 0xd3, 0x42, 0x48, 0xf6, 0x7b, 0x25, 0x22, 0x9a,
+    0x8d, 0x16, 0x95, 0x98, 0xb3, 0x62, 0x42, 0x55, 0xe2, 0x8e, 0x0b, 0x8b, 0x03, 0xc5, 0x4b, 0x61,
+    0xf0, 0x40, 0xa3, 0x99, 0x56, 0x01, 0x9e, 0x32, 0x55, 0x30, 0x40, 0x7e, 0x74, 0x44, 0x3f, 0xb2,
+    0x51, 0x41, 0xf2, 0x65, 0x21, 0xdf, 0xef, 0xed, 0xbd, 0xfa, 0x56, 0xde, 0xd3, 0x4e, 0xca, 0x23,
+    0x7d, 0x93, 0x3a, 0x13, 0x2e, 0xd5, 0xc3, 0xde, 0x42, 0x7e, 0xb1, 0x6a, 0x02, 0x3a, 0x23, 0x1d,
+    0x6f, 0xc3, 0xe5, 0x8c, 0x21, 0x54, 0x2b, 0x14, 0x22, 0x5c, 0x8e, 0xe6, 0xe3, 0x31, 0x13, 0xad,
+    0x3a, 0x55, 0x18, 0xc7, 0xee, 0x1d, 0xa2, 0xf5, 0xb4, 0xb1, 0x98, 0x30, 0x5b, 0x24, 0x5c, 0xcb,
+    0x06, 0x14, 0xe9, 0xe8, 0xa7, 0x42, 0x2a, 0xfa, 0x14, 0x66, 0x70, 0x2a, 0xe9, 0x8a, 0xd0, 0x5e,
+    0x5f, 0xd7, 0x06, 0xc0, 0x65, 0xb2, 0x80, 0x5e, 0x7c, 0xb0, 0x9e, 0xe6, 0x57, 0x9c, 0x3c, 0x62,
+    0xc9, 0x68, 0x65, 0x8d, 0x2f, 0x59, 0x64, 0x2a, 0x6f, 0x0b, 0x73, 0x74, 0x43, 0x15, 0x7e, 0x48,
+    0xd8, 0x22, 0x27, 0x75, 0x62, 0x1c, 0x5a, 0x15, 0x69, 0x32, 0x06, 0x13, 0x49, 0x9d, 0xd1, 0x52,
+    0xb1, 0x1e, 0xcb, 0x6e, 0xd5, 0x04, 0xfe, 0x03, 0xfb, 0xef, 0xe0, 0xcf, 0x3f, 0x09, 0xc1, 0xb9,
+    0x65, 0xea, 0x2a, 0xc9, 0xd4, 0x8f, 0x66, 0xdb, 0x82, 0x7f, 0x1d, 0x6d, 0x3e, 0x3d, 0x56, 0x8d,
+    0x73, 0xee, 0x4e, 0x85, 0xb5, 0x40, 0x35, 0xf5, 0xf0, 0x58, 0x5d, 0x45, 0xca, 0x9a, 0x28, 0x17,
+    0x73, 0x32, 0xbe, 0x40, 0xab, 0xed, 0xd6, 0x99, 0xed, 0xbf, 0x33, 0xdf, 0xd9, 0xda, 0x16, 0x96,
+    0x05, 0x3f, 0xe0, 0xe1, 0x3b, 0xc5, 0x4f, 0x05, 0x52, 0xb9, 0x12, 0xa9, 0xdd, 0x94, 0xd1, 0xd7,
+    0xe3, 0xa5, 0x17, 0x9b, 0x2d, 0xc5, 0x68, 0xa4, 0xc4, 0xb2, 0x65, 0x39, 0x8a, 0xdd, 0x2b, 0x0a,
+    0x16, 0x0a, 0xe5, 0x23, 0xf8, 0xf2, 0xea, 0x5b, 0x8d, 0xf5, 0xc3, 0x54, 0x7e, 0x79, 0x91, 0x91,
+    0xa3, 0x94, 0x4b, 0xf6, 0x12, 0xaf, 0x52, 0x54, 0x57, 0xab, 0x58, 0xdf, 0xe0, 0x39, 0x70, 0xd0,
+    0xa1, 0x43, 0x3c, 0x79, 0x58, 0xbf, 0x99, 0x8f, 0x22, 0xd7, 0xde, 0x98, 0x2a, 0xad, 0x52, 0x28,
+    0x8c, 0x7a, 0xa3, 0x40, 0x79, 0x24, 0xd4, 0x4e, 0xca, 0xc3, 0x78, 0xa7, 0x29, 0xd3, 0x86, 0x93,
+    0x91, 0xe7, 0x05, 0xa6, 0xa2, 0x89, 0xf9, 0x38, 0xf4, 0x39, 0x96, 0x58, 0x78, 0xb1, 0xbd, 0x81,
+    0xd6, 0x1e, 0xaa, 0x32, 0x4e, 0x6e, 0x5b, 0xab, 0x70, 0x70, 0x30, 0xd7, 0x64, 0xa6, 0x89, 0x01,
+    0x39, 0xc3, 0x2c, 0xc7, 0x34, 0x97, 0x72, 0xe0, 0xfc, 0x86, 0x05, 0xa0, 0x69, 0xad, 0x13, 0xcb,
+    0x09, 0x5f, 0x9c, 0x68, 0x9c, 0xda, 0x0a, 0xb2, 0x42, 0xde, 0x66, 0x0e, 0xf0, 0x8d, 0xb4, 0xd2,
+    0x6b, 0x8d, 0x14, 0x4a, 0x37, 0x6d, 0x99, 0x66, 0x94, 0x60, 0xe1, 0x14, 0xf3, 0x5e, 0xed, 0x40,
+    0xcf, 0x45, 0x44, 0xa7, 0x70, 0xab, 0xbf, 0xf3, 0x3d, 0x2d, 0xeb, 0xb0, 0xf0, 0x22, 0xd1, 0x3b,
+    0x52, 0x44, 0xf5, 0x3d, 0x9b, 0x74, 0x2e, 0xf6, 0x1d, 0x1a, 0x15, 0xaf, 0x78, 0x16, 0xc6, 0x4f,
+    0x71, 0xa2, 0xf5, 0xc2, 0x46, 0xf9, 0x25, 0x81, 0xe3, 0x00, 0xe5, 0xfe, 0xfa, 0xa4, 0x7c, 0x48,
+    0x24, 0xd5, 0x32, 0x65, 0x18, 0x8e, 0xb8, 0xd4, 0x51, 0x45, 0x1d, 0xae, 0x05, 0xc7, 0xad, 0xbb,
+    0x8b, 0x24, 0x56, 0x93, 0x06, 0x2c, 0xf1, 0x91, 0xc9, 0x1f, 0x84, 0xba, 0x8f, 0xa2, 0x6e, 0x29,
+    0x60, 0xde, 0xac, 0xd8, 0xeb, 0xbd, 0xb4, 0x8b, 0xc2, 0xad, 0xc6, 0xe1, 0x0e, 0x4f, 0xfb, 0x31,
+    0xbf, 0xc7, 0xd8, 0xc5, 0xd0, 0xdf, 0xc5, 0x0b, 0x18, 0x5e, 0x57, 0xe0, 0x0f, 0xb0, 0x71, 0xea,
+    0xe0, 0xb9, 0x99, 0x22, 0x51, 0x6e, 0x37, 0x12, 0x0b, 0xe3, 0x3f, 0x78, 0x46, 0xea, 0x36, 0x85,
+    0x11, 0x28, 0xc6, 0xa6, 0x92, 0xe7, 0x35, 0x55, 0x06, 0xcf, 0x80, 0xe2, 0x29, 0x48, 0xd0, 0x83,
+    0x5c, 0x3c, 0x81, 0xfa, 0xc8, 0x40, 0x05, 0xf0, 0xca, 0x38, 0x1b, 0xf2, 0x27, 0x5d, 0x80, 0x74,
+    0x5d, 0x6d, 0xcb, 0xa0, 0xc8, 0x4c, 0x5f, 0xb2, 0xa7, 0x82, 0x4f, 0x4f, 0xd2, 0x04, 0x09, 0x2e,
+    0xb9, 0xd4, 0x2f, 0x96, 0x22, 0x8b, 0x46, 0x7a, 0xf2, 0x93, 0x0d, 0xf5, 0xe1, 0xf5, 0xea, 0x04,
+    0xd4, 0xaf, 0xd8, 0x5a, 0x5a, 0x3f, 0x7c, 0x56, 0xaa, 0x29, 0x5e, 0xf4, 0xdb, 0xa4, 0xd2, 0xc9,
+    0xba, 0x04, 0x5e, 0x4f, 0xbb, 0x7f, 0x5b, 0x64, 0xfa, 0xe4, 0x4b, 0x58, 0xc8, 0xd0, 0xff, 0x2e,
+    0x1b, 0x87, 0xf3, 0x14, 0xd3, 0xc9, 0xe1, 0x86, 0x64, 0x5e, 0x29, 0xd4, 0xf4, 0xe0, 0x16, 0xad,
+    0xe6, 0xb3, 0xad, 0x96, 0x26, 0x99, 0x1d, 0x5d, 0xb3, 0xe8, 0x2a, 0xb8, 0xbd, 0xb6, 0x52, 0x54,
+    0x37, 0x6b, 0x6b, 0x8f, 0x2a, 0x98, 0x86, 0x7d, 0x9f, 0x13, 0x49, 0x71, 0xac, 0xfb, 0xf1, 0x69,
+    0x28, 0xd4, 0x5f, 0xf7, 0xbf, 0x7e, 0x23, 0xc4, 0x43, 0x42, 0x62, 0xf2, 0xd7, 0xf6, 0xe7, 0x47,
+    0xe6, 0xdd, 0x42, 0x70, 0x6d, 0x35, 0x43, 0xe1, 0x19, 0x29, 0x9f, 0x0a, 0x87, 0xff, 0x1b, 0x21,
+    0x59, 0x16, 0xff, 0x73, 0xee, 0x6d, 0x38, 0xb1, 0x2a, 0xff, 0x9e, 0xd0, 0xf5, 0xde, 0x86, 0xa5,
+    0xb5, 0x56, 0xfd, 0x50, 0x1d, 0x8d, 0xc5, 0xf3, 0x51, 0x7e, 0xd4, 0x30, 0xad, 0x1c, 0xd3, 0x04,
+    0x5e, 0x30, 0xf9, 0x5e, 0x9f, 0x45, 0xe5, 0x2d, 0xf9, 0x58, 0xc8, 0x03, 0x87, 0x12, 0x9f, 0x69,
+    0xde, 0x63, 0x59, 0x92, 0xe3, 0x38, 0x29, 0x1b, 0xa3, 0x62, 0x7b, 0xe5, 0x50, 0xa7, 0x6e, 0x5c,
+    0x6d, 0x3b, 0x6f, 0xad, 0x5a, 0x8e, 0xdc, 0xaa, 0xda, 0x6e, 0x09, 0xb9, 0x5c, 0x41, 0x2a, 0x3e,
+    0xab, 0x21, 0x4e, 0x98, 0x6e, 0x7b, 0x6c, 0x86, 0x7c, 0x30, 0xf4, 0x39, 0x33, 0xa8, 0x48, 0x2f,
+    0x9f, 0x19, 0xa0, 0xfd, 0x20, 0x8d, 0x27, 0x5c, 0xf3, 0x95, 0x2d, 0x8b, 0x14, 0x57, 0x59, 0xd1,
+    0xc4, 0x39, 0x5e, 0x65, 0x0e, 0x3d, 0xd8, 0x72, 0xd8, 0xe5, 0x22, 0xc1, 0x1b, 0xbc, 0xd8, 0xe0,
+    0x44, 0x3c, 0x66, 0x75, 0x13, 0x47, 0xa1, 0x64, 0xd0, 0xea, 0x08, 0xc1, 0x17, 0x57, 0xb3, 0xd6,
+    0xfb, 0x66, 0x1e, 0x5a, 0x53, 0x7e, 0xdf, 0x69, 0x1f, 0x36, 0x08, 0x46, 0x78, 0xff, 0x7e, 0x3d,
+    0xdc, 0x84, 0x45, 0x07, 0xfa, 0x19, 0xb4, 0xdd, 0xef, 0x80, 0xeb, 0xa1, 0xd7, 0x36, 0xc2, 0x95,
+    0x9e, 0xfe, 0x1e, 0x30, 0x9f, 0x1c, 0xf4, 0x24, 0xda, 0x53, 0x60, 0xb9, 0x0b, 0xb5, 0xfb, 0x7c,
+    0xac, 0x53, 0x09, 0xf6, 0x45, 0x0e, 0xd4, 0x79, 0xb3, 0xe9, 0xbe, 0xf1, 0xb8, 0xf4, 0x44, 0xdd,
+    0x47, 0xe3, 0xf1, 0x8b, 0x9d, 0xf4, 0x7d, 0x06, 0x6f, 0xff, 0x65, 0x7b, 0x7f, 0x97, 0xf1, 0xda,
+    0xcf, 0x1a, 0xcf, 0x58, 0x55, 0xd6, 0x1e, 0x56, 0xf6, 0xe2, 0x2e, 0x4c, 0xcd, 0x95, 0x65, 0x4a,
+    0xc5, 0xe9, 0x8a, 0x34, 0x9b, 0x3a, 0xbc, 0x7e, 0x0d, 0x07, 0x58, 0x35, 0xd5, 0xf9, 0xd1, 0x94,
+    0x85, 0x0f, 0x9d, 0x8d, 0x75, 0x89, 0x5e, 0xfb, 0xf6, 0xa2, 0x6b, 0x68, 0x73, 0x76, 0xcb, 0x2f,
+    0xc9, 0xf5, 0x7d, 0x17, 0xa1, 0x9a, 0x38, 0x58, 0xe3, 0x9a, 0x18, 0x27, 0x76, 0x31, 0x0a, 0xef,
+    0xcd, 0x5d, 0x3d, 0x6c, 0x10, 0x17, 0x25, 0x76, 0x13, 0xfc, 0x05, 0xdb, 0x35, 0xa9, 0x55, 0x54,
+    0x3e, 0x79, 0x49, 0xa9, 0x17, 0x4e, 0xf2, 0x2c, 0x4f, 0x6f, 0x2e, 0xbd, 0x2f, 0x1c, 0xc9, 0x35,
+    0x13, 0xed, 0x56, 0x5d, 0x85, 0x4a, 0x06, 0xf8, 0x69, 0x4b, 0x7d, 0x65, 0xd1, 0xdb, 0x70, 0x1d,
+    0x28, 0x97, 0xb2, 0x06, 0x93, 0xcb, 0xb2, 0x1d, 0xa4, 0x26, 0xa3, 0xee, 0x29, 0x55, 0x4f, 0x55,
+    0x66, 0xea, 0x7a, 0x99, 0x1e, 0x4f, 0x66, 0x59, 0x5d, 0x90, 0x53, 0x1b, 0x9a, 0x90, 0x04, 0x7a,
+    0x5b, 0x8d, 0x63, 0xd9, 0xe8, 0xa8, 0x78, 0x3e, 0x6a, 0x67, 0x59, 0xe4, 0xd6, 0xca, 0x77, 0x03,
+    0xdd, 0x9b, 0x76, 0x42, 0x29, 0x93, 0xdb, 0xcc, 0x2c, 0x61, 0x0a, 0x5b, 0xd6, 0x4a, 0x9e, 0xc7,
+    0x0c, 0x8e, 0xb4, 0xc8, 0x2b, 0x0a, 0xdd, 0x09, 0x69, 0x5a, 0xb4, 0xe9, 0x92, 0x2a, 0x8c, 0xed,
+    0x6d, 0xdd, 0x3a, 0x9d, 0xdf, 0xeb, 0x97, 0xdd, 0x65, 0x28, 0xc2, 0x29, 0xfd, 0xc4, 0x61, 0xde,
+    0x85, 0x22, 0x09, 0x47, 0x29, 0xb3, 0x01, 0x23, 0x7e, 0x5e, 0x9d, 0xf0, 0x67, 0x5f, 0x77, 0x5f,
+    0x8a, 0xd7, 0xdd, 0xcf, 0xaf, 0xbe, 0x95, 0x10, 0x0f, 0x47, 0xf4, 0x1d, 0x41, 0xca, 0x6a, 0xfe,
+    0x7f, 0xfb, 0xe4, 0xcb, 0xbb, 0x5b, 0x01, 0x5e, 0xc7, 0xba, 0xc5, 0xca, 0x94, 0xc2, 0x0b, 0x58,
+    0x96, 0x8f, 0x3e, 0x09, 0x63, 0x51, 0xfc, 0x8e, 0x80, 0xa5, 0x98, 0x62, 0x50, 0xc8, 0x0b, 0x61,
+    0x26, 0x17, 0x4c, 0x48, 0xfd, 0xfb, 0x47, 0xcd, 0x26, 0x15, 0x4f, 0x53, 0x93, 0x5b, 0xab, 0xee,
+    0x17, 0x98, 0x79, 0x20, 0x25, 0x31, 0x75, 0xf7, 0x7f, 0x6d, 0x8d, 0xd3, 0x50, 0x4e, 0x30, 0x6f,
+    0xb6, 0x7e, 0x9f, 0x87, 0x69, 0xa2, 0x96, 0xf4, 0x75, 0x4c, 0xe6, 0xa4, 0x1b, 0xb5, 0xf5, 0xb9,
+    0x7e, 0xb8, 0xb7, 0xbd, 0x3c, 0x92, 0xd8, 0x72, 0xb4, 0xa5, 0xa8, 0x69, 0x43, 0xec, 0x7e, 0x4d,
+    0xe2, 0xcf, 0xb5, 0xc3, 0xbd, 0xf5, 0xc5, 0x12, 0xc6, 0xe1, 0x4c, 0x61, 0x38, 0xe0, 0x83, 0x05,
+    0xeb, 0x22, 0x7c, 0x8d, 0xc7, 0x25, 0x82, 0x53, 0x2e, 0x3d, 0x0d, 0x90, 0x97, 0x64, 0x37, 0x6a,
+    0x82, 0x3e, 0xa0, 0xc6, 0xf2, 0x06, 0xa0, 0x75, 0x12, 0x8c, 0xf8, 0x76, 0xa3, 0x57, 0x96, 0x07,
+    0xe4, 0x2a, 0x14, 0xf3, 0xb3, 0xb8, 0x4a, 0x90, 0xcd, 0x0e, 0x86, 0xf5, 0x7c, 0xe7, 0x88, 0x06,
+    0x1d, 0xea, 0x86, 0x1d, 0xeb, 0x6e, 0x98, 0xf9, 0x63, 0x2d, 0x24, 0x2a, 0x30, 0xf6, 0x3b, 0x65,
+    0x98, 0xfa, 0xf0, 0x0d, 0xec, 0x6f, 0xe8, 0xe0, 0x50, 0xab, 0x47, 0x56, 0x7d, 0x25, 0xfb, 0x71,
+    0xbb, 0xd6, 0xda, 0x4c, 0xba, 0x6f, 0xaf, 0x35, 0xcc, 0x7e, 0xde, 0xd4, 0xad, 0x7d, 0x0f, 0xed,
+    0x8d, 0xfb, 0xf7, 0xdf, 0x99, 0x07, 0x76, 0x5d, 0xd8, 0xa2, 0xc5, 0xb4, 0x4e, 0xeb, 0x11, 0xab,
+    0x7f, 0x17, 0x19, 0x56, 0xb7, 0xdc, 0xcd, 0xea, 0x22, 0xd1, 0x0f, 0xcb, 0xcd, 0x3b, 0xde, 0x36,
+    0x76, 0x14, 0xb7, 0xcc, 0x66, 0xfa, 0x55, 0x8f, 0xab, 0xd6, 0x01, 0x2b, 0xad, 0xb4, 0x2e, 0x55,
+    0xd3, 0x55, 0xb8, 0x1d, 0xd1, 0x75, 0xbf, 0x4e, 0x3b, 0xc2, 0xda, 0xda, 0x4a, 0xac, 0x3d, 0x8a,
+    0x80, 0xe1, 0xd7, 0x9a, 0x8f, 0x5f, 0x90, 0x39, 0x74, 0x00, 0xfd, 0x5c, 0xe8, 0x8d, 0x49, 0x63,
+    0xab, 0x31, 0x1e, 0x7e, 0xd0, 0xaa, 0x36, 0x49, 0xea, 0xda, 0x63, 0xa6, 0xd9, 0x90, 0x19, 0x5e,
+    0x70, 0x90, 0xb6, 0x3f, 0xfd, 0x23, 0x3a, 0xd0, 0xbb, 0x4d, 0x39, 0xfe, 0x32, 0x16, 0x35, 0x49,
+    0xea, 0xf2, 0x36, 0xce, 0x11, 0xe5, 0x9c, 0xa0, 0x48, 0x5b, 0x55, 0x85, 0xb1, 0xbd, 0x21, 0x55,
+    0x50, 0xee, 0x52, 0x9b, 0xfc, 0x56, 0x9b, 0x82, 0xf8, 0x51, 0x0f, 0xc8, 0x89, 0x13, 0x39, 0xa3,
+    0x9f, 0x3f, 0x8e, 0x60, 0x67, 0x84, 0x06, 0xff, 0xba, 0x73, 0xf8, 0x32, 0xac, 0xa7, 0x00, 0x1e,
+    0x56, 0x82, 0x4e, 0x92, 0x98, 0xfd, 0xe3, 0x82, 0x66, 0x3c, 0x63, 0x7f, 0x47, 0xce, 0x62, 0x3f,
+    0x1a, 0xf4, 0xbf, 0x7e, 0x1b, 0xf5, 0x2d, 0xd5, 0x1f, 0x00, 0x00,
+};
+static const static_page_t CONTROL_JS_PAGE = {
+    CONTROL_JS,
+    sizeof(CONTROL_JS),
+    "text/javascript",
+    "\"048bd04cb1dd505d\"",
+    true
+};
 
 
-)rawliteral";
+// index.html: 2531 bytes, 884 gzipped
+static const uint8_t PROGMEM INDEX_HTML[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x56, 0xdf, 0x8f, 0xd3, 0x30,
+    0x0c, 0x7e, 0xbf, 0xbf, 0xc2, 0x84, 0x07, 0x40, 0xa2, 0xeb, 0xb6, 0xd3, 0x9d, 0x10, 0x6a, 0x87,
+    0x80, 0x57, 0x1e, 0xf8, 0x21, 0xc1, 0x23, 0xca, 0x92, 0xac, 0x09, 0x4b, 0x9b, 0x92, 0x64, 0xdd,
+    0x8d, 0xbf, 0x1e, 0x27, 0x69, 0xb7, 0xb2, 0xdb, 0x8d, 0x1b, 0x9c, 0xb4, 0x6b, 0xe2, 0xd8, 0x9f,
+    0x3f, 0xdb, 0xb1, 0xdb, 0xe2, 0x09, 0x37, 0xcc, 0xef, 0x5a, 0x01, 0xd2, 0xd7, 0x7a, 0x71, 0x55,
+    0x0c, 0x0f, 0x41, 0xf9, 0xe2, 0x0a, 0xa0, 0xa8, 0x85, 0xa7, 0xc0, 0x24, 0xb5, 0x4e, 0xf8, 0x92,
+    0x6c, 0xfc, 0x2a, 0x7b, 0x45, 0xe2, 0x81, 0x56, 0xcd, 0x1a, 0xac, 0xd0, 0x25, 0x71, 0x7e, 0xa7,
+    0x85, 0x93, 0x42, 0x78, 0x02, 0xd2, 0x8a, 0x55, 0x2f, 0x99, 0x30, 0xe7, 0x92, 0xaa, 0x63, 0x56,
+    0xb5, 0x1e, 0x9c, 0x65, 0x25, 0x61, 0xa6, 0xf1, 0xd6, 0xe8, 0xc9, 0x0f, 0x3c, 0x2b, 0xf2, 0x74,
+    0x12, 0x95, 0xbc, 0xf2, 0x5a, 0x2c, 0xbe, 0xa9, 0x95, 0x82, 0xcf, 0xa6, 0x13, 0x16, 0xde, 0x27,
+    0xcd, 0x22, 0x4f, 0x27, 0x57, 0x45, 0x9e, 0x48, 0x5d, 0x15, 0x4b, 0xc3, 0x77, 0x09, 0x58, 0x30,
+    0xaf, 0x4c, 0x03, 0x8a, 0x97, 0xa4, 0xa6, 0xaa, 0x89, 0xee, 0x50, 0xce, 0x55, 0x17, 0x65, 0xce,
+    0x5b, 0x41, 0xeb, 0x2c, 0xf8, 0xc4, 0x53, 0x61, 0x09, 0x30, 0x4d, 0x9d, 0x2b, 0x89, 0xaa, 0x69,
+    0x25, 0x46, 0xf2, 0x64, 0x87, 0x96, 0xb4, 0x8f, 0x80, 0xd1, 0xd6, 0x6f, 0xac, 0x20, 0xc0, 0xcd,
+    0xb6, 0xd1, 0x86, 0xf2, 0xbd, 0x68, 0xf2, 0xa3, 0xad, 0x0e, 0xfa, 0xaa, 0xae, 0x46, 0x9e, 0x48,
+    0x8a, 0x31, 0xe8, 0xab, 0xa6, 0xfa, 0x53, 0x33, 0xa7, 0x3d, 0xb9, 0x1c, 0xd9, 0x1d, 0xf1, 0xec,
+    0x93, 0x42, 0xe0, 0xe5, 0x40, 0x70, 0x90, 0xec, 0xcd, 0x5d, 0x97, 0x1c, 0xf1, 0x96, 0x72, 0x02,
+    0x98, 0x1f, 0x87, 0x81, 0x97, 0x64, 0x36, 0x99, 0xe1, 0x4e, 0x89, 0xed, 0x3b, 0x73, 0x57, 0x92,
+    0x6c, 0x36, 0x9d, 0x42, 0xfc, 0x37, 0x4f, 0x3f, 0x02, 0x77, 0xb5, 0x6e, 0x10, 0x4f, 0x7a, 0xdf,
+    0xbe, 0xce, 0xf3, 0xed, 0x76, 0x3b, 0xd9, 0x5e, 0x4f, 0x8c, 0xad, 0x72, 0x3c, 0x9d, 0xe6, 0x88,
+    0xba, 0x77, 0x81, 0x4e, 0x92, 0x0b, 0xf4, 0x10, 0x0b, 0x48, 0x60, 0xa5, 0x34, 0xd6, 0xb7, 0x31,
+    0x0d, 0xae, 0x31, 0x42, 0xb3, 0x16, 0x25, 0x79, 0x3a, 0x0d, 0xb0, 0x69, 0x97, 0x6d, 0x15, 0xf7,
+    0xb2, 0x24, 0xf3, 0x11, 0x08, 0xc2, 0xb4, 0xd4, 0x4b, 0x08, 0x25, 0x41, 0x2a, 0x90, 0xcd, 0xa7,
+    0xd0, 0x65, 0xd7, 0x53, 0x90, 0x61, 0xa7, 0x91, 0x15, 0x84, 0x5d, 0x78, 0x42, 0x90, 0x06, 0xbe,
+    0xd0, 0x5d, 0x23, 0x66, 0x7e, 0x1a, 0x64, 0x36, 0x8d, 0xba, 0xd0, 0x25, 0xf5, 0x00, 0x92, 0xf5,
+    0xc6, 0x59, 0x0f, 0x26, 0x21, 0x88, 0x83, 0x97, 0x07, 0x51, 0x82, 0x2a, 0xea, 0x20, 0x0b, 0xd4,
+    0xef, 0xc2, 0x4a, 0x67, 0x3d, 0xc2, 0x80, 0xd4, 0x45, 0x14, 0x79, 0x06, 0x64, 0x1e, 0xb3, 0x8b,
+    0x20, 0xc1, 0xa4, 0x4b, 0xf1, 0xf4, 0xb1, 0x0c, 0x31, 0x75, 0x51, 0x43, 0x9e, 0xa0, 0xc2, 0x94,
+    0x65, 0x5a, 0xa4, 0x22, 0xe2, 0x45, 0xfe, 0x15, 0xb3, 0xca, 0xb0, 0x6a, 0xa8, 0xc9, 0x76, 0xf1,
+    0x61, 0xb1, 0xa0, 0xe7, 0xec, 0x54, 0xc3, 0x15, 0xa3, 0xde, 0xd8, 0x13, 0x86, 0xf3, 0x7b, 0x86,
+    0x16, 0xbb, 0x23, 0x9a, 0x2d, 0xcd, 0xa6, 0xe1, 0xd4, 0xee, 0xf0, 0x36, 0xa4, 0x3b, 0x42, 0x60,
+    0x37, 0x2c, 0x86, 0x0a, 0x86, 0xb5, 0x14, 0xaa, 0x92, 0xbe, 0xdf, 0x8c, 0xb0, 0x8a, 0xbc, 0x3a,
+    0x5c, 0x63, 0xbc, 0x32, 0xfb, 0xcd, 0x72, 0xe3, 0x3d, 0xb6, 0x9f, 0x69, 0x98, 0x56, 0x6c, 0x8d,
+    0x5d, 0x20, 0xcd, 0xf6, 0x8b, 0xf0, 0x1e, 0x2f, 0xbf, 0x7b, 0xfe, 0x82, 0x2c, 0x86, 0x75, 0x91,
+    0x27, 0xcd, 0xc3, 0x6d, 0x6e, 0x69, 0xea, 0x5a, 0x2f, 0xb4, 0xc0, 0x11, 0x83, 0xdc, 0xc2, 0x34,
+    0x40, 0xe9, 0xc3, 0x4d, 0xe2, 0x7a, 0xb0, 0x6c, 0x49, 0xd9, 0xba, 0xb2, 0x21, 0x26, 0x72, 0x70,
+    0x2d, 0x15, 0x17, 0x63, 0xd7, 0xe7, 0x10, 0x0e, 0x5d, 0x25, 0x67, 0x23, 0x8e, 0xb8, 0x19, 0xe4,
+    0x9e, 0x2e, 0x31, 0xe5, 0x7d, 0x2f, 0xee, 0x1d, 0x47, 0xe9, 0xb8, 0x5f, 0xbc, 0xfd, 0x23, 0xe1,
+    0x9e, 0x2f, 0x3e, 0x84, 0x0c, 0x22, 0x96, 0xe7, 0xc7, 0x27, 0x85, 0x6a, 0xda, 0x8d, 0x87, 0x30,
+    0x6b, 0x4b, 0x62, 0x69, 0x53, 0x61, 0xf5, 0x03, 0xa9, 0x15, 0x3a, 0x91, 0x04, 0x6a, 0xd5, 0xc4,
+    0x4a, 0xd6, 0x14, 0x6b, 0x34, 0xbf, 0xb9, 0xc1, 0xae, 0xa6, 0x7a, 0x23, 0xe2, 0x85, 0x18, 0x21,
+    0x85, 0x3f, 0x8c, 0x59, 0x06, 0xfb, 0xc8, 0xec, 0x23, 0xb5, 0x14, 0x13, 0x28, 0xec, 0xf3, 0x67,
+    0x11, 0xe9, 0xd9, 0x4b, 0xf0, 0x52, 0xb9, 0x49, 0xb4, 0x8e, 0x79, 0x18, 0x53, 0xc1, 0xdd, 0x88,
+    0xf2, 0x99, 0x40, 0x80, 0x19, 0x1d, 0xca, 0x11, 0x7b, 0xbb, 0x90, 0xf3, 0xc5, 0x57, 0xcc, 0xaf,
+    0xc1, 0x1c, 0xcd, 0xcf, 0x22, 0x9e, 0xc8, 0xc8, 0xa7, 0x0d, 0xd5, 0xca, 0xef, 0x2e, 0x49, 0xc9,
+    0xcf, 0x64, 0xd2, 0x27, 0x65, 0x36, 0x64, 0xe5, 0xf6, 0xfa, 0x1f, 0x92, 0xd2, 0x63, 0x5d, 0x92,
+    0x96, 0x13, 0x41, 0x7c, 0x16, 0xce, 0xe8, 0x4d, 0x78, 0xd7, 0x5c, 0x54, 0xda, 0xc0, 0xc2, 0xa9,
+    0x5f, 0xe2, 0xa8, 0xbc, 0xb7, 0xfb, 0x38, 0x6e, 0x1e, 0x5d, 0xdb, 0x01, 0xea, 0x3f, 0x03, 0x79,
+    0xcb, 0xf1, 0x2d, 0xa6, 0x3a, 0xf1, 0xd7, 0x30, 0x98, 0x14, 0x6c, 0xbd, 0x34, 0x77, 0x29, 0x12,
+    0xda, 0x9b, 0xe1, 0xc0, 0x09, 0x72, 0xc1, 0x1f, 0x49, 0x7b, 0xb0, 0x1b, 0x58, 0xf7, 0xd6, 0xf0,
+    0x06, 0x66, 0xf0, 0x1a, 0xa6, 0x97, 0xf3, 0xff, 0xb2, 0x56, 0x2d, 0xbe, 0x7c, 0xf0, 0xbd, 0x04,
+    0x29, 0x25, 0x17, 0x06, 0x92, 0x68, 0x7e, 0xf7, 0xf8, 0x96, 0xc7, 0x61, 0xa5, 0xf9, 0x63, 0xf3,
+    0x7f, 0x6c, 0x77, 0x3f, 0xa0, 0xdb, 0xbf, 0x06, 0x84, 0xeb, 0x30, 0x40, 0x1e, 0x9c, 0x9e, 0xc7,
+    0x23, 0xec, 0xbd, 0x36, 0x4e, 0xdc, 0x1b, 0x9d, 0xc3, 0x5c, 0xc3, 0x71, 0x99, 0xbe, 0x7e, 0x8e,
+    0x36, 0x68, 0x10, 0x3f, 0x8f, 0xc2, 0xf7, 0x52, 0xfc, 0x96, 0xfb, 0x0d, 0xf2, 0xb0, 0x15, 0xf0,
+    0xe3, 0x09, 0x00, 0x00,
+};
+static const static_page_t INDEX_HTML_PAGE = {
+    INDEX_HTML,
+    sizeof(INDEX_HTML),
+    "text/html",
+    "\"c4782c9284a5ff28\"",
+    true
+};
 
 
-static const char PROGMEM INDEX_HTML[] = R"rawliteral(
-<!doctype html>
-<html>
-<head>
-  <meta charset="utf-8">
-  <link rel="stylesheet" href="style.css">
-  <script src="control.js"></script>
-  <title>Wifi Rover Control</title>
-</head>
+// loading.jpg: 36270 bytes, 22199 gzipped
+static const uint8_t PROGMEM LOADING_JPG[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0x7d, 0x05, 0x58, 0x5c, 0x4d,
+    0x96, 0xf6, 0x6d, 0xdc, 0xe9, 0xc6, 0x09, 0xd6, 0x68, 0x80, 0xe0, 0x10, 0xdc, 0xdd, 0xdd, 0x21,
+    0x04, 0x0f, 0xee, 0xee, 0xee, 0x1e, 0x12, 0x24, 0x04, 0x77, 0x92, 0x20, 0x81, 0x20, 0x41, 0x03,
+    0xc1, 0x09, 0x4e, 0x08, 0x04, 0x27, 0x84, 0x10, 0xdc, 0x9d, 0xbf, 0x49, 0x32, 0x33, 0xdf, 0x37,
+    0xbb, 0x33, 0xcf, 0xee, 0xce, 0xff, 0xec, 0xce, 0xce, 0x7e, 0x97, 0xee, 0xe7, 0x9e, 0x5b, 0xa7,
+    0xce, 0xa9, 0x53, 0xa7, 0xce, 0x79, 0xab, 0xea, 0x76, 0xf7, 0xe5, 0x66, 0xfa, 0x66, 0x11, 0x00,
+    0xcb, 0x4b, 0xcb, 0x49, 0x03, 0x20, 0xd8, 0xc1, 0x04, 0x62, 0x02, 0x80, 0x9b, 0x6b, 0x00, 0x57,
+    0xc2, 0xc5, 0xc2, 0xc4, 0xcd, 0xc2, 0x1c, 0xea, 0x69, 0xed, 0x66, 0x05, 0x95, 0x91, 0x53, 0x52,
+    0xbd, 0x59, 0x86, 0xab, 0x92, 0x93, 0x90, 0x78, 0xa8, 0xaa, 0xae, 0x22, 0x2d, 0xa7, 0x28, 0x05,
+    0xab, 0x0d, 0x00, 0x70, 0xb9, 0x76, 0x66, 0xf6, 0xae, 0x08, 0x6c, 0x00, 0x60, 0xef, 0xe0, 0xe6,
+    0xa2, 0x2e, 0x23, 0x0e, 0xd5, 0xd5, 0xd3, 0x87, 0x22, 0x7f, 0x01, 0xd0, 0x00, 0x0c, 0x00, 0x17,
+    0x20, 0x07, 0x48, 0x4d, 0xcc, 0x5c, 0x9d, 0xc4, 0x54, 0x55, 0x15, 0x81, 0xbf, 0x79, 0x1c, 0x4f,
+    0x01, 0xa0, 0xdb, 0xf3, 0x38, 0xf3, 0xad, 0x2e, 0xe0, 0x3f, 0x77, 0x60, 0x9a, 0x5b, 0xb8, 0x9a,
+    0x01, 0x00, 0x08, 0x0a, 0xa3, 0x45, 0xcd, 0x9c, 0x5c, 0xdc, 0x60, 0xb4, 0x31, 0x8c, 0xe6, 0xf6,
+    0x74, 0x73, 0xba, 0xa5, 0xd3, 0x61, 0x34, 0x9e, 0x99, 0x95, 0x89, 0x39, 0x8c, 0x7e, 0x01, 0xa3,
+    0x99, 0x5c, 0x60, 0x06, 0xc2, 0xe8, 0xe9, 0xdb, 0x72, 0xd3, 0x9f, 0xf4, 0xe6, 0x2d, 0xfd, 0xe8,
+    0x07, 0x0d, 0x77, 0xab, 0x13, 0xcf, 0x45, 0x53, 0x5d, 0x02, 0x46, 0xe3, 0xc1, 0x68, 0xe8, 0xa3,
+    0xdf, 0xd0, 0xa6, 0xbf, 0xa1, 0xcd, 0xac, 0x5c, 0xec, 0x61, 0x34, 0x17, 0x8c, 0xa6, 0x31, 0xb7,
+    0x77, 0x80, 0xe9, 0x87, 0xd3, 0xfd, 0x49, 0x9b, 0xdf, 0xd2, 0x7e, 0xb7, 0xb4, 0xbd, 0x9d, 0xbb,
+    0xd9, 0x2f, 0x3b, 0x6f, 0x7b, 0x88, 0x61, 0xe1, 0xa0, 0xa5, 0x71, 0x5b, 0x0e, 0x7b, 0x93, 0x02,
+    0x32, 0x80, 0x1c, 0xa0, 0x04, 0xa8, 0x02, 0x50, 0xc0, 0x14, 0x70, 0x07, 0xac, 0x01, 0x3b, 0xc0,
+    0x0d, 0x60, 0x86, 0x9d, 0x1d, 0x60, 0x25, 0xae, 0x80, 0x3a, 0x8c, 0x2f, 0xfe, 0x37, 0xe4, 0xef,
+    0xfc, 0x90, 0x57, 0x85, 0x49, 0x99, 0xc2, 0xa4, 0xac, 0x01, 0x33, 0x98, 0x84, 0x24, 0xe0, 0x08,
+    0xd8, 0x03, 0x26, 0x3f, 0xe4, 0x81, 0xdb, 0x31, 0xf8, 0x6b, 0xdf, 0xba, 0x5a, 0x72, 0x72, 0xfc,
+    0xd4, 0x84, 0x21, 0x0e, 0x00, 0x88, 0xf3, 0x37, 0x37, 0x07, 0xb4, 0x00, 0x80, 0xfc, 0x18, 0x00,
+    0xae, 0x92, 0x6e, 0x6e, 0x2e, 0xf2, 0x6e, 0x6e, 0xae, 0xf2, 0x01, 0x00, 0xfe, 0x33, 0x00, 0xb4,
+    0x3b, 0xfc, 0x45, 0xde, 0x31, 0x17, 0x00, 0x78, 0x8f, 0x60, 0xe5, 0x49, 0x7f, 0x29, 0xa3, 0xc9,
+    0x01, 0x00, 0xec, 0x30, 0x00, 0x78, 0xd3, 0xf5, 0x97, 0x32, 0xd3, 0x34, 0x00, 0xa8, 0x8f, 0x04,
+    0x00, 0xa2, 0x4f, 0x4e, 0x26, 0x2e, 0x26, 0x3f, 0x8a, 0xe0, 0x61, 0x6f, 0x38, 0x4b, 0x4b, 0x00,
+    0xd8, 0x2f, 0x81, 0x0d, 0x93, 0x1e, 0x00, 0xe0, 0x8e, 0x00, 0x00, 0x9a, 0xc1, 0x4f, 0xbf, 0xfd,
+    0xe2, 0x03, 0x05, 0x1f, 0x01, 0x40, 0x13, 0xe6, 0x2b, 0xc5, 0x21, 0x00, 0xc8, 0xc8, 0x04, 0x00,
+    0xba, 0x47, 0x30, 0xdd, 0x86, 0x7f, 0xa3, 0xdf, 0x28, 0xbf, 0xf5, 0xdb, 0xdf, 0xad, 0xf3, 0xcb,
+    0x7f, 0x37, 0xb3, 0x80, 0x04, 0x00, 0x0f, 0x07, 0x77, 0xfb, 0x82, 0x1d, 0x08, 0xb0, 0x17, 0x22,
+    0x0a, 0x22, 0x22, 0x02, 0x02, 0x22, 0x1a, 0x32, 0x32, 0x12, 0x0a, 0x06, 0x1a, 0x06, 0x06, 0x3a,
+    0x1a, 0x3a, 0x3a, 0x26, 0x16, 0x0e, 0x18, 0x13, 0x0b, 0x82, 0x85, 0x8e, 0x0e, 0x26, 0x00, 0x43,
+    0x70, 0xf1, 0xf0, 0xf1, 0xf1, 0x31, 0xb0, 0x09, 0x89, 0x08, 0xf0, 0x88, 0x70, 0xf0, 0xf0, 0xf1,
+    0x6e, 0x95, 0x80, 0xe0, 0x61, 0x32, 0x08, 0x88, 0xa8, 0x88, 0x88, 0xa8, 0x78, 0x98, 0xe8, 0x98,
+    0x78, 0xff, 0xe9, 0xe3, 0xe6, 0x1d, 0x00, 0x41, 0x01, 0x2d, 0xc2, 0x05, 0xc1, 0x83, 0x20, 0x00,
+    0x1c, 0x04, 0x04, 0x0f, 0x01, 0xdd, 0x74, 0x01, 0x24, 0x3f, 0x32, 0xee, 0xf6, 0xf8, 0x73, 0x3c,
+    0x23, 0x21, 0x22, 0x23, 0xc0, 0xc3, 0xdd, 0x32, 0x49, 0x61, 0xa5, 0xf0, 0xbf, 0x67, 0x22, 0x20,
+    0x22, 0x21, 0xc3, 0xa3, 0xc0, 0xb8, 0x33, 0x00, 0x06, 0x3c, 0x08, 0x80, 0x03, 0xc3, 0x83, 0x61,
+    0xbd, 0x5f, 0xd6, 0xfb, 0x30, 0x9c, 0xc8, 0xc3, 0xf2, 0xf7, 0xb2, 0x04, 0xde, 0x94, 0xa0, 0x80,
+    0xdc, 0xc1, 0xc8, 0x72, 0xf6, 0xef, 0xe6, 0x12, 0x5c, 0x66, 0x49, 0x00, 0x9d, 0x7d, 0xd5, 0xdf,
+    0xad, 0xc3, 0x50, 0xee, 0xb9, 0xfc, 0x87, 0x9a, 0x3f, 0xd4, 0xfc, 0x4b, 0xa8, 0x41, 0xda, 0x0a,
+    0x68, 0x1b, 0x5f, 0x31, 0xfe, 0x9b, 0xd5, 0x28, 0x58, 0x3f, 0x7b, 0x7f, 0x17, 0x14, 0xfd, 0x6b,
+    0x8d, 0x87, 0xde, 0x4a, 0xa7, 0xe7, 0x92, 0x57, 0xd7, 0xfe, 0x91, 0x03, 0x27, 0xa4, 0xff, 0x56,
+    0x4a, 0x43, 0x73, 0xa7, 0x6b, 0xe8, 0x0d, 0x0c, 0x5b, 0x95, 0xfb, 0xae, 0xe0, 0x07, 0xdd, 0x73,
+    0x44, 0x7e, 0x16, 0x3f, 0x5c, 0xbb, 0xd0, 0xb4, 0xdf, 0x61, 0x9c, 0x88, 0xcc, 0xc7, 0x9d, 0xf2,
+    0x0a, 0xfa, 0xa1, 0xbe, 0x6d, 0xb8, 0x52, 0x6c, 0xc8, 0x63, 0xe1, 0x61, 0x7c, 0xda, 0xc1, 0xc5,
+    0x69, 0x47, 0x75, 0x77, 0xcf, 0xdc, 0x01, 0x7a, 0xd6, 0xc9, 0xc3, 0x88, 0x91, 0xfd, 0xdf, 0xa8,
+    0x2b, 0x2e, 0x5b, 0x88, 0x7e, 0x66, 0x07, 0x00, 0x58, 0xaf, 0xe3, 0xcf, 0x35, 0x1e, 0xdb, 0xb5,
+    0xda, 0x02, 0xb6, 0xe2, 0x63, 0xdb, 0x1f, 0xbf, 0xef, 0x5b, 0xae, 0x55, 0xbd, 0xe0, 0x80, 0x4b,
+    0xa9, 0xf0, 0xdd, 0x49, 0x74, 0xcc, 0xa1, 0x7b, 0xea, 0x32, 0x8e, 0x26, 0x44, 0xae, 0x61, 0x5d,
+    0x5e, 0x7f, 0x1d, 0x28, 0x6b, 0xc0, 0xe6, 0xee, 0x5c, 0xdf, 0x5c, 0x71, 0x71, 0x79, 0x95, 0x88,
+    0x11, 0xe3, 0x3f, 0x73, 0x15, 0x78, 0x72, 0x76, 0x31, 0x1e, 0x9d, 0xfb, 0xac, 0xae, 0xc3, 0xab,
+    0x65, 0x23, 0x9c, 0xcc, 0xe8, 0xfb, 0xec, 0x92, 0x6d, 0xb8, 0x49, 0x12, 0x71, 0xca, 0xc1, 0xa2,
+    0xda, 0xe4, 0xf6, 0x1b, 0xe3, 0x8d, 0xdc, 0x43, 0x43, 0x3b, 0xff, 0xe6, 0x2f, 0x3e, 0x82, 0x5f,
+    0xdd, 0xe2, 0xea, 0x3d, 0x13, 0xdf, 0x7e, 0xb9, 0x26, 0xc6, 0xbb, 0x7e, 0x68, 0x45, 0xf1, 0xb0,
+    0x2b, 0x3e, 0x9d, 0xff, 0x85, 0xf5, 0xa7, 0x87, 0x84, 0x2d, 0x4a, 0xcc, 0x46, 0x27, 0x27, 0x67,
+    0x47, 0x19, 0x75, 0xed, 0xde, 0x57, 0x26, 0x36, 0x9d, 0xa3, 0xf6, 0xed, 0x53, 0xd7, 0x81, 0x6d,
+    0xd1, 0xcf, 0x0c, 0x91, 0x73, 0xa6, 0x08, 0xb2, 0x94, 0x90, 0xbf, 0x5e, 0x9c, 0x2e, 0xbc, 0xfa,
+    0xf4, 0xa8, 0xaf, 0xa8, 0x2b, 0x27, 0xa5, 0xa4, 0x6c, 0xfd, 0x21, 0xc5, 0x67, 0xb9, 0x5b, 0xb3,
+    0xd1, 0x6c, 0x9e, 0x9f, 0x66, 0xbc, 0x69, 0x07, 0x80, 0xef, 0xbc, 0x0b, 0x45, 0x7c, 0xdc, 0x03,
+    0x6b, 0x55, 0xdc, 0x8b, 0xb6, 0xb6, 0x0c, 0x3e, 0x9a, 0xdc, 0x91, 0x49, 0x7a, 0xa3, 0xee, 0x8a,
+    0x72, 0x67, 0x0c, 0xcf, 0xec, 0x90, 0x8e, 0x3c, 0x06, 0xf8, 0xb5, 0xf0, 0x85, 0x64, 0xc4, 0xf7,
+    0x2e, 0x26, 0x15, 0x66, 0x0f, 0xe6, 0x33, 0x52, 0x77, 0xf6, 0x79, 0x0c, 0x07, 0x56, 0x2e, 0xa2,
+    0x47, 0x5e, 0x3f, 0xe8, 0xcc, 0xb0, 0x15, 0xf6, 0xff, 0x14, 0x5c, 0x8e, 0xcb, 0x3d, 0x8d, 0xd5,
+    0x16, 0x7d, 0x1e, 0x00, 0x2f, 0xf7, 0xde, 0xaf, 0xb5, 0xee, 0x84, 0xef, 0xba, 0x6d, 0xf0, 0x7e,
+    0x9b, 0xd0, 0xe4, 0xf8, 0xa1, 0x3f, 0x6f, 0x26, 0xca, 0x45, 0xab, 0x89, 0xad, 0xc4, 0xe4, 0xc1,
+    0xea, 0x98, 0xb4, 0xd1, 0x7e, 0x15, 0x37, 0xf4, 0xdb, 0xf6, 0xeb, 0xb9, 0x18, 0xc6, 0x1b, 0x20,
+    0x65, 0x55, 0x71, 0xc8, 0xcf, 0x9f, 0xea, 0xbc, 0xd9, 0x8e, 0x5f, 0xda, 0xa0, 0xb9, 0xd3, 0x8a,
+    0x0f, 0xf9, 0xd9, 0x4c, 0x9b, 0x3e, 0xc1, 0xd3, 0xcc, 0x8a, 0x5c, 0xb1, 0xf5, 0x86, 0x8f, 0x39,
+    0x63, 0x84, 0xd2, 0x83, 0x9e, 0xb2, 0x03, 0xf3, 0x3a, 0xfb, 0x57, 0x32, 0xb5, 0xf9, 0x1b, 0x97,
+    0x1f, 0xb5, 0xda, 0x8f, 0xf2, 0xac, 0x03, 0x84, 0x93, 0x85, 0x84, 0xb9, 0xf1, 0x27, 0x5a, 0x78,
+    0xb2, 0x6c, 0xbc, 0xa4, 0x9e, 0x13, 0x6a, 0x9e, 0xc8, 0x34, 0xc4, 0xb5, 0x7c, 0xf1, 0x98, 0x20,
+    0xb3, 0xfd, 0x72, 0x91, 0x48, 0xe9, 0x39, 0xb0, 0x61, 0x7d, 0xce, 0x22, 0xb8, 0xd9, 0x7c, 0x94,
+    0x0d, 0xfd, 0x73, 0x48, 0xc2, 0xbf, 0x58, 0x09, 0x48, 0x5d, 0x9d, 0x65, 0xcd, 0x6c, 0x6f, 0xfe,
+    0x70, 0xac, 0x48, 0x42, 0xea, 0x80, 0x99, 0xc0, 0x23, 0xcd, 0xbc, 0xf5, 0x1e, 0xd9, 0x70, 0x6d,
+    0x26, 0x1b, 0x53, 0x49, 0xa3, 0xed, 0x53, 0x68, 0xc5, 0xf9, 0x35, 0x8d, 0x5f, 0x9b, 0xf3, 0x72,
+    0x65, 0x23, 0xab, 0xcc, 0xc0, 0x49, 0xc0, 0x83, 0x57, 0x67, 0x8b, 0x6e, 0x8a, 0x3d, 0x2e, 0x51,
+    0x23, 0x2e, 0xcc, 0xe9, 0x77, 0xf2, 0x38, 0xed, 0x83, 0xbe, 0x7d, 0x12, 0xc9, 0xf5, 0x4e, 0x78,
+    0xfd, 0x75, 0x69, 0x9c, 0xe3, 0xf9, 0x0d, 0x90, 0xb1, 0x71, 0x8a, 0x2c, 0x37, 0xe0, 0x99, 0x6e,
+    0x8f, 0x0c, 0x1d, 0x7e, 0xac, 0xf0, 0xf6, 0x61, 0xe5, 0x54, 0x78, 0x11, 0xcc, 0x0a, 0x63, 0xcc,
+    0x28, 0x7e, 0x9f, 0x3b, 0x43, 0xdd, 0x83, 0x64, 0xda, 0x88, 0x4f, 0x19, 0x39, 0x4e, 0x9e, 0x1c,
+    0x0e, 0x96, 0x04, 0xae, 0xf9, 0xb4, 0xde, 0x5a, 0x72, 0x03, 0xb4, 0x0d, 0xd7, 0xd6, 0xf5, 0xf0,
+    0x4f, 0x46, 0xe6, 0xaf, 0xf3, 0xbd, 0x9a, 0xe5, 0xb3, 0x0e, 0x23, 0x39, 0x7a, 0x6b, 0xe4, 0x5c,
+    0xba, 0x44, 0x9e, 0xc8, 0x37, 0x89, 0x2f, 0x84, 0xfe, 0xed, 0x34, 0x19, 0xa6, 0x67, 0xd5, 0x57,
+    0x25, 0xe3, 0xc5, 0x7a, 0x53, 0xb1, 0xe0, 0x66, 0x37, 0xcd, 0xe5, 0x93, 0xfb, 0xca, 0x37, 0xc0,
+    0xd1, 0xe5, 0xd5, 0xc0, 0xec, 0xc1, 0x5c, 0xfa, 0x9d, 0x97, 0xa5, 0xfc, 0xa5, 0x03, 0xf3, 0xda,
+    0x00, 0xde, 0xa4, 0xc0, 0x1e, 0xcc, 0x20, 0x00, 0x34, 0xe5, 0xdc, 0x26, 0xef, 0x62, 0x9f, 0x36,
+    0x64, 0x6c, 0xf4, 0xc8, 0x97, 0x0e, 0xd6, 0x25, 0xa4, 0x1e, 0x92, 0x02, 0x82, 0xe3, 0xe5, 0xd0,
+    0x57, 0xf2, 0x86, 0xae, 0xf1, 0x4d, 0x57, 0x76, 0x4a, 0x37, 0x00, 0xed, 0xf1, 0xa9, 0xfe, 0xc7,
+    0x31, 0x77, 0x94, 0x8a, 0x6d, 0x85, 0xd1, 0xfd, 0xab, 0x85, 0x34, 0xdb, 0x56, 0x2f, 0x32, 0x5c,
+    0xf6, 0xcf, 0xf9, 0x5c, 0xa4, 0xb1, 0x96, 0x48, 0xa5, 0x8a, 0xb3, 0xc6, 0xfc, 0x96, 0x1a, 0x6d,
+    0x07, 0x42, 0x0f, 0x01, 0x32, 0x4e, 0x86, 0x85, 0xb3, 0xec, 0xca, 0x20, 0x37, 0xbf, 0x7a, 0xcf,
+    0xe8, 0xb6, 0xd5, 0xc6, 0xb1, 0xd2, 0xfa, 0x8a, 0x37, 0xfa, 0x55, 0x87, 0x6a, 0x69, 0xcd, 0x2f,
+    0x00, 0xe4, 0xef, 0x67, 0xe7, 0xdf, 0x75, 0x87, 0x8b, 0xce, 0xc8, 0xc7, 0xd7, 0x1c, 0x60, 0xe3,
+    0x7f, 0x39, 0xac, 0xd3, 0x8e, 0x78, 0x5f, 0xf9, 0x12, 0x26, 0x7f, 0x3f, 0xcf, 0xda, 0x6e, 0xfd,
+    0xbc, 0x90, 0x3c, 0x36, 0x3e, 0x78, 0xf5, 0xf8, 0xc5, 0xb7, 0x33, 0xd6, 0x3c, 0xef, 0xee, 0x82,
+    0x30, 0x6f, 0xff, 0x8a, 0xf3, 0x00, 0x85, 0x75, 0x65, 0x93, 0x97, 0x67, 0xdb, 0x1f, 0x62, 0xcb,
+    0x4d, 0x3f, 0xf4, 0xaf, 0xa8, 0xf4, 0x8f, 0xff, 0x48, 0x3e, 0x78, 0x4b, 0xa4, 0x0a, 0x1b, 0xac,
+    0x72, 0x98, 0x6f, 0x82, 0x7e, 0xa9, 0x00, 0x00, 0xf7, 0x2c, 0xc7, 0xb1, 0xe4, 0xb4, 0xac, 0x52,
+    0xec, 0xbb, 0x2d, 0xf6, 0x16, 0xac, 0xf2, 0xb0, 0x24, 0x43, 0xe7, 0x67, 0x29, 0x8b, 0x16, 0xa1,
+    0x5d, 0x3b, 0xae, 0xcc, 0xaf, 0x98, 0xeb, 0x31, 0x72, 0x99, 0xd9, 0x30, 0xca, 0xb8, 0xb8, 0xbc,
+    0x10, 0xb5, 0xe6, 0xad, 0x54, 0xec, 0xf7, 0x3c, 0x23, 0x79, 0x65, 0xb1, 0x77, 0xd5, 0xb5, 0xae,
+    0xf7, 0x6a, 0x69, 0xb0, 0x2e, 0x47, 0x78, 0xb3, 0x7d, 0x12, 0xf5, 0x99, 0x1d, 0x32, 0x8c, 0x71,
+    0xfd, 0xa8, 0x62, 0x11, 0xbe, 0xd8, 0x42, 0xe0, 0x06, 0xe0, 0x9c, 0xdc, 0x45, 0xe3, 0x6f, 0x99,
+    0xa4, 0xd5, 0x3e, 0x56, 0xfe, 0x9e, 0x39, 0x39, 0xee, 0xe6, 0xd7, 0xe7, 0x7d, 0x0a, 0x73, 0x1e,
+    0xd2, 0x20, 0xa6, 0x76, 0x98, 0x6d, 0xf3, 0x19, 0x57, 0xa6, 0xb3, 0x1b, 0x5e, 0x9d, 0xc1, 0x3c,
+    0x6c, 0x9c, 0x57, 0xf2, 0x2d, 0x05, 0x52, 0xbf, 0x14, 0xe3, 0xf2, 0x6b, 0x11, 0xd4, 0x32, 0xd3,
+    0xc3, 0xf2, 0x21, 0xa0, 0x2d, 0xe7, 0x55, 0x4e, 0xca, 0x39, 0x81, 0xf0, 0x4e, 0xda, 0x9a, 0x42,
+    0xee, 0x4c, 0x70, 0x79, 0x5a, 0xfd, 0xd7, 0x16, 0x19, 0xea, 0x43, 0x41, 0xac, 0xc4, 0x38, 0x2b,
+    0xe9, 0x26, 0x58, 0x08, 0x19, 0x89, 0xbd, 0x39, 0x0b, 0xf9, 0x0f, 0xf4, 0x4b, 0x75, 0xca, 0xfe,
+    0xba, 0x2d, 0x1a, 0x80, 0xd1, 0xb0, 0xa8, 0x3f, 0x5e, 0xb4, 0x75, 0xf9, 0x89, 0x0b, 0x09, 0x95,
+    0xee, 0x5b, 0xbb, 0x75, 0xed, 0xd5, 0xdd, 0x57, 0x97, 0x5f, 0xcc, 0x3e, 0x0c, 0xfa, 0x08, 0x16,
+    0x8f, 0x6b, 0x39, 0x5e, 0x5e, 0x27, 0x35, 0x73, 0x30, 0x1c, 0xd0, 0x8e, 0xf8, 0xf8, 0xbd, 0x40,
+    0x8e, 0x90, 0x12, 0x86, 0xe1, 0x1f, 0x5a, 0x27, 0x94, 0xc7, 0xf6, 0xe8, 0x54, 0x9b, 0x18, 0xf4,
+    0x12, 0x5d, 0x01, 0x26, 0x01, 0x83, 0xb5, 0x80, 0x85, 0x68, 0x17, 0x4f, 0xc1, 0x09, 0x6c, 0x99,
+    0xd4, 0xb9, 0xfe, 0xab, 0xc8, 0x56, 0xa1, 0xb6, 0xb4, 0x29, 0x04, 0x98, 0xed, 0x2b, 0xdf, 0x08,
+    0x47, 0xbf, 0xf0, 0xb8, 0xb4, 0x99, 0xac, 0x9c, 0x94, 0xed, 0x5f, 0x88, 0x92, 0x13, 0xe3, 0xad,
+    0x6c, 0x7d, 0x65, 0x7c, 0x5a, 0xe9, 0xbb, 0xbe, 0xff, 0xec, 0x09, 0xa7, 0x40, 0xa8, 0x59, 0xfc,
+    0x68, 0xac, 0xaf, 0x98, 0x41, 0xdd, 0x40, 0x46, 0x16, 0x91, 0x36, 0x31, 0x26, 0x6f, 0x26, 0x36,
+    0xcf, 0xcb, 0xc0, 0xb4, 0x99, 0xb6, 0x39, 0xf2, 0x45, 0x2f, 0x73, 0x0d, 0x58, 0x06, 0x0a, 0x09,
+    0x6b, 0xdf, 0x22, 0x0e, 0x08, 0x96, 0x0b, 0xb0, 0x54, 0xfe, 0x2d, 0x64, 0x82, 0x36, 0xf6, 0xaa,
+    0x60, 0xd9, 0x77, 0x8b, 0x5c, 0xe0, 0xda, 0xcb, 0x1d, 0xa5, 0xce, 0xe6, 0xd6, 0xc9, 0xc5, 0xdf,
+    0x81, 0xea, 0x9f, 0xba, 0x0b, 0xcb, 0x20, 0x1f, 0xc1, 0xb5, 0xa0, 0xdf, 0x60, 0xb4, 0x23, 0x5f,
+    0xa0, 0x23, 0x9f, 0x11, 0x1f, 0xbe, 0xe8, 0xef, 0x14, 0x9e, 0x5e, 0x9f, 0xc1, 0xe2, 0xa3, 0xfd,
+    0x17, 0x78, 0x92, 0x57, 0x92, 0x60, 0xfb, 0xd9, 0xe6, 0xfe, 0x6d, 0xa0, 0xa7, 0x90, 0x6d, 0x84,
+    0x59, 0xf6, 0x27, 0xe4, 0xfe, 0x3b, 0xc7, 0x9f, 0xdd, 0xfe, 0x77, 0x8e, 0x3f, 0xd4, 0xfc, 0xa1,
+    0xe6, 0x0f, 0x35, 0x7f, 0x51, 0x73, 0x4c, 0x69, 0xc3, 0xbe, 0xf6, 0xa5, 0xfd, 0xef, 0xd5, 0xb2,
+    0x13, 0x9f, 0x08, 0x84, 0xed, 0x79, 0x18, 0xc0, 0x00, 0x6c, 0xab, 0x05, 0x07, 0xdb, 0xae, 0xdd,
+    0x6e, 0x7d, 0x7e, 0x6c, 0x79, 0x00, 0x78, 0x44, 0x10, 0x1c, 0x3e, 0x17, 0x2e, 0x1e, 0x92, 0x31,
+    0x18, 0x8a, 0x43, 0x70, 0x1f, 0x22, 0xaa, 0x4a, 0xcb, 0x06, 0xdb, 0x00, 0xa1, 0xc0, 0xf8, 0x20,
+    0x44, 0xb8, 0xd4, 0x54, 0xb7, 0xbb, 0x07, 0xab, 0x4c, 0x67, 0xe8, 0xc2, 0xe2, 0xc3, 0x49, 0xaf,
+    0xff, 0x57, 0x10, 0x68, 0x2c, 0x6a, 0xe3, 0x0f, 0x73, 0x3e, 0x1f, 0xae, 0x63, 0xf6, 0x5d, 0x0d,
+    0x2b, 0x07, 0x7d, 0xfe, 0xef, 0x26, 0xcf, 0x88, 0x47, 0x98, 0x1f, 0x65, 0x33, 0xbb, 0xbe, 0x7f,
+    0xe5, 0x55, 0x37, 0x4c, 0xd0, 0xb8, 0xfc, 0x51, 0x50, 0xff, 0x6b, 0xac, 0xe1, 0x9e, 0xed, 0x3f,
+    0x5b, 0xd1, 0x78, 0xa5, 0x8c, 0x56, 0x5b, 0x21, 0xd2, 0xea, 0xf5, 0xd7, 0x0b, 0xcc, 0x84, 0xef,
+    0xb5, 0x2f, 0xef, 0xd9, 0x1b, 0xd8, 0x9c, 0xd8, 0xac, 0xe8, 0xd4, 0x3d, 0x3c, 0x57, 0x25, 0x79,
+    0x7c, 0x91, 0x63, 0x82, 0x60, 0xba, 0x14, 0x38, 0x1a, 0x34, 0xce, 0xe3, 0x02, 0x99, 0xbd, 0xc3,
+    0x68, 0x3f, 0x4b, 0x76, 0xef, 0x06, 0xa8, 0x7b, 0xaa, 0x35, 0xd0, 0x19, 0x61, 0x11, 0xf3, 0x80,
+    0x86, 0x1a, 0x2d, 0x1c, 0xc1, 0xde, 0x52, 0xcc, 0xdc, 0x43, 0xd3, 0xce, 0x6a, 0x27, 0xfc, 0x7a,
+    0xf3, 0x56, 0xcf, 0x34, 0xb3, 0x48, 0x6e, 0x72, 0x62, 0x86, 0xe3, 0xf7, 0xd2, 0x52, 0xcf, 0xee,
+    0xfa, 0xa5, 0x06, 0x1c, 0x96, 0x87, 0xaf, 0xf2, 0xa1, 0x0b, 0x96, 0x39, 0x18, 0x6c, 0x4b, 0x3c,
+    0xf5, 0x2b, 0x1f, 0xa7, 0xc2, 0xc4, 0xf8, 0x27, 0xab, 0xee, 0x58, 0x6e, 0x23, 0x91, 0xad, 0x35,
+    0x18, 0x7b, 0x86, 0x2d, 0xd3, 0x51, 0x2e, 0xe9, 0x61, 0x91, 0x2d, 0x97, 0x3d, 0x24, 0xab, 0x3c,
+    0xa5, 0x97, 0x91, 0x68, 0x5b, 0xf4, 0xe2, 0x99, 0x2f, 0xba, 0x16, 0xf2, 0x5c, 0x49, 0xf4, 0x6c,
+    0xb0, 0xf3, 0x0d, 0xba, 0x82, 0xda, 0x15, 0x75, 0x0f, 0x43, 0x7c, 0x95, 0xfc, 0x5c, 0x1f, 0x6a,
+    0x87, 0x62, 0x1d, 0x18, 0x02, 0xbe, 0xe1, 0xb8, 0x80, 0x38, 0x07, 0xf3, 0xc8, 0x33, 0x0c, 0x81,
+    0x21, 0xe7, 0xd3, 0x13, 0x5d, 0xca, 0x4a, 0x8a, 0xd6, 0xef, 0x34, 0x70, 0xeb, 0xcd, 0xe3, 0x3c,
+    0x6d, 0xbe, 0xc2, 0xc2, 0x5f, 0x26, 0x5c, 0x7b, 0x2a, 0x8b, 0x28, 0x4c, 0x3a, 0x2a, 0xc5, 0xba,
+    0x9b, 0xed, 0x99, 0xf6, 0xbe, 0xb7, 0x11, 0x0a, 0xfa, 0x9c, 0xab, 0x1d, 0x93, 0xde, 0x39, 0xc4,
+    0xf3, 0x8d, 0xbc, 0x17, 0xe4, 0x13, 0xae, 0xb7, 0xf2, 0x31, 0x80, 0xb6, 0x93, 0xff, 0x7e, 0x7c,
+    0xbd, 0xeb, 0xc7, 0xba, 0x95, 0x93, 0x39, 0x13, 0xb0, 0x72, 0x9d, 0xe3, 0x0c, 0xbc, 0x4b, 0xa0,
+    0xeb, 0x26, 0x41, 0xce, 0xa0, 0x6c, 0x2a, 0x7d, 0x99, 0x1e, 0xf9, 0x93, 0x27, 0xbc, 0xb1, 0x15,
+    0x10, 0x6a, 0x67, 0x1b, 0x3b, 0x46, 0xb6, 0x8d, 0x00, 0xab, 0x34, 0xdb, 0x39, 0x4a, 0xa9, 0x81,
+    0xf9, 0xef, 0xe3, 0x05, 0xfa, 0xe3, 0xfd, 0x5c, 0x06, 0xe2, 0xe0, 0x3e, 0xcf, 0xa8, 0x66, 0x6b,
+    0x75, 0xe4, 0x66, 0x9b, 0x7a, 0x5f, 0xcb, 0x6d, 0x51, 0x07, 0x95, 0xed, 0xbb, 0x2f, 0x6a, 0x8e,
+    0x07, 0xd2, 0xbd, 0x2f, 0xa6, 0x53, 0x69, 0x63, 0x63, 0x6b, 0xc6, 0xcd, 0x26, 0xc0, 0x6e, 0x2e,
+    0x67, 0xd6, 0x0a, 0x11, 0x2f, 0xb1, 0xa8, 0x66, 0xba, 0x89, 0xad, 0x0f, 0xf7, 0x59, 0x0b, 0xd5,
+    0xb8, 0xf0, 0x3a, 0x3b, 0x6a, 0xd7, 0x9e, 0x47, 0x30, 0x14, 0xae, 0xb0, 0x70, 0xee, 0xf2, 0xb1,
+    0xa0, 0xfb, 0xd9, 0x7e, 0x6c, 0x25, 0x30, 0xae, 0x15, 0xdb, 0x79, 0x62, 0x8e, 0xb4, 0x1a, 0xcc,
+    0x0d, 0x6f, 0xbf, 0x8f, 0xb0, 0xe0, 0xbe, 0xcd, 0xab, 0xd4, 0x59, 0xf5, 0x59, 0xd7, 0x7c, 0x20,
+    0x49, 0x4a, 0x17, 0xa6, 0xec, 0xb9, 0x75, 0xa3, 0xb1, 0xea, 0xbe, 0x72, 0x8c, 0x10, 0x8c, 0xe7,
+    0xb4, 0xdf, 0xc5, 0xee, 0x3c, 0xc5, 0xed, 0xe7, 0xb2, 0x37, 0x49, 0x63, 0x9f, 0xcb, 0x98, 0x25,
+    0x35, 0x19, 0x25, 0xbc, 0xbc, 0x49, 0xf5, 0x42, 0xc2, 0xc0, 0x2f, 0x98, 0x67, 0x0e, 0x93, 0xda,
+    0xf7, 0x44, 0x99, 0x5d, 0x3a, 0xee, 0xbc, 0x1d, 0x66, 0x8f, 0x7f, 0xc8, 0xf8, 0xd9, 0xde, 0x05,
+    0xc3, 0xd4, 0x33, 0x97, 0xfa, 0xec, 0x82, 0xac, 0x8a, 0x47, 0x4a, 0x7a, 0x0a, 0x05, 0x23, 0xbb,
+    0xca, 0x6f, 0x1d, 0x00, 0xb7, 0x09, 0x6a, 0x4c, 0x3e, 0x91, 0x62, 0xe6, 0x54, 0xa7, 0x0c, 0x19,
+    0xc6, 0x69, 0x0a, 0xb0, 0xb2, 0xf6, 0xae, 0xd2, 0xe7, 0xdb, 0xa0, 0x55, 0x3f, 0x7a, 0x59, 0xbd,
+    0x00, 0xbe, 0x01, 0x3e, 0xa8, 0xbe, 0x51, 0x9f, 0x3e, 0x43, 0xff, 0xee, 0x5d, 0x4e, 0x70, 0x3e,
+    0x4b, 0xb9, 0xfa, 0x50, 0xad, 0x48, 0x96, 0x20, 0xfe, 0x0c, 0xdd, 0x5d, 0x91, 0x94, 0x2f, 0xf5,
+    0x49, 0x4c, 0x4d, 0xf7, 0x84, 0xc8, 0x41, 0x2b, 0x94, 0x47, 0x30, 0xe4, 0xfc, 0x58, 0xd3, 0xc0,
+    0xcd, 0xe9, 0x20, 0xbc, 0x2c, 0x2e, 0xa0, 0xa9, 0xed, 0x81, 0xda, 0x92, 0x9b, 0x1e, 0x4b, 0x6a,
+    0x6d, 0xee, 0xca, 0xdc, 0x7d, 0x9e, 0x95, 0x2d, 0xf5, 0x74, 0xd0, 0x48, 0xe7, 0xcc, 0xbd, 0x7b,
+    0x3d, 0x9a, 0x43, 0xb6, 0x7a, 0xf8, 0xa0, 0xc6, 0x55, 0xfc, 0x4a, 0x6b, 0x89, 0x1b, 0x40, 0xa6,
+    0xb7, 0x75, 0xe4, 0x36, 0xae, 0x8c, 0x6b, 0xaf, 0xfd, 0x02, 0xce, 0xdd, 0x8b, 0x67, 0x5f, 0x46,
+    0x96, 0xae, 0x6d, 0x2c, 0x8d, 0xeb, 0x8c, 0x4d, 0x9f, 0x6a, 0x5b, 0x7d, 0x1b, 0x7f, 0x64, 0x34,
+    0xe4, 0xd8, 0xfa, 0x95, 0x25, 0xb1, 0xa6, 0xfe, 0x19, 0xcc, 0xc2, 0x43, 0xbb, 0x0c, 0xe9, 0x8d,
+    0x45, 0x0a, 0xb0, 0xd2, 0x54, 0xfb, 0x4f, 0x0b, 0x35, 0x28, 0x3e, 0x9c, 0x46, 0x5e, 0xbb, 0x84,
+    0xb9, 0xa4, 0x05, 0x53, 0xcd, 0x19, 0xf0, 0x89, 0xf3, 0x18, 0x0c, 0xef, 0xb3, 0xb6, 0xdc, 0x33,
+    0xb0, 0x19, 0xfa, 0xbc, 0x42, 0x1f, 0xf8, 0xd5, 0xef, 0x76, 0x20, 0xe8, 0x2b, 0xbe, 0x99, 0x87,
+    0x0d, 0x19, 0xd6, 0x0a, 0x7f, 0x43, 0x6f, 0x12, 0xdf, 0x4e, 0xaa, 0xd0, 0x9f, 0xd3, 0x61, 0x29,
+    0xb4, 0xf3, 0x2d, 0x6c, 0xba, 0x01, 0xba, 0xb4, 0x9e, 0xd4, 0x08, 0x79, 0x6d, 0xa4, 0x5f, 0xc7,
+    0xdc, 0x2a, 0x53, 0xbd, 0x01, 0x46, 0xf7, 0x59, 0x6b, 0x7f, 0x06, 0xad, 0x20, 0x08, 0x1d, 0x10,
+    0x6f, 0x07, 0xe7, 0x2b, 0xe4, 0x16, 0xc9, 0xf7, 0x78, 0xda, 0x95, 0xd2, 0x18, 0xe8, 0x46, 0x7d,
+    0x0f, 0xd3, 0xb0, 0x1c, 0x3d, 0x31, 0xc9, 0x29, 0x40, 0x1a, 0xe8, 0x9e, 0x7f, 0x60, 0x85, 0x4a,
+    0xa8, 0xcd, 0x8b, 0x26, 0x53, 0x76, 0x75, 0xff, 0x8e, 0x56, 0x71, 0x94, 0xb9, 0x44, 0xe7, 0x3c,
+    0x97, 0x1a, 0x82, 0xd1, 0x7d, 0x92, 0xea, 0xd7, 0x9e, 0x50, 0x9e, 0xbb, 0x27, 0x78, 0x3d, 0x07,
+    0xad, 0x94, 0x37, 0x40, 0x56, 0x5e, 0x42, 0xee, 0x87, 0xbe, 0x6e, 0x4f, 0x2d, 0xca, 0xd8, 0x97,
+    0x62, 0x16, 0xa5, 0x33, 0x67, 0x84, 0x63, 0x4c, 0x0a, 0x18, 0xfe, 0xd3, 0xc8, 0xf6, 0xba, 0x2e,
+    0x23, 0x49, 0x3a, 0x53, 0x67, 0xb8, 0xf4, 0x44, 0xfd, 0x98, 0x1b, 0x46, 0xb8, 0xbb, 0x61, 0xba,
+    0x4b, 0x80, 0x30, 0x73, 0x12, 0xcc, 0x1b, 0x31, 0x4f, 0x5e, 0xd6, 0x81, 0x9f, 0xae, 0x4a, 0x71,
+    0x10, 0xaf, 0xdd, 0x13, 0x95, 0x6d, 0x2a, 0x10, 0x13, 0xf0, 0xd7, 0xb2, 0xb6, 0xcb, 0xc5, 0xea,
+    0x4e, 0x19, 0x5a, 0x92, 0x68, 0x3a, 0xda, 0x5c, 0xb0, 0xd8, 0xaa, 0x24, 0xd3, 0xa0, 0x18, 0xbd,
+    0xcd, 0xc8, 0x18, 0x8a, 0x73, 0x61, 0xa9, 0xe3, 0x5b, 0xf3, 0x2f, 0xee, 0x73, 0x5f, 0x28, 0x7d,
+    0xed, 0xd5, 0xdb, 0x27, 0xf0, 0x4b, 0x0c, 0x86, 0x8d, 0x50, 0x4e, 0x35, 0x55, 0x31, 0x05, 0xdd,
+    0x42, 0xf0, 0x57, 0x0a, 0xcb, 0xb4, 0x33, 0xcc, 0x85, 0xd8, 0x92, 0xe6, 0x83, 0x35, 0x79, 0x7e,
+    0x5b, 0xeb, 0xc8, 0xcf, 0x77, 0x8e, 0x2f, 0x23, 0xce, 0x55, 0xa3, 0x3f, 0x3e, 0xa8, 0xe5, 0x93,
+    0x11, 0xb7, 0xff, 0xc8, 0xf8, 0x3d, 0x38, 0xc3, 0x4b, 0x99, 0xc8, 0x62, 0xad, 0x21, 0x3a, 0xcd,
+    0xab, 0x38, 0x00, 0x29, 0xcd, 0x4b, 0x3b, 0x00, 0x39, 0x15, 0x6a, 0xf3, 0x50, 0x50, 0x69, 0xaa,
+    0x4b, 0x7d, 0xbf, 0xd0, 0x2f, 0x7c, 0x78, 0xff, 0x64, 0x00, 0xbb, 0xe1, 0xfe, 0xd6, 0x30, 0xc4,
+    0xe6, 0x2a, 0x5a, 0x40, 0x78, 0xab, 0xef, 0x63, 0x65, 0xc0, 0x61, 0xe7, 0x36, 0xa6, 0xff, 0xdd,
+    0xde, 0x22, 0x8c, 0x54, 0xb7, 0xa9, 0x4e, 0x8e, 0xdd, 0x2c, 0xb6, 0x81, 0x21, 0xd7, 0xa5, 0x92,
+    0x4a, 0xd3, 0x63, 0xbf, 0xe0, 0x01, 0xeb, 0x0b, 0x1c, 0x1f, 0xab, 0x34, 0xab, 0x30, 0xa1, 0xc5,
+    0x27, 0x82, 0x31, 0x6d, 0x8b, 0x65, 0x91, 0x7d, 0xb5, 0xd6, 0x9e, 0xe1, 0x16, 0x88, 0xd0, 0x45,
+    0xfa, 0x14, 0x16, 0x86, 0x55, 0xe2, 0xb4, 0xb0, 0xa5, 0x08, 0x23, 0xdb, 0x28, 0x53, 0x16, 0xfc,
+    0x15, 0x73, 0x52, 0x81, 0x2d, 0x50, 0xa3, 0x48, 0xe3, 0x0d, 0x80, 0xf2, 0xb0, 0xa7, 0xe6, 0x12,
+    0x9e, 0xa7, 0x42, 0xd0, 0x67, 0xa1, 0xff, 0x15, 0x26, 0x4e, 0x1f, 0xeb, 0x44, 0xda, 0x0d, 0xb0,
+    0x72, 0x1b, 0xba, 0x7e, 0x6f, 0x26, 0xb7, 0x3f, 0x16, 0x8a, 0x7f, 0x03, 0x37, 0x49, 0xb2, 0x24,
+    0xa3, 0xff, 0x23, 0x04, 0xdd, 0x27, 0xf6, 0x27, 0x37, 0x40, 0xee, 0x3f, 0xac, 0xe7, 0xdf, 0x12,
+    0xf7, 0xde, 0x7b, 0xbf, 0x0d, 0x30, 0x86, 0x8d, 0xbb, 0xb0, 0x0c, 0x6d, 0x87, 0xe3, 0x20, 0xc1,
+    0x6b, 0xc4, 0x17, 0x1d, 0xb6, 0x6c, 0xfa, 0xff, 0x8c, 0x44, 0x49, 0x61, 0x94, 0x7f, 0x5b, 0xfa,
+    0xff, 0xd0, 0x44, 0xf8, 0x57, 0xa4, 0x6c, 0xbd, 0x52, 0xe0, 0x6d, 0x9e, 0x55, 0x21, 0x30, 0xfd,
+    0x4c, 0xb8, 0x7f, 0x7e, 0x22, 0x7f, 0x79, 0x0e, 0xf5, 0x06, 0x80, 0x2d, 0x9c, 0x94, 0x20, 0x00,
+    0x00, 0x87, 0x88, 0x88, 0x86, 0x8e, 0x88, 0x7c, 0x7b, 0x9f, 0xfb, 0x76, 0x07, 0x04, 0x07, 0xc0,
+    0x23, 0x20, 0x22, 0x41, 0x08, 0x28, 0x93, 0xab, 0xd9, 0xef, 0x8b, 0xa9, 0xa9, 0x6b, 0x9a, 0xb8,
+    0x8c, 0x8e, 0x81, 0x71, 0xf0, 0xf0, 0x35, 0x9c, 0x83, 0x53, 0xf2, 0xf2, 0x97, 0x71, 0xa1, 0xc6,
+    0x21, 0x1d, 0x54, 0x1c, 0xe2, 0x92, 0x35, 0xef, 0x76, 0xa9, 0x4d, 0xcd, 0x45, 0x55, 0x97, 0x68,
+    0xe8, 0xd8, 0x38, 0xb9, 0xcc, 0xf6, 0x7e, 0x2c, 0xae, 0x60, 0xcb, 0x2f, 0x11, 0x50, 0x94, 0x29,
+    0x41, 0x89, 0x82, 0x9a, 0x26, 0x3d, 0x83, 0x24, 0x42, 0xcd, 0x38, 0x0b, 0xfb, 0x18, 0x51, 0x8a,
+    0x4f, 0x33, 0x07, 0xaa, 0xea, 0x0e, 0xcd, 0x91, 0x97, 0x39, 0x4e, 0xde, 0xbc, 0xdc, 0xc6, 0x6e,
+    0x2f, 0xad, 0x44, 0xf3, 0xe3, 0xc9, 0xa5, 0x24, 0xf9, 0x48, 0xef, 0xbb, 0x15, 0x9d, 0xd0, 0x27,
+    0x58, 0xfb, 0x2a, 0x3a, 0x11, 0x62, 0x8c, 0x64, 0xab, 0xd9, 0x95, 0x18, 0x21, 0x9a, 0x02, 0x7d,
+    0x42, 0x46, 0xc4, 0x08, 0xa5, 0x9e, 0x7f, 0x88, 0xfd, 0xab, 0x8b, 0x45, 0xe6, 0x13, 0x94, 0xbc,
+    0x56, 0x4b, 0x65, 0x65, 0x10, 0x05, 0x6a, 0x46, 0x59, 0xd8, 0xc6, 0x78, 0xc7, 0xee, 0xb7, 0x22,
+    0x4c, 0xa0, 0x2b, 0xed, 0xfa, 0xe1, 0xfb, 0x61, 0x97, 0x72, 0x3f, 0xa1, 0x36, 0x58, 0x54, 0x12,
+    0xad, 0x5d, 0x40, 0xee, 0xd0, 0x69, 0x3f, 0x0f, 0xb5, 0x56, 0xff, 0x83, 0xf9, 0x1f, 0x63, 0x6e,
+    0xb3, 0x71, 0x35, 0x68, 0xbd, 0xc6, 0x7b, 0x59, 0x8e, 0x61, 0x91, 0x2e, 0xc9, 0xbf, 0x7e, 0x69,
+    0x12, 0x2a, 0xee, 0xd2, 0xfb, 0xf0, 0xbe, 0x50, 0x40, 0xed, 0x97, 0xa4, 0x56, 0x1b, 0x9f, 0x2b,
+    0xeb, 0x01, 0x4a, 0xbf, 0x89, 0xa3, 0xf3, 0xf1, 0xa7, 0xe2, 0x67, 0x65, 0xdf, 0x8f, 0x4a, 0x98,
+    0xc2, 0x0f, 0x34, 0x3e, 0x7e, 0x57, 0xd6, 0x43, 0x5f, 0x2b, 0xa9, 0x9c, 0xca, 0xaa, 0x21, 0x1c,
+    0x52, 0x79, 0xf8, 0x92, 0xcf, 0x9c, 0x35, 0x33, 0xbb, 0x4d, 0xff, 0x0f, 0xb1, 0x7f, 0x7a, 0x31,
+    0xe9, 0x88, 0x06, 0xa7, 0x7e, 0x65, 0x34, 0xe2, 0x0f, 0xc8, 0x49, 0xe6, 0x25, 0x58, 0xd8, 0x3d,
+    0xdb, 0xbf, 0x0b, 0x85, 0xeb, 0x22, 0x05, 0x74, 0x0d, 0x39, 0xaf, 0x0d, 0x7c, 0xa2, 0x8e, 0x5c,
+    0x04, 0xd5, 0x55, 0x8e, 0xd7, 0xa8, 0x58, 0x38, 0x28, 0x54, 0x4f, 0xdd, 0x87, 0xe8, 0x96, 0xe9,
+    0xa1, 0xe9, 0x6e, 0x08, 0xa5, 0x8d, 0xcf, 0x5d, 0xd9, 0x1b, 0x62, 0x7b, 0x69, 0xc9, 0x28, 0xef,
+    0x5e, 0x64, 0xfd, 0x36, 0xa6, 0xe6, 0x2f, 0xaa, 0xa7, 0xdf, 0x55, 0x87, 0x8b, 0x7d, 0xc8, 0x0d,
+    0xa1, 0x12, 0xbf, 0x06, 0x77, 0xdd, 0x11, 0x19, 0x15, 0xd3, 0x69, 0x3e, 0x5f, 0x31, 0x51, 0xdb,
+    0xf2, 0xbb, 0x73, 0x7f, 0xc8, 0xaa, 0x90, 0x6a, 0xa4, 0x28, 0xa3, 0xe1, 0xab, 0x91, 0x13, 0xbd,
+    0x33, 0xd2, 0x7a, 0x5f, 0x58, 0x19, 0x21, 0x17, 0x83, 0xb5, 0x03, 0xe5, 0x04, 0x29, 0x06, 0xa9,
+    0x68, 0x03, 0xc7, 0x12, 0xcf, 0xb5, 0xbb, 0x7c, 0x42, 0x8b, 0x89, 0xd6, 0x3d, 0x54, 0xc9, 0x4e,
+    0xa8, 0x47, 0xc1, 0x2b, 0x3c, 0x33, 0x33, 0x7a, 0xb2, 0x42, 0xa1, 0xbc, 0xc3, 0xab, 0xf9, 0xf6,
+    0xce, 0xd9, 0x8f, 0xe2, 0x4c, 0x81, 0x4d, 0xc4, 0x34, 0x5a, 0x5b, 0x21, 0x5f, 0x97, 0x0a, 0x05,
+    0x73, 0x29, 0xa7, 0xc3, 0xbc, 0x1a, 0x8d, 0xba, 0xe1, 0x50, 0xa3, 0x9c, 0xd1, 0xb3, 0x8c, 0x7b,
+    0x62, 0xe3, 0x08, 0x68, 0xb4, 0xbf, 0x9a, 0x9a, 0x3e, 0xba, 0xa7, 0xc0, 0xce, 0x9b, 0x4f, 0x97,
+    0xe4, 0xac, 0x0e, 0xc7, 0xc3, 0x66, 0x98, 0x2f, 0xc7, 0x4b, 0xca, 0x42, 0xe8, 0x6a, 0xdb, 0xa8,
+    0x7e, 0xb4, 0x51, 0xc4, 0x36, 0x10, 0xf6, 0x49, 0x9c, 0x08, 0xf9, 0xca, 0xed, 0xf7, 0x16, 0x17,
+    0x9f, 0xbc, 0xde, 0x20, 0x68, 0x3f, 0x79, 0x50, 0x75, 0xe0, 0x3a, 0x92, 0x3d, 0xa9, 0x0a, 0xe0,
+    0x12, 0xdd, 0x00, 0x08, 0x7e, 0x34, 0x63, 0x8f, 0x49, 0x2e, 0x73, 0x58, 0xcb, 0xc8, 0x55, 0xdf,
+    0xba, 0x36, 0x87, 0x34, 0xd0, 0xf0, 0xc1, 0xa3, 0x18, 0x63, 0x98, 0x92, 0xd0, 0x3e, 0xc6, 0x46,
+    0x17, 0xbc, 0xb3, 0xab, 0x8f, 0x88, 0x9f, 0xaf, 0x6e, 0x56, 0xac, 0x86, 0x56, 0xba, 0x27, 0x17,
+    0x7f, 0xad, 0x92, 0x36, 0x11, 0x3f, 0x12, 0xea, 0x4a, 0x8f, 0x3a, 0x81, 0xc2, 0x04, 0xbc, 0x17,
+    0x2b, 0x9f, 0xa6, 0xe2, 0xe7, 0xd5, 0x23, 0xca, 0x24, 0x99, 0xba, 0x20, 0x30, 0xdd, 0x8b, 0x8b,
+    0x31, 0x76, 0xef, 0x66, 0x3d, 0xfa, 0x18, 0x84, 0x15, 0x94, 0xe6, 0x4e, 0x92, 0xbb, 0xf6, 0xc6,
+    0x14, 0xad, 0xdb, 0x35, 0xa4, 0x1d, 0x68, 0x74, 0x9a, 0x0b, 0x56, 0xac, 0x3b, 0xa6, 0xc1, 0xf7,
+    0x1d, 0x7e, 0xc5, 0x8d, 0x4f, 0xfe, 0xb1, 0xa3, 0xc0, 0x70, 0x2a, 0x86, 0x7f, 0xce, 0x36, 0x7b,
+    0x20, 0x5c, 0x3c, 0x18, 0x00, 0xa3, 0x5a, 0x6f, 0x8e, 0xf0, 0x8e, 0xae, 0x7f, 0x37, 0xfc, 0x66,
+    0x88, 0x46, 0x18, 0x85, 0x12, 0xa5, 0x20, 0xe3, 0x10, 0xf4, 0xbe, 0x7d, 0x01, 0xfd, 0x8d, 0x40,
+    0x46, 0xdc, 0x44, 0xed, 0x7b, 0x30, 0x0b, 0x25, 0x29, 0x35, 0x1d, 0x8d, 0xfb, 0xbb, 0xad, 0x44,
+    0x9c, 0x90, 0xf1, 0xab, 0x10, 0x2c, 0x48, 0x93, 0x90, 0xd8, 0x1b, 0x79, 0x06, 0x54, 0xd5, 0x5d,
+    0xf6, 0xa0, 0x82, 0x2e, 0xab, 0x12, 0x9d, 0x6b, 0x29, 0x72, 0xac, 0xee, 0x12, 0xfd, 0x61, 0xcb,
+    0x31, 0x3d, 0xda, 0x06, 0x5e, 0xe4, 0x8a, 0x33, 0x16, 0xb6, 0x25, 0x93, 0x30, 0x92, 0xcc, 0x20,
+    0xac, 0x66, 0x31, 0x5d, 0x2c, 0x7e, 0x25, 0xed, 0x51, 0xd0, 0x48, 0xac, 0xb1, 0x7b, 0x90, 0x18,
+    0xbe, 0x42, 0xbb, 0x8c, 0x9c, 0xf9, 0x5e, 0xaa, 0x9d, 0xa8, 0x73, 0xdd, 0x41, 0x90, 0x80, 0x12,
+    0x94, 0xd4, 0x41, 0xc1, 0xc9, 0x0a, 0x92, 0x56, 0x9e, 0x98, 0x5b, 0x30, 0xd9, 0x3f, 0xf2, 0x75,
+    0xd9, 0xd7, 0x19, 0xb4, 0xa2, 0xe0, 0x62, 0x88, 0x63, 0x06, 0xf4, 0x6c, 0x8b, 0x95, 0x47, 0x55,
+    0xaf, 0xd2, 0xb1, 0xf9, 0x8f, 0x45, 0x45, 0x06, 0xe9, 0x52, 0x25, 0x3f, 0x76, 0x39, 0xb6, 0x40,
+    0xfb, 0x34, 0x89, 0x11, 0x54, 0xa3, 0xe7, 0x4b, 0x53, 0x50, 0x6a, 0x51, 0x62, 0xde, 0x4c, 0x35,
+    0xd1, 0xac, 0xe9, 0x62, 0xc2, 0xbb, 0x47, 0xfb, 0x54, 0x7e, 0xdb, 0xb4, 0x89, 0xfe, 0xbb, 0xfb,
+    0x2b, 0x5f, 0x16, 0x7c, 0x34, 0x04, 0x40, 0x94, 0xb6, 0xe4, 0xb5, 0xe8, 0x8a, 0x0c, 0x27, 0x4e,
+    0x8f, 0x2b, 0xda, 0x1b, 0xad, 0x7c, 0x38, 0xda, 0xa7, 0x6b, 0xc9, 0x10, 0xb9, 0xd4, 0xdd, 0x01,
+    0x5a, 0xb3, 0xa6, 0x44, 0x59, 0xef, 0xb2, 0xb1, 0x42, 0xc2, 0x4a, 0x76, 0x49, 0x04, 0xf3, 0xfc,
+    0x07, 0xfc, 0xf0, 0x38, 0x7f, 0xed, 0x87, 0xea, 0xee, 0xa9, 0xee, 0x29, 0x69, 0x46, 0x0c, 0x57,
+    0x84, 0xbc, 0xf7, 0x5b, 0x3d, 0x74, 0x34, 0x96, 0x21, 0x3a, 0x2f, 0x74, 0xba, 0xad, 0xf4, 0x11,
+    0x48, 0x45, 0x71, 0x4e, 0xfb, 0xf1, 0x3e, 0x4e, 0x25, 0x96, 0xe8, 0x70, 0xd6, 0xc2, 0x25, 0x88,
+    0xdc, 0x51, 0x7d, 0xba, 0x9a, 0x2e, 0xc9, 0x9e, 0x40, 0x63, 0x69, 0x61, 0x34, 0xfd, 0xfa, 0x13,
+    0x67, 0x92, 0x22, 0xbf, 0x48, 0x2a, 0x52, 0xaa, 0x45, 0x88, 0xbe, 0x36, 0x81, 0x76, 0x78, 0xae,
+    0x72, 0x65, 0xdd, 0x83, 0x61, 0x54, 0x35, 0x37, 0xac, 0x86, 0xa2, 0xeb, 0x90, 0x5d, 0xc8, 0x18,
+    0x8e, 0x23, 0xb5, 0x01, 0xae, 0x04, 0xdc, 0x82, 0xe9, 0x98, 0x11, 0x43, 0x03, 0x99, 0x03, 0x41,
+    0x4f, 0xb5, 0xe4, 0x06, 0x0d, 0x5c, 0x04, 0x84, 0x94, 0x4b, 0x2d, 0xcc, 0x69, 0x39, 0x19, 0x5f,
+    0xf4, 0x3b, 0x42, 0xd0, 0x3d, 0x9d, 0x20, 0xac, 0x90, 0x81, 0x15, 0x7a, 0xdd, 0xd8, 0x5c, 0xf7,
+    0xf7, 0xac, 0x87, 0x84, 0x41, 0x09, 0x49, 0x8f, 0xbd, 0xef, 0x4c, 0x67, 0x12, 0x11, 0x5c, 0x10,
+    0xa4, 0xec, 0x29, 0xb5, 0x6f, 0xb8, 0xd4, 0x0a, 0xf3, 0x5e, 0xb7, 0x8b, 0xf2, 0xd6, 0x3c, 0x48,
+    0xc3, 0x68, 0x08, 0x72, 0xa6, 0xfc, 0xfc, 0x32, 0xdc, 0x81, 0xb3, 0x45, 0xcf, 0xab, 0x07, 0x43,
+    0x87, 0x45, 0xc1, 0xcd, 0xbc, 0x27, 0x12, 0x8d, 0x31, 0x78, 0x0a, 0x15, 0xd0, 0xae, 0x04, 0xc8,
+    0x10, 0xd3, 0xba, 0x55, 0xab, 0xc9, 0x9d, 0x2a, 0x0c, 0x5a, 0xf4, 0xd2, 0x92, 0x44, 0x57, 0x31,
+    0x74, 0x7c, 0x56, 0xbb, 0xc8, 0xcc, 0x12, 0x49, 0xe3, 0x36, 0xbf, 0xeb, 0x3f, 0x7d, 0x22, 0x9f,
+    0xd2, 0x6f, 0x22, 0x6d, 0x45, 0xeb, 0xf3, 0xde, 0xcf, 0x32, 0x3c, 0x57, 0xac, 0x0b, 0xc4, 0x1a,
+    0x97, 0xa7, 0xe4, 0x6f, 0x35, 0x87, 0x7c, 0xff, 0x35, 0x58, 0x9b, 0x33, 0x8b, 0x00, 0x40, 0x1c,
+    0x88, 0xd8, 0x44, 0xb3, 0xa8, 0x7c, 0xbd, 0x10, 0x52, 0x19, 0x7c, 0x84, 0x34, 0x56, 0x68, 0xeb,
+    0x87, 0x5a, 0x4a, 0xf0, 0x6c, 0xc1, 0x6d, 0xfe, 0xd8, 0x5f, 0x7c, 0x9a, 0x7c, 0x95, 0x6b, 0xf3,
+    0x5e, 0x5f, 0xfd, 0x79, 0x9b, 0x53, 0x6a, 0x3c, 0x1e, 0x26, 0x17, 0x70, 0x74, 0x1a, 0x84, 0x26,
+    0xe9, 0xd8, 0xe1, 0xce, 0x88, 0x28, 0x1f, 0x78, 0x4c, 0xd2, 0xce, 0xde, 0x67, 0x89, 0xde, 0x50,
+    0x88, 0xdb, 0x4a, 0x7e, 0x97, 0x2d, 0x5d, 0x1f, 0x5b, 0xe5, 0x04, 0x85, 0x86, 0xed, 0x4a, 0xff,
+    0x00, 0x9e, 0xb3, 0x0e, 0xa3, 0x84, 0x99, 0x63, 0x05, 0x9d, 0xbe, 0xe0, 0x95, 0x41, 0x2a, 0x4a,
+    0xa1, 0xfe, 0x06, 0xf5, 0x9d, 0x5d, 0x5b, 0x2d, 0xa6, 0x58, 0x04, 0x8b, 0x11, 0x87, 0x16, 0xde,
+    0x5a, 0x2c, 0xf4, 0xa8, 0x4f, 0xf8, 0xcd, 0x99, 0x8a, 0xc2, 0x83, 0x9f, 0xc5, 0x13, 0x80, 0x59,
+    0x8f, 0x07, 0x94, 0x77, 0x4d, 0x5d, 0x5f, 0x77, 0xf2, 0x8a, 0x78, 0x79, 0x14, 0x0a, 0xe1, 0xb2,
+    0x58, 0x59, 0xad, 0xc6, 0x77, 0xb2, 0xde, 0x59, 0x1c, 0xc1, 0x5b, 0x26, 0x49, 0x73, 0x32, 0x79,
+    0x1a, 0x63, 0x91, 0xcf, 0x61, 0xac, 0x39, 0x38, 0x26, 0x1d, 0xee, 0xe6, 0x2b, 0x67, 0xf1, 0x1d,
+    0x43, 0xa8, 0xe6, 0x54, 0x21, 0x32, 0xb8, 0x7d, 0x47, 0xfb, 0x9b, 0x31, 0x3c, 0x79, 0x30, 0x9b,
+    0x73, 0x1c, 0xb5, 0x64, 0xaa, 0xe1, 0x06, 0xcb, 0x73, 0x6a, 0x71, 0x21, 0x53, 0x8f, 0xee, 0xc9,
+    0x82, 0xbe, 0x41, 0xc6, 0xc9, 0xc5, 0x94, 0xe0, 0xef, 0x10, 0x74, 0x16, 0xfd, 0x38, 0x08, 0x49,
+    0x47, 0xb4, 0x23, 0xe9, 0x00, 0xc2, 0x97, 0x77, 0x48, 0xc4, 0x7e, 0xd2, 0x5f, 0x1f, 0xd9, 0x95,
+    0xee, 0x10, 0x58, 0x94, 0x7b, 0x2b, 0xd0, 0xcb, 0xa2, 0x0b, 0x7f, 0xb4, 0x9a, 0xdb, 0xca, 0x7f,
+    0xce, 0xff, 0x27, 0x14, 0xf9, 0x6d, 0x02, 0x7f, 0xc6, 0x94, 0x4f, 0x65, 0x51, 0xa7, 0xb5, 0x06,
+    0x96, 0x1f, 0x10, 0x3b, 0xa8, 0x29, 0xf1, 0xd3, 0xcf, 0x24, 0xf2, 0x16, 0xd5, 0x55, 0x9b, 0x04,
+    0xa7, 0xbf, 0x7b, 0x69, 0x84, 0xca, 0x72, 0x34, 0xe0, 0x61, 0x94, 0x37, 0xaa, 0x4c, 0xc0, 0x1b,
+    0xbd, 0xda, 0x1d, 0xc0, 0xc6, 0x8c, 0xbb, 0x7e, 0x5f, 0x64, 0x9f, 0x2c, 0xe4, 0x8e, 0xda, 0x5a,
+    0x99, 0xc1, 0xdc, 0x98, 0x19, 0x48, 0xd2, 0x82, 0x95, 0xa8, 0xe1, 0x4b, 0x8a, 0x6a, 0x8f, 0x32,
+    0x1a, 0x7b, 0x94, 0x93, 0xd8, 0x87, 0x9a, 0x5a, 0x66, 0x4e, 0x97, 0x91, 0x54, 0x54, 0x51, 0x5b,
+    0xb3, 0xcd, 0x8d, 0x4e, 0xe6, 0x11, 0xd9, 0xa7, 0x94, 0xba, 0x3b, 0x6c, 0x1c, 0x1c, 0xfe, 0x17,
+    0xf9, 0x5c, 0x18, 0x99, 0x34, 0xdd, 0xfc, 0x4e, 0xee, 0x23, 0x32, 0x9d, 0x5d, 0x11, 0xf0, 0xf0,
+    0x62, 0xeb, 0xd7, 0x4b, 0x78, 0x91, 0xf3, 0x31, 0x0b, 0xa2, 0x46, 0xea, 0xaa, 0xc7, 0xfd, 0x55,
+    0x2b, 0x4f, 0xa3, 0x25, 0x4e, 0x10, 0x07, 0x42, 0x63, 0x64, 0xbf, 0xee, 0x2f, 0xf0, 0x6c, 0x9d,
+    0x50, 0xf6, 0x04, 0x3f, 0x18, 0x86, 0xcb, 0xba, 0x01, 0xdc, 0x16, 0xcc, 0xdd, 0x14, 0x22, 0x1a,
+    0x69, 0x47, 0x19, 0x85, 0x0d, 0x37, 0x16, 0xd0, 0x40, 0x6a, 0x91, 0x31, 0x50, 0x8e, 0xa0, 0x3e,
+    0xd6, 0x87, 0xc6, 0x47, 0xcb, 0x5d, 0xf1, 0x6c, 0x05, 0xa3, 0xd9, 0x49, 0x50, 0x52, 0x9a, 0xb4,
+    0xcd, 0xc4, 0x11, 0x73, 0x62, 0x9f, 0x60, 0xc2, 0x1a, 0x2e, 0x8e, 0xbe, 0xad, 0xc9, 0x68, 0x8b,
+    0x6e, 0x38, 0x82, 0x5d, 0x76, 0x9e, 0xda, 0xb7, 0x4f, 0xd1, 0xa6, 0x34, 0x9c, 0x25, 0xc5, 0x15,
+    0xe1, 0x6d, 0x78, 0xf5, 0xd3, 0xb8, 0xdf, 0x3e, 0x61, 0x35, 0xe2, 0x48, 0xb7, 0xb8, 0x12, 0x27,
+    0xc2, 0x71, 0x13, 0x3a, 0x77, 0x64, 0xf0, 0xa0, 0xb6, 0xfd, 0xd2, 0xb8, 0xfc, 0x02, 0xff, 0x3e,
+    0xd3, 0x0a, 0x80, 0x51, 0x0f, 0x30, 0x21, 0xfc, 0x0c, 0x8d, 0x82, 0xbd, 0x16, 0x89, 0xac, 0xac,
+    0x2a, 0x14, 0xb8, 0x86, 0x8e, 0xf7, 0xe8, 0x36, 0x18, 0x1c, 0x0f, 0x72, 0x91, 0x81, 0x90, 0x8f,
+    0xe3, 0x7d, 0xce, 0x5d, 0x6b, 0x56, 0x3c, 0xc6, 0x7d, 0x8b, 0x38, 0x70, 0xcc, 0x56, 0xd6, 0x8e,
+    0x7c, 0x62, 0x26, 0x61, 0x6b, 0x0d, 0x44, 0xd2, 0x5b, 0x83, 0x66, 0xb2, 0x05, 0xe8, 0xd4, 0x5c,
+    0xfc, 0x3b, 0xb8, 0xd9, 0xeb, 0x08, 0xc5, 0xa4, 0x66, 0x51, 0xb4, 0x8f, 0x4b, 0xf3, 0x8e, 0x20,
+    0x32, 0x61, 0xca, 0xbb, 0x0e, 0x3c, 0xd3, 0x3c, 0xaf, 0x59, 0xa8, 0x46, 0x75, 0xe7, 0x48, 0xb8,
+    0xa8, 0x49, 0x25, 0xf7, 0xcd, 0x44, 0x88, 0x08, 0xa2, 0x0f, 0xef, 0xe4, 0x9c, 0x61, 0x75, 0x60,
+    0xd2, 0x8f, 0x0d, 0x0e, 0xe3, 0x0a, 0xa0, 0xd5, 0xc2, 0x6f, 0xa1, 0xc8, 0x3f, 0x40, 0x7a, 0xcf,
+    0x94, 0x46, 0x9b, 0x6b, 0x55, 0xbc, 0xcd, 0x82, 0x44, 0x78, 0xa0, 0x51, 0x97, 0xa4, 0xa7, 0x57,
+    0x88, 0x2a, 0xad, 0xe7, 0xb0, 0xdc, 0x18, 0x8a, 0xf4, 0xac, 0x01, 0x62, 0xfb, 0x6d, 0xb5, 0x61,
+    0xd9, 0x95, 0x8b, 0xa4, 0xca, 0x7c, 0x17, 0x15, 0x44, 0x64, 0xaa, 0x13, 0x4b, 0xdc, 0x19, 0x57,
+    0xa5, 0xac, 0x67, 0x0d, 0xaf, 0xc1, 0x6a, 0x3f, 0x72, 0xad, 0x9a, 0x18, 0xae, 0x38, 0x9c, 0x26,
+    0x5a, 0x47, 0x08, 0xf2, 0x7a, 0x4f, 0x4a, 0x49, 0x4b, 0x45, 0xe8, 0x26, 0xcb, 0xef, 0xd3, 0x00,
+    0x75, 0x1c, 0xbc, 0x6c, 0x6b, 0xa4, 0xd8, 0x71, 0x57, 0x36, 0x61, 0xd7, 0x8b, 0xbd, 0x72, 0xaf,
+    0x8d, 0x5a, 0x6f, 0x80, 0x5f, 0x12, 0x35, 0x6c, 0xa2, 0x2e, 0xdc, 0x89, 0x8c, 0x1e, 0xa4, 0x23,
+    0x08, 0x1d, 0xbf, 0x7a, 0x87, 0x8a, 0x21, 0xfc, 0x54, 0x70, 0x92, 0x58, 0x43, 0xae, 0x48, 0xd7,
+    0x28, 0x37, 0x55, 0x64, 0x05, 0x93, 0x28, 0xb9, 0x41, 0xd7, 0x44, 0x9d, 0xcc, 0x27, 0x44, 0xbe,
+    0xce, 0x2a, 0x2e, 0x93, 0x4b, 0x8d, 0x26, 0x1c, 0x43, 0x47, 0x3a, 0xa1, 0x4a, 0xff, 0xdc, 0x9b,
+    0x85, 0x37, 0x6b, 0x08, 0x69, 0x93, 0x58, 0x10, 0x4e, 0x54, 0x56, 0xeb, 0xbc, 0xf1, 0xc5, 0x72,
+    0xf7, 0x94, 0xb7, 0xb4, 0x4a, 0x8d, 0x90, 0x8e, 0x84, 0xec, 0x52, 0x8f, 0x87, 0x9a, 0x6c, 0x63,
+    0xdc, 0x8b, 0x61, 0x6c, 0x2b, 0xd1, 0x24, 0x2c, 0x9c, 0xf5, 0x34, 0x8c, 0x6c, 0x38, 0x7e, 0x19,
+    0x95, 0x16, 0xc4, 0x87, 0xf0, 0x1b, 0x98, 0x45, 0xb2, 0x53, 0xa7, 0xb8, 0xaa, 0xcc, 0x3c, 0xad,
+    0xdf, 0x5a, 0x36, 0xcf, 0xc3, 0xab, 0x84, 0x7a, 0x69, 0xd5, 0x40, 0xf1, 0x36, 0x23, 0x68, 0x92,
+    0x63, 0x9a, 0x20, 0xda, 0xfc, 0x64, 0x9b, 0x15, 0x66, 0x9f, 0xf4, 0xd0, 0x53, 0x00, 0xfe, 0xdd,
+    0xc3, 0x4a, 0xf8, 0x68, 0xe7, 0x8c, 0x79, 0x1b, 0x2c, 0xc3, 0x5c, 0xac, 0x23, 0x0a, 0xcd, 0x58,
+    0x7c, 0x88, 0x59, 0x91, 0x49, 0x1c, 0x85, 0x9b, 0xa8, 0x78, 0x23, 0x13, 0x64, 0xd1, 0x24, 0x34,
+    0x73, 0x46, 0x16, 0xfd, 0x0e, 0x16, 0x5a, 0xbb, 0xf8, 0x97, 0x71, 0x8f, 0x70, 0x1c, 0x9d, 0xe9,
+    0xc7, 0x0c, 0x0b, 0x4f, 0x7d, 0x3a, 0xdd, 0x89, 0x97, 0x08, 0x08, 0x2c, 0xba, 0x8c, 0x24, 0xb2,
+    0xd5, 0xa3, 0x30, 0x47, 0x3a, 0xf6, 0x0b, 0x6d, 0x7d, 0xfb, 0x5e, 0x11, 0x10, 0x93, 0x6d, 0x44,
+    0xb5, 0x54, 0xcb, 0x17, 0x05, 0xd3, 0x13, 0xbd, 0x07, 0x6d, 0xe1, 0x45, 0xe9, 0x10, 0x3f, 0x9f,
+    0x68, 0xfe, 0xf2, 0xfe, 0xae, 0x97, 0xf9, 0xf9, 0x6e, 0xc7, 0xf7, 0xb8, 0xba, 0x4f, 0x5d, 0x14,
+    0xed, 0x26, 0xd8, 0x95, 0x93, 0xbf, 0xe6, 0x0d, 0xb1, 0xdf, 0x4e, 0xdf, 0x1d, 0xb8, 0xa4, 0x5d,
+    0x6e, 0xaf, 0x70, 0xe2, 0xd2, 0x04, 0x15, 0x49, 0xd9, 0x5a, 0xd6, 0x35, 0x0e, 0x02, 0xf2, 0x16,
+    0xc3, 0x26, 0x21, 0x06, 0x45, 0x7a, 0x31, 0x14, 0x5e, 0x92, 0xd2, 0x8d, 0x4c, 0x80, 0xcc, 0xd8,
+    0xf8, 0x2b, 0x6f, 0x2e, 0xa2, 0x95, 0xd3, 0x30, 0xc6, 0x5c, 0x41, 0xf8, 0x10, 0x5c, 0x7d, 0x77,
+    0x47, 0x0b, 0x0b, 0xfa, 0xab, 0x45, 0xf0, 0x9d, 0xa2, 0x5a, 0x10, 0x75, 0xce, 0x80, 0xdf, 0x42,
+    0xfd, 0x9c, 0x67, 0x97, 0x23, 0xb2, 0xb3, 0x57, 0x18, 0x0f, 0x51, 0x43, 0xbc, 0xe2, 0x73, 0x5d,
+    0x5f, 0xda, 0xc7, 0xe2, 0xf4, 0xf1, 0x9f, 0x86, 0x58, 0xeb, 0xd5, 0x29, 0x27, 0xa0, 0xdc, 0x7b,
+    0x6a, 0xf1, 0xbb, 0xdb, 0x3e, 0x91, 0x35, 0xda, 0x4e, 0x10, 0xf0, 0x45, 0x81, 0x79, 0xa8, 0xa7,
+    0x62, 0x4a, 0xa1, 0x1c, 0x66, 0x99, 0x66, 0xa1, 0x81, 0x6e, 0x88, 0x9c, 0xf0, 0x5e, 0x40, 0x5e,
+    0x8c, 0x22, 0xa5, 0x8b, 0xa2, 0xba, 0x7a, 0xd2, 0xcf, 0xe6, 0x97, 0x7e, 0x01, 0x96, 0x5d, 0xed,
+    0xf2, 0x74, 0x99, 0x6a, 0x3c, 0xa0, 0x67, 0x0b, 0x79, 0xda, 0xbe, 0x18, 0x99, 0xfa, 0x24, 0x6f,
+    0x23, 0x37, 0xa2, 0x87, 0xd5, 0x8d, 0xf6, 0x9c, 0x7a, 0x6e, 0xde, 0xb3, 0x80, 0x95, 0x8e, 0xf1,
+    0x03, 0x4d, 0x81, 0x12, 0xce, 0xb1, 0x71, 0x27, 0xad, 0x1c, 0x7b, 0x5b, 0xdf, 0xfe, 0x79, 0x8a,
+    0x59, 0xe0, 0xe3, 0x2f, 0x47, 0xd4, 0x4f, 0x26, 0x07, 0x37, 0x97, 0x0b, 0x12, 0xbb, 0x53, 0x2d,
+    0x1a, 0xe9, 0x00, 0x0c, 0xb3, 0x68, 0x72, 0x73, 0xc6, 0x37, 0x5f, 0x56, 0xa1, 0xb2, 0x80, 0xab,
+    0x3e, 0xfd, 0x77, 0xe7, 0xba, 0x96, 0xd3, 0x77, 0xf9, 0xa2, 0xc0, 0x3b, 0x1e, 0xfe, 0xaa, 0xf1,
+    0xcb, 0xae, 0x18, 0xe3, 0x08, 0xf5, 0xb4, 0xf3, 0xef, 0x8a, 0xd4, 0xf9, 0xa2, 0xf3, 0x72, 0xa9,
+    0x3b, 0x03, 0x42, 0x26, 0x4d, 0x71, 0x18, 0xf2, 0x73, 0x83, 0xef, 0x2d, 0x34, 0xa9, 0xa0, 0x86,
+    0x3e, 0xd2, 0x46, 0x28, 0x24, 0x07, 0x22, 0xac, 0xdb, 0xb2, 0xa5, 0x6b, 0x9c, 0x9f, 0xac, 0x50,
+    0x3e, 0x2f, 0x5f, 0x27, 0x2d, 0xfe, 0xb2, 0xce, 0xc6, 0x15, 0xdd, 0xa5, 0x46, 0x41, 0x06, 0x77,
+    0x43, 0x80, 0x97, 0xd2, 0x77, 0xbb, 0x64, 0xed, 0x8a, 0x2a, 0x79, 0xf8, 0x4b, 0xab, 0xe3, 0xec,
+    0xce, 0xef, 0xbc, 0xbb, 0xd3, 0xe4, 0xe8, 0x2b, 0x9c, 0x67, 0x87, 0xed, 0x82, 0xaa, 0x2f, 0x66,
+    0xa6, 0x5f, 0x8a, 0x94, 0xc4, 0x55, 0x17, 0x24, 0x67, 0x5c, 0xa8, 0x5f, 0xd8, 0x9f, 0x5d, 0xcc,
+    0x7b, 0xcd, 0x06, 0xda, 0x7d, 0xfc, 0xad, 0x7d, 0x59, 0xdd, 0x32, 0x32, 0x33, 0x84, 0x90, 0x1e,
+    0xf9, 0xad, 0xca, 0x28, 0xd5, 0xfb, 0x42, 0xed, 0x6f, 0xba, 0x1a, 0xd8, 0xf3, 0x60, 0xe0, 0x95,
+    0x01, 0xa0, 0x8e, 0x6b, 0x71, 0x4f, 0x61, 0x10, 0xc3, 0xb1, 0x1d, 0xce, 0xb1, 0x24, 0xac, 0xe6,
+    0x98, 0xc6, 0xf0, 0xd4, 0xa8, 0x97, 0xc6, 0xcc, 0x92, 0x2d, 0x55, 0x92, 0x16, 0x82, 0x8d, 0x8a,
+    0x5c, 0x65, 0xb1, 0x39, 0x16, 0xab, 0xfd, 0xc2, 0xc8, 0x59, 0xb7, 0xf6, 0x9d, 0x09, 0x29, 0xb5,
+    0x3c, 0x9f, 0x16, 0x99, 0x6b, 0x5f, 0x56, 0x21, 0x76, 0x17, 0xbc, 0x16, 0xf5, 0x22, 0xea, 0x9d,
+    0xf9, 0x7d, 0xdb, 0xf0, 0x08, 0x19, 0x9f, 0x31, 0x7a, 0x3b, 0xf5, 0x3a, 0xe3, 0x5e, 0x44, 0x76,
+    0x49, 0x5f, 0x44, 0x2a, 0x7c, 0x3a, 0x2b, 0x77, 0x56, 0x4a, 0x67, 0x85, 0x39, 0xe2, 0x80, 0x2c,
+    0x36, 0x9f, 0xc7, 0x8c, 0x1e, 0xce, 0x3d, 0x7b, 0xe9, 0x32, 0xdf, 0x0e, 0x65, 0xea, 0x76, 0xad,
+    0x3e, 0xde, 0xcf, 0x4f, 0xd2, 0xda, 0x15, 0xce, 0x9d, 0xd1, 0x8c, 0x77, 0x0c, 0xbe, 0x0f, 0x37,
+    0xee, 0x24, 0x45, 0x98, 0xe7, 0x39, 0x70, 0x1e, 0x1a, 0x41, 0xd8, 0x82, 0x16, 0xe0, 0x38, 0x21,
+    0x08, 0x4e, 0x59, 0x7e, 0xe9, 0x8e, 0x17, 0x7c, 0x8a, 0x20, 0xd1, 0xfd, 0xb0, 0x5c, 0x44, 0x33,
+    0xe3, 0xf9, 0x5a, 0x73, 0x44, 0x3f, 0x64, 0x47, 0xe3, 0x68, 0x31, 0x2c, 0x35, 0xc3, 0x76, 0xa2,
+    0x04, 0xbb, 0x1d, 0x4e, 0x18, 0xc7, 0x5f, 0x9d, 0xef, 0xb2, 0x7e, 0xe8, 0xc2, 0x7f, 0x9f, 0xb4,
+    0x7f, 0x10, 0x19, 0xda, 0x0b, 0x8d, 0x8b, 0xe5, 0xb3, 0xbd, 0x53, 0x17, 0x1b, 0x24, 0xfc, 0x49,
+    0x54, 0x92, 0x4d, 0x1d, 0xef, 0xd8, 0x49, 0xfc, 0x24, 0x4f, 0x65, 0xe8, 0x3c, 0x32, 0x02, 0xad,
+    0x15, 0x79, 0x82, 0x44, 0x3e, 0xf9, 0xe5, 0x2e, 0x5d, 0xae, 0xbe, 0x03, 0x8a, 0xbd, 0x35, 0x5e,
+    0x4b, 0x2a, 0xd1, 0x4a, 0x98, 0x78, 0x15, 0x18, 0x1b, 0x22, 0x5b, 0xaa, 0x8f, 0xff, 0xb6, 0xe5,
+    0x35, 0x5f, 0x57, 0xb3, 0x1a, 0x88, 0x18, 0x41, 0x3c, 0x36, 0x9d, 0x2b, 0xea, 0xae, 0x80, 0x20,
+    0x67, 0xe8, 0x49, 0xa4, 0xcd, 0xaf, 0xe9, 0xa4, 0xe4, 0xd7, 0x25, 0xe9, 0x9a, 0xae, 0x09, 0x5f,
+    0xb7, 0x1a, 0x9e, 0x91, 0x4b, 0xc3, 0x03, 0x8e, 0x24, 0xda, 0x63, 0x0b, 0xa0, 0xd1, 0xcd, 0x41,
+    0x81, 0x2e, 0xb9, 0xd0, 0x5a, 0x3a, 0x2d, 0xd4, 0xe0, 0xd1, 0x0d, 0x40, 0x69, 0x95, 0x99, 0x61,
+    0x0e, 0xc9, 0xaf, 0x08, 0xee, 0xc0, 0x2c, 0xe7, 0x4f, 0x93, 0x0f, 0xc9, 0x62, 0x43, 0x99, 0xa2,
+    0xa2, 0x5c, 0x14, 0x04, 0xf3, 0xac, 0x05, 0x3c, 0xfc, 0x9c, 0x2c, 0x75, 0xf2, 0x60, 0xff, 0x2f,
+    0x43, 0xfa, 0x73, 0x86, 0x0c, 0x21, 0x6c, 0xdd, 0x08, 0x70, 0x1c, 0x63, 0x20, 0xbd, 0x36, 0x58,
+    0xbb, 0x6a, 0x3d, 0xfc, 0xf7, 0x96, 0x7f, 0xbf, 0x16, 0x22, 0x8f, 0x19, 0x96, 0x9e, 0xca, 0xf7,
+    0xb8, 0xd3, 0x69, 0x74, 0x32, 0x3d, 0x49, 0xd8, 0x90, 0x50, 0xe1, 0x78, 0x6b, 0x10, 0x58, 0x71,
+    0x82, 0x2d, 0x3a, 0x2e, 0xaa, 0x21, 0x9a, 0xa8, 0x13, 0x84, 0x52, 0x28, 0xbd, 0x42, 0x58, 0x9e,
+    0xab, 0x5f, 0x72, 0x03, 0x98, 0xf8, 0x49, 0xe0, 0xbd, 0x31, 0x7e, 0x9b, 0xa0, 0x2a, 0xf0, 0x7c,
+    0x59, 0x02, 0x55, 0x2a, 0xeb, 0x30, 0xd0, 0x2a, 0x46, 0x02, 0x8b, 0xf6, 0x55, 0x3b, 0xa7, 0x84,
+    0xaa, 0xac, 0xab, 0x1a, 0x1d, 0xb4, 0x26, 0x93, 0xbf, 0xf0, 0xad, 0x6c, 0x88, 0x54, 0xa5, 0x3a,
+    0x37, 0x2b, 0x92, 0x94, 0x7a, 0xef, 0x0b, 0xe9, 0x07, 0x74, 0x1b, 0xa3, 0x89, 0xb2, 0x8b, 0x6f,
+    0xd1, 0xde, 0x40, 0x92, 0x57, 0x55, 0x45, 0x56, 0xb0, 0x98, 0x5d, 0xe4, 0x96, 0x71, 0x3c, 0xfa,
+    0x93, 0x05, 0xc2, 0x5d, 0x7b, 0xe5, 0x27, 0x86, 0xe4, 0xda, 0x69, 0x1e, 0x13, 0x59, 0x8d, 0xab,
+    0x1c, 0xa0, 0x92, 0xee, 0xe0, 0xa6, 0xa3, 0x61, 0x7c, 0x2d, 0xb9, 0x90, 0x84, 0x74, 0xad, 0x51,
+    0xa7, 0x5d, 0x17, 0x35, 0x4b, 0xcc, 0x10, 0x89, 0x16, 0x8d, 0xb2, 0x60, 0x55, 0x8f, 0x3a, 0x01,
+    0xd6, 0x29, 0xb0, 0xe1, 0xf4, 0xbe, 0xff, 0xae, 0xd3, 0x89, 0x97, 0x1c, 0x6d, 0x7e, 0x10, 0xd0,
+    0x18, 0xa3, 0xc5, 0x62, 0x08, 0xb2, 0x7e, 0x1a, 0xdb, 0x22, 0x3d, 0x5e, 0xc8, 0x20, 0xf3, 0x82,
+    0x6d, 0xba, 0xab, 0xd6, 0x9b, 0x4f, 0xca, 0xb4, 0x19, 0x47, 0x5d, 0x48, 0x1c, 0x64, 0x3f, 0x00,
+    0x09, 0x21, 0xf5, 0xe2, 0x7e, 0xb9, 0x4c, 0xac, 0x9b, 0xd4, 0x20, 0xd9, 0x71, 0x37, 0x68, 0x6e,
+    0x73, 0x2b, 0x99, 0x6c, 0x71, 0xb0, 0x4c, 0x85, 0xce, 0x82, 0x58, 0xec, 0xe1, 0xa7, 0x2d, 0xf4,
+    0x96, 0xda, 0xf1, 0x12, 0x79, 0xa1, 0xca, 0x50, 0xe9, 0xc6, 0x97, 0x78, 0xbf, 0xf7, 0x1b, 0x7d,
+    0x0b, 0x7a, 0xeb, 0xc3, 0x89, 0x3f, 0x83, 0x48, 0xf8, 0x43, 0x04, 0xcf, 0x4a, 0x7c, 0x4c, 0xa4,
+    0x64, 0xbd, 0x4b, 0xcc, 0x43, 0xd0, 0x3b, 0x21, 0x5d, 0x1c, 0x68, 0x64, 0xc7, 0x36, 0x50, 0xa7,
+    0xda, 0x5b, 0x45, 0x5f, 0xbc, 0x18, 0x79, 0x70, 0x16, 0x95, 0x54, 0x31, 0xdd, 0x0d, 0xe0, 0xab,
+    0xfb, 0xbd, 0x9f, 0x49, 0x88, 0x90, 0xd6, 0x41, 0x49, 0x8e, 0xea, 0x7e, 0xe2, 0x33, 0xdb, 0x12,
+    0x44, 0xad, 0x35, 0x02, 0x6a, 0xa2, 0x5e, 0xfa, 0xe9, 0xff, 0x55, 0xde, 0x2d, 0xd5, 0x23, 0x6b,
+    0xfe, 0xf0, 0xfd, 0xbe, 0xf7, 0x4f, 0x13, 0x6a, 0x0a, 0x14, 0xf1, 0xa6, 0x5e, 0x3d, 0x75, 0x0f,
+    0xf2, 0x61, 0x1b, 0x11, 0xd2, 0x95, 0xe8, 0xc2, 0xb1, 0x6d, 0x39, 0xa7, 0x60, 0xf7, 0x28, 0xa8,
+    0xc1, 0x32, 0xb2, 0x08, 0xd7, 0x5d, 0x80, 0xe2, 0xd2, 0x20, 0x65, 0x97, 0xd3, 0x3f, 0x2e, 0xb5,
+    0x69, 0xbf, 0xf2, 0xc1, 0x9f, 0xea, 0x36, 0x0b, 0xba, 0xaa, 0xce, 0x6d, 0xf1, 0xba, 0x60, 0x59,
+    0xee, 0x88, 0x0c, 0x01, 0xdb, 0x30, 0x7e, 0xb5, 0x62, 0x78, 0x27, 0x06, 0x7e, 0x95, 0xe1, 0x67,
+    0xbe, 0x29, 0xdd, 0x2b, 0xb7, 0x58, 0xe6, 0x14, 0xca, 0xe7, 0xb5, 0xda, 0x21, 0x6b, 0x38, 0xce,
+    0x94, 0xba, 0x92, 0x12, 0x66, 0xef, 0xca, 0x23, 0xf0, 0x24, 0x64, 0xaa, 0xc8, 0x4f, 0x15, 0x92,
+    0xb2, 0x8e, 0x19, 0xf2, 0xfb, 0x54, 0x00, 0xaf, 0x69, 0x1b, 0xf3, 0x21, 0x89, 0x21, 0x78, 0x08,
+    0x12, 0x2f, 0xbc, 0x90, 0x60, 0x1e, 0x45, 0xc5, 0x22, 0x64, 0x09, 0x17, 0x0a, 0x0d, 0x0a, 0xa8,
+    0x29, 0x18, 0xc3, 0xb3, 0x33, 0x63, 0x7b, 0x9e, 0x2e, 0x94, 0xc7, 0xe5, 0xbf, 0x3d, 0xd2, 0xf9,
+    0xe9, 0xa3, 0x38, 0xe4, 0xc3, 0x1e, 0x5f, 0x50, 0xee, 0x07, 0x9f, 0xc0, 0x5a, 0x31, 0xb2, 0x5d,
+    0x57, 0xfd, 0x15, 0xf9, 0x69, 0xe1, 0xc1, 0xba, 0xa8, 0x2b, 0xf8, 0xca, 0xce, 0xa0, 0xf6, 0x72,
+    0x2a, 0x77, 0x55, 0x41, 0x55, 0x5d, 0x7c, 0x14, 0xec, 0xb8, 0x10, 0xb2, 0xd2, 0xb1, 0x25, 0x6f,
+    0x8e, 0x17, 0xc7, 0xa6, 0x85, 0x32, 0x72, 0xe2, 0xaa, 0xbb, 0xe7, 0xe3, 0x79, 0x64, 0xe0, 0xd7,
+    0x06, 0xea, 0xef, 0x5e, 0xda, 0xb0, 0x42, 0x0c, 0x6b, 0x83, 0xe6, 0xc8, 0x70, 0x1e, 0x60, 0x7d,
+    0x62, 0xe9, 0xc7, 0x29, 0x60, 0x9c, 0x44, 0x4f, 0x0d, 0xce, 0x08, 0xe3, 0x4d, 0x83, 0x53, 0x48,
+    0x55, 0x93, 0x8e, 0xe1, 0x76, 0x12, 0x5d, 0xc8, 0x38, 0x0b, 0x74, 0x91, 0x22, 0x9c, 0x83, 0xa5,
+    0xa7, 0x44, 0xc8, 0xef, 0x33, 0xc9, 0xe8, 0xa2, 0xec, 0xac, 0x4d, 0xb6, 0xd0, 0xf5, 0xcc, 0xf1,
+    0xd9, 0xf1, 0xc5, 0xc8, 0x6f, 0x3b, 0xe1, 0xbb, 0xb9, 0xe7, 0xea, 0xca, 0x91, 0x42, 0x4f, 0x89,
+    0x4a, 0x29, 0x0a, 0xb7, 0xb8, 0x78, 0xf6, 0xef, 0xdd, 0x44, 0x69, 0x69, 0xdf, 0x89, 0x9a, 0xc7,
+    0x5a, 0xde, 0x43, 0x71, 0x60, 0x77, 0xbe, 0x93, 0xc1, 0x5f, 0x75, 0xac, 0x40, 0x17, 0x96, 0x23,
+    0xb2, 0xe2, 0xdd, 0x42, 0xbf, 0x1f, 0x43, 0x92, 0x8d, 0x80, 0x4f, 0x49, 0x89, 0xc2, 0x0b, 0x8f,
+    0x62, 0x0a, 0xf9, 0x44, 0xd3, 0xe0, 0xa5, 0x6b, 0x7a, 0xbc, 0xa6, 0x0a, 0xc7, 0x0a, 0xe8, 0x82,
+    0x12, 0x42, 0x75, 0x6a, 0x11, 0xdc, 0xf2, 0xa7, 0x97, 0x8c, 0x93, 0xc4, 0xd4, 0x83, 0x40, 0x63,
+    0xd6, 0x7e, 0x34, 0xe8, 0x6a, 0x79, 0x87, 0xd3, 0x13, 0x13, 0xd2, 0x75, 0xdd, 0xa9, 0xb2, 0x1c,
+    0x41, 0xc6, 0x68, 0x16, 0xd7, 0x26, 0x63, 0x89, 0xb2, 0xe1, 0x65, 0x9b, 0x85, 0x78, 0xb7, 0xf7,
+    0x62, 0x2c, 0x60, 0x0b, 0x77, 0x19, 0x0a, 0x78, 0x6a, 0x5b, 0xd8, 0x72, 0xda, 0x6e, 0xd0, 0x81,
+    0x21, 0x59, 0xd1, 0x09, 0xb6, 0xc8, 0x6e, 0x0a, 0x82, 0x8c, 0x70, 0x38, 0x52, 0xbb, 0x99, 0x4e,
+    0x8d, 0x89, 0x69, 0x7f, 0x10, 0xd5, 0x86, 0x23, 0x74, 0x78, 0x56, 0x65, 0x95, 0xf2, 0x6a, 0xc2,
+    0xbd, 0x8b, 0x59, 0xf9, 0x09, 0x55, 0x9e, 0x98, 0x3c, 0x94, 0x9a, 0x99, 0x63, 0x7d, 0x8c, 0x28,
+    0x39, 0xcf, 0x39, 0x53, 0x87, 0xcc, 0x7b, 0x3b, 0x5d, 0xd2, 0x56, 0xc6, 0x60, 0xd4, 0xb5, 0xc8,
+    0xa9, 0x52, 0x15, 0xa0, 0xa2, 0xa4, 0x15, 0xca, 0x94, 0xc0, 0x11, 0x22, 0x8f, 0xcd, 0x1e, 0x08,
+    0xf6, 0xd9, 0x85, 0x6d, 0x06, 0xe8, 0xb7, 0xc6, 0x78, 0x4f, 0x49, 0x96, 0x23, 0x7a, 0x62, 0xd9,
+    0x33, 0xb4, 0x53, 0x73, 0x91, 0xba, 0xe0, 0x83, 0x2c, 0x7a, 0xde, 0x75, 0xe0, 0x71, 0x0b, 0x64,
+    0xc4, 0xf4, 0x97, 0x16, 0x81, 0x59, 0xd8, 0x48, 0xa9, 0x59, 0x84, 0x09, 0x88, 0xa2, 0x97, 0xdb,
+    0x01, 0x71, 0x72, 0xf5, 0x08, 0x78, 0x8d, 0x82, 0x57, 0x4a, 0x00, 0xfd, 0x1b, 0x0e, 0x6f, 0x26,
+    0x68, 0x6a, 0xae, 0xfa, 0x37, 0x60, 0x86, 0x8a, 0x1c, 0x15, 0x03, 0xdf, 0xb7, 0x63, 0x9b, 0x39,
+    0x36, 0x8e, 0x8a, 0x16, 0x04, 0x21, 0x6f, 0xab, 0x01, 0xe5, 0x6f, 0x91, 0xa9, 0xc3, 0x49, 0x7f,
+    0x3f, 0x1d, 0x42, 0xd3, 0x94, 0x73, 0x42, 0xb0, 0x25, 0x16, 0x71, 0x6c, 0xe8, 0x9d, 0x19, 0x69,
+    0xaf, 0x9f, 0xe5, 0x24, 0x89, 0x31, 0x7f, 0x14, 0x97, 0x8d, 0x16, 0x94, 0x5b, 0x8b, 0xe6, 0xe7,
+    0x26, 0x4b, 0xad, 0x45, 0x8e, 0x2a, 0x1c, 0xd8, 0x7d, 0xe0, 0xa3, 0x56, 0x7c, 0xdf, 0x56, 0x4f,
+    0x82, 0xbf, 0x8a, 0x96, 0xc8, 0x9a, 0xbc, 0x19, 0xb4, 0x48, 0x3f, 0x36, 0xd1, 0x52, 0xfd, 0xa8,
+    0xce, 0x8a, 0x37, 0xdd, 0xed, 0x06, 0xa0, 0xc7, 0x24, 0xc5, 0x88, 0x7f, 0x89, 0x81, 0xee, 0xff,
+    0x9a, 0xbd, 0xa1, 0x58, 0x5c, 0xda, 0x11, 0x27, 0x15, 0x90, 0x17, 0xdb, 0x24, 0x2b, 0x3d, 0x8c,
+    0xd2, 0xcf, 0xee, 0x17, 0x13, 0xdf, 0x4f, 0x05, 0x90, 0xf4, 0x69, 0xc7, 0x0b, 0x9d, 0x0b, 0x5e,
+    0xae, 0x37, 0x8e, 0x35, 0xe8, 0x94, 0x02, 0x10, 0x70, 0x4a, 0xf6, 0x10, 0x65, 0x34, 0x79, 0xa2,
+    0xd4, 0xb0, 0x45, 0x7b, 0x8b, 0x17, 0x80, 0x82, 0x90, 0xea, 0xf1, 0x8d, 0xd4, 0x8f, 0x69, 0x48,
+    0x61, 0x7a, 0xca, 0x57, 0xdb, 0x35, 0x5a, 0x46, 0x66, 0x3f, 0x69, 0x24, 0xae, 0xfa, 0xb5, 0x7c,
+    0x4d, 0xef, 0x48, 0x29, 0xf6, 0xe4, 0xb1, 0xed, 0xdb, 0x25, 0x2a, 0x95, 0x9c, 0xbd, 0xe6, 0xf9,
+    0x54, 0x9b, 0x58, 0x72, 0x7b, 0xda, 0xe5, 0x54, 0xd1, 0xcc, 0xbc, 0x37, 0x7a, 0x02, 0x34, 0x8b,
+    0x1e, 0xc2, 0xcf, 0xc8, 0xc4, 0x05, 0xb3, 0x16, 0xcc, 0x9d, 0x30, 0x87, 0xbf, 0x6a, 0xa6, 0xd3,
+    0x8a, 0xcb, 0xd0, 0xc1, 0x45, 0x92, 0x65, 0x3f, 0x77, 0x3c, 0xc5, 0xf3, 0x96, 0xc2, 0x1c, 0x86,
+    0x43, 0x4b, 0x4a, 0x0a, 0x23, 0x05, 0x85, 0xb1, 0xa3, 0x6c, 0xa6, 0x18, 0xd2, 0xff, 0xb5, 0xcb,
+    0x90, 0x35, 0xbe, 0xe5, 0x0d, 0xf7, 0x1c, 0x03, 0xf0, 0xdd, 0x29, 0x9b, 0x0d, 0xb4, 0x5d, 0x94,
+    0xf1, 0x24, 0xb3, 0xda, 0x82, 0xfa, 0x8a, 0x13, 0xb5, 0x00, 0xc2, 0x74, 0x2d, 0x42, 0x16, 0x56,
+    0x7d, 0xfe, 0x57, 0xf9, 0x25, 0xa3, 0x5c, 0x40, 0x52, 0x5c, 0xde, 0x97, 0x2b, 0x82, 0xc6, 0x47,
+    0x88, 0x50, 0x28, 0x0d, 0xee, 0x68, 0x11, 0x80, 0xe2, 0xa8, 0xcd, 0x16, 0x3a, 0xef, 0xb2, 0x71,
+    0xbf, 0xf0, 0xe4, 0x7a, 0x52, 0xa6, 0x0a, 0x44, 0x3b, 0x7f, 0x43, 0x85, 0x6c, 0x9c, 0x5b, 0xf9,
+    0x39, 0x0b, 0x35, 0x00, 0xce, 0x16, 0x8d, 0x2c, 0xc4, 0xec, 0x51, 0xcb, 0x27, 0xb9, 0x15, 0x8b,
+    0xfe, 0x62, 0xb5, 0x65, 0x77, 0x16, 0xe0, 0x6c, 0x10, 0x8b, 0x6f, 0x00, 0x33, 0xcf, 0x0b, 0x61,
+    0xdd, 0x92, 0x59, 0xb9, 0xf7, 0x2b, 0x04, 0x7a, 0x0e, 0x72, 0xb0, 0xe1, 0x97, 0x6e, 0x60, 0x8f,
+    0x77, 0xea, 0x1f, 0x74, 0xd6, 0x59, 0xc3, 0x6c, 0xa5, 0x2f, 0x47, 0xd6, 0x46, 0x06, 0xe9, 0x37,
+    0x4b, 0x72, 0x11, 0xa8, 0x10, 0x4b, 0x77, 0x11, 0x44, 0x9a, 0x73, 0x0f, 0xa2, 0xf1, 0x8e, 0x59,
+    0x35, 0x99, 0x59, 0x6f, 0xa5, 0x6c, 0x81, 0x42, 0xc2, 0x1c, 0xed, 0x04, 0x3a, 0x4a, 0xb7, 0xee,
+    0x5e, 0x4a, 0xdc, 0x00, 0x8b, 0x1e, 0xc8, 0x17, 0x92, 0xbf, 0x83, 0xf3, 0xe5, 0xbf, 0xdc, 0xa5,
+    0x28, 0x1b, 0x62, 0xc5, 0xf8, 0x7c, 0x35, 0x3a, 0x9d, 0x35, 0xb6, 0x3b, 0x34, 0x3c, 0x47, 0x16,
+    0xfd, 0x2f, 0x7b, 0x19, 0x43, 0x4c, 0xc1, 0x54, 0x73, 0x81, 0x68, 0xab, 0xc0, 0x02, 0x65, 0xd3,
+    0xcd, 0x39, 0xc1, 0xbe, 0x01, 0x3c, 0x9f, 0xf3, 0x15, 0x2d, 0x3d, 0xcb, 0x69, 0x12, 0xc0, 0xcd,
+    0x34, 0x22, 0x6e, 0xbc, 0x28, 0xa8, 0xfe, 0xe3, 0xf2, 0xf6, 0x12, 0x62, 0xdb, 0x52, 0x2d, 0x86,
+    0x68, 0x3a, 0x49, 0x47, 0x8f, 0x04, 0xa1, 0x8f, 0x6c, 0xfc, 0xdd, 0xea, 0xbe, 0xa1, 0x6b, 0x7e,
+    0x6c, 0x5b, 0xf7, 0x9e, 0x9e, 0xd2, 0x7b, 0x08, 0x2a, 0x1b, 0x66, 0x19, 0x3f, 0xf9, 0x15, 0x4f,
+    0xea, 0xdb, 0x5f, 0x7b, 0x2c, 0x9a, 0x75, 0xdf, 0xc3, 0x79, 0xf5, 0x4d, 0xb9, 0x91, 0x93, 0x6f,
+    0xcd, 0x45, 0xd3, 0x8f, 0xf3, 0x76, 0xc6, 0xbd, 0x15, 0xaa, 0xef, 0x4a, 0x2c, 0x14, 0xef, 0xa7,
+    0x99, 0x2a, 0x47, 0xb6, 0x29, 0x7d, 0x61, 0xe9, 0x7a, 0x8e, 0x1d, 0xf0, 0xac, 0xff, 0x41, 0xf4,
+    0x1f, 0x62, 0xff, 0x5b, 0xc4, 0xee, 0x8b, 0x64, 0x33, 0x97, 0x4b, 0x89, 0x1f, 0xd5, 0xa4, 0xba,
+    0x11, 0x56, 0x02, 0xbe, 0xbf, 0x5b, 0x1b, 0xf8, 0x51, 0xfc, 0x2e, 0x34, 0x3a, 0x76, 0xff, 0x60,
+    0xfe, 0x7f, 0x60, 0x46, 0x99, 0xac, 0x95, 0xbc, 0x56, 0xd3, 0x29, 0x65, 0x17, 0x05, 0x6a, 0x34,
+    0x58, 0xd8, 0x47, 0x78, 0xc7, 0x2c, 0x04, 0x39, 0xfa, 0x74, 0xb7, 0x0b, 0xfb, 0xbd, 0x2c, 0x52,
+    0xaa, 0xe7, 0xfe, 0xdd, 0x15, 0xb8, 0x62, 0x49, 0x84, 0xde, 0x3d, 0xb2, 0x89, 0x0c, 0x15, 0x8c,
+    0x1a, 0x6d, 0x81, 0x32, 0x8e, 0x6c, 0x62, 0xf3, 0x17, 0x9e, 0xea, 0x7f, 0x88, 0xfd, 0x8b, 0x8b,
+    0x45, 0xe6, 0xad, 0x95, 0x28, 0xa8, 0xa5, 0xdd, 0xde, 0x0e, 0xae, 0x51, 0x63, 0x61, 0x1b, 0x21,
+    0x7a, 0x7c, 0xd3, 0x05, 0x08, 0x40, 0x00, 0x00, 0x01, 0x84, 0x82, 0x82, 0x80, 0x88, 0x00, 0xff,
+    0xf3, 0x07, 0x5d, 0x00, 0x08, 0x0e, 0x1e, 0x01, 0x11, 0x82, 0x8b, 0xcf, 0xa9, 0xa6, 0xee, 0x0c,
+    0xc6, 0xc1, 0xa3, 0x0c, 0x4e, 0xae, 0xde, 0x85, 0xb2, 0x8b, 0x19, 0x53, 0x71, 0x70, 0x89, 0x77,
+    0x98, 0x98, 0xe6, 0x2d, 0x51, 0x8b, 0xaa, 0xd2, 0xb0, 0xfd, 0xfc, 0x90, 0x19, 0xee, 0xf6, 0x43,
+    0xe6, 0xb0, 0x30, 0x89, 0xf5, 0x29, 0xd5, 0x0a, 0xfd, 0xe6, 0xf7, 0xfa, 0x93, 0x6b, 0x8c, 0x53,
+    0x95, 0xec, 0xda, 0x75, 0xde, 0x31, 0x75, 0x15, 0x83, 0x5a, 0x2f, 0x8d, 0x4c, 0x5f, 0xda, 0x1c,
+    0xe0, 0xdb, 0xea, 0xa4, 0xff, 0xdf, 0x66, 0xb2, 0x40, 0x30, 0xa8, 0xf5, 0xa8, 0x94, 0x6a, 0x04,
+    0xaf, 0x72, 0x18, 0xf4, 0x08, 0x4c, 0xff, 0xb7, 0x13, 0x97, 0x58, 0xf9, 0xf4, 0x53, 0x96, 0x33,
+    0x31, 0x0e, 0x37, 0x80, 0x98, 0x0c, 0x49, 0xdc, 0xdb, 0x45, 0xfa, 0x15, 0xe7, 0x34, 0x3f, 0x44,
+    0x52, 0x07, 0x8e, 0x9d, 0xa0, 0x82, 0xf8, 0xee, 0x07, 0xbb, 0x78, 0xce, 0x0d, 0x03, 0xad, 0x70,
+    0x09, 0x3c, 0xc4, 0x9e, 0xed, 0x6a, 0xdd, 0x2b, 0x2c, 0xa7, 0x68, 0xbc, 0x9f, 0x2d, 0x16, 0x40,
+    0x7f, 0x54, 0xfd, 0xff, 0x52, 0x15, 0x84, 0x12, 0x37, 0xc5, 0x6c, 0x91, 0x3a, 0x77, 0x9d, 0x4d,
+    0x2c, 0xdf, 0xfb, 0x1a, 0xc7, 0x3e, 0xf9, 0xeb, 0x75, 0x7f, 0x96, 0x38, 0x0f, 0x83, 0x06, 0x1c,
+    0xdf, 0x49, 0x92, 0xfa, 0x58, 0xfc, 0x06, 0x5f, 0x88, 0xf6, 0x93, 0x1d, 0xb9, 0xe1, 0x1b, 0x40,
+    0x59, 0xbd, 0x86, 0xa9, 0xeb, 0x99, 0xb9, 0xf7, 0xe9, 0xbc, 0xf7, 0x98, 0xbb, 0xa4, 0xbc, 0x88,
+    0xc8, 0x61, 0xd1, 0x3d, 0xf5, 0x5e, 0x76, 0xf3, 0xb8, 0x28, 0x79, 0x14, 0xf5, 0x19, 0x2a, 0x39,
+    0x95, 0x66, 0xb9, 0x75, 0xf5, 0x3b, 0x1c, 0x6a, 0x4a, 0x6d, 0x37, 0x80, 0x4f, 0x5c, 0x8a, 0x7e,
+    0x37, 0x45, 0x82, 0xf3, 0x50, 0xef, 0x67, 0xd1, 0x3c, 0x53, 0xd2, 0xd3, 0x3a, 0xb1, 0xd7, 0x38,
+    0xdd, 0x57, 0x5f, 0xd2, 0x0e, 0xa1, 0xa6, 0xa4, 0xce, 0x96, 0xe1, 0x59, 0x17, 0xb5, 0x52, 0x52,
+    0x82, 0xb3, 0xdd, 0xa9, 0xd9, 0x3b, 0x27, 0x45, 0xf7, 0xa8, 0x06, 0xe5, 0xde, 0xc8, 0xe4, 0xc4,
+    0x5f, 0x68, 0xad, 0x05, 0x10, 0xe6, 0xcf, 0x18, 0xaf, 0xe9, 0xa4, 0xbf, 0xb8, 0x01, 0x1e, 0x1d,
+    0x5c, 0x21, 0x99, 0xe9, 0xbb, 0x1d, 0xf9, 0x25, 0xca, 0x17, 0x11, 0xc4, 0x0e, 0x78, 0xfd, 0x2a,
+    0x2a, 0x42, 0x4a, 0x6b, 0x34, 0xa8, 0x6d, 0x58, 0xd6, 0x67, 0xb6, 0x48, 0xd7, 0x2c, 0xce, 0xa9,
+    0xa3, 0x2c, 0x13, 0xab, 0xcb, 0xea, 0x67, 0x08, 0x2b, 0xb2, 0xd1, 0x43, 0x62, 0x4a, 0x4e, 0x46,
+    0x5e, 0x50, 0x40, 0x9d, 0x52, 0x35, 0x39, 0x6c, 0x7d, 0x6e, 0xbe, 0x6e, 0x73, 0xbf, 0xfe, 0xa9,
+    0xac, 0x1c, 0x51, 0x00, 0xdf, 0x9b, 0x56, 0x9c, 0x79, 0xe3, 0x22, 0x81, 0xd1, 0xcb, 0x88, 0x6c,
+    0x89, 0x2f, 0xfc, 0x5c, 0x6f, 0xe9, 0xb9, 0xe2, 0xfb, 0xe6, 0xd1, 0x34, 0x18, 0xae, 0x69, 0xe2,
+    0x8b, 0x9a, 0x18, 0x4d, 0xf7, 0x31, 0x24, 0xf3, 0xa9, 0xfc, 0x1f, 0xaa, 0x20, 0xe4, 0x5b, 0x2a,
+    0x0e, 0xea, 0x44, 0xf3, 0x15, 0xbe, 0x94, 0x2e, 0xf2, 0xb1, 0x9e, 0x50, 0x7e, 0xd3, 0x3c, 0xdb,
+    0xb9, 0x53, 0x14, 0xf6, 0x9d, 0x5e, 0x92, 0x57, 0x85, 0xdf, 0x56, 0xf6, 0x45, 0x66, 0x43, 0x27,
+    0xc4, 0xca, 0x5f, 0xbf, 0x0c, 0xbb, 0xf5, 0x29, 0xee, 0x8b, 0xdc, 0xcf, 0x0a, 0x0e, 0xdc, 0x0e,
+    0xde, 0x10, 0xc4, 0x7e, 0x39, 0xea, 0x0c, 0xd4, 0x2c, 0x09, 0x91, 0x5a, 0x6a, 0x7d, 0xeb, 0x90,
+    0xa9, 0xa7, 0x03, 0x7a, 0x96, 0x84, 0x0c, 0xd0, 0x56, 0xf1, 0x2c, 0x3a, 0x0d, 0x95, 0xcf, 0x49,
+    0xb3, 0xd1, 0x6e, 0x75, 0x49, 0x3e, 0x14, 0x31, 0xf6, 0xf1, 0xfd, 0x07, 0xc8, 0x0c, 0xa9, 0x37,
+    0x00, 0x9a, 0xb8, 0x05, 0xd7, 0x55, 0x1f, 0x66, 0x43, 0x9a, 0x82, 0x1e, 0x72, 0xde, 0x69, 0xaa,
+    0xc4, 0xd0, 0xcb, 0x0d, 0x34, 0xda, 0x26, 0x7e, 0x8d, 0xcf, 0xa2, 0x5f, 0x38, 0x72, 0x96, 0x64,
+    0x2d, 0xf9, 0xea, 0x55, 0x34, 0x4f, 0x88, 0xd4, 0xa3, 0x11, 0x5f, 0x54, 0x42, 0x1b, 0xe5, 0x68,
+    0x5c, 0x29, 0x39, 0x23, 0x8a, 0x90, 0xa6, 0x5c, 0xe9, 0x8b, 0xf7, 0xfa, 0xb5, 0xa5, 0xd2, 0x1f,
+    0xdb, 0x25, 0x8a, 0x90, 0x1c, 0x57, 0x0c, 0x5e, 0x42, 0x2a, 0x55, 0xeb, 0xdf, 0x0e, 0x76, 0x91,
+    0xde, 0xe7, 0xfb, 0x50, 0x49, 0x85, 0x88, 0xd5, 0xe7, 0x30, 0x49, 0x49, 0x82, 0xa6, 0x38, 0x58,
+    0xeb, 0x8d, 0x82, 0x3c, 0xd4, 0x35, 0x5a, 0x31, 0x2e, 0xe1, 0x84, 0x51, 0x30, 0x58, 0xc2, 0x2e,
+    0x3a, 0x05, 0xb7, 0x4a, 0xb5, 0x98, 0x12, 0xf6, 0xbd, 0x6e, 0x9d, 0xe6, 0xab, 0x92, 0x15, 0x17,
+    0x45, 0x71, 0x54, 0x89, 0xd2, 0x89, 0x25, 0x53, 0x14, 0x3b, 0xc2, 0xac, 0xc5, 0x5e, 0xea, 0x1a,
+    0x59, 0xa8, 0xf5, 0xbb, 0x4c, 0xeb, 0xd0, 0xa6, 0x6f, 0xda, 0xf9, 0x57, 0x3c, 0xb7, 0xee, 0x43,
+    0xfd, 0x15, 0x02, 0x79, 0x48, 0x85, 0xe5, 0x6e, 0xde, 0x11, 0xc6, 0x06, 0x76, 0xad, 0x1c, 0x59,
+    0x9d, 0x49, 0x71, 0x0d, 0x1a, 0x4a, 0xdc, 0x62, 0x4f, 0x48, 0x05, 0x0e, 0x02, 0x5e, 0x5b, 0xa5,
+    0x52, 0x4c, 0x32, 0x72, 0x9d, 0x47, 0xf1, 0x8a, 0x7b, 0xae, 0xb8, 0xf6, 0x92, 0x0a, 0xdc, 0x7d,
+    0xab, 0x19, 0x66, 0x80, 0x8c, 0xb9, 0xef, 0x57, 0x8e, 0xf3, 0x68, 0xa1, 0xf3, 0x60, 0x31, 0xce,
+    0xe6, 0x49, 0x01, 0xd5, 0x01, 0x25, 0x36, 0xd8, 0x69, 0x23, 0x8b, 0x8a, 0x2f, 0xfc, 0x7c, 0x10,
+    0xa7, 0x96, 0xf5, 0x0b, 0xdf, 0x21, 0xef, 0x18, 0x39, 0xb3, 0x56, 0x52, 0x8c, 0xb8, 0x81, 0xd7,
+    0x58, 0x0e, 0x65, 0x55, 0xe7, 0xd2, 0x06, 0x49, 0xa4, 0xf5, 0xe3, 0x29, 0xb1, 0xdb, 0x06, 0xc1,
+    0x43, 0x8c, 0xd0, 0xf5, 0xaf, 0xa7, 0x0a, 0x5e, 0xf4, 0x96, 0xea, 0x1a, 0x38, 0xb2, 0xb4, 0xf4,
+    0x56, 0x09, 0xf6, 0x5d, 0xa4, 0xce, 0xce, 0x0e, 0x83, 0x86, 0xf0, 0xaa, 0x4a, 0x3c, 0x6b, 0x1a,
+    0xe9, 0x2e, 0x90, 0x34, 0x34, 0xeb, 0xe2, 0x5e, 0x4a, 0x9b, 0x10, 0xaf, 0x01, 0x89, 0xaa, 0x52,
+    0xef, 0x21, 0xf7, 0x90, 0x08, 0x0b, 0x5a, 0x76, 0x9a, 0xd0, 0x2a, 0xbb, 0x06, 0x83, 0x18, 0x33,
+    0xf0, 0x86, 0xa1, 0xa0, 0x74, 0xde, 0x97, 0x7c, 0x8d, 0x0b, 0xde, 0x6b, 0x84, 0x7b, 0xc8, 0x10,
+    0xee, 0xc6, 0x4b, 0x1a, 0x34, 0xb2, 0x94, 0xb9, 0x72, 0x71, 0x6e, 0xa2, 0x0c, 0x0e, 0x75, 0xc1,
+    0x38, 0x1e, 0x05, 0x52, 0xf3, 0x27, 0x14, 0xef, 0xb2, 0xcf, 0x7e, 0x8a, 0x85, 0xb9, 0x31, 0x1a,
+    0x30, 0x4a, 0xf7, 0xca, 0x6d, 0xdb, 0xd6, 0xb1, 0x9f, 0x7b, 0xfd, 0x2e, 0xfe, 0x50, 0x65, 0x3f,
+    0x24, 0x3d, 0x3e, 0x47, 0x41, 0xd8, 0xa8, 0x92, 0x09, 0x88, 0x2a, 0xfc, 0xce, 0x91, 0xcf, 0x0e,
+    0x58, 0xaa, 0x24, 0x13, 0x44, 0x5a, 0x20, 0x8d, 0xb8, 0xd2, 0x94, 0xe0, 0x3f, 0xae, 0x07, 0x1b,
+    0xe6, 0x6e, 0x8c, 0x59, 0x73, 0x30, 0x2f, 0x2b, 0xd5, 0x09, 0x86, 0x16, 0x5b, 0xdb, 0xcb, 0xdf,
+    0x0b, 0xa3, 0x72, 0xcf, 0x91, 0x23, 0xcf, 0x10, 0xe3, 0xaf, 0x54, 0xf1, 0x32, 0xed, 0x23, 0x06,
+    0xa7, 0xbe, 0x88, 0x65, 0xa7, 0xfb, 0x44, 0xee, 0x03, 0x8d, 0xf1, 0x1c, 0x17, 0x4e, 0xdf, 0x29,
+    0xd5, 0x09, 0xc8, 0xa4, 0x1e, 0x1c, 0x3a, 0xa0, 0x06, 0x77, 0xc9, 0x59, 0xd0, 0xe8, 0x58, 0x25,
+    0x52, 0x71, 0x63, 0x0c, 0xca, 0xe5, 0x04, 0x62, 0x0f, 0x87, 0x4f, 0x73, 0x3f, 0x9f, 0xb7, 0x60,
+    0x0f, 0x97, 0xab, 0xb8, 0xd0, 0x24, 0x8d, 0xf4, 0x4e, 0x8c, 0xea, 0x15, 0xeb, 0x66, 0x90, 0x2f,
+    0x70, 0x95, 0xf4, 0x9c, 0xb8, 0xd7, 0xa6, 0xc4, 0xf1, 0x24, 0xd9, 0x92, 0x66, 0x8c, 0x91, 0x53,
+    0xe7, 0x7b, 0x3e, 0xb3, 0xfe, 0x0b, 0xfa, 0x5e, 0x89, 0x26, 0x45, 0x56, 0xc3, 0x7e, 0x67, 0xbd,
+    0xeb, 0xe1, 0xaf, 0xe7, 0xf8, 0x39, 0x9b, 0xd7, 0x81, 0x79, 0x38, 0xd7, 0x23, 0x2d, 0xd6, 0xc5,
+    0x18, 0x59, 0x5b, 0x34, 0x1f, 0x16, 0x2f, 0x15, 0x9c, 0x6e, 0x00, 0x36, 0xcd, 0xc2, 0xb6, 0x3a,
+    0xaa, 0x1a, 0x8f, 0x65, 0xac, 0x06, 0x47, 0xa6, 0xa9, 0x97, 0x38, 0x39, 0x9f, 0x7a, 0x76, 0xa1,
+    0x0a, 0x97, 0x88, 0xf9, 0xb7, 0x89, 0x9b, 0xf9, 0x70, 0x99, 0xf3, 0xca, 0x4d, 0xc6, 0x9f, 0xff,
+    0xed, 0xd1, 0x8f, 0x81, 0x5a, 0xfe, 0x65, 0x67, 0x00, 0xcf, 0x96, 0x4e, 0xc6, 0x29, 0x2d, 0x15,
+    0xbf, 0xb8, 0xce, 0x3a, 0x14, 0xff, 0x45, 0x07, 0xfe, 0x0c, 0xd5, 0x93, 0xf2, 0xfe, 0xb8, 0x2e,
+    0x10, 0x71, 0xab, 0xb4, 0xb8, 0x90, 0x4f, 0xdc, 0xf6, 0x11, 0x18, 0xfc, 0xcd, 0x70, 0x9b, 0xd5,
+    0x8b, 0x26, 0x45, 0xde, 0x3c, 0xea, 0x31, 0x4d, 0x4d, 0x81, 0x40, 0xd8, 0x33, 0x1b, 0x6f, 0x64,
+    0xd9, 0x89, 0x99, 0x14, 0x1d, 0x14, 0x29, 0x9b, 0xd6, 0xc7, 0x42, 0x1c, 0x21, 0x75, 0xd9, 0x99,
+    0x8b, 0xef, 0x53, 0x38, 0x28, 0x7f, 0x21, 0xfa, 0xa1, 0xe8, 0x95, 0xb8, 0xef, 0xe1, 0x38, 0xd9,
+    0x11, 0xda, 0xce, 0xb8, 0xa4, 0x8f, 0xfb, 0x43, 0xce, 0x66, 0xf1, 0x0a, 0xbd, 0xd4, 0x0c, 0xab,
+    0x44, 0xed, 0x0a, 0x24, 0x9d, 0x68, 0xce, 0x9d, 0xa5, 0xb3, 0xbd, 0x0c, 0x95, 0x86, 0x77, 0xfd,
+    0xf1, 0x9d, 0x34, 0xe7, 0xe4, 0x51, 0x3f, 0x5c, 0x64, 0xf1, 0x73, 0x14, 0xb2, 0xa3, 0xde, 0xdd,
+    0x67, 0xcb, 0xa7, 0x84, 0x2f, 0x75, 0xb4, 0x79, 0x51, 0x92, 0xa5, 0x7a, 0x3f, 0xa8, 0x11, 0x0d,
+    0xa9, 0x8a, 0x90, 0xf2, 0x36, 0x90, 0x51, 0x8a, 0x3f, 0x8b, 0xd1, 0xd6, 0x89, 0xb4, 0x4d, 0x50,
+    0x16, 0xcf, 0x9e, 0xa1, 0x4b, 0x9a, 0xa4, 0xe4, 0xa8, 0x3d, 0x8d, 0x56, 0xd9, 0x5c, 0x39, 0x05,
+    0x8b, 0x28, 0x67, 0x5f, 0xb9, 0xc9, 0xff, 0xcc, 0x0f, 0x21, 0xc8, 0x82, 0xf2, 0xab, 0x2b, 0xc9,
+    0x8c, 0x93, 0xdd, 0xcb, 0xd3, 0xdf, 0x8e, 0xac, 0x69, 0x8d, 0xcd, 0x0a, 0xfe, 0x63, 0x1d, 0x22,
+    0x58, 0x16, 0x77, 0xd9, 0x72, 0x0d, 0x6d, 0x1f, 0x50, 0x22, 0xe3, 0x8a, 0xba, 0xde, 0xeb, 0xed,
+    0x90, 0xe4, 0xf0, 0x3d, 0x8a, 0x92, 0x7e, 0x8f, 0x3b, 0x4e, 0x49, 0x2e, 0x0e, 0x0a, 0xb5, 0xe7,
+    0x8a, 0x39, 0x82, 0x0c, 0x3d, 0x8b, 0xdb, 0x3e, 0x9c, 0x87, 0xe6, 0xa7, 0x0c, 0xb7, 0xb7, 0x41,
+    0x9d, 0x31, 0x9e, 0x5e, 0x99, 0x42, 0xd4, 0x90, 0x71, 0x77, 0xef, 0xaf, 0x1a, 0x99, 0xc2, 0x46,
+    0xbd, 0x56, 0x8a, 0xcb, 0x4e, 0x80, 0xcf, 0x52, 0x2c, 0x6a, 0xea, 0x33, 0x6b, 0xdc, 0x1a, 0xdb,
+    0xa6, 0x99, 0x52, 0xea, 0xc1, 0x07, 0xb2, 0x8f, 0xea, 0x75, 0x1f, 0xbf, 0x37, 0xff, 0x00, 0xc3,
+    0x5f, 0x86, 0x80, 0x45, 0x54, 0xb3, 0xaf, 0xb8, 0x7a, 0xfc, 0xc5, 0xdf, 0x1e, 0x8e, 0x92, 0x61,
+    0x39, 0x94, 0xe8, 0x09, 0x9b, 0x53, 0x52, 0x1d, 0x07, 0x86, 0x1b, 0x89, 0xae, 0xa4, 0x37, 0x4b,
+    0xf2, 0x36, 0x94, 0x7d, 0xa6, 0x3a, 0x55, 0xa7, 0x19, 0x6e, 0x8b, 0xfc, 0xda, 0x41, 0xb4, 0x9f,
+    0x2e, 0xc6, 0xc0, 0x13, 0x26, 0xaf, 0x94, 0xf3, 0x41, 0x03, 0xb3, 0x89, 0x82, 0x50, 0xf5, 0x30,
+    0x37, 0x85, 0x21, 0xf3, 0x00, 0xfc, 0x42, 0xa3, 0x91, 0xa7, 0xe4, 0x55, 0xb4, 0xd8, 0x9d, 0x4a,
+    0x5b, 0x23, 0x92, 0x44, 0x6b, 0xb9, 0xd3, 0x0f, 0x66, 0x98, 0x5d, 0x5c, 0x7b, 0x1b, 0xb9, 0x5d,
+    0x45, 0xe6, 0x7a, 0xd1, 0xdc, 0xbd, 0x07, 0x23, 0x16, 0xc2, 0x2b, 0xd8, 0x5c, 0xa5, 0x3a, 0xfc,
+    0x48, 0xd4, 0xcf, 0x5c, 0x5d, 0x4e, 0x88, 0x78, 0x23, 0x14, 0x02, 0xaa, 0x91, 0x2d, 0xf0, 0xe8,
+    0x86, 0x03, 0x42, 0xb2, 0x21, 0x97, 0x21, 0x54, 0x19, 0x7a, 0x2a, 0x2f, 0xa8, 0xa8, 0x9f, 0x89,
+    0x11, 0x43, 0xbf, 0xb2, 0xd5, 0xa8, 0x6b, 0x71, 0x5c, 0x1e, 0xca, 0x07, 0x3e, 0xa2, 0x68, 0x0f,
+    0x3e, 0x77, 0x3b, 0xf9, 0x9e, 0xff, 0x0b, 0xcf, 0xd7, 0x13, 0xce, 0xdd, 0x3d, 0x37, 0x7e, 0x58,
+    0xf2, 0xfe, 0x4f, 0x53, 0xb2, 0xed, 0xe3, 0x19, 0xfd, 0x78, 0xe9, 0x47, 0xcd, 0x7f, 0x59, 0x8b,
+    0x64, 0x47, 0x1a, 0xcf, 0x78, 0x7a, 0xa7, 0x76, 0x33, 0x0e, 0x2f, 0x5c, 0x06, 0x9a, 0xa4, 0xd3,
+    0x65, 0x0a, 0x39, 0x72, 0x8e, 0x6d, 0x66, 0x8f, 0x9d, 0x94, 0x38, 0x31, 0xb0, 0x95, 0x9c, 0xa6,
+    0x42, 0x30, 0x66, 0xc0, 0x56, 0x2a, 0xa5, 0xa6, 0x10, 0x8c, 0x7b, 0x7a, 0xfc, 0xa4, 0xf6, 0x2c,
+    0x4f, 0xcb, 0x7b, 0x19, 0x15, 0x55, 0x66, 0x72, 0x27, 0xb2, 0x67, 0xb0, 0xdc, 0x49, 0x97, 0x4e,
+    0x25, 0x85, 0x5f, 0x5a, 0x20, 0xdc, 0x55, 0xa3, 0x49, 0x39, 0xc4, 0xae, 0x4a, 0x1b, 0x2f, 0xcf,
+    0xed, 0x44, 0x35, 0xe1, 0x2f, 0x1b, 0x99, 0xc0, 0xb5, 0x7b, 0xf1, 0xf4, 0xb1, 0x10, 0x4b, 0x07,
+    0xf7, 0xfe, 0x90, 0x0d, 0x4c, 0x1f, 0x35, 0xcb, 0x0e, 0xc7, 0x3c, 0x9a, 0xb2, 0x79, 0x82, 0x6b,
+    0x96, 0xf4, 0x46, 0x1d, 0xb6, 0x74, 0x32, 0x5d, 0xc9, 0xa2, 0x7a, 0x33, 0x16, 0x77, 0x9a, 0x82,
+    0x96, 0x39, 0xfe, 0x5d, 0xae, 0x00, 0x83, 0x70, 0xbd, 0x8b, 0x1b, 0x20, 0x71, 0x93, 0x4a, 0xc9,
+    0xae, 0xd5, 0x35, 0x8b, 0x12, 0xd5, 0xae, 0x4e, 0x55, 0xff, 0x67, 0x63, 0xa4, 0x59, 0x43, 0x6b,
+    0x44, 0x61, 0x12, 0x68, 0x53, 0xb2, 0xfe, 0x61, 0xad, 0xcf, 0xb5, 0x90, 0x88, 0x14, 0x50, 0x27,
+    0x95, 0x9f, 0xe4, 0xb1, 0x10, 0x94, 0xf7, 0xb2, 0x28, 0x89, 0x5d, 0x46, 0xb2, 0x55, 0x88, 0x04,
+    0xee, 0x5d, 0x85, 0x89, 0x72, 0xc4, 0x5f, 0xfb, 0x90, 0x47, 0xd8, 0xdf, 0x00, 0xe9, 0xa4, 0x19,
+    0x2e, 0x37, 0x40, 0xd0, 0x20, 0xae, 0x12, 0x79, 0x7d, 0x46, 0xa4, 0xf1, 0x33, 0x6f, 0xcb, 0x3a,
+    0xe2, 0xf5, 0x00, 0x62, 0x08, 0xae, 0xad, 0x0f, 0xd2, 0x33, 0x3a, 0x55, 0x59, 0xe5, 0xc8, 0x69,
+    0x85, 0x6f, 0x93, 0xaa, 0x26, 0x61, 0x55, 0xcf, 0x35, 0xd7, 0xdd, 0x6b, 0xbc, 0x91, 0xc2, 0x91,
+    0x28, 0x93, 0xb1, 0x85, 0x2b, 0x2b, 0x63, 0x7e, 0xf9, 0xed, 0x06, 0xe8, 0xf4, 0xf0, 0xb9, 0x6f,
+    0x73, 0x36, 0x48, 0x92, 0x6a, 0xa8, 0xf2, 0x41, 0x23, 0x34, 0xf5, 0x83, 0x63, 0x38, 0xb5, 0xd6,
+    0xfa, 0xfb, 0xef, 0x81, 0xbb, 0x5c, 0x9f, 0xb8, 0x42, 0xc4, 0x02, 0x7b, 0xff, 0x94, 0x62, 0x88,
+    0xcc, 0xf4, 0xf3, 0x05, 0xe9, 0x1a, 0x75, 0x71, 0x8d, 0x31, 0x1e, 0xd5, 0x69, 0xec, 0xca, 0x53,
+    0x1c, 0x6b, 0x0c, 0x33, 0xdd, 0x86, 0xef, 0x05, 0x74, 0x07, 0xd2, 0x4b, 0x6c, 0x89, 0x5d, 0xf1,
+    0xb6, 0xcc, 0x58, 0x4c, 0x9f, 0xbf, 0xb0, 0x18, 0xfc, 0xef, 0xa8, 0x62, 0xa2, 0x10, 0xf9, 0x70,
+    0xd0, 0xdc, 0x2f, 0xf2, 0xfa, 0xee, 0xd6, 0x35, 0xe2, 0xff, 0x88, 0x05, 0xff, 0x99, 0x2a, 0x21,
+    0xee, 0x75, 0xa4, 0x7d, 0x6a, 0x5e, 0xb4, 0xbf, 0x52, 0x39, 0xb8, 0x3b, 0x69, 0xcf, 0xe6, 0x45,
+    0x44, 0x27, 0x76, 0x64, 0xe9, 0xb4, 0xc9, 0xee, 0x11, 0x09, 0x86, 0x30, 0x79, 0x81, 0x49, 0x64,
+    0xe7, 0x84, 0x1d, 0xdb, 0xa9, 0x4f, 0x7c, 0x04, 0x05, 0xb6, 0xda, 0xed, 0xd4, 0xc2, 0x4d, 0xe4,
+    0x27, 0x24, 0xfd, 0x47, 0x95, 0xdf, 0x56, 0x51, 0x8d, 0xd2, 0x36, 0xd0, 0xae, 0x51, 0x08, 0x0c,
+    0xf9, 0x15, 0xbb, 0x17, 0xc2, 0xff, 0x82, 0x04, 0x8d, 0x3e, 0x91, 0x74, 0x79, 0xb8, 0xf9, 0x64,
+    0xf7, 0x3d, 0xba, 0x57, 0xec, 0x7a, 0xf7, 0x9d, 0x63, 0xfa, 0x2a, 0xe2, 0xb4, 0x95, 0x0c, 0x7f,
+    0x03, 0xfd, 0xef, 0xff, 0x4f, 0x33, 0x21, 0xce, 0x56, 0xfe, 0x77, 0xca, 0x28, 0x60, 0xdb, 0x74,
+    0xe1, 0xdb, 0x9f, 0xd5, 0x01, 0xc8, 0x08, 0xc8, 0xc8, 0x08, 0x20, 0x04, 0xb8, 0x1f, 0xdf, 0x0e,
+    0x07, 0xe0, 0xe0, 0x21, 0x1c, 0x9c, 0x2e, 0xc9, 0x1d, 0xa3, 0x38, 0x5c, 0x29, 0xf9, 0x60, 0x4a,
+    0x2a, 0x76, 0x35, 0xe3, 0x25, 0x5c, 0xa8, 0x98, 0xba, 0x49, 0x70, 0x35, 0x02, 0xb5, 0x78, 0x88,
+    0xa9, 0xa8, 0xaa, 0x73, 0x1e, 0xcd, 0x2e, 0x9b, 0xe4, 0xde, 0xaf, 0xdf, 0xda, 0x21, 0x89, 0xc0,
+    0xd9, 0x12, 0x4d, 0x81, 0x0d, 0x54, 0xac, 0x35, 0x13, 0xe1, 0xcb, 0xcb, 0xc8, 0x91, 0xb5, 0xd4,
+    0x05, 0xb1, 0xca, 0x0b, 0xbd, 0xc8, 0xb4, 0x64, 0x77, 0xf9, 0xcb, 0x93, 0x17, 0xdd, 0xb5, 0xa8,
+    0xdb, 0x37, 0xca, 0x65, 0x82, 0x27, 0xff, 0x60, 0xff, 0x8e, 0xad, 0x6c, 0x36, 0xd3, 0x0e, 0x6f,
+    0xbd, 0x59, 0x6c, 0x38, 0x78, 0x26, 0x74, 0xc2, 0x89, 0x9a, 0xc6, 0x29, 0xac, 0xe2, 0x3f, 0xf8,
+    0xce, 0x62, 0x70, 0xf8, 0xf1, 0x82, 0x2b, 0x5b, 0x86, 0x2b, 0xe7, 0xea, 0xc9, 0xe7, 0x41, 0xba,
+    0x7f, 0x0a, 0x66, 0xc3, 0x28, 0x17, 0xab, 0x5b, 0x0e, 0x8e, 0xc8, 0x95, 0x41, 0x73, 0xfa, 0xf9,
+    0xcb, 0x79, 0x45, 0x7f, 0xed, 0x1d, 0x3a, 0xe1, 0x0a, 0xcf, 0xc7, 0x14, 0x5a, 0x6f, 0xfb, 0x12,
+    0xcb, 0xe7, 0x56, 0x7b, 0x26, 0x1d, 0xf6, 0xcd, 0x36, 0xea, 0xbd, 0xd9, 0x8f, 0xfe, 0x2f, 0x57,
+    0xf0, 0xe8, 0xc2, 0x41, 0x1e, 0x9d, 0xb0, 0x3e, 0x5d, 0xd9, 0x6e, 0x5d, 0x33, 0xe1, 0x58, 0x7b,
+    0x74, 0xa5, 0xc4, 0x14, 0xbf, 0x43, 0xce, 0x8c, 0x97, 0x8f, 0x92, 0x9b, 0x18, 0x92, 0x17, 0xcf,
+    0x2a, 0x8c, 0x89, 0x57, 0x4e, 0x3e, 0xd6, 0xb9, 0xb8, 0x24, 0x73, 0xf1, 0x6c, 0xdb, 0x12, 0x97,
+    0xc5, 0xd2, 0xff, 0x54, 0x2e, 0x82, 0x43, 0x01, 0xd9, 0xa8, 0x77, 0xf7, 0x06, 0x90, 0xbc, 0x38,
+    0x43, 0x14, 0x3a, 0x38, 0x53, 0x66, 0x75, 0x32, 0x9e, 0xde, 0x71, 0x2e, 0x58, 0xc6, 0x55, 0x20,
+    0x25, 0xe7, 0x16, 0x98, 0xb1, 0x3e, 0xcd, 0xb9, 0x76, 0x9a, 0x3a, 0x6a, 0xc8, 0x84, 0x43, 0x12,
+    0xdb, 0x32, 0x3f, 0x3f, 0x81, 0x2e, 0xd8, 0xcc, 0xef, 0xac, 0x4c, 0x89, 0x7c, 0x03, 0xd5, 0x91,
+    0x86, 0x79, 0x22, 0xc7, 0x6b, 0x98, 0xc7, 0xbf, 0xc5, 0x62, 0xc9, 0x1d, 0x9d, 0x1b, 0x25, 0x59,
+    0x20, 0x63, 0xe1, 0x3a, 0x1a, 0xf3, 0x0b, 0xfc, 0x28, 0xfc, 0xa3, 0xf5, 0x85, 0x90, 0xc5, 0x4b,
+    0xdf, 0xb7, 0x4a, 0xa0, 0x17, 0x67, 0x59, 0xf5, 0x09, 0x2a, 0x9a, 0x0f, 0x27, 0xa9, 0x91, 0xdf,
+    0xb7, 0x50, 0x5b, 0x55, 0x67, 0x53, 0x65, 0xd7, 0x35, 0xbb, 0xf8, 0xe4, 0xeb, 0x49, 0xbe, 0x3c,
+    0xf7, 0x3c, 0xdc, 0x94, 0x9e, 0x2b, 0x61, 0xf9, 0xdc, 0x51, 0x72, 0x29, 0x45, 0xdf, 0xc4, 0x83,
+    0x2a, 0x4a, 0x36, 0xf7, 0x5e, 0xf8, 0x5a, 0x4c, 0xc5, 0xef, 0x5a, 0xcd, 0x0c, 0x05, 0x01, 0xcd,
+    0x57, 0x96, 0x7d, 0x15, 0x47, 0x4a, 0x28, 0x3b, 0x52, 0xfe, 0x2b, 0x5b, 0xad, 0x17, 0x1e, 0x69,
+    0xa0, 0x03, 0xe7, 0x1e, 0xfd, 0xa8, 0xc8, 0x83, 0xc9, 0xd7, 0xd4, 0x56, 0xbb, 0x22, 0xf0, 0x63,
+    0xe8, 0xeb, 0xd1, 0x6d, 0x46, 0x47, 0x9f, 0xd2, 0x09, 0xfd, 0x0d, 0xc4, 0x29, 0x4a, 0xb8, 0xee,
+    0x7f, 0x6d, 0xc8, 0x5e, 0x1d, 0xaa, 0x19, 0xaf, 0xdb, 0xbf, 0x08, 0xcb, 0x59, 0x1e, 0x13, 0x37,
+    0xb7, 0xe7, 0x42, 0x65, 0x98, 0xf9, 0x76, 0xec, 0x2b, 0x63, 0x9a, 0xe9, 0xf1, 0x53, 0xa1, 0x5c,
+    0x32, 0x7f, 0xc8, 0x92, 0x8a, 0xe7, 0x65, 0xf9, 0xde, 0xb2, 0x9b, 0xd8, 0x8e, 0x2b, 0x0a, 0x5d,
+    0x42, 0x3f, 0x93, 0x09, 0x10, 0xac, 0x62, 0xcd, 0x4d, 0x5e, 0xd2, 0xf2, 0x2e, 0xb9, 0xa6, 0x2c,
+    0x45, 0xb5, 0xc7, 0x0b, 0x24, 0x8f, 0x31, 0x3b, 0x5b, 0x54, 0x3b, 0x2e, 0x85, 0x6e, 0xc9, 0x9d,
+    0x26, 0xb0, 0xde, 0xe6, 0x22, 0x3a, 0x9c, 0xfb, 0xfd, 0x41, 0x74, 0x68, 0xe2, 0x19, 0x1a, 0x41,
+    0x57, 0xfc, 0x27, 0x4f, 0x31, 0xa6, 0x5c, 0x2e, 0x3f, 0x43, 0x1d, 0x1b, 0x63, 0xb2, 0x43, 0xfb,
+    0x7b, 0xd5, 0x6c, 0xce, 0x37, 0x00, 0xa5, 0xf8, 0x74, 0xf2, 0x5b, 0x96, 0xf5, 0x80, 0x0e, 0xab,
+    0x4f, 0x67, 0xc9, 0x57, 0x02, 0xd2, 0x9f, 0x43, 0xbf, 0x3c, 0x28, 0x0b, 0xf2, 0x1c, 0xad, 0x2d,
+    0x11, 0x84, 0x50, 0x23, 0x47, 0xfa, 0x60, 0x18, 0xcf, 0x38, 0x9f, 0x32, 0x9a, 0xa7, 0xb2, 0xcf,
+    0x03, 0xea, 0xb1, 0x05, 0x4e, 0xa9, 0xa0, 0xb9, 0xcf, 0xfe, 0x3f, 0x03, 0xfd, 0x62, 0xd7, 0x90,
+    0x22, 0xd1, 0xb5, 0x4e, 0xed, 0x79, 0xc1, 0xe4, 0xc2, 0xa1, 0xd8, 0x8b, 0x3a, 0xcf, 0x2b, 0x2a,
+    0xff, 0xe6, 0x2c, 0xb9, 0xd1, 0x81, 0x8f, 0xd4, 0x3e, 0xdf, 0xf6, 0x50, 0xe4, 0x67, 0xac, 0x92,
+    0x8e, 0xae, 0xb0, 0xc5, 0x3e, 0x79, 0xbe, 0x76, 0x0c, 0xd5, 0x6a, 0xce, 0xb2, 0xf0, 0x65, 0x18,
+    0x12, 0xd0, 0x7a, 0xf0, 0x39, 0x83, 0xda, 0xa7, 0xa5, 0x88, 0x2b, 0xb1, 0x52, 0xea, 0x6e, 0xd9,
+    0x07, 0x12, 0x65, 0x96, 0x8d, 0x3c, 0x0a, 0xcb, 0x15, 0xbc, 0x40, 0x40, 0x60, 0x92, 0x76, 0x4d,
+    0xfa, 0x52, 0x7f, 0x45, 0xfe, 0x38, 0x19, 0x0d, 0xe1, 0x79, 0x65, 0x53, 0xf6, 0xd9, 0x65, 0xc9,
+    0x8f, 0x66, 0x0e, 0x21, 0xb4, 0x24, 0x64, 0x6b, 0xd9, 0xab, 0x3b, 0xbf, 0xaa, 0x09, 0x8f, 0xb4,
+    0xad, 0x5f, 0xd7, 0xae, 0x88, 0x71, 0xd5, 0xdb, 0xb7, 0x0a, 0x61, 0x3d, 0x7f, 0x97, 0x34, 0x5f,
+    0x7c, 0x03, 0xf4, 0x1f, 0xab, 0xe9, 0x7b, 0xa6, 0x79, 0x41, 0x61, 0x06, 0xc8, 0xfa, 0x8a, 0x0a,
+    0x35, 0x3f, 0xc4, 0x3f, 0x0f, 0xdc, 0x4a, 0x6b, 0x18, 0xb3, 0x79, 0x5b, 0x23, 0x8f, 0x79, 0xd7,
+    0xa2, 0x7d, 0x8c, 0x4c, 0xbc, 0x9c, 0x06, 0x4f, 0xe3, 0x13, 0xbd, 0x7d, 0xf5, 0x60, 0xc9, 0x1a,
+    0x9e, 0x9b, 0xbd, 0xe4, 0x56, 0x9a, 0x9a, 0x78, 0xfc, 0x0e, 0x57, 0xc3, 0xf8, 0xc7, 0x13, 0xed,
+    0xe6, 0x3c, 0xbb, 0xfe, 0xab, 0xe2, 0x71, 0x15, 0x27, 0x95, 0xc6, 0x74, 0xa3, 0x59, 0x73, 0xe2,
+    0x2c, 0xee, 0x3b, 0x65, 0x9c, 0x6d, 0x9b, 0x56, 0x4a, 0x33, 0x74, 0x32, 0x5a, 0x14, 0x38, 0xd1,
+    0x42, 0x8b, 0xea, 0x07, 0xcb, 0x3a, 0x1a, 0x2d, 0x8f, 0xfd, 0x88, 0xca, 0x8e, 0xc3, 0x6f, 0x00,
+    0x99, 0xa3, 0xe2, 0xa6, 0x84, 0x51, 0xbc, 0xda, 0x53, 0xf2, 0x50, 0x3c, 0x37, 0xb4, 0x07, 0xca,
+    0x63, 0x85, 0x1f, 0x6e, 0x80, 0xea, 0x3c, 0x34, 0x23, 0x73, 0x7b, 0x21, 0x7b, 0x17, 0x8e, 0xc4,
+    0x50, 0x8f, 0x19, 0x3f, 0x7e, 0x11, 0xb5, 0x2b, 0x57, 0x65, 0x48, 0xfd, 0x0d, 0x40, 0xa5, 0x5c,
+    0xa3, 0x26, 0x3c, 0xaf, 0x4c, 0xb3, 0xd6, 0x6b, 0x9d, 0xdc, 0x76, 0x8c, 0x3b, 0xdf, 0x3d, 0xce,
+    0x54, 0x52, 0x71, 0x03, 0xf8, 0xe1, 0xd3, 0x79, 0x5e, 0xc5, 0xa3, 0x74, 0xde, 0x7b, 0xf3, 0x5c,
+    0xc6, 0xfc, 0x49, 0x2d, 0x22, 0x68, 0x39, 0xa7, 0xad, 0xf9, 0x22, 0x23, 0x6c, 0x20, 0x23, 0x27,
+    0x00, 0x3d, 0x74, 0x6f, 0x5b, 0x76, 0x67, 0xf5, 0x81, 0xb8, 0xd3, 0x99, 0x28, 0x19, 0x38, 0xf9,
+    0x40, 0x2d, 0xc6, 0x5b, 0xa4, 0x2b, 0x84, 0x1f, 0xbe, 0xd0, 0x29, 0x0a, 0x32, 0x37, 0xaf, 0xe5,
+    0xcd, 0x7e, 0x87, 0xae, 0x99, 0x5f, 0x5e, 0xdf, 0x7a, 0x07, 0x35, 0x6d, 0x9f, 0x91, 0xee, 0xed,
+    0xcb, 0xa2, 0x76, 0x7c, 0x76, 0x72, 0x3c, 0xb3, 0x71, 0x99, 0xfe, 0x65, 0xbc, 0x93, 0xe1, 0x2f,
+    0x3f, 0xa3, 0x38, 0xdf, 0x06, 0x93, 0x6c, 0x21, 0x3b, 0xbd, 0xf5, 0x06, 0xc8, 0x8e, 0x80, 0x5c,
+    0x46, 0xd3, 0x2a, 0xab, 0x0c, 0xca, 0x48, 0x00, 0xd7, 0xa2, 0x21, 0x6d, 0x2a, 0x57, 0x35, 0x27,
+    0x56, 0x58, 0xb3, 0x8e, 0xa1, 0xe7, 0xa3, 0xb3, 0xd1, 0x43, 0x4d, 0xd6, 0x06, 0xcc, 0x4e, 0x34,
+    0x31, 0x09, 0xd2, 0x56, 0xd2, 0x43, 0xf8, 0x99, 0xfc, 0x54, 0x17, 0xd7, 0x3e, 0x0f, 0x5d, 0xd9,
+    0x0a, 0x1c, 0xf7, 0x30, 0x4b, 0xf2, 0xc1, 0x7e, 0xd6, 0x1d, 0xbe, 0x6c, 0x37, 0xc0, 0x23, 0xb9,
+    0xef, 0x1b, 0x45, 0x8e, 0xa4, 0xd9, 0x15, 0x5e, 0xab, 0x47, 0x52, 0xcf, 0x7c, 0xdd, 0x9a, 0x32,
+    0xad, 0xf2, 0x14, 0x81, 0x5c, 0xe4, 0xec, 0xca, 0x26, 0x01, 0x3c, 0xa4, 0xc4, 0xd5, 0xed, 0x2f,
+    0xb3, 0x4f, 0xb6, 0x45, 0x56, 0x26, 0x2a, 0xfa, 0xa2, 0x46, 0xb9, 0xe9, 0xc6, 0xf4, 0x05, 0x7d,
+    0x6e, 0xbb, 0xaf, 0xee, 0x7e, 0xa2, 0x76, 0xba, 0x0e, 0xc3, 0x41, 0xe3, 0x92, 0x0a, 0xb3, 0xb7,
+    0x3b, 0xa3, 0x84, 0x0b, 0xbb, 0x3f, 0xda, 0xce, 0xf9, 0x81, 0x97, 0x3b, 0x1d, 0x4e, 0x01, 0x42,
+    0x7d, 0x24, 0x97, 0xa1, 0x65, 0xca, 0x22, 0x6c, 0xc8, 0xf9, 0x60, 0x61, 0x1b, 0x27, 0x15, 0xe4,
+    0x33, 0x30, 0x1c, 0xc2, 0x0d, 0x00, 0xaa, 0x7d, 0x86, 0x61, 0x5e, 0x95, 0x5c, 0x2b, 0x6b, 0xa0,
+    0x4c, 0xfb, 0x61, 0x8f, 0x11, 0x10, 0x36, 0xd6, 0x60, 0x5d, 0xd5, 0x54, 0xf6, 0xd4, 0x90, 0x08,
+    0x66, 0x34, 0x16, 0x64, 0xe8, 0x2c, 0xce, 0xc9, 0xe8, 0x2a, 0xdb, 0xc9, 0xe9, 0xff, 0x09, 0xb1,
+    0x92, 0x6d, 0x8e, 0xc3, 0x8a, 0x0f, 0x03, 0x87, 0x25, 0x64, 0xfa, 0x65, 0x35, 0xe0, 0x0f, 0x34,
+    0x12, 0x25, 0x54, 0xfa, 0x51, 0x1f, 0x96, 0x5c, 0x7f, 0xf2, 0x5d, 0x0c, 0x15, 0xa3, 0xc0, 0xeb,
+    0x11, 0xc4, 0x9a, 0x15, 0xa3, 0x5e, 0x82, 0xb5, 0x7e, 0x30, 0xf6, 0xc3, 0xbf, 0xd9, 0x51, 0x72,
+    0x7b, 0x79, 0xf6, 0xdd, 0xfb, 0x43, 0x69, 0x70, 0x56, 0x5c, 0xf7, 0xbc, 0x79, 0xfb, 0xeb, 0x1f,
+    0xc7, 0x55, 0xc0, 0x4e, 0x34, 0x99, 0x72, 0xa7, 0xaf, 0x5e, 0xb5, 0x59, 0xce, 0x08, 0xbc, 0xed,
+    0xbf, 0xea, 0x23, 0xdd, 0x6e, 0xb2, 0xba, 0x5b, 0x01, 0xf3, 0x00, 0xc3, 0xfa, 0x95, 0xcc, 0xd1,
+    0x90, 0xc2, 0xf1, 0xa5, 0xdb, 0x2f, 0xbf, 0xb2, 0xb6, 0x2d, 0x05, 0xe4, 0x5c, 0x58, 0xec, 0xfc,
+    0x05, 0x2c, 0x18, 0x61, 0x39, 0xa9, 0xb5, 0xd2, 0xb5, 0x5e, 0xd1, 0x13, 0x3d, 0xea, 0x51, 0x2e,
+    0x52, 0xe3, 0x73, 0xd1, 0x5a, 0xca, 0xf7, 0xf4, 0xe5, 0x0d, 0x50, 0x2b, 0x53, 0xf5, 0x38, 0x9c,
+    0x5f, 0xce, 0xa7, 0xd0, 0x53, 0x8b, 0x1c, 0x84, 0xf2, 0x4c, 0x09, 0x92, 0xdd, 0x56, 0x26, 0x9e,
+    0xb3, 0xc6, 0x0d, 0x7e, 0x2a, 0x5c, 0x1f, 0x2c, 0xdd, 0x0f, 0x3f, 0x2d, 0xf7, 0xae, 0xa5, 0xf0,
+    0x4b, 0xeb, 0x68, 0xd7, 0xfd, 0x36, 0xc9, 0x81, 0x33, 0xf2, 0x18, 0x6c, 0x83, 0x4c, 0x6e, 0x43,
+    0xb2, 0x8f, 0xf2, 0xc2, 0x43, 0xc5, 0xba, 0xd7, 0x08, 0x9e, 0xe5, 0xe8, 0x18, 0xf6, 0xa7, 0x8d,
+    0xef, 0xc2, 0x37, 0x97, 0xb9, 0xa2, 0x2e, 0x44, 0xdc, 0x61, 0x20, 0x07, 0x8b, 0x50, 0xc5, 0xc6,
+    0x8c, 0xf5, 0xb4, 0xad, 0xb3, 0x6f, 0xb1, 0x3b, 0x67, 0xeb, 0x4c, 0x49, 0xa3, 0x24, 0x37, 0xc0,
+    0x7a, 0xee, 0xda, 0xf3, 0x0c, 0x19, 0x9d, 0x87, 0xce, 0x28, 0x01, 0x73, 0x14, 0x0f, 0x72, 0x33,
+    0x50, 0x3d, 0x26, 0xf6, 0x4f, 0x46, 0x7e, 0xb8, 0x9a, 0xbc, 0x67, 0x5c, 0x7a, 0x48, 0xe8, 0xe1,
+    0x3e, 0xe1, 0x56, 0x4b, 0xe5, 0xc6, 0xe9, 0x11, 0xbe, 0xc5, 0x20, 0xee, 0x03, 0x21, 0x50, 0x0e,
+    0xbd, 0x90, 0x75, 0x77, 0xce, 0x67, 0x21, 0x25, 0x32, 0x12, 0x0a, 0x82, 0x3b, 0x90, 0x63, 0xfb,
+    0xd9, 0x47, 0xed, 0x5b, 0xcc, 0x65, 0x7a, 0x35, 0x33, 0x56, 0x3b, 0xa8, 0x3f, 0xa6, 0x2f, 0x21,
+    0x00, 0xe6, 0x3a, 0xfc, 0xa3, 0xfc, 0xc8, 0x3a, 0x5c, 0xa2, 0xe3, 0xea, 0x2b, 0x81, 0x11, 0xf2,
+    0x77, 0xca, 0xf8, 0x17, 0x3d, 0x9f, 0x78, 0x3a, 0x9b, 0x0f, 0x3d, 0x37, 0xa3, 0x91, 0x10, 0xed,
+    0x2e, 0xee, 0x0a, 0x6c, 0x8c, 0xca, 0x2a, 0xb9, 0xbd, 0x9c, 0x4e, 0xc8, 0xae, 0xda, 0xde, 0x0f,
+    0x4e, 0x88, 0x4f, 0x58, 0x92, 0xf1, 0x94, 0xd9, 0x10, 0x79, 0x65, 0xf3, 0xb0, 0x7e, 0x25, 0xef,
+    0xa7, 0x16, 0x88, 0xff, 0x0d, 0x80, 0x7e, 0x78, 0x03, 0xcc, 0xb2, 0x7a, 0xff, 0x9c, 0x15, 0x2f,
+    0x74, 0x49, 0xc8, 0x30, 0xf1, 0x3c, 0xf1, 0x7f, 0x33, 0x9f, 0x1f, 0xaa, 0x92, 0xbd, 0x59, 0x40,
+    0x3e, 0x7a, 0xb9, 0x90, 0x33, 0x4a, 0xe0, 0x2e, 0xdd, 0xb9, 0xeb, 0x28, 0x8b, 0x9d, 0xaf, 0x7d,
+    0xe5, 0xfb, 0xd1, 0x12, 0x4c, 0x76, 0xe4, 0xce, 0x90, 0xd2, 0x3c, 0xa6, 0x6b, 0x6d, 0x75, 0x8a,
+    0x40, 0x74, 0x5c, 0x05, 0x58, 0x6f, 0x1e, 0xda, 0x77, 0x6f, 0xa5, 0xb1, 0x7c, 0xa6, 0xec, 0xb9,
+    0x54, 0x42, 0x79, 0xc3, 0x1d, 0x15, 0x4c, 0x76, 0xf5, 0x85, 0x80, 0xfd, 0x05, 0x34, 0xd3, 0x57,
+    0x6e, 0x58, 0x68, 0x9b, 0x2b, 0xff, 0x18, 0x90, 0xc3, 0xf3, 0x48, 0xf2, 0x6d, 0x47, 0x40, 0x13,
+    0x10, 0xc2, 0x8a, 0x1e, 0x32, 0xb6, 0xde, 0x25, 0x63, 0x8e, 0x7e, 0x69, 0x62, 0xb5, 0x47, 0x06,
+    0x45, 0xde, 0xe2, 0x0a, 0x24, 0x74, 0x2f, 0x07, 0xcc, 0x02, 0x72, 0xa9, 0x39, 0xfb, 0x68, 0xf3,
+    0x53, 0x34, 0x15, 0x0b, 0x1a, 0x6b, 0xc7, 0x6f, 0x80, 0xb6, 0xbd, 0xed, 0x5b, 0xa5, 0x94, 0xb5,
+    0x44, 0x37, 0x00, 0xae, 0x8c, 0xfe, 0xdc, 0xd9, 0x15, 0xe1, 0x56, 0xf5, 0x0b, 0x98, 0xaf, 0x9e,
+    0xd4, 0x51, 0xc7, 0x3e, 0x3f, 0x5a, 0x9f, 0x8d, 0x9f, 0x65, 0x91, 0x78, 0x4d, 0x7c, 0x3e, 0x12,
+    0x4a, 0x3e, 0x05, 0x60, 0x0a, 0xa5, 0x1a, 0xb5, 0xa3, 0x52, 0x25, 0x8c, 0x61, 0x7b, 0x01, 0xc1,
+    0x32, 0x8f, 0x4a, 0x6c, 0x78, 0x08, 0xde, 0xc2, 0x50, 0x16, 0x96, 0x21, 0xa5, 0x1b, 0x06, 0x6d,
+    0x22, 0xf9, 0xb9, 0x10, 0xb2, 0x8e, 0xd1, 0x8b, 0x47, 0xaf, 0xf7, 0xb3, 0x57, 0x19, 0x42, 0x5f,
+    0xed, 0x33, 0x6d, 0xc4, 0x47, 0x2e, 0x4e, 0x4c, 0x67, 0x4e, 0x11, 0x24, 0x42, 0x46, 0xae, 0x82,
+    0xc6, 0xeb, 0x0e, 0xee, 0xca, 0x6f, 0xc0, 0x27, 0x46, 0x8a, 0xf9, 0x02, 0x34, 0x31, 0x02, 0xb2,
+    0x42, 0x8b, 0x70, 0x88, 0x64, 0xd9, 0x11, 0xfd, 0x33, 0xe8, 0x91, 0x31, 0x96, 0xd3, 0x30, 0x00,
+    0xf6, 0xff, 0xfa, 0x03, 0xf2, 0x60, 0x60, 0xf2, 0xbe, 0x5e, 0xfa, 0xc3, 0x48, 0x71, 0xf6, 0x97,
+    0x0b, 0x07, 0x76, 0x7f, 0x81, 0x77, 0x5b, 0x8a, 0x0a, 0x01, 0xf1, 0x79, 0x48, 0x1a, 0xaf, 0x0f,
+    0xaf, 0xa5, 0x84, 0x25, 0x2e, 0x13, 0x2f, 0x24, 0x7e, 0x4e, 0x82, 0xfd, 0x44, 0x63, 0x07, 0x8b,
+    0xa3, 0xf2, 0x55, 0x8f, 0x83, 0x2a, 0x50, 0x79, 0xd1, 0xfe, 0x5b, 0x4e, 0x05, 0x55, 0x7d, 0x9f,
+    0x54, 0xfa, 0x51, 0x1e, 0x5e, 0x65, 0x5b, 0x98, 0xdc, 0x05, 0x69, 0xe3, 0x38, 0xe1, 0xff, 0xcf,
+    0x9d, 0x0c, 0x94, 0xa3, 0xb7, 0x1c, 0xa3, 0x1d, 0x1b, 0x7e, 0xa2, 0xa6, 0xab, 0xcd, 0x5d, 0xbb,
+    0xa6, 0x18, 0xfc, 0x4a, 0x7a, 0x18, 0x9e, 0xeb, 0xef, 0x87, 0xdb, 0xf6, 0xff, 0xef, 0x24, 0x09,
+    0x84, 0xe5, 0xf5, 0x03, 0xf0, 0xb0, 0x9d, 0xff, 0xb9, 0x97, 0xb5, 0xff, 0x0e, 0xb3, 0xd2, 0x2c,
+    0x1d, 0xb0, 0x27, 0x2b, 0x32, 0x12, 0x54, 0x8e, 0x69, 0xf6, 0x7a, 0x8e, 0xef, 0xb5, 0xc7, 0xff,
+    0x5b, 0x58, 0xd4, 0x49, 0xc4, 0xcd, 0xaf, 0x24, 0xbf, 0x2b, 0xf5, 0x07, 0xfb, 0x77, 0x6c, 0x3e,
+    0xd8, 0x4a, 0x8e, 0xb9, 0xa0, 0xa6, 0x0d, 0xb6, 0x9f, 0xbc, 0x07, 0xbe, 0xfd, 0x98, 0x17, 0xf9,
+    0xf6, 0x33, 0x5f, 0xd0, 0x9f, 0x1e, 0xc1, 0x09, 0xa1, 0xcc, 0xdb, 0x05, 0xb3, 0xab, 0x99, 0x74,
+    0x8c, 0xee, 0x89, 0x19, 0x3b, 0x07, 0x43, 0x93, 0xab, 0x45, 0x55, 0x97, 0xfe, 0xfc, 0xa0, 0x16,
+    0x11, 0x4a, 0x90, 0x71, 0x33, 0xfa, 0xdb, 0xac, 0xfd, 0xcd, 0x33, 0x1c, 0x1a, 0xd9, 0x64, 0x2a,
+    0xc9, 0xe8, 0x7f, 0xe4, 0x04, 0x0d, 0x0f, 0xd9, 0x65, 0xd9, 0xe6, 0x1c, 0x52, 0xf0, 0x15, 0xcc,
+    0xce, 0x37, 0xf8, 0xb4, 0x7a, 0x84, 0x33, 0x3f, 0x7c, 0xb7, 0xf4, 0xe9, 0xb1, 0xb7, 0x90, 0x64,
+    0xfd, 0xeb, 0xbe, 0x0d, 0xda, 0x96, 0x6c, 0x15, 0x35, 0xe6, 0xcd, 0x7d, 0x9f, 0x68, 0xc7, 0x47,
+    0x8f, 0x27, 0xfe, 0xf1, 0x4a, 0xa7, 0xa0, 0x47, 0x73, 0x9f, 0x31, 0x4c, 0x46, 0x47, 0x5d, 0x2d,
+    0xd6, 0x06, 0x86, 0xd2, 0x9e, 0xb1, 0x72, 0x1b, 0xd9, 0x35, 0x7f, 0xf2, 0xae, 0x39, 0xf8, 0x6f,
+    0xbf, 0x54, 0xfd, 0x34, 0x1a, 0x2a, 0x4a, 0x8c, 0x9d, 0x00, 0x33, 0x7a, 0x5f, 0x9c, 0xbd, 0xe3,
+    0x11, 0x74, 0xfd, 0x4b, 0x94, 0xa9, 0x38, 0x34, 0x9f, 0x7d, 0xd1, 0x13, 0xa1, 0x17, 0xe3, 0x94,
+    0xac, 0x83, 0xe7, 0xd8, 0x75, 0x42, 0x21, 0xc0, 0x64, 0x38, 0x44, 0x6e, 0x59, 0xef, 0x92, 0x61,
+    0x83, 0xe1, 0x34, 0x39, 0xe7, 0x1d, 0x06, 0x68, 0xe4, 0xee, 0x2e, 0x3c, 0x10, 0x78, 0x11, 0x94,
+    0x11, 0x45, 0x94, 0x12, 0xa2, 0x17, 0x35, 0x8f, 0x9b, 0x34, 0x2f, 0x8f, 0xb1, 0x28, 0x8a, 0x10,
+    0x44, 0xd9, 0x2f, 0x3a, 0xca, 0xc3, 0xcb, 0xb9, 0x27, 0x91, 0x40, 0x29, 0xb9, 0xf8, 0xac, 0xe9,
+    0xc1, 0xd8, 0xc0, 0xe0, 0xe7, 0x81, 0x52, 0xb3, 0xcb, 0x6f, 0x1b, 0xb4, 0x6d, 0x1c, 0x39, 0xa1,
+    0x2b, 0x21, 0x6c, 0xf7, 0xe0, 0x97, 0x7b, 0x71, 0xf2, 0x25, 0xe7, 0x41, 0xd1, 0x24, 0x42, 0xf9,
+    0x8a, 0xd6, 0xec, 0xa4, 0xf0, 0x13, 0x77, 0xcd, 0x89, 0xd8, 0x9a, 0xc4, 0x3c, 0xb1, 0x8f, 0x3f,
+    0xca, 0x5b, 0x4f, 0x1b, 0xc7, 0x98, 0x29, 0xc4, 0x60, 0xd2, 0x5c, 0x83, 0x09, 0x04, 0x16, 0x6f,
+    0xdb, 0x4b, 0x15, 0x1f, 0x4d, 0xb6, 0x74, 0x6e, 0x8a, 0xd2, 0xe7, 0x60, 0xfa, 0xe0, 0x51, 0x9d,
+    0xa2, 0xbe, 0x38, 0x8c, 0x33, 0x4d, 0x45, 0x80, 0xe0, 0x4c, 0x94, 0x9c, 0x34, 0x87, 0x32, 0xa5,
+    0x07, 0xe8, 0x53, 0x6c, 0x21, 0x48, 0x91, 0x45, 0x9d, 0x32, 0xb3, 0x59, 0xb8, 0xc5, 0x6c, 0x53,
+    0x6c, 0xa0, 0x24, 0x2a, 0x21, 0xe5, 0x38, 0xa8, 0xda, 0x65, 0x65, 0x49, 0x12, 0xa5, 0x05, 0x2a,
+    0x94, 0xb6, 0x7e, 0xa0, 0x5b, 0x1b, 0x10, 0x09, 0xe2, 0x75, 0x4d, 0x41, 0x0f, 0x3e, 0x95, 0x6f,
+    0x99, 0x0c, 0xf6, 0x06, 0xe5, 0x09, 0xc8, 0x4a, 0xb0, 0x55, 0x49, 0x03, 0xdd, 0x9b, 0xac, 0x8c,
+    0x94, 0x56, 0xbd, 0xaf, 0x79, 0xe7, 0xc0, 0xba, 0x51, 0x73, 0xd1, 0x24, 0x34, 0xa2, 0x4c, 0xc4,
+    0x84, 0x1e, 0x7c, 0xe6, 0xf9, 0x04, 0x71, 0xb1, 0x9c, 0xf1, 0xe3, 0x3c, 0x8f, 0x90, 0x4e, 0x57,
+    0x96, 0xb0, 0xc1, 0x35, 0x6d, 0x0e, 0x84, 0xe2, 0xe3, 0x83, 0x90, 0x7c, 0x82, 0xfb, 0x6e, 0x08,
+    0x5f, 0x59, 0xda, 0x83, 0x44, 0xe6, 0x7a, 0xe9, 0xb8, 0x1a, 0x72, 0xc7, 0x95, 0x53, 0xc7, 0xab,
+    0xdf, 0xf5, 0xa0, 0x17, 0x37, 0x09, 0x52, 0x26, 0x6a, 0xaa, 0x92, 0x37, 0x61, 0x0a, 0x7f, 0x86,
+    0xa6, 0x8f, 0x2d, 0x87, 0x2a, 0xf1, 0x6b, 0x28, 0xf7, 0xa0, 0xf3, 0xa3, 0x6f, 0x2f, 0xb3, 0xfa,
+    0xd5, 0x88, 0xe1, 0xdc, 0x4b, 0x13, 0xcb, 0xd8, 0x11, 0x56, 0x13, 0xf5, 0x59, 0xe7, 0xba, 0x70,
+    0xaa, 0x7c, 0xdd, 0x88, 0x04, 0x8a, 0x0d, 0x2c, 0x3d, 0x56, 0x30, 0x46, 0xf1, 0x0a, 0x7f, 0x72,
+    0xe1, 0x94, 0xf3, 0x0e, 0xae, 0xc7, 0x0f, 0x3b, 0xeb, 0x08, 0x67, 0x21, 0x43, 0xa5, 0x63, 0xf7,
+    0x8e, 0x89, 0x59, 0x29, 0xc2, 0x2e, 0xe3, 0xba, 0x1a, 0x31, 0x02, 0x1b, 0xaf, 0xb3, 0x63, 0x97,
+    0x0f, 0xaf, 0x42, 0x7b, 0xd0, 0xb9, 0x44, 0x1c, 0xc0, 0x26, 0x61, 0x25, 0x4e, 0x61, 0x43, 0x67,
+    0x25, 0x53, 0xf2, 0x58, 0x90, 0x83, 0x9b, 0x6d, 0xa9, 0xf3, 0x3e, 0xc1, 0x81, 0xef, 0xa9, 0xa6,
+    0x65, 0x29, 0x20, 0x21, 0x90, 0xd4, 0x19, 0x2c, 0xbe, 0xc8, 0xd5, 0xeb, 0xe6, 0x7e, 0xbc, 0x5f,
+    0x25, 0x59, 0x85, 0xb1, 0x6e, 0xe8, 0xe7, 0x90, 0x49, 0x97, 0xfe, 0x94, 0xa9, 0x8f, 0x22, 0x0a,
+    0x71, 0x7b, 0x43, 0x6c, 0xf5, 0x73, 0x66, 0x55, 0xfd, 0x1b, 0x4a, 0x0a, 0xa7, 0x98, 0x92, 0x65,
+    0x8d, 0x09, 0x05, 0x3b, 0xd0, 0x37, 0xec, 0xfc, 0xb8, 0x80, 0xa4, 0xe5, 0xf5, 0x76, 0x6f, 0xe1,
+    0xbe, 0x54, 0xbc, 0x79, 0x97, 0xfb, 0x4b, 0xa8, 0x49, 0x99, 0x1f, 0x33, 0xba, 0xe7, 0x37, 0xe1,
+    0xa9, 0xa6, 0x39, 0xcf, 0x3f, 0xd2, 0x20, 0x39, 0xa1, 0xa0, 0x50, 0x7d, 0x26, 0xc1, 0xe3, 0xe7,
+    0x45, 0xef, 0x8a, 0x3a, 0x7f, 0x20, 0xd5, 0xdb, 0xb4, 0x18, 0xe1, 0x5c, 0xa9, 0xd0, 0xca, 0xd6,
+    0x6b, 0xac, 0xd2, 0x04, 0xff, 0x11, 0xb6, 0x7f, 0x60, 0x86, 0x37, 0xbd, 0x47, 0x73, 0x2a, 0x1a,
+    0x89, 0x51, 0xcc, 0xa4, 0x2d, 0x7b, 0xf0, 0xaa, 0x2a, 0x79, 0x75, 0xc9, 0xd8, 0x64, 0xcb, 0xe8,
+    0xee, 0x1a, 0x8f, 0xaa, 0xe6, 0xb1, 0x2a, 0xbc, 0x5e, 0xd0, 0x84, 0x3f, 0xa2, 0x90, 0x58, 0x95,
+    0x74, 0xfb, 0x61, 0xdb, 0xf7, 0x6e, 0xd9, 0x28, 0x39, 0xde, 0xa5, 0x43, 0xb0, 0x1d, 0x97, 0x54,
+    0x34, 0xc9, 0xeb, 0x16, 0xf6, 0x06, 0x33, 0x45, 0xa7, 0xc8, 0x45, 0xb5, 0x04, 0x5c, 0x78, 0xf6,
+    0x63, 0x47, 0xc5, 0xdc, 0xe2, 0x83, 0xe4, 0x4a, 0x14, 0x54, 0x10, 0x07, 0xdb, 0x96, 0xeb, 0xbb,
+    0x9e, 0x0c, 0x59, 0x4b, 0xd2, 0xc3, 0xb7, 0x1b, 0x56, 0x3f, 0x24, 0xf0, 0x8f, 0x99, 0x14, 0xda,
+    0xde, 0xbe, 0x73, 0x88, 0xaa, 0x4f, 0xe9, 0x4d, 0xa6, 0x5b, 0x9e, 0x16, 0x46, 0x4d, 0xea, 0x5e,
+    0x72, 0xe2, 0x08, 0xca, 0xff, 0xe5, 0x95, 0x00, 0x8d, 0xb7, 0x20, 0xe9, 0xbe, 0xf6, 0xf5, 0x71,
+    0xa7, 0x01, 0xe8, 0xbb, 0x60, 0x70, 0x8a, 0x73, 0xe7, 0x3a, 0x1d, 0x62, 0x42, 0x2b, 0x41, 0xf3,
+    0xa3, 0xc4, 0x19, 0x67, 0x1e, 0x3e, 0x2b, 0x53, 0x6b, 0x8a, 0x40, 0x86, 0x9f, 0x81, 0xb7, 0x48,
+    0x4f, 0xb5, 0xcf, 0x07, 0x90, 0x1c, 0xe6, 0x93, 0x22, 0xdd, 0x99, 0xe6, 0xfc, 0x6e, 0xfc, 0x14,
+    0x21, 0x39, 0x11, 0x05, 0x7b, 0x03, 0x29, 0xc1, 0x05, 0xe4, 0x71, 0x49, 0xd7, 0xb3, 0x1b, 0xc4,
+    0x9e, 0x43, 0xd5, 0x87, 0x18, 0x80, 0x20, 0x66, 0xd2, 0xb1, 0x5b, 0x54, 0x8a, 0x30, 0xe8, 0x0a,
+    0x96, 0x87, 0x17, 0x7d, 0x1c, 0x18, 0xcc, 0x7e, 0x55, 0xd7, 0x01, 0x8a, 0x78, 0x43, 0xb8, 0x51,
+    0x76, 0x9a, 0x7a, 0x84, 0x33, 0x0b, 0x17, 0x8c, 0x1a, 0xdc, 0xb1, 0x2e, 0xb6, 0x55, 0x32, 0x6c,
+    0xcc, 0x65, 0x96, 0x8e, 0x5e, 0xbf, 0x88, 0x92, 0xd5, 0x48, 0x9e, 0xcb, 0x44, 0xc3, 0x44, 0x17,
+    0xc7, 0x09, 0x3c, 0xba, 0x82, 0xff, 0x82, 0x49, 0x0a, 0x7e, 0x07, 0xf6, 0xda, 0x68, 0x86, 0x4f,
+    0x0f, 0x5c, 0x6e, 0x99, 0x00, 0x4c, 0x4d, 0xc0, 0xdd, 0x37, 0x80, 0xc2, 0x2b, 0xff, 0x46, 0x48,
+    0x54, 0xe7, 0xde, 0x8b, 0x92, 0x61, 0xbb, 0x23, 0xa4, 0x14, 0x07, 0xca, 0x0c, 0xda, 0x1b, 0x00,
+    0x31, 0xcc, 0x2a, 0x88, 0x65, 0x0f, 0x99, 0x22, 0xea, 0x49, 0x29, 0x42, 0x65, 0xd0, 0xb7, 0xe3,
+    0x05, 0xed, 0x2e, 0x77, 0x66, 0x41, 0xd1, 0x3b, 0x94, 0xd9, 0x20, 0x00, 0x0a, 0xff, 0xb8, 0xd9,
+    0x11, 0x87, 0xb3, 0x4a, 0x8a, 0x3d, 0x7c, 0x11, 0x54, 0x62, 0x1e, 0x82, 0xb3, 0xdc, 0x7d, 0xa9,
+    0x30, 0x0b, 0xc2, 0x91, 0x04, 0x00, 0xa5, 0x8e, 0xa7, 0x2a, 0xaa, 0x1a, 0x07, 0x40, 0xa4, 0xd8,
+    0x5c, 0x55, 0x4d, 0x8e, 0xc8, 0x07, 0x18, 0xb6, 0x5c, 0xf6, 0x07, 0x60, 0x07, 0xe7, 0x3e, 0xeb,
+    0x35, 0x17, 0x75, 0x7c, 0x17, 0xe5, 0x42, 0x64, 0x6b, 0x3c, 0x54, 0x14, 0xa1, 0x0b, 0x87, 0x24,
+    0x48, 0x25, 0x12, 0x95, 0xc9, 0x3e, 0x88, 0xb8, 0xb0, 0x8b, 0x37, 0x12, 0xa7, 0x9d, 0xb4, 0xed,
+    0x40, 0x51, 0xf9, 0xed, 0x81, 0x2d, 0x3c, 0x81, 0x17, 0xe0, 0x8f, 0x27, 0xaa, 0xdf, 0xfc, 0x4a,
+    0x1e, 0x99, 0x45, 0xa6, 0x14, 0x3d, 0x03, 0x91, 0x59, 0x8c, 0xce, 0x35, 0x1d, 0x50, 0xbb, 0x03,
+    0xc4, 0x5e, 0xa2, 0x0e, 0x7f, 0x79, 0x85, 0x8a, 0x71, 0xbf, 0xea, 0xad, 0x94, 0x4a, 0x57, 0x49,
+    0xe9, 0xd3, 0x69, 0x8d, 0x2f, 0x6f, 0x72, 0x84, 0x82, 0x78, 0x59, 0xdc, 0xf7, 0x3c, 0x27, 0x89,
+    0x8d, 0xe5, 0x78, 0x9d, 0xa2, 0x02, 0xa6, 0xe1, 0x93, 0x7a, 0x1e, 0x22, 0xd9, 0x07, 0x2e, 0x21,
+    0x33, 0x49, 0x04, 0xb1, 0x23, 0x0a, 0x89, 0xa3, 0xba, 0xa3, 0xc4, 0x32, 0x1c, 0xcc, 0x0a, 0x49,
+    0xbe, 0x69, 0x9f, 0xae, 0xa2, 0xdd, 0x14, 0x83, 0xb3, 0x80, 0x24, 0x25, 0x11, 0x45, 0x35, 0xe6,
+    0x65, 0xa0, 0xc5, 0x4d, 0xaa, 0x65, 0x96, 0x73, 0x6a, 0xba, 0x74, 0xf1, 0x51, 0xe3, 0xa8, 0x45,
+    0x83, 0xbb, 0x88, 0x43, 0x96, 0x66, 0xfb, 0x5c, 0x72, 0x3e, 0x7d, 0x80, 0x7a, 0x55, 0xe9, 0x56,
+    0xd3, 0xae, 0xcb, 0x51, 0x49, 0x4f, 0x97, 0x0c, 0x98, 0xc3, 0xfc, 0x8a, 0xe6, 0x77, 0x03, 0xf0,
+    0xc2, 0xf0, 0xf2, 0x80, 0xe1, 0x54, 0x18, 0x86, 0xc7, 0x77, 0x9c, 0xcd, 0x72, 0x61, 0x59, 0xb0,
+    0xa1, 0x46, 0x0c, 0xb0, 0x11, 0x39, 0x05, 0xc2, 0xb2, 0x00, 0x5d, 0x34, 0xea, 0x42, 0x22, 0x0c,
+    0x60, 0x53, 0x58, 0x97, 0xa6, 0x90, 0xa7, 0xb3, 0xc2, 0x2e, 0x09, 0x65, 0x72, 0xa5, 0x27, 0xf4,
+    0xe0, 0x84, 0x93, 0xb5, 0x8e, 0x38, 0xae, 0x44, 0xb4, 0x7e, 0xea, 0x74, 0x25, 0x3c, 0xb2, 0xbe,
+    0xc4, 0x8c, 0x03, 0xbf, 0x75, 0x1f, 0x13, 0x65, 0x7e, 0x65, 0xfc, 0xc3, 0xc7, 0x32, 0xfb, 0xa0,
+    0x28, 0x53, 0xe2, 0x91, 0xe6, 0xb3, 0x39, 0x41, 0x25, 0x36, 0x16, 0x62, 0xb0, 0x88, 0x2a, 0xfa,
+    0xdc, 0x48, 0x68, 0x47, 0xcb, 0x7d, 0x13, 0x47, 0x3b, 0x38, 0xe1, 0x15, 0xfc, 0xdf, 0x74, 0xf1,
+    0x39, 0x66, 0xd5, 0xb3, 0x5a, 0x5e, 0x51, 0xc8, 0xe2, 0xfb, 0x75, 0x70, 0x54, 0x54, 0xca, 0x07,
+    0x63, 0x25, 0xa3, 0xb0, 0x00, 0x40, 0x65, 0xf2, 0x3a, 0x50, 0x18, 0x3c, 0xf5, 0x48, 0xf4, 0x19,
+    0x58, 0xf5, 0x5a, 0x22, 0x92, 0x4b, 0xad, 0xb3, 0x72, 0xa3, 0xa4, 0x29, 0x1e, 0x73, 0xbd, 0x99,
+    0x29, 0x29, 0x04, 0xe0, 0x2d, 0xe9, 0x99, 0x3c, 0x46, 0x6d, 0x47, 0x87, 0xee, 0x99, 0x11, 0x66,
+    0x9c, 0x8b, 0xb2, 0x35, 0x6f, 0x92, 0x65, 0x63, 0x6d, 0xe1, 0x01, 0xc7, 0xc6, 0x2d, 0x14, 0x52,
+    0x30, 0x8c, 0xaf, 0xe2, 0x33, 0x25, 0x05, 0x45, 0xd1, 0xe7, 0x4d, 0xa7, 0xa9, 0x98, 0x4a, 0xfa,
+    0x53, 0x3d, 0x75, 0x21, 0x0c, 0xb3, 0xe4, 0x4e, 0x21, 0x23, 0xa5, 0xcd, 0x17, 0xf5, 0x2f, 0x39,
+    0x05, 0x1c, 0xc0, 0x4a, 0x88, 0xe2, 0xbd, 0x9a, 0x61, 0x69, 0x10, 0xe3, 0x0f, 0x94, 0x44, 0x04,
+    0x44, 0x05, 0xfe, 0x74, 0xcb, 0x0e, 0x41, 0x48, 0x98, 0x63, 0x3a, 0xf9, 0x3e, 0x12, 0xeb, 0x79,
+    0xd8, 0x15, 0xa6, 0x39, 0xcc, 0xb0, 0x59, 0xc4, 0x8e, 0xe1, 0xe0, 0x72, 0x19, 0x06, 0xce, 0x83,
+    0xf7, 0x76, 0xa9, 0x14, 0xe2, 0x90, 0x73, 0xe2, 0xa2, 0x71, 0xee, 0xf0, 0x52, 0x86, 0x41, 0xf7,
+    0xa6, 0x60, 0x20, 0x2a, 0x3a, 0x0f, 0x09, 0x16, 0xb8, 0x9f, 0x8f, 0xc1, 0x52, 0xf5, 0xa0, 0xe7,
+    0x52, 0x0a, 0xfc, 0x2d, 0x7f, 0xfc, 0x5b, 0x08, 0xba, 0xae, 0xd2, 0x86, 0x00, 0x47, 0x94, 0x2e,
+    0x1b, 0xcb, 0xa6, 0xeb, 0x87, 0x1e, 0x79, 0xeb, 0xac, 0x5b, 0x3c, 0xed, 0xc7, 0xe4, 0x9a, 0x07,
+    0x13, 0x72, 0x2e, 0x96, 0x86, 0x87, 0xc2, 0x6d, 0x77, 0x0a, 0x26, 0x51, 0x00, 0x8f, 0xe1, 0xbe,
+    0xd2, 0x8a, 0x32, 0x13, 0x11, 0x3c, 0x22, 0xa1, 0x47, 0x2c, 0x80, 0x1b, 0xfc, 0xea, 0x4b, 0x4c,
+    0xcb, 0xa2, 0xb8, 0xcb, 0x1a, 0xff, 0x2a, 0xe5, 0x29, 0x9d, 0x57, 0x5a, 0xf7, 0x7c, 0x96, 0x39,
+    0x81, 0xe1, 0xbc, 0x1a, 0x84, 0xf8, 0xfb, 0x67, 0xff, 0x94, 0x78, 0x44, 0xa4, 0xd8, 0x3e, 0x0c,
+    0x24, 0x9d, 0x3e, 0xd3, 0x3b, 0xf1, 0xbe, 0x4f, 0x4f, 0xc9, 0x18, 0x8a, 0x9d, 0x43, 0x70, 0xa8,
+    0xc5, 0xa2, 0xde, 0x91, 0xe7, 0xdd, 0xa3, 0xbc, 0x44, 0x66, 0xf2, 0xa2, 0x4e, 0x54, 0xe9, 0xb2,
+    0xb3, 0xd9, 0xd0, 0xe6, 0xd7, 0x50, 0x5c, 0x41, 0x60, 0xa4, 0x09, 0xfa, 0x70, 0x97, 0x53, 0x0d,
+    0x1d, 0x09, 0x71, 0x2e, 0xc1, 0xbb, 0xf4, 0x56, 0xf9, 0x8a, 0x05, 0x50, 0x6b, 0xac, 0x97, 0xb5,
+    0x63, 0x55, 0x55, 0x51, 0x46, 0xc7, 0xe7, 0x01, 0x40, 0xae, 0x77, 0x6a, 0x88, 0x8b, 0x4d, 0x31,
+    0x97, 0x8e, 0x8d, 0xb4, 0xf1, 0x98, 0x52, 0x58, 0xa4, 0x57, 0x55, 0xe3, 0x2d, 0x92, 0x29, 0xf3,
+    0xae, 0x93, 0x9e, 0xe0, 0x20, 0xed, 0xc6, 0xa1, 0x7e, 0x7a, 0x5c, 0x58, 0x14, 0x9d, 0x4d, 0xbb,
+    0xf7, 0x3a, 0xb7, 0x75, 0x93, 0xee, 0xeb, 0x30, 0x17, 0x9c, 0xae, 0xe1, 0x83, 0x20, 0x5b, 0x28,
+    0x41, 0x1c, 0x3a, 0x67, 0x7c, 0x2a, 0xdc, 0x68, 0xb0, 0xa5, 0x6b, 0x4b, 0x10, 0xed, 0xfb, 0xf0,
+    0xe9, 0x88, 0x07, 0x52, 0xc7, 0x26, 0x84, 0x6f, 0xbc, 0xfd, 0x60, 0xe3, 0x78, 0x03, 0x48, 0x5b,
+    0xdd, 0x1d, 0x26, 0x94, 0x34, 0x3c, 0x98, 0x6f, 0xba, 0xca, 0x44, 0xc1, 0x7e, 0x80, 0x9c, 0xe3,
+    0xa0, 0x71, 0xbf, 0x4a, 0xc0, 0xd4, 0xd0, 0xbf, 0xee, 0x84, 0xfe, 0x41, 0x1a, 0x09, 0x68, 0xc4,
+    0x3f, 0x50, 0x0d, 0x36, 0x07, 0x2f, 0x42, 0x12, 0xe1, 0x1b, 0xe8, 0x34, 0x2d, 0x63, 0xe2, 0x46,
+    0xd5, 0x32, 0x19, 0x39, 0xa5, 0xa4, 0xad, 0x4a, 0x87, 0xf0, 0x89, 0xf3, 0x0b, 0xb8, 0xfe, 0x8b,
+    0x45, 0x43, 0x99, 0xb1, 0x7a, 0xff, 0x98, 0x86, 0xbf, 0x5d, 0x04, 0x46, 0xae, 0xa4, 0x07, 0xed,
+    0xc2, 0xd2, 0x62, 0x17, 0x95, 0x5c, 0x99, 0x00, 0x89, 0x7c, 0x52, 0xe8, 0x89, 0x8a, 0x85, 0xc6,
+    0x27, 0xcd, 0x63, 0xad, 0x7f, 0x46, 0xc2, 0x5d, 0xc4, 0x43, 0x6f, 0x69, 0xf7, 0xbf, 0x63, 0xf9,
+    0xf4, 0xdb, 0x4a, 0xb9, 0x88, 0x21, 0x63, 0x2c, 0xdb, 0x2e, 0xc3, 0xaf, 0x57, 0xff, 0xe1, 0x45,
+    0x20, 0x95, 0x64, 0x08, 0x01, 0xba, 0xec, 0xdb, 0x86, 0x01, 0xda, 0x3f, 0x3d, 0x0e, 0xfd, 0xc7,
+    0x37, 0x10, 0xc1, 0x14, 0x37, 0xc0, 0x7f, 0xed, 0xef, 0x74, 0x5f, 0x8e, 0x26, 0xe5, 0x6f, 0xbe,
+    0xee, 0xfe, 0xc1, 0xfd, 0x83, 0xfb, 0x3f, 0xc0, 0x95, 0xf8, 0xcf, 0x07, 0xf2, 0x75, 0xdf, 0x5f,
+    0x94, 0x46, 0x15, 0xfd, 0xbb, 0x4d, 0x52, 0xfe, 0xa4, 0x93, 0x0c, 0x7e, 0x94, 0x3c, 0x90, 0xcb,
+    0xfe, 0x1d, 0x17, 0x9a, 0xa2, 0x38, 0x98, 0x51, 0x06, 0xd9, 0x95, 0xc3, 0x0c, 0x91, 0x34, 0x4f,
+    0xb9, 0x77, 0x37, 0xb6, 0x91, 0x66, 0xb5, 0xb4, 0x4f, 0x5d, 0x1c, 0x6f, 0xff, 0x27, 0x17, 0x93,
+    0x22, 0xd5, 0x9d, 0xd6, 0x29, 0x10, 0x3a, 0x05, 0xc1, 0x4d, 0x11, 0xf6, 0x7b, 0x98, 0x83, 0x46,
+    0xad, 0x97, 0x38, 0xda, 0x98, 0x77, 0xfc, 0x93, 0x6b, 0x40, 0x99, 0x6d, 0x95, 0x9a, 0x1e, 0x88,
+    0x91, 0x82, 0x8b, 0x9e, 0x22, 0x73, 0x91, 0xa2, 0x52, 0xa0, 0x74, 0x03, 0x20, 0xb0, 0x47, 0x4f,
+    0x6c, 0xff, 0x89, 0xdd, 0x9a, 0x0e, 0x63, 0xd3, 0xa4, 0x58, 0xdf, 0x4b, 0x91, 0x43, 0x4d, 0x51,
+    0x59, 0x83, 0xc2, 0xa5, 0x56, 0x9f, 0x5d, 0xfe, 0xe4, 0xde, 0x00, 0xf1, 0x14, 0x1c, 0x7a, 0x30,
+    0xdd, 0x34, 0x29, 0x4c, 0x24, 0x29, 0xfe, 0xcb, 0x99, 0x39, 0x4b, 0xda, 0xf4, 0xf9, 0xc9, 0xbf,
+    0xd8, 0xb0, 0x75, 0x58, 0xf7, 0x60, 0x54, 0x0f, 0x64, 0x4b, 0x0e, 0x23, 0x42, 0xb1, 0x39, 0x85,
+    0xe9, 0x24, 0x96, 0x8f, 0xe6, 0xcb, 0x27, 0x4a, 0x0e, 0x06, 0x1a, 0xf5, 0xbf, 0xf2, 0x23, 0x34,
+    0xe6, 0xaf, 0xbb, 0x2c, 0xf9, 0x9b, 0xa7, 0x8d, 0xa2, 0xfe, 0xfe, 0x59, 0xa4, 0x0c, 0x77, 0xf7,
+    0xa5, 0xfe, 0x2b, 0x80, 0xd1, 0xf7, 0x47, 0xac, 0xfe, 0xc1, 0xfd, 0x97, 0xe2, 0xfe, 0xd7, 0xe7,
+    0xce, 0x9b, 0x2e, 0xe0, 0x2e, 0xe4, 0xf6, 0x7f, 0x95, 0xc0, 0x03, 0x70, 0x70, 0x20, 0x84, 0x9f,
+    0x4f, 0xef, 0x05, 0x41, 0x28, 0x01, 0x76, 0x31, 0xb5, 0x3d, 0xb0, 0x09, 0x94, 0x4d, 0x54, 0xd5,
+    0xd9, 0x38, 0x38, 0x39, 0xb7, 0xe3, 0xcf, 0x4f, 0x97, 0x03, 0x63, 0x01, 0xd6, 0x4a, 0x32, 0xef,
+    0x92, 0xbc, 0x0f, 0xda, 0x76, 0x8f, 0x15, 0x33, 0x38, 0xcc, 0xfb, 0x1e, 0xd3, 0xfd, 0x43, 0x27,
+    0x5e, 0xa0, 0x90, 0x8b, 0x42, 0x5e, 0xea, 0x2b, 0x6c, 0x0b, 0x77, 0xd4, 0xff, 0x1f, 0x94, 0x8b,
+    0xb3, 0xab, 0x85, 0x7e, 0xa7, 0x40, 0x20, 0xe3, 0x3a, 0x69, 0xf5, 0xef, 0xcc, 0x69, 0x70, 0x3d,
+    0xc1, 0x0a, 0x58, 0x1a, 0xfe, 0xcc, 0x77, 0x11, 0x29, 0xe2, 0xf4, 0x75, 0x9b, 0xf4, 0xea, 0x9f,
+    0xad, 0xc8, 0x38, 0xf7, 0x4e, 0x1e, 0xb3, 0x40, 0x47, 0x6c, 0xe2, 0xb9, 0xcf, 0xf5, 0xd5, 0x63,
+    0xba, 0x20, 0x45, 0x0d, 0x16, 0x8e, 0x10, 0xdd, 0xb8, 0xab, 0x2c, 0x51, 0x14, 0x49, 0xd9, 0xe8,
+    0xa8, 0x84, 0xa8, 0x65, 0x41, 0x27, 0x04, 0x4d, 0x0b, 0xb6, 0x2a, 0x02, 0x4d, 0xd6, 0xcd, 0xa5,
+    0x30, 0xaa, 0x50, 0x86, 0xa2, 0x28, 0x8e, 0xe8, 0x40, 0x95, 0xb3, 0x37, 0x8a, 0xd9, 0xbd, 0x68,
+    0xe5, 0x15, 0x8c, 0xb5, 0x15, 0xe5, 0x37, 0x80, 0x55, 0xdf, 0xeb, 0x24, 0x51, 0x1a, 0xe6, 0x22,
+    0xd5, 0x2a, 0xbd, 0x73, 0x2f, 0x73, 0x30, 0x03, 0xba, 0xb5, 0x14, 0x93, 0x74, 0xc0, 0xf0, 0xf7,
+    0x5e, 0x2a, 0x24, 0x7c, 0xd5, 0x7b, 0x70, 0x95, 0x2f, 0x16, 0x19, 0x12, 0x8e, 0xb1, 0x46, 0x65,
+    0xa9, 0x19, 0xdc, 0x80, 0xdd, 0x8e, 0x11, 0x30, 0x2a, 0x12, 0x10, 0x7c, 0x37, 0x0f, 0x35, 0x99,
+    0xb7, 0x21, 0x08, 0x14, 0x3f, 0x48, 0x53, 0x1e, 0xf4, 0xe4, 0xcb, 0xe6, 0x1a, 0x33, 0x17, 0x41,
+    0x42, 0x87, 0xac, 0x53, 0x10, 0x03, 0x7f, 0xd6, 0xce, 0xcb, 0xcd, 0x17, 0x48, 0xa0, 0x11, 0xa2,
+    0xc0, 0x58, 0xf3, 0xbe, 0x7a, 0x27, 0x1b, 0x7e, 0x34, 0x68, 0x10, 0xea, 0xf6, 0x31, 0x6a, 0x7e,
+    0x00, 0xab, 0x18, 0xc8, 0x56, 0x8c, 0x8a, 0x4a, 0xed, 0x25, 0x98, 0x31, 0x3c, 0x10, 0x0e, 0xcf,
+    0x90, 0x5e, 0x9b, 0x09, 0xcd, 0x32, 0xd2, 0x0f, 0xcf, 0xee, 0xcb, 0x59, 0x9c, 0x4d, 0x58, 0x85,
+    0x9b, 0xa9, 0xa8, 0x04, 0x5d, 0xd2, 0x25, 0xd8, 0x8e, 0x00, 0x1c, 0x3c, 0x53, 0x0e, 0xfa, 0xa2,
+    0xa1, 0xba, 0x85, 0xc5, 0x66, 0x55, 0xe5, 0xca, 0x69, 0x53, 0xe1, 0x20, 0xd3, 0xbd, 0xc9, 0x02,
+    0xc5, 0xa0, 0x9f, 0x63, 0x13, 0x6b, 0x21, 0x14, 0xe3, 0xb8, 0x26, 0xe6, 0x96, 0x82, 0xda, 0x8a,
+    0xa3, 0xec, 0x31, 0x93, 0xfb, 0xed, 0x80, 0x64, 0xd1, 0x26, 0x62, 0x84, 0x14, 0x74, 0x72, 0x48,
+    0x4e, 0x53, 0x9b, 0xf2, 0x0d, 0x11, 0x0a, 0xb7, 0x84, 0xbe, 0xc7, 0xf0, 0xda, 0x20, 0x22, 0x75,
+    0xa9, 0xa5, 0xde, 0x57, 0x87, 0x2e, 0x03, 0x55, 0x1d, 0xc1, 0x7e, 0x78, 0xc6, 0x2d, 0xb9, 0x1f,
+    0x56, 0x3e, 0x62, 0x78, 0xa0, 0x70, 0x21, 0x69, 0xdd, 0x00, 0x71, 0xc6, 0x38, 0x78, 0x97, 0xb7,
+    0x8d, 0x16, 0xb0, 0x31, 0x76, 0xc1, 0x3b, 0x80, 0xf6, 0xa4, 0x25, 0xb1, 0xb6, 0xd0, 0x2c, 0x8e,
+    0x0c, 0x3f, 0xb4, 0xc3, 0xab, 0x3f, 0xa6, 0x82, 0x43, 0xcb, 0x53, 0xac, 0x07, 0x81, 0x4f, 0x77,
+    0xb4, 0x5b, 0x15, 0xce, 0x51, 0x59, 0xdb, 0xde, 0x85, 0x65, 0x7f, 0x8a, 0xf9, 0x78, 0x12, 0x6a,
+    0x5d, 0x5f, 0xe5, 0x3d, 0x8f, 0xf9, 0xc8, 0x7a, 0x63, 0x3f, 0x31, 0x05, 0x67, 0x24, 0x10, 0x2e,
+    0x0b, 0xca, 0x1d, 0xe2, 0x81, 0xfd, 0xb2, 0x10, 0xff, 0xa5, 0x38, 0x55, 0xd2, 0xfd, 0x3c, 0x04,
+    0xaf, 0xa7, 0x89, 0xc2, 0x9e, 0xcf, 0x52, 0xa8, 0x52, 0xbb, 0x52, 0xc9, 0x1f, 0x7f, 0xb8, 0x01,
+    0x30, 0x42, 0x45, 0x51, 0xc6, 0xd5, 0x7c, 0xd4, 0x59, 0x03, 0x38, 0xa3, 0x0a, 0x31, 0xad, 0xc4,
+    0xc8, 0x69, 0x0b, 0x86, 0x9f, 0x2f, 0x23, 0x90, 0xa2, 0xca, 0x16, 0xa8, 0xe1, 0x3c, 0x71, 0xba,
+    0x6f, 0x11, 0x81, 0x13, 0x28, 0x2e, 0xd1, 0x40, 0x99, 0x0f, 0x49, 0xd5, 0xc9, 0x76, 0xac, 0xdf,
+    0x17, 0x13, 0x99, 0xae, 0x9f, 0x6f, 0xb0, 0x8e, 0xec, 0x30, 0x11, 0xaf, 0xd4, 0x94, 0x4f, 0x62,
+    0x29, 0xa1, 0x67, 0x0b, 0x01, 0x49, 0x6d, 0x8e, 0xe2, 0x62, 0x12, 0x7a, 0xc0, 0x25, 0x59, 0xd5,
+    0xba, 0xf2, 0x58, 0x55, 0x58, 0x4a, 0x4c, 0xad, 0xea, 0x72, 0xc3, 0x13, 0x8d, 0x7e, 0x83, 0x48,
+    0xee, 0xc7, 0xe6, 0x7b, 0xdc, 0x5d, 0x24, 0x90, 0x23, 0x8a, 0x7a, 0x81, 0x08, 0x75, 0xec, 0xab,
+    0xe7, 0xdb, 0x88, 0x8b, 0xc2, 0xec, 0x7d, 0xd2, 0xb7, 0xcc, 0xd7, 0x52, 0x78, 0x87, 0x99, 0x74,
+    0x68, 0x86, 0xf1, 0x53, 0xd2, 0x51, 0x23, 0x01, 0x66, 0x50, 0x37, 0x97, 0x8f, 0xa4, 0x9a, 0x60,
+    0xfe, 0xfa, 0xf3, 0xe8, 0xd3, 0xb3, 0x1d, 0x6d, 0x61, 0xd4, 0x0b, 0xf4, 0x47, 0x59, 0x50, 0x64,
+    0x82, 0x73, 0xaa, 0x2a, 0x04, 0xc4, 0x78, 0x90, 0x66, 0x6b, 0x69, 0x6f, 0xd0, 0xe7, 0x68, 0xc3,
+    0x6c, 0xea, 0x67, 0xb3, 0x34, 0xf7, 0x54, 0xc3, 0x32, 0xdf, 0x68, 0x34, 0x04, 0xe7, 0xf2, 0x52,
+    0x3d, 0x6a, 0x17, 0xba, 0x01, 0x76, 0xe1, 0xb5, 0x82, 0xd0, 0x72, 0x59, 0x31, 0x68, 0xae, 0xc3,
+    0x22, 0x9d, 0x24, 0x24, 0xa9, 0xe9, 0x2b, 0x7f, 0x33, 0x10, 0x37, 0x00, 0x2c, 0x6d, 0xcc, 0xd8,
+    0xba, 0xb6, 0xa1, 0x8c, 0x56, 0x77, 0xd4, 0x88, 0x90, 0xfb, 0xee, 0x6b, 0x98, 0xc5, 0xd5, 0x5c,
+    0x30, 0x2e, 0xc9, 0x4b, 0xce, 0x2c, 0xe9, 0x86, 0xbd, 0x40, 0xda, 0x86, 0x03, 0xed, 0x02, 0x64,
+    0x08, 0x4b, 0x28, 0x78, 0x70, 0x0f, 0xe2, 0x01, 0x74, 0x69, 0x59, 0xb2, 0x24, 0x9b, 0x29, 0xa2,
+    0x62, 0xf4, 0x1b, 0xa0, 0x3c, 0xb6, 0x98, 0x5c, 0x04, 0x25, 0xce, 0x1c, 0x41, 0x77, 0xae, 0xba,
+    0x23, 0x75, 0x1d, 0xda, 0x86, 0x99, 0x88, 0xd9, 0xda, 0x20, 0xa3, 0x8a, 0x10, 0x15, 0x6a, 0x14,
+    0xdc, 0x8e, 0x25, 0x0e, 0xe2, 0x66, 0xf5, 0x16, 0xcd, 0xbd, 0xf3, 0x44, 0xe3, 0x54, 0x7d, 0x19,
+    0x8d, 0xe9, 0x4e, 0x13, 0x62, 0x5d, 0x62, 0x3e, 0x10, 0x42, 0xca, 0x38, 0xb0, 0xae, 0xbd, 0xfe,
+    0x08, 0x53, 0x1e, 0x08, 0x7b, 0x42, 0xcf, 0x82, 0x67, 0x34, 0xbb, 0x0e, 0xc5, 0x4d, 0x06, 0x79,
+    0xd2, 0x25, 0xa9, 0xd2, 0x63, 0xe0, 0x0e, 0xd8, 0xb3, 0xee, 0xda, 0xf5, 0xa5, 0xa0, 0xa0, 0x8e,
+    0x44, 0x3c, 0x8c, 0x12, 0xff, 0x2c, 0xae, 0xa6, 0xcc, 0xab, 0x06, 0x82, 0x47, 0x1a, 0x7d, 0x77,
+    0x08, 0x88, 0x98, 0x75, 0x2e, 0x63, 0xdb, 0xa4, 0x11, 0xcf, 0x7e, 0xf3, 0x45, 0xb1, 0xba, 0x4b,
+    0xa7, 0xdb, 0x8f, 0xda, 0x89, 0xad, 0xdc, 0x9d, 0x84, 0xb5, 0xd0, 0x0e, 0xaf, 0xf9, 0x60, 0xb7,
+    0xe5, 0x2d, 0x87, 0xa6, 0x2a, 0x6e, 0x6c, 0x3e, 0x06, 0x3f, 0xed, 0x3a, 0xa3, 0x84, 0x6e, 0x37,
+    0x34, 0x6f, 0xb9, 0x1a, 0x45, 0x1e, 0x63, 0x0e, 0x1f, 0x77, 0x55, 0xd2, 0x47, 0xee, 0xbd, 0xf2,
+    0x9a, 0xb1, 0xa8, 0x2e, 0x84, 0xbe, 0xd7, 0x9e, 0xbe, 0xe0, 0xf4, 0x95, 0x74, 0xa4, 0xcc, 0x3b,
+    0x9c, 0x54, 0x00, 0x95, 0xdb, 0x5d, 0xef, 0x43, 0x21, 0x93, 0xec, 0xae, 0xa2, 0xc9, 0x34, 0x26,
+    0xae, 0xd3, 0x27, 0x70, 0x3e, 0xb6, 0x0e, 0x1a, 0xef, 0x37, 0x66, 0xb8, 0xc6, 0x61, 0x39, 0xeb,
+    0x6a, 0xda, 0x24, 0x3d, 0x05, 0xfe, 0x92, 0xe5, 0x25, 0x35, 0x4e, 0x44, 0x62, 0x38, 0x0f, 0x72,
+    0x23, 0x4f, 0xc2, 0x63, 0xc4, 0xa0, 0x76, 0x32, 0x50, 0xe4, 0x4a, 0x63, 0x97, 0xa8, 0x47, 0x30,
+    0x33, 0x72, 0xd1, 0x71, 0x00, 0x31, 0x23, 0xd5, 0xab, 0x4d, 0x42, 0x03, 0xbb, 0xf9, 0xae, 0xaa,
+    0x45, 0xa2, 0x27, 0x67, 0xca, 0xb8, 0x78, 0x22, 0xeb, 0xf7, 0x5e, 0x55, 0xa2, 0x8c, 0xa3, 0x6b,
+    0x95, 0xdd, 0x53, 0x4f, 0xf9, 0x28, 0xda, 0x0e, 0x22, 0x82, 0xca, 0x29, 0x6e, 0x8e, 0xbc, 0xc4,
+    0x7d, 0x3d, 0xb2, 0x0e, 0xb1, 0x8a, 0x39, 0x96, 0x91, 0xed, 0xa6, 0x0e, 0x65, 0xa5, 0x00, 0xfb,
+    0x6a, 0x36, 0x7c, 0x58, 0x50, 0x98, 0x96, 0x10, 0xe3, 0x85, 0x93, 0xa4, 0x0d, 0xa0, 0xb5, 0xea,
+    0xec, 0x42, 0xa1, 0x4f, 0x20, 0x2a, 0xdf, 0x4a, 0x55, 0x0d, 0x72, 0x9e, 0x29, 0x93, 0x46, 0xd0,
+    0x34, 0xd5, 0xf9, 0xc2, 0xab, 0xa8, 0x7a, 0x03, 0xe4, 0xbe, 0x6a, 0x6a, 0x76, 0x47, 0x96, 0xcf,
+    0x4d, 0x46, 0x12, 0x61, 0x27, 0xe2, 0x2f, 0x8f, 0x9b, 0x9b, 0xa5, 0x46, 0xe4, 0x60, 0xa4, 0x2e,
+    0x45, 0x8b, 0x09, 0xe4, 0x96, 0xcf, 0x15, 0x33, 0x66, 0x6a, 0xc8, 0x4d, 0x78, 0x8d, 0xf4, 0xc1,
+    0x16, 0xfc, 0x24, 0x68, 0xae, 0x5d, 0x54, 0x18, 0x80, 0xcf, 0xcd, 0xa2, 0x45, 0x7f, 0xa3, 0xf6,
+    0x2d, 0xac, 0xbc, 0x0b, 0x20, 0xdf, 0x68, 0xee, 0x02, 0xd3, 0x8b, 0x49, 0x81, 0x09, 0xe2, 0xac,
+    0x09, 0x48, 0xa5, 0x69, 0x03, 0x34, 0xc2, 0xde, 0x63, 0x9f, 0xa3, 0x7d, 0xaf, 0xe8, 0x65, 0x7c,
+    0x97, 0xa4, 0x2a, 0x69, 0xf5, 0x0e, 0x43, 0x95, 0x2b, 0x92, 0xc9, 0x4b, 0x29, 0x85, 0xd1, 0x18,
+    0x31, 0xd2, 0x64, 0xd4, 0x19, 0x86, 0x3f, 0x4a, 0x6f, 0x33, 0x35, 0x9a, 0xe8, 0x95, 0xab, 0xf7,
+    0x5f, 0xce, 0x47, 0x99, 0x26, 0xf1, 0xad, 0x1f, 0xef, 0xb8, 0x67, 0x70, 0x58, 0x54, 0x74, 0xe0,
+    0xe9, 0xa8, 0x74, 0xb7, 0xd0, 0x85, 0xa8, 0x7c, 0xce, 0x7f, 0x44, 0x8f, 0xba, 0x99, 0x5e, 0x7c,
+    0x03, 0x78, 0x71, 0x3f, 0xf3, 0x45, 0xde, 0x73, 0x06, 0x28, 0x91, 0x96, 0x42, 0xe2, 0x37, 0xd3,
+    0x29, 0x5f, 0xc7, 0x65, 0x03, 0xb2, 0xdd, 0x79, 0x4c, 0x18, 0xc5, 0x5d, 0x37, 0x40, 0x60, 0x84,
+    0x3a, 0x7d, 0x81, 0x3c, 0x4a, 0x6a, 0xb4, 0x4c, 0xf7, 0x6e, 0x07, 0x3e, 0xc9, 0x29, 0xf2, 0x98,
+    0x15, 0xcd, 0x55, 0x3f, 0x5d, 0x80, 0x25, 0x0e, 0xb2, 0x10, 0x71, 0xcb, 0xf6, 0x6b, 0x3a, 0xc5,
+    0xba, 0xc0, 0x50, 0x4b, 0xc5, 0xf4, 0xb1, 0x88, 0xb8, 0xf6, 0x62, 0xaf, 0x98, 0xbb, 0xf9, 0x09,
+    0x81, 0xe4, 0x8b, 0xa8, 0x9b, 0x99, 0x09, 0x37, 0x80, 0x2e, 0x07, 0xb1, 0xaf, 0xce, 0x53, 0x9a,
+    0x6c, 0xb3, 0x3b, 0x7a, 0xbb, 0xc8, 0x03, 0xf7, 0x1e, 0x5c, 0x8a, 0x42, 0x46, 0xb9, 0x48, 0xaf,
+    0x6b, 0xcd, 0x5d, 0xdc, 0x4a, 0xf6, 0x1b, 0x62, 0xcc, 0xe9, 0xf9, 0x11, 0x51, 0x00, 0x28, 0xb5,
+    0xd1, 0xec, 0x70, 0x84, 0xe1, 0xa7, 0xed, 0xf9, 0xe8, 0x14, 0x83, 0x16, 0x25, 0xf7, 0x06, 0x09,
+    0x3c, 0x29, 0x1f, 0x1c, 0xac, 0x20, 0x01, 0x53, 0xd6, 0xdc, 0x4b, 0x46, 0xaa, 0x75, 0xc7, 0x47,
+    0xc1, 0x5c, 0x23, 0xd7, 0xca, 0x9f, 0xdc, 0xb9, 0x0a, 0xd8, 0x71, 0x5a, 0xbe, 0x6d, 0xa1, 0x3e,
+    0xaf, 0x4f, 0x40, 0x83, 0x1b, 0xee, 0x27, 0xef, 0xc1, 0xc3, 0xde, 0xe8, 0xf2, 0x4c, 0xa0, 0x83,
+    0x2b, 0xee, 0x74, 0x36, 0xab, 0x89, 0xff, 0x36, 0x76, 0xed, 0x70, 0xb5, 0xe0, 0xb8, 0x1a, 0x12,
+    0x58, 0xed, 0xd8, 0xe2, 0x14, 0x07, 0x00, 0x41, 0x08, 0x80, 0x31, 0x12, 0xa8, 0x0f, 0xfd, 0xb5,
+    0x5b, 0x65, 0x08, 0x6a, 0xbc, 0x09, 0x9c, 0x66, 0xed, 0x48, 0x79, 0x57, 0xdc, 0x60, 0xd4, 0xcb,
+    0xb7, 0x2a, 0xa8, 0x4f, 0x56, 0xee, 0xc5, 0xd0, 0xe7, 0xb9, 0x69, 0x83, 0x66, 0xce, 0x3e, 0xae,
+    0x4d, 0xa7, 0x00, 0xe8, 0xa3, 0xb2, 0x7e, 0xf8, 0xba, 0x3e, 0x95, 0xb6, 0x67, 0xe6, 0x5d, 0xaa,
+    0xe0, 0x06, 0x86, 0x52, 0x77, 0x55, 0xf4, 0x4d, 0x56, 0x99, 0xe3, 0x96, 0xd9, 0x5b, 0x37, 0xaa,
+    0x35, 0xa0, 0x1a, 0xd5, 0x1d, 0x17, 0xce, 0xf7, 0x2f, 0x27, 0xf1, 0x2d, 0x7a, 0x7c, 0x75, 0x6f,
+    0x74, 0xb1, 0xcf, 0x7b, 0x8f, 0x87, 0x0b, 0x73, 0x23, 0x56, 0x3e, 0xf6, 0xe7, 0x52, 0x47, 0x28,
+    0xac, 0xbb, 0x11, 0x81, 0xfa, 0xdc, 0xc4, 0x02, 0x12, 0x29, 0x04, 0xb2, 0x0a, 0xea, 0x58, 0xe7,
+    0x6a, 0x2c, 0x5d, 0x4a, 0xe3, 0xb9, 0x70, 0xd5, 0x4f, 0x00, 0xae, 0x89, 0x20, 0x75, 0x24, 0xca,
+    0x2d, 0x04, 0xd9, 0x62, 0x70, 0x85, 0x36, 0x10, 0xf8, 0x4a, 0x37, 0xc5, 0x3b, 0xce, 0xcc, 0xf1,
+    0x9d, 0x08, 0x53, 0xb8, 0xeb, 0x6e, 0xff, 0x7b, 0x3c, 0x5b, 0x90, 0x36, 0xbe, 0xb1, 0x97, 0x11,
+    0x2f, 0x34, 0x34, 0x10, 0x38, 0x27, 0x93, 0xa4, 0x68, 0x54, 0x5d, 0x18, 0x7a, 0x27, 0xfa, 0x35,
+    0x98, 0xe7, 0xf9, 0xd4, 0x97, 0xbe, 0x37, 0x91, 0x87, 0x06, 0x1c, 0x16, 0x0b, 0x96, 0xf7, 0x34,
+    0x5a, 0x2b, 0x95, 0x8f, 0x50, 0x5f, 0x3b, 0xc8, 0x96, 0xd3, 0xbf, 0xa2, 0x88, 0xf3, 0xc5, 0x04,
+    0x44, 0xde, 0xe2, 0x2d, 0x74, 0xc6, 0x48, 0xee, 0x14, 0x8c, 0x3f, 0x1f, 0xdb, 0x1c, 0x78, 0x83,
+    0x7d, 0x50, 0x0b, 0x04, 0x43, 0xa2, 0x32, 0xa9, 0xac, 0x12, 0xa2, 0xfb, 0xa9, 0x06, 0x19, 0x33,
+    0xa9, 0xfd, 0x69, 0x1c, 0x3c, 0x03, 0xf3, 0x66, 0xe9, 0x54, 0x11, 0x84, 0x23, 0x95, 0x1e, 0xf5,
+    0x52, 0x20, 0xbe, 0xe0, 0x89, 0x25, 0x68, 0x10, 0xd3, 0x96, 0x79, 0x13, 0x95, 0x87, 0x3e, 0x4d,
+    0xd1, 0xf1, 0xda, 0xb2, 0x17, 0x84, 0x56, 0xa1, 0xe5, 0xae, 0x35, 0xf9, 0x40, 0x27, 0x21, 0x18,
+    0x04, 0xd5, 0x05, 0x2b, 0x1a, 0xda, 0x6a, 0x57, 0x7a, 0x88, 0x3e, 0x87, 0x23, 0x1b, 0x3f, 0x06,
+    0x07, 0xc1, 0xa3, 0x04, 0x40, 0x51, 0xfd, 0xb0, 0xf8, 0x87, 0x93, 0x02, 0x14, 0x88, 0xbe, 0x9e,
+    0x78, 0xce, 0xd2, 0x3d, 0x80, 0xb9, 0x02, 0x36, 0x2f, 0x5b, 0xa6, 0x3f, 0x97, 0x94, 0x54, 0xc4,
+    0x15, 0x2f, 0x13, 0x3d, 0xb5, 0x2c, 0xb5, 0x63, 0x7b, 0xb3, 0x60, 0x42, 0x66, 0x8b, 0x46, 0x6c,
+    0x78, 0x0f, 0x9c, 0x1c, 0x34, 0xd8, 0x05, 0x11, 0x86, 0xc8, 0x54, 0x67, 0x51, 0xc2, 0x05, 0x7d,
+    0xaa, 0x2b, 0x2d, 0x33, 0x1d, 0x80, 0xaf, 0x22, 0xd3, 0xed, 0x51, 0x6d, 0x0f, 0xdc, 0x13, 0xf3,
+    0xe8, 0xfc, 0x88, 0xf4, 0xe1, 0xfe, 0x36, 0x83, 0x31, 0x89, 0x44, 0xbb, 0x55, 0x67, 0x4c, 0x1c,
+    0xdd, 0x08, 0x7d, 0x7e, 0x3a, 0x48, 0x53, 0xf7, 0x39, 0x95, 0xf2, 0x3d, 0x70, 0x50, 0xee, 0xe7,
+    0x49, 0x40, 0x58, 0x0b, 0xbe, 0x2e, 0x2b, 0xd3, 0xaa, 0xb8, 0x62, 0x50, 0x88, 0xa9, 0x1b, 0x02,
+    0x6a, 0xb8, 0xe4, 0xc0, 0x59, 0x66, 0x64, 0x42, 0x6b, 0x0a, 0xaf, 0xae, 0x0c, 0x29, 0x8d, 0x21,
+    0x43, 0x99, 0x5d, 0x57, 0xb7, 0x62, 0x25, 0xd5, 0x05, 0x10, 0x9e, 0x40, 0x1d, 0x92, 0x8c, 0xe4,
+    0xbe, 0xd1, 0xf3, 0xdc, 0x02, 0x0d, 0x78, 0x0c, 0x78, 0xc9, 0x39, 0x6b, 0x81, 0xfc, 0xc3, 0x4f,
+    0x5e, 0x18, 0x10, 0x3b, 0x0c, 0x42, 0x63, 0x0e, 0xac, 0xa7, 0xc1, 0xa2, 0xe4, 0x4e, 0x0c, 0x33,
+    0xd5, 0x21, 0x51, 0xe5, 0xd0, 0x99, 0xa8, 0xd1, 0x45, 0x53, 0x44, 0x44, 0xe3, 0x80, 0xe9, 0x74,
+    0x8f, 0x8e, 0x00, 0xc4, 0x0f, 0x9e, 0x24, 0xd5, 0x23, 0xee, 0x7a, 0x18, 0xa2, 0x65, 0xe6, 0xb8,
+    0xa7, 0xdb, 0x77, 0x43, 0xd1, 0xa2, 0xc2, 0xe5, 0xef, 0xca, 0x5b, 0x25, 0x9f, 0x45, 0x3b, 0xb1,
+    0xab, 0x32, 0x6d, 0x63, 0x2b, 0xc6, 0x68, 0x4d, 0x13, 0xee, 0xcd, 0x52, 0x31, 0xd6, 0x72, 0x39,
+    0xf3, 0xb2, 0x4c, 0x12, 0x87, 0xf3, 0x84, 0xc8, 0xdf, 0x11, 0xae, 0x80, 0x46, 0x85, 0x97, 0x6b,
+    0xe2, 0x50, 0xef, 0xca, 0x86, 0x84, 0x4c, 0xe2, 0xa8, 0x4d, 0x33, 0x92, 0xcd, 0xc8, 0x54, 0x11,
+    0x1f, 0x6a, 0x71, 0x15, 0x53, 0x20, 0x12, 0x79, 0xf4, 0xbc, 0x73, 0x06, 0x0b, 0x15, 0xea, 0x41,
+    0xd6, 0xfd, 0x72, 0x3a, 0x1e, 0xd3, 0xfc, 0x79, 0x20, 0xda, 0x19, 0x7c, 0x09, 0x88, 0xa4, 0xcb,
+    0x0a, 0xb3, 0x6b, 0xda, 0x21, 0x4a, 0xae, 0x55, 0x1c, 0x70, 0x5a, 0x7a, 0x0a, 0x21, 0xa1, 0xe1,
+    0xa6, 0x60, 0x3c, 0x92, 0xcc, 0x5c, 0xe4, 0xfe, 0x5c, 0x8f, 0xd7, 0xc9, 0xba, 0x64, 0x08, 0xdf,
+    0xdd, 0xf1, 0x20, 0x62, 0x8c, 0x74, 0xd5, 0x6d, 0xd1, 0x61, 0xa0, 0xe2, 0x2e, 0x0d, 0x71, 0x2a,
+    0xa7, 0xe0, 0x68, 0x99, 0x44, 0x61, 0xf2, 0x08, 0x46, 0x35, 0x8c, 0x9a, 0x5e, 0x84, 0xfc, 0x7d,
+    0xaa, 0xf6, 0x31, 0xa2, 0x5a, 0x54, 0x39, 0x7c, 0x36, 0x52, 0x14, 0x28, 0xab, 0x38, 0x89, 0x30,
+    0xa5, 0x18, 0x3b, 0xba, 0x64, 0x60, 0x7d, 0xeb, 0x27, 0x8e, 0xed, 0x4f, 0x1c, 0x5e, 0xa0, 0x7b,
+    0xba, 0x40, 0x15, 0x01, 0x09, 0xfc, 0x55, 0x20, 0x81, 0x62, 0x86, 0xa4, 0x06, 0xa5, 0xd8, 0x08,
+    0xbd, 0x28, 0x08, 0x74, 0xe7, 0x78, 0xe1, 0xfd, 0x3a, 0x14, 0xd3, 0x86, 0x46, 0x4a, 0x17, 0x12,
+    0x82, 0x07, 0x89, 0x5c, 0xf9, 0x6c, 0xa6, 0x49, 0x83, 0x5a, 0x80, 0x53, 0x4e, 0xe2, 0x76, 0x37,
+    0x86, 0x23, 0x97, 0xc7, 0x4a, 0x87, 0x35, 0x6a, 0xfb, 0xf0, 0x71, 0x7e, 0x7e, 0x4a, 0x3b, 0x4a,
+    0x3f, 0x5c, 0x79, 0x3b, 0x3e, 0x16, 0x52, 0x10, 0x5e, 0x44, 0xd0, 0x61, 0xa1, 0x91, 0x9f, 0xe3,
+    0x62, 0xa8, 0x71, 0x6a, 0x3c, 0x79, 0x97, 0xa4, 0x8a, 0x29, 0x3f, 0xb6, 0xf1, 0x5e, 0xb0, 0x54,
+    0x6c, 0x46, 0x06, 0xc4, 0xc0, 0x23, 0x1b, 0xf7, 0x1e, 0x3b, 0x60, 0x8d, 0xf4, 0x3d, 0x24, 0x6e,
+    0x33, 0x33, 0x38, 0x99, 0x0b, 0x54, 0x74, 0x1f, 0x39, 0x1c, 0x7a, 0xf0, 0xd5, 0xcb, 0x18, 0x2e,
+    0x69, 0xa3, 0xc8, 0x42, 0x5b, 0x87, 0xf1, 0x06, 0x68, 0xa5, 0x4a, 0x62, 0x2b, 0xc3, 0x87, 0x4d,
+    0xba, 0x01, 0xae, 0x41, 0x85, 0x08, 0xf4, 0x62, 0x46, 0x45, 0x15, 0x0b, 0x71, 0x97, 0xf2, 0x0f,
+    0x34, 0x59, 0xe0, 0xb4, 0x3d, 0xc8, 0xdd, 0xcf, 0x6a, 0x9b, 0x62, 0x1e, 0xe0, 0x87, 0x6d, 0xf9,
+    0x7d, 0x3f, 0x58, 0xad, 0xc4, 0x93, 0x03, 0x96, 0xc0, 0x41, 0x08, 0xdf, 0xf5, 0x93, 0xef, 0x8e,
+    0x15, 0x9f, 0x7d, 0x76, 0xaf, 0x20, 0x8d, 0xf3, 0xea, 0x03, 0xc2, 0xf1, 0xac, 0x3a, 0x51, 0xc9,
+    0xe4, 0x80, 0xe1, 0xcf, 0x2f, 0x5b, 0x8e, 0x68, 0xfa, 0x2a, 0x3c, 0x0e, 0x95, 0x2e, 0x93, 0xec,
+    0x70, 0x92, 0x0b, 0xa6, 0xa3, 0xa2, 0x37, 0x65, 0xc4, 0x36, 0xc9, 0x51, 0x54, 0xdd, 0xf2, 0xf4,
+    0x9f, 0x80, 0xd2, 0x85, 0x9c, 0xa5, 0xea, 0xd3, 0x9c, 0x38, 0xf1, 0x69, 0xb6, 0x29, 0x30, 0x42,
+    0x34, 0x67, 0x38, 0x13, 0xd2, 0xfd, 0x61, 0x69, 0xe4, 0x2e, 0x15, 0x04, 0xb7, 0x18, 0x80, 0xc2,
+    0x8d, 0x2a, 0x3b, 0xba, 0x29, 0x29, 0x79, 0x4c, 0x9d, 0x7b, 0x8c, 0x4d, 0x00, 0x05, 0x5e, 0x52,
+    0xcc, 0xa2, 0x1a, 0x4d, 0x23, 0xb7, 0x13, 0xb7, 0x8f, 0xc0, 0x25, 0x8d, 0x90, 0xa7, 0xc6, 0x0e,
+    0xc7, 0x2f, 0x33, 0xc0, 0xa3, 0x25, 0xeb, 0x44, 0x5b, 0x9d, 0x7c, 0xe5, 0x45, 0x13, 0x15, 0x0f,
+    0xc3, 0xdf, 0xd0, 0x6f, 0x39, 0x1d, 0xee, 0xcb, 0xa7, 0xd0, 0x2c, 0xfa, 0x7f, 0xd5, 0x5b, 0x07,
+    0x54, 0x93, 0x4d, 0xba, 0xfe, 0x52, 0x20, 0xa1, 0x85, 0x84, 0x00, 0x46, 0x6a, 0x28, 0xd2, 0x7e,
+    0x5a, 0x68, 0x22, 0x35, 0x09, 0x1d, 0x11, 0x41, 0x45, 0xc0, 0x5f, 0xe9, 0x02, 0x2a, 0x28, 0x20,
+    0x88, 0xf4, 0x14, 0x7a, 0x89, 0xa1, 0x08, 0x84, 0x1a, 0x10, 0x94, 0xa2, 0xd2, 0x94, 0x22, 0x96,
+    0x80, 0x48, 0x57, 0x82, 0x15, 0x84, 0x5f, 0x9a, 0x48, 0xf3, 0x57, 0x82, 0x88, 0xa8, 0x94, 0xab,
+    0xde, 0x75, 0xcf, 0xee, 0x3d, 0xbb, 0xf7, 0xfc, 0x7b, 0x77, 0xef, 0x39, 0xbb, 0xe7, 0xcc, 0x99,
+    0x77, 0xe6, 0xfb, 0xe6, 0xcc, 0xbc, 0xef, 0x7c, 0x33, 0xcf, 0xcc, 0x3b, 0xcf, 0x37, 0x98, 0x62,
+    0x07, 0x15, 0x54, 0x81, 0x11, 0x93, 0x05, 0x54, 0x6a, 0xb7, 0x70, 0x1d, 0x0d, 0xda, 0xd7, 0x4b,
+    0x1e, 0x48, 0xbe, 0x6a, 0xc5, 0xd5, 0xf6, 0xd2, 0x9f, 0xe3, 0xdf, 0x3c, 0xaa, 0x0f, 0xe7, 0x3d,
+    0x54, 0xeb, 0x73, 0x57, 0xee, 0x79, 0x0d, 0x85, 0xa4, 0x0f, 0xa8, 0x8a, 0x60, 0xdd, 0x1d, 0x5c,
+    0x34, 0x88, 0x4d, 0x35, 0x9f, 0x1e, 0x42, 0x41, 0xd7, 0xcc, 0x93, 0x6b, 0xc1, 0x9a, 0x44, 0x8a,
+    0xe6, 0x9f, 0xed, 0xe4, 0x7c, 0x78, 0x55, 0x19, 0x8d, 0x5e, 0x13, 0x9d, 0xd8, 0x83, 0xb3, 0xc0,
+    0x27, 0x82, 0x9d, 0x22, 0x05, 0xa3, 0x36, 0xfe, 0x66, 0x1f, 0x1d, 0x75, 0xc4, 0x2b, 0x97, 0x37,
+    0x48, 0xe5, 0xbd, 0xfa, 0xcc, 0x79, 0x55, 0x11, 0x9d, 0xb7, 0x2a, 0xb4, 0x3f, 0xee, 0x81, 0xd6,
+    0xf1, 0x6d, 0x20, 0xc7, 0xfb, 0xd2, 0x68, 0x7e, 0xf3, 0xeb, 0xf7, 0x34, 0x8c, 0x32, 0x4d, 0x3e,
+    0x99, 0xf7, 0xc0, 0xef, 0xee, 0x15, 0x29, 0xc6, 0x8e, 0x74, 0x34, 0x03, 0x59, 0x68, 0x7c, 0x50,
+    0xbb, 0x81, 0x2e, 0xcf, 0x7c, 0x4a, 0xa3, 0x3a, 0xc9, 0x96, 0x27, 0x00, 0x10, 0x29, 0x1d, 0x06,
+    0x39, 0x07, 0xcc, 0x52, 0x15, 0x75, 0x76, 0xe7, 0x5c, 0x65, 0xe8, 0x83, 0x55, 0xb4, 0xf2, 0x5d,
+    0xf8, 0x54, 0x76, 0xac, 0xc5, 0x91, 0x02, 0x46, 0x9b, 0x7c, 0x1f, 0x16, 0xea, 0xfd, 0x2d, 0x71,
+    0x9e, 0xe7, 0x58, 0xf5, 0x71, 0x4a, 0xff, 0xc0, 0xb3, 0xb8, 0xfb, 0xcd, 0x7f, 0xa7, 0xc8, 0x4f,
+    0x11, 0x38, 0xc6, 0x4b, 0x16, 0x49, 0x70, 0xe0, 0x2d, 0xdb, 0xda, 0x06, 0xca, 0xfb, 0x2e, 0x76,
+    0x96, 0xfb, 0xf2, 0x6a, 0x41, 0xdf, 0x1a, 0xdd, 0x5b, 0x8e, 0xfd, 0xfa, 0xfe, 0xee, 0x3f, 0x1c,
+    0xba, 0xc3, 0x2b, 0xae, 0x12, 0x98, 0x6b, 0x08, 0xd3, 0xcd, 0xce, 0xc6, 0x3f, 0xee, 0x44, 0x20,
+    0x00, 0x6f, 0x81, 0x1d, 0x9d, 0xf4, 0xa8, 0x0f, 0xa5, 0xff, 0x2a, 0x97, 0x24, 0x43, 0xd7, 0xdd,
+    0xd6, 0xe2, 0x7d, 0xf7, 0xd9, 0xef, 0xac, 0x39, 0x0a, 0x00, 0x81, 0xbf, 0xdf, 0x94, 0x06, 0xfd,
+    0xa4, 0xcd, 0xbf, 0xb3, 0xe6, 0x0d, 0xc3, 0x9c, 0x6f, 0x2e, 0x92, 0x67, 0x19, 0x32, 0x98, 0xbc,
+    0x8c, 0xf5, 0xc8, 0xec, 0xf8, 0xe6, 0x28, 0x4d, 0xfd, 0xf9, 0x72, 0x34, 0xd2, 0x74, 0x0f, 0x54,
+    0x94, 0xea, 0xaf, 0x67, 0x50, 0xcb, 0x2c, 0xbf, 0xc5, 0xfb, 0xcb, 0x7f, 0x74, 0x24, 0xf3, 0x21,
+    0xcb, 0xc6, 0xbf, 0x39, 0xc9, 0xb3, 0x7c, 0x56, 0xde, 0xa4, 0xb4, 0xd3, 0xfa, 0xfa, 0x01, 0xb3,
+    0x85, 0x0d, 0xf9, 0xd4, 0x7f, 0x8b, 0x0c, 0x60, 0xd9, 0x8f, 0xd0, 0xb7, 0xd2, 0x8b, 0xaa, 0xd5,
+    0x1a, 0xcd, 0x1d, 0x6c, 0x3e, 0xde, 0xa4, 0xc6, 0x08, 0x18, 0xf0, 0xfd, 0xf5, 0xff, 0x3f, 0xa3,
+    0x64, 0x8e, 0xeb, 0x98, 0xca, 0x8d, 0xdb, 0xc1, 0x23, 0xdb, 0x66, 0x23, 0xb8, 0xb6, 0x5f, 0x4b,
+    0xad, 0x17, 0x0e, 0x86, 0x4f, 0x96, 0xf1, 0x53, 0x43, 0x7a, 0xcd, 0xb0, 0x23, 0xf7, 0x36, 0x4d,
+    0x84, 0x2c, 0x42, 0xb2, 0xa4, 0x71, 0xd5, 0x80, 0x6b, 0xb1, 0xfd, 0x36, 0xb0, 0x10, 0x94, 0xfd,
+    0xcb, 0xb8, 0x3f, 0x0a, 0x84, 0xd6, 0x14, 0xcc, 0x34, 0x87, 0xda, 0x77, 0xe9, 0x99, 0x6d, 0xcc,
+    0x1e, 0xf7, 0x80, 0x94, 0xc2, 0xcb, 0x14, 0xcf, 0x48, 0x2b, 0x6a, 0x48, 0x96, 0x97, 0x4a, 0xf4,
+    0xe8, 0x4b, 0x59, 0x9b, 0x38, 0x08, 0x01, 0xb0, 0x1d, 0x27, 0x6a, 0x2f, 0x17, 0xb2, 0x10, 0x62,
+    0x2c, 0x32, 0xed, 0xfc, 0x83, 0x89, 0x4b, 0xa7, 0x3a, 0x1a, 0xc5, 0x20, 0xf9, 0xdb, 0x40, 0x54,
+    0x7c, 0xe6, 0xd1, 0x8a, 0xa4, 0xa1, 0xf1, 0x93, 0xb1, 0xea, 0xf0, 0x62, 0x08, 0x6a, 0x02, 0x34,
+    0xf0, 0xfb, 0x63, 0x70, 0x4a, 0x5f, 0xe6, 0xe0, 0xbc, 0x80, 0xeb, 0xca, 0x62, 0x00, 0xd9, 0x00,
+    0xcb, 0xda, 0xea, 0xa1, 0xd1, 0xcd, 0xa1, 0x8c, 0xe7, 0x72, 0x92, 0x27, 0x01, 0xb1, 0x8f, 0x54,
+    0x3c, 0x11, 0xf3, 0xfa, 0xf4, 0x91, 0x2a, 0xec, 0x8c, 0xa2, 0x84, 0x55, 0x36, 0xf7, 0xc6, 0x4a,
+    0xab, 0xcd, 0xc5, 0x77, 0x3a, 0x70, 0xb8, 0x0f, 0xe5, 0x88, 0x54, 0xb8, 0x98, 0xac, 0x0c, 0x1d,
+    0xe4, 0xbf, 0x3e, 0xbe, 0xc4, 0x96, 0x81, 0x2e, 0x72, 0x13, 0x3e, 0x9a, 0xdb, 0x09, 0xca, 0x90,
+    0xde, 0xf9, 0x73, 0xf8, 0x5d, 0xa1, 0x99, 0xe4, 0x25, 0x7c, 0x69, 0x53, 0xb3, 0x1c, 0x6e, 0xe2,
+    0x39, 0xfb, 0xa3, 0x2c, 0xd1, 0xee, 0x04, 0x88, 0x76, 0x03, 0x2a, 0xe9, 0xc8, 0xe4, 0xe5, 0x7e,
+    0x30, 0x34, 0xc3, 0x53, 0xfe, 0xb1, 0x13, 0xd3, 0x2c, 0x8b, 0xdd, 0x7d, 0x7e, 0x1b, 0x20, 0xc6,
+    0xcb, 0x13, 0xd2, 0x7c, 0xbf, 0xa0, 0xaf, 0xb0, 0x94, 0xf2, 0x49, 0x46, 0x0c, 0x12, 0xf9, 0x6c,
+    0x6e, 0x4b, 0xde, 0x85, 0x20, 0x76, 0x6d, 0x18, 0xc4, 0x1f, 0xeb, 0x37, 0x38, 0x45, 0x6b, 0x85,
+    0x42, 0xb5, 0x08, 0x6a, 0x82, 0x86, 0x19, 0xc8, 0x37, 0x58, 0xd1, 0x1e, 0x0c, 0x20, 0x42, 0x77,
+    0xda, 0xc1, 0x4f, 0x81, 0x3c, 0x68, 0x1e, 0x5f, 0x24, 0x25, 0x5a, 0xef, 0x2a, 0x9b, 0x0b, 0x2e,
+    0x4f, 0x15, 0xc2, 0xdc, 0xcb, 0x90, 0x76, 0x7f, 0xfa, 0x1e, 0x54, 0xad, 0x76, 0x1f, 0x13, 0x7b,
+    0xce, 0x3e, 0x9f, 0x38, 0x72, 0x17, 0x3f, 0xaf, 0x6b, 0xc7, 0xe6, 0xde, 0xea, 0x7a, 0x9b, 0xde,
+    0x10, 0x55, 0xf6, 0xf9, 0x82, 0x6a, 0x3a, 0x8e, 0x35, 0x72, 0x47, 0xf8, 0x08, 0x8c, 0x28, 0xb3,
+    0xe2, 0x0a, 0xca, 0xf1, 0xa6, 0x0f, 0x38, 0x13, 0xe9, 0xca, 0xe2, 0xb9, 0xa6, 0xe9, 0xbe, 0x3f,
+    0xdf, 0x58, 0x13, 0xed, 0x5c, 0xf4, 0xf6, 0x55, 0x8b, 0x95, 0x43, 0xdf, 0x2d, 0xd1, 0xd4, 0x48,
+    0x31, 0x5a, 0x7d, 0xbc, 0xf8, 0x8a, 0xd3, 0x2e, 0x5b, 0xb8, 0x02, 0x71, 0x94, 0x42, 0xeb, 0xb9,
+    0x98, 0xfd, 0x9e, 0x97, 0x69, 0xb1, 0x96, 0xd0, 0x9f, 0xad, 0x10, 0x60, 0x3b, 0xf5, 0xa7, 0x8d,
+    0xf2, 0x77, 0xcf, 0x95, 0x96, 0xfe, 0xf8, 0x7e, 0xa5, 0xad, 0x4f, 0x37, 0xf8, 0x46, 0x29, 0x38,
+    0x64, 0x8a, 0x64, 0xab, 0x3c, 0xb6, 0xe4, 0x46, 0x68, 0xc4, 0x5c, 0xe2, 0x75, 0x30, 0x90, 0x50,
+    0xaf, 0x34, 0xa2, 0x1a, 0x14, 0xc8, 0x3f, 0x23, 0xf5, 0x30, 0x1d, 0x6f, 0xa5, 0xaa, 0x9f, 0xf8,
+    0x94, 0x36, 0x76, 0xaa, 0x75, 0x48, 0x18, 0x20, 0x36, 0xe9, 0x74, 0x34, 0x6b, 0xb4, 0xd7, 0x7a,
+    0xa5, 0xd4, 0xea, 0x79, 0xa2, 0x05, 0x2c, 0xf5, 0xfd, 0xb2, 0x2d, 0x05, 0x30, 0xf4, 0xce, 0xdf,
+    0x68, 0x6e, 0xe2, 0xb9, 0x03, 0x65, 0xab, 0x78, 0x3e, 0xb0, 0x86, 0x44, 0x54, 0x71, 0x33, 0x0a,
+    0x1f, 0xe0, 0x97, 0x8d, 0x1a, 0x81, 0x18, 0xf9, 0xe4, 0x4f, 0xa9, 0x26, 0x0b, 0xb0, 0x7a, 0x86,
+    0x12, 0x89, 0x53, 0x67, 0xbb, 0x34, 0x39, 0x98, 0xc0, 0xc6, 0x4f, 0x62, 0x5c, 0x3f, 0xc6, 0x31,
+    0x73, 0x0a, 0x81, 0x1f, 0xe9, 0x46, 0xbe, 0xd2, 0x21, 0x56, 0xec, 0x7c, 0x9f, 0xe4, 0xdb, 0xd1,
+    0x9e, 0x31, 0x95, 0xcd, 0x34, 0x64, 0xea, 0x98, 0x10, 0x46, 0x79, 0x33, 0x41, 0x45, 0xc3, 0xc5,
+    0x34, 0xfa, 0x23, 0x03, 0x08, 0xfb, 0xbe, 0x36, 0xe6, 0x42, 0xa0, 0xd1, 0xa7, 0xbe, 0x74, 0x5e,
+    0xa9, 0x73, 0x4c, 0x73, 0x93, 0xf7, 0xcc, 0x31, 0x93, 0x61, 0xb8, 0xad, 0x1e, 0x4b, 0xd6, 0xa2,
+    0x67, 0xaf, 0xa5, 0x7a, 0xcf, 0x7a, 0x70, 0xd7, 0xc9, 0x6d, 0x00, 0xae, 0xde, 0xc6, 0xfd, 0x7b,
+    0xde, 0x4c, 0xf3, 0xdb, 0x8c, 0x2e, 0x7d, 0x99, 0xe4, 0x73, 0xbf, 0xbf, 0x3e, 0xf7, 0xc2, 0x09,
+    0x2a, 0x6f, 0x3f, 0x2c, 0xcd, 0x9e, 0x6a, 0xcf, 0xf9, 0x32, 0xa6, 0x83, 0x1d, 0x60, 0xa6, 0x31,
+    0xf9, 0xde, 0xc8, 0x27, 0xb6, 0x43, 0xac, 0x25, 0x5e, 0x7c, 0x5b, 0x1f, 0x5c, 0xb3, 0xc4, 0x85,
+    0x7c, 0x9d, 0x79, 0x64, 0x4b, 0x28, 0xd0, 0xd0, 0x7b, 0xf6, 0xfb, 0xe3, 0xad, 0x07, 0x51, 0x82,
+    0xf2, 0x12, 0x5b, 0x79, 0x4a, 0x4c, 0x39, 0xe4, 0x6b, 0xcd, 0x1e, 0x02, 0x10, 0xbf, 0xcc, 0xe3,
+    0xc1, 0x3e, 0xe9, 0xfa, 0x35, 0x7b, 0x03, 0xc4, 0xb7, 0x62, 0x69, 0x4a, 0x05, 0x19, 0x3f, 0xf9,
+    0x93, 0x72, 0x42, 0x97, 0x81, 0x86, 0xf1, 0x93, 0x43, 0x69, 0xe6, 0x96, 0x98, 0x53, 0x6c, 0xdc,
+    0x4a, 0x47, 0xa1, 0x40, 0xf0, 0x90, 0x51, 0x21, 0x3f, 0x3b, 0x29, 0x0b, 0x11, 0xb7, 0x37, 0xe7,
+    0xd0, 0x00, 0x52, 0x56, 0x60, 0x06, 0xf2, 0xd6, 0x21, 0x37, 0x38, 0xa8, 0xf7, 0x36, 0xe8, 0x7e,
+    0xb8, 0x78, 0xf8, 0x12, 0x64, 0xe0, 0x17, 0xc8, 0xc1, 0x14, 0x89, 0xae, 0x19, 0x92, 0x38, 0x14,
+    0xc4, 0xe7, 0xe1, 0xd0, 0x7a, 0x9a, 0xe3, 0xbd, 0x0d, 0xb4, 0x59, 0x1d, 0xa5, 0xd7, 0x7b, 0xc0,
+    0x9e, 0xbe, 0xdf, 0x11, 0xf2, 0x02, 0x24, 0xd5, 0x65, 0xd6, 0x07, 0x33, 0xad, 0xec, 0x47, 0x7a,
+    0x48, 0xc9, 0xdd, 0x85, 0x79, 0xe6, 0xe6, 0x6b, 0x9a, 0x9f, 0x0b, 0x09, 0x6c, 0xf7, 0xd9, 0x20,
+    0xd7, 0x07, 0xdc, 0x3d, 0xfa, 0x63, 0xc2, 0xc7, 0xce, 0x1c, 0x5c, 0xd6, 0xbf, 0x04, 0xbc, 0x7f,
+    0xec, 0x46, 0xe0, 0xe7, 0xf6, 0x8a, 0x38, 0x33, 0x87, 0x5f, 0xe8, 0x8c, 0x93, 0xdb, 0xb0, 0x38,
+    0x8b, 0x24, 0x6c, 0x44, 0x90, 0xd9, 0xcc, 0x19, 0x98, 0x04, 0x8c, 0xba, 0x63, 0x63, 0xe5, 0x6a,
+    0x62, 0x35, 0x89, 0x24, 0x07, 0x29, 0xbd, 0xd8, 0x6f, 0x27, 0x57, 0xde, 0x85, 0x92, 0x02, 0x4b,
+    0xdd, 0x88, 0x63, 0x6d, 0x03, 0x8f, 0x2e, 0x1d, 0xa7, 0x4b, 0xcf, 0x71, 0xa2, 0x32, 0xc0, 0x53,
+    0xf2, 0xce, 0xca, 0x32, 0x6c, 0x10, 0x64, 0x86, 0x65, 0xec, 0x23, 0x3f, 0xef, 0xac, 0x09, 0x08,
+    0xf6, 0x30, 0x94, 0x64, 0x7d, 0x4c, 0x1b, 0x8c, 0x4a, 0xc8, 0x67, 0xc1, 0xf0, 0xcd, 0x13, 0xe8,
+    0x15, 0x6a, 0xcc, 0x24, 0x76, 0x73, 0x65, 0x65, 0xe8, 0xd6, 0xce, 0x02, 0xe3, 0x0e, 0xa1, 0x50,
+    0x27, 0x36, 0x30, 0xad, 0xa7, 0xdf, 0x7a, 0xdf, 0xcf, 0x47, 0x33, 0x3c, 0x5a, 0x70, 0x79, 0xf1,
+    0xb3, 0x84, 0xbb, 0x33, 0x85, 0x9e, 0x5d, 0xc7, 0x23, 0x9b, 0x08, 0x37, 0x6f, 0x5a, 0xe6, 0x66,
+    0xcc, 0xc7, 0x28, 0x4d, 0x54, 0xde, 0xab, 0x85, 0xb2, 0xd5, 0x44, 0xfd, 0x86, 0x8c, 0x8a, 0x22,
+    0x96, 0x90, 0x7d, 0xf1, 0x02, 0x69, 0x6f, 0xec, 0xa9, 0x87, 0xbc, 0xad, 0xe4, 0xe5, 0xd1, 0xd8,
+    0x08, 0x45, 0x99, 0x0b, 0xd1, 0x65, 0xef, 0xaa, 0x3e, 0xc0, 0x05, 0xc6, 0x87, 0x5d, 0x05, 0x1c,
+    0xbc, 0x80, 0x62, 0x3d, 0x81, 0xe7, 0x50, 0x04, 0xb7, 0x86, 0xf6, 0x93, 0xf8, 0x4c, 0x3c, 0xff,
+    0x25, 0x7c, 0x9d, 0x0d, 0x8f, 0x49, 0xf0, 0x8f, 0x71, 0x31, 0xf7, 0x4e, 0xd7, 0x14, 0x94, 0x8a,
+    0x54, 0xdd, 0xd8, 0xf5, 0x06, 0xc9, 0xf2, 0x95, 0xcb, 0xdb, 0x5a, 0x45, 0x14, 0xc9, 0xad, 0x49,
+    0x3f, 0xdd, 0xa1, 0x09, 0x2d, 0xed, 0x66, 0xc0, 0x2b, 0x77, 0x92, 0xe2, 0x22, 0x7c, 0x57, 0x12,
+    0x48, 0x80, 0x28, 0xb0, 0x62, 0xbd, 0x22, 0xfe, 0xa8, 0xd7, 0x05, 0x0f, 0xa2, 0x53, 0x94, 0x18,
+    0x49, 0x6f, 0x61, 0xbb, 0x42, 0xb2, 0xe1, 0xfe, 0x6d, 0xf2, 0x30, 0x7a, 0xd2, 0x35, 0xf1, 0xd5,
+    0xdd, 0x9f, 0xaa, 0x46, 0x7d, 0x20, 0x5f, 0x37, 0xdd, 0x66, 0xf0, 0xad, 0x36, 0x22, 0xfd, 0xd6,
+    0xa1, 0xf9, 0x85, 0x57, 0xe3, 0x8b, 0x11, 0x66, 0x58, 0xa3, 0xdd, 0x1c, 0x98, 0x3d, 0xe8, 0xb3,
+    0xe0, 0x1c, 0x81, 0x3e, 0x08, 0xd3, 0xd8, 0xd8, 0x06, 0xa0, 0x80, 0xb5, 0x84, 0xf0, 0x66, 0x3a,
+    0x1e, 0x11, 0xa4, 0xf9, 0xe1, 0x31, 0xd1, 0xfe, 0xf6, 0xf7, 0xee, 0x36, 0x80, 0x0e, 0x92, 0x37,
+    0xb0, 0x25, 0x60, 0x6e, 0x02, 0x05, 0x42, 0xf2, 0xa6, 0x45, 0x81, 0xaf, 0xa5, 0xfe, 0xe2, 0x95,
+    0x3a, 0x52, 0x0e, 0x90, 0x34, 0xe1, 0x0f, 0xb3, 0x8d, 0x8a, 0x82, 0x30, 0x4d, 0x6f, 0xb1, 0xd8,
+    0x7a, 0x73, 0x42, 0x11, 0x7c, 0x6b, 0x3a, 0x52, 0x78, 0x90, 0xb5, 0x01, 0x48, 0x59, 0xb9, 0xe4,
+    0x17, 0x5e, 0xf9, 0x3e, 0xaf, 0x10, 0x59, 0x42, 0xd1, 0x33, 0x3f, 0x61, 0xcb, 0x89, 0xee, 0xe4,
+    0xca, 0xf5, 0x2d, 0xda, 0xd1, 0x0e, 0x95, 0xf5, 0x44, 0x1a, 0xae, 0xe0, 0x09, 0xc6, 0x4a, 0x8b,
+    0x4f, 0x86, 0x04, 0x30, 0xf1, 0x20, 0xf1, 0x20, 0x54, 0xe3, 0x51, 0xaf, 0x2f, 0x8c, 0x4e, 0xe3,
+    0x09, 0x38, 0x98, 0xe6, 0x12, 0x2c, 0x50, 0x25, 0xf9, 0xe9, 0x89, 0x67, 0x09, 0x37, 0x4c, 0x9b,
+    0x7a, 0x8f, 0x6b, 0x43, 0x0b, 0xee, 0x99, 0x19, 0xce, 0x7e, 0x7f, 0x43, 0x6b, 0x88, 0x14, 0x5f,
+    0x76, 0x9a, 0x97, 0x72, 0xbc, 0x3c, 0x5c, 0x2f, 0x26, 0x11, 0xd7, 0x95, 0x09, 0x3b, 0xde, 0x6f,
+    0x17, 0x6a, 0x42, 0xe2, 0x09, 0x22, 0x5c, 0x4a, 0x0a, 0x6e, 0xee, 0x86, 0x0b, 0xa4, 0x2f, 0x7b,
+    0x18, 0x52, 0x8e, 0xa7, 0x3f, 0x91, 0xd8, 0x45, 0xe7, 0xfa, 0x8c, 0x89, 0x58, 0x9e, 0x1f, 0x51,
+    0x3d, 0x4f, 0x93, 0x92, 0x11, 0x68, 0xfe, 0x6b, 0xdb, 0xa1, 0xdd, 0xdb, 0x40, 0x83, 0xf4, 0x63,
+    0x2d, 0xc9, 0x0f, 0xe6, 0xb2, 0x30, 0xfd, 0xfb, 0xc8, 0x98, 0xaa, 0x71, 0x4d, 0xeb, 0x38, 0xaa,
+    0x39, 0x4f, 0x36, 0x5f, 0x1f, 0xa4, 0x8f, 0x95, 0x49, 0x92, 0xd8, 0x90, 0x49, 0x7e, 0x05, 0x5f,
+    0x53, 0x01, 0xbb, 0x34, 0x26, 0xbf, 0xcf, 0x9c, 0xac, 0xc3, 0x97, 0x49, 0xdd, 0x0d, 0x43, 0x21,
+    0x38, 0x69, 0x9f, 0xa4, 0xdb, 0xe8, 0x50, 0x99, 0x0b, 0xbe, 0x0c, 0xef, 0xc4, 0xb6, 0x59, 0x76,
+    0x45, 0x2f, 0x76, 0x8b, 0xd0, 0x1a, 0xa7, 0xa4, 0xb9, 0x88, 0xd4, 0x7f, 0x33, 0xb8, 0x3c, 0x3c,
+    0x4d, 0x3b, 0x46, 0x97, 0x06, 0x2b, 0xfc, 0x58, 0x12, 0x10, 0x24, 0x21, 0x18, 0x17, 0xa2, 0x19,
+    0x68, 0xf3, 0x26, 0x27, 0x65, 0xe6, 0x6f, 0x69, 0xc1, 0x79, 0x26, 0xee, 0x77, 0x0c, 0x0c, 0xf9,
+    0x33, 0xbf, 0x9b, 0x20, 0xdc, 0xb9, 0x0d, 0xb0, 0x4c, 0xaf, 0xb4, 0x18, 0xf3, 0xea, 0xef, 0x31,
+    0x65, 0x5b, 0x21, 0x04, 0xe3, 0x07, 0x48, 0x23, 0xb9, 0x46, 0xdb, 0x80, 0xcc, 0x2d, 0xd2, 0x28,
+    0x19, 0x23, 0x30, 0x01, 0x99, 0x5a, 0xf6, 0xea, 0x5d, 0x86, 0xe1, 0xa2, 0xbd, 0x31, 0xef, 0xc5,
+    0x3e, 0xa6, 0xa4, 0xdc, 0x0a, 0xca, 0xfa, 0x25, 0x87, 0xbe, 0x20, 0xa3, 0xf8, 0x48, 0xff, 0xbb,
+    0x19, 0xd1, 0xe3, 0x70, 0xd9, 0xe0, 0x9d, 0xeb, 0xce, 0x04, 0x8b, 0x50, 0x61, 0x67, 0x82, 0x7d,
+    0xe2, 0x57, 0x16, 0xe1, 0xeb, 0xec, 0x6c, 0x69, 0x2c, 0x5d, 0xd8, 0x9e, 0xff, 0x91, 0x95, 0x83,
+    0xca, 0xef, 0x79, 0x07, 0xe4, 0x2b, 0x1e, 0x65, 0x62, 0x16, 0x88, 0xc0, 0x30, 0x2f, 0xb4, 0x22,
+    0x00, 0xb3, 0xd5, 0x96, 0x05, 0xb1, 0x03, 0xa5, 0x0c, 0x76, 0x34, 0xac, 0x06, 0xa4, 0xd1, 0x6c,
+    0x64, 0xca, 0xc7, 0x02, 0x74, 0x16, 0x44, 0x49, 0xdf, 0xd0, 0x73, 0xdc, 0x18, 0x49, 0xe8, 0x46,
+    0x60, 0x04, 0x65, 0x35, 0xbe, 0x4e, 0xc1, 0x24, 0x28, 0x10, 0x42, 0xcb, 0xc8, 0x22, 0x95, 0x44,
+    0x12, 0xec, 0x82, 0x86, 0x00, 0x1a, 0x82, 0x86, 0x92, 0x8e, 0xa8, 0x3e, 0xe8, 0xed, 0xe8, 0x00,
+    0x9d, 0x79, 0x07, 0x8a, 0xae, 0x9c, 0xe6, 0xcb, 0x30, 0x38, 0xc1, 0x00, 0x45, 0x0f, 0x34, 0xb8,
+    0xa8, 0xca, 0x87, 0x83, 0xa4, 0xad, 0x29, 0x86, 0x20, 0x33, 0xf9, 0xbc, 0xfc, 0x41, 0xb3, 0x18,
+    0x16, 0x20, 0x04, 0x48, 0x96, 0xdb, 0xaf, 0x5b, 0xb5, 0xe7, 0x8c, 0x15, 0x59, 0x4b, 0x93, 0xb7,
+    0x81, 0x7b, 0xf0, 0x1b, 0xd0, 0x80, 0x6c, 0x03, 0xd9, 0xc9, 0xd8, 0x9e, 0x92, 0x4c, 0x94, 0xaa,
+    0x2b, 0xfe, 0xdc, 0xe0, 0x0a, 0x5a, 0x07, 0xd4, 0xd2, 0x60, 0xb8, 0x9a, 0x86, 0xb7, 0x10, 0xc2,
+    0x1b, 0xa5, 0xca, 0xce, 0x64, 0x59, 0xfb, 0x37, 0x8f, 0x09, 0x20, 0x51, 0xbd, 0xc0, 0x6d, 0xa3,
+    0xb7, 0x61, 0xe6, 0x56, 0xf2, 0x42, 0x1c, 0x4e, 0xfd, 0x93, 0x5a, 0x1d, 0xd4, 0xbd, 0x7a, 0xc3,
+    0x4b, 0xea, 0x6e, 0xf3, 0x5b, 0x9e, 0x03, 0xab, 0x54, 0x7b, 0x58, 0xeb, 0x70, 0xe9, 0xc0, 0xaa,
+    0x90, 0x38, 0x2a, 0xbf, 0xe7, 0xd5, 0xfb, 0x42, 0x6c, 0x56, 0x90, 0xf1, 0x49, 0xa4, 0xa3, 0xbe,
+    0xf6, 0x1e, 0x49, 0x7c, 0x6d, 0xb3, 0xb5, 0x0c, 0x74, 0xde, 0x92, 0x70, 0x63, 0x01, 0x63, 0x9d,
+    0xc6, 0xfd, 0xf0, 0x26, 0xcc, 0xdc, 0x25, 0x05, 0x72, 0xd4, 0xcb, 0x9d, 0xf9, 0x3f, 0x6a, 0x2c,
+    0xf3, 0xc2, 0x4a, 0xe2, 0xc8, 0x61, 0x18, 0x1b, 0xaa, 0x68, 0xdf, 0x2a, 0xc4, 0x3d, 0xef, 0x07,
+    0xe8, 0xaf, 0x47, 0x4c, 0xcb, 0xe9, 0xa9, 0xb3, 0x03, 0xd9, 0x96, 0x30, 0xb4, 0x3d, 0xaa, 0x02,
+    0x8c, 0x98, 0x5d, 0xf7, 0xd4, 0x11, 0xd4, 0xfd, 0xc4, 0xd2, 0x5b, 0x5e, 0x37, 0x9f, 0x13, 0xc9,
+    0x61, 0xb7, 0xad, 0x7c, 0x83, 0x27, 0xb9, 0x1f, 0xe3, 0x97, 0x65, 0x86, 0x1d, 0x6f, 0x6c, 0x56,
+    0xb9, 0x96, 0x5a, 0xeb, 0x55, 0x33, 0x52, 0xf3, 0xcf, 0x24, 0xaa, 0xef, 0x4a, 0x56, 0x2b, 0xaf,
+    0x8a, 0x3e, 0x70, 0x6a, 0x70, 0x0a, 0x70, 0xfa, 0x55, 0xe4, 0xf0, 0xbf, 0x2c, 0xe1, 0x30, 0x4c,
+    0x09, 0x81, 0xa2, 0x97, 0x7f, 0xa0, 0xda, 0x32, 0x2a, 0x14, 0x14, 0xdd, 0x95, 0xc7, 0x7c, 0x7a,
+    0x87, 0xbb, 0x72, 0x5e, 0x57, 0x83, 0x50, 0x1d, 0x29, 0xb0, 0x97, 0x7d, 0xd2, 0x8d, 0x7a, 0x60,
+    0x55, 0xec, 0x3f, 0xe0, 0xa1, 0xd9, 0xbe, 0xfb, 0x67, 0xc7, 0xb4, 0xff, 0xdb, 0x92, 0xd5, 0xad,
+    0x1f, 0xfb, 0xa8, 0xfd, 0xff, 0x76, 0x19, 0xc7, 0xf5, 0x3e, 0xf9, 0xdb, 0xe2, 0x84, 0xd6, 0xe1,
+    0x1f, 0xa0, 0xf6, 0x9f, 0x1d, 0x09, 0xa6, 0x53, 0xf8, 0x1e, 0xdc, 0x30, 0x2c, 0x76, 0xfe, 0xce,
+    0x04, 0x21, 0xbf, 0x33, 0x41, 0x60, 0x10, 0x14, 0x0c, 0x86, 0x80, 0xfe, 0x82, 0x09, 0x42, 0x3a,
+    0x7a, 0x92, 0x83, 0x33, 0xb1, 0x78, 0x4d, 0x07, 0x8f, 0x86, 0x3f, 0x31, 0x41, 0xdf, 0xff, 0x0d,
+    0x46, 0xda, 0xf3, 0xa3, 0xcb, 0xd6, 0x77, 0x5e, 0x58, 0xdf, 0xfc, 0xdf, 0x3d, 0xc4, 0x3f, 0x24,
+    0xea, 0xf5, 0x35, 0x11, 0xb0, 0x59, 0xdf, 0x7b, 0x5f, 0x66, 0xff, 0xa0, 0x8f, 0x56, 0xc8, 0x6f,
+    0x5e, 0x88, 0x5b, 0x4f, 0xb2, 0x72, 0x5f, 0xee, 0xe6, 0xc7, 0x68, 0x7a, 0x74, 0x50, 0xb9, 0xff,
+    0x2f, 0xc2, 0x53, 0xea, 0xf1, 0xe5, 0x4a, 0x83, 0x8e, 0x12, 0xe9, 0x9e, 0x4f, 0x6f, 0xec, 0xae,
+    0x0a, 0x99, 0x61, 0x8f, 0x23, 0x56, 0x37, 0x39, 0x6c, 0x1c, 0x9b, 0x5b, 0xd6, 0x58, 0x51, 0x89,
+    0x9b, 0xce, 0xcb, 0x07, 0xb9, 0x66, 0x1a, 0x4d, 0x12, 0x73, 0x50, 0x56, 0xb5, 0x6f, 0xd8, 0x8c,
+    0x6b, 0x67, 0xe0, 0xf4, 0xc3, 0xcb, 0x51, 0x4e, 0xba, 0x71, 0xd5, 0x5a, 0x9e, 0x3b, 0xaf, 0x93,
+    0xcd, 0x6b, 0x5f, 0x99, 0x5e, 0xc7, 0x15, 0x4c, 0x0a, 0xdb, 0x1a, 0x2f, 0x7c, 0xdd, 0x06, 0x4c,
+    0x06, 0x6c, 0x88, 0xc9, 0x22, 0xf7, 0xdd, 0x8d, 0x28, 0x39, 0xd1, 0x01, 0xc3, 0xfb, 0x76, 0xdf,
+    0x9a, 0x37, 0xbb, 0xa2, 0x85, 0xbb, 0x72, 0x09, 0x20, 0x0a, 0x85, 0xad, 0x4f, 0xc9, 0x96, 0x51,
+    0x18, 0x70, 0xa7, 0xa4, 0x05, 0xce, 0xc3, 0xfe, 0x7c, 0xcf, 0x11, 0x65, 0x04, 0x5c, 0xf7, 0xd1,
+    0x15, 0xe3, 0x6d, 0xe0, 0xb3, 0x35, 0x3f, 0x88, 0x1d, 0x57, 0xcb, 0xd0, 0x3a, 0xbe, 0x37, 0xc7,
+    0xc9, 0x0b, 0x0e, 0x72, 0xfb, 0x2d, 0x5b, 0xe8, 0x71, 0x24, 0x0a, 0xe7, 0x63, 0xb7, 0x80, 0xbe,
+    0xac, 0x3b, 0x9f, 0xe1, 0x19, 0xe3, 0xcb, 0xe1, 0x39, 0x92, 0x06, 0x66, 0x94, 0x2d, 0x3f, 0x61,
+    0xb7, 0x88, 0x63, 0xaf, 0x9e, 0x38, 0x23, 0x29, 0x2f, 0xf4, 0x26, 0x2a, 0x92, 0xe7, 0xc4, 0x61,
+    0x00, 0xf1, 0xcc, 0x01, 0x91, 0x11, 0x65, 0xd6, 0x92, 0x8c, 0x61, 0x27, 0x70, 0x3f, 0x7b, 0x11,
+    0x61, 0xf2, 0x59, 0x4e, 0xec, 0xda, 0x8e, 0x7d, 0xb0, 0x6f, 0x4d, 0x8b, 0xba, 0xdb, 0x64, 0xa3,
+    0x86, 0x90, 0x48, 0x41, 0x48, 0xeb, 0xe4, 0x9e, 0x49, 0x22, 0xf9, 0xf5, 0x6e, 0xb7, 0xc2, 0x25,
+    0xe4, 0x51, 0xa8, 0xd0, 0xb9, 0x92, 0xf3, 0x72, 0x39, 0x81, 0x9e, 0xc9, 0x77, 0x3c, 0x47, 0xba,
+    0xf6, 0x76, 0x03, 0x27, 0x02, 0xe5, 0xb8, 0x24, 0x4c, 0xbc, 0xd7, 0x23, 0x5e, 0x82, 0x4c, 0x50,
+    0x17, 0x63, 0xf3, 0xbb, 0x2a, 0xf9, 0x96, 0x5a, 0x47, 0x2d, 0xe4, 0xcc, 0xf4, 0x4f, 0xc9, 0xa2,
+    0xcf, 0x8e, 0x1f, 0xeb, 0x73, 0x0c, 0xf7, 0x37, 0xd3, 0x48, 0xa2, 0x5c, 0xa6, 0x1c, 0xc4, 0x83,
+    0xcb, 0x35, 0x24, 0x67, 0x50, 0xa5, 0x14, 0x33, 0xda, 0x80, 0x55, 0xd3, 0xba, 0x43, 0xc1, 0xad,
+    0x9c, 0x2b, 0x73, 0xa2, 0x5f, 0x3f, 0x68, 0x7b, 0x7f, 0x46, 0x9d, 0x17, 0xbb, 0xbb, 0x12, 0x66,
+    0xc5, 0xde, 0x1b, 0x32, 0xff, 0x1b, 0xf5, 0xf3, 0xc1, 0xf6, 0x3b, 0x12, 0x56, 0x46, 0x78, 0xbc,
+    0x11, 0x62, 0xa6, 0x50, 0x8e, 0xee, 0x0c, 0x56, 0x32, 0x56, 0xbc, 0xb0, 0x8f, 0x3c, 0x45, 0x36,
+    0x50, 0xcc, 0x2c, 0x98, 0xde, 0x33, 0x0d, 0x06, 0x4d, 0x86, 0x4b, 0x84, 0xa5, 0xaa, 0xc3, 0x2f,
+    0x39, 0xd8, 0xd8, 0xae, 0x8a, 0x47, 0x60, 0x91, 0x1f, 0x93, 0xbd, 0xb9, 0x6e, 0x24, 0x68, 0xb7,
+    0x94, 0x12, 0x29, 0x57, 0x85, 0xee, 0x9d, 0x29, 0xb1, 0x53, 0x08, 0x2f, 0x23, 0xd6, 0x11, 0x0e,
+    0xba, 0xec, 0xb8, 0x28, 0x8e, 0xed, 0xd8, 0xa7, 0x03, 0x7d, 0x94, 0x13, 0x1e, 0xc3, 0xc6, 0x55,
+    0xf0, 0x4a, 0x5e, 0xba, 0xde, 0x18, 0xc3, 0xb1, 0xb1, 0xae, 0xb7, 0x08, 0x4d, 0x2e, 0x3f, 0xe7,
+    0x3d, 0x52, 0x5c, 0x42, 0x6a, 0x4a, 0x92, 0xb7, 0x20, 0x9d, 0xe4, 0xee, 0xfb, 0xf0, 0x20, 0x5c,
+    0x8d, 0x30, 0x9e, 0x22, 0x51, 0x82, 0xc0, 0x7a, 0x5b, 0x0b, 0x1b, 0x5a, 0x1d, 0xf3, 0xf9, 0x3a,
+    0x9d, 0x95, 0xe9, 0x91, 0xba, 0x80, 0x32, 0x7f, 0xdb, 0xd3, 0x60, 0x68, 0x6c, 0x2a, 0x9f, 0x24,
+    0x29, 0xa4, 0x11, 0x0e, 0x65, 0x19, 0xf4, 0x8b, 0xc4, 0x6b, 0x06, 0x3c, 0x8f, 0xd0, 0xbf, 0x3e,
+    0x5b, 0x65, 0x98, 0x29, 0x97, 0xdd, 0xd1, 0xc7, 0x4c, 0x50, 0x2a, 0x68, 0x26, 0xac, 0xb9, 0xb6,
+    0xba, 0xce, 0xc5, 0x72, 0xb9, 0x6f, 0x03, 0x90, 0x9b, 0x41, 0x5c, 0x7f, 0xa1, 0x55, 0x16, 0xae,
+    0x66, 0x38, 0x94, 0x7d, 0x36, 0xea, 0x3a, 0xf9, 0xf8, 0x56, 0x4e, 0x5f, 0xb6, 0x12, 0xbd, 0x03,
+    0xcc, 0x2b, 0x01, 0x73, 0x59, 0x83, 0xf5, 0x5a, 0x5d, 0x76, 0x45, 0x36, 0x6e, 0xe4, 0xd5, 0xec,
+    0x12, 0xf7, 0xb1, 0x55, 0xb3, 0x36, 0xba, 0xc6, 0x22, 0x45, 0x43, 0xdf, 0xa4, 0x13, 0xa8, 0x38,
+    0x26, 0x31, 0x73, 0x9a, 0x8a, 0x3b, 0xa0, 0xf7, 0x94, 0xef, 0xa2, 0xdf, 0xeb, 0x23, 0xeb, 0xda,
+    0x08, 0x97, 0x5d, 0xc8, 0x32, 0xf5, 0x51, 0x76, 0x02, 0xad, 0x4a, 0xaa, 0x40, 0x46, 0x40, 0x12,
+    0xbe, 0x88, 0x4d, 0xef, 0xbb, 0x59, 0x68, 0xdd, 0xd3, 0x45, 0x14, 0xd6, 0x88, 0x9d, 0xf1, 0x38,
+    0x19, 0xe6, 0x6e, 0xad, 0x4e, 0xad, 0x55, 0x0c, 0x84, 0x44, 0x45, 0x5d, 0xad, 0xd7, 0xe3, 0x0f,
+    0x0b, 0xf9, 0x6c, 0xfb, 0x2a, 0x5d, 0xfb, 0x46, 0xcd, 0xce, 0xb2, 0x68, 0x91, 0xce, 0xd4, 0x57,
+    0x43, 0x32, 0xe6, 0x8a, 0xa0, 0x79, 0x05, 0x1d, 0x2e, 0x70, 0x12, 0xde, 0x28, 0x63, 0x6c, 0xc3,
+    0xd7, 0x8e, 0x01, 0xe8, 0x9f, 0x36, 0xd3, 0xe8, 0x84, 0xff, 0xca, 0x68, 0xeb, 0xe1, 0x93, 0x17,
+    0xe1, 0x1e, 0x1e, 0x8e, 0xc9, 0x61, 0xdc, 0xaa, 0x8b, 0xca, 0xb1, 0xda, 0x39, 0x66, 0xff, 0x2e,
+    0x8d, 0x2f, 0x42, 0x6f, 0xe5, 0x40, 0xd1, 0xf2, 0x6f, 0x51, 0xfb, 0xe1, 0x92, 0xab, 0x0a, 0xa7,
+    0xa1, 0xf6, 0x69, 0x63, 0x0d, 0xbb, 0x0c, 0x95, 0x6f, 0x6b, 0x31, 0x11, 0x97, 0xc8, 0xc7, 0x6c,
+    0x9f, 0x40, 0x73, 0x87, 0xcb, 0xbb, 0x60, 0xbd, 0xbf, 0xd9, 0x2a, 0x76, 0xda, 0xab, 0xdc, 0xed,
+    0x4e, 0x49, 0xb4, 0xcc, 0xef, 0xd0, 0xa9, 0xf3, 0xd8, 0x02, 0x77, 0x97, 0x93, 0x5c, 0x76, 0x29,
+    0x01, 0xca, 0xd1, 0x6e, 0xbe, 0x44, 0x4c, 0x2c, 0xdc, 0x1b, 0xcd, 0x2a, 0xd0, 0x40, 0xe7, 0x21,
+    0x40, 0xa3, 0x6a, 0xc2, 0x12, 0xf3, 0xe2, 0x36, 0xb7, 0x3f, 0xd8, 0x9d, 0xef, 0x74, 0x25, 0xf6,
+    0xc7, 0x6e, 0xaa, 0xdc, 0x68, 0x7e, 0x9a, 0x8a, 0x2f, 0x4e, 0x32, 0xda, 0xdf, 0x78, 0x88, 0x1b,
+    0x08, 0x95, 0x2a, 0xe9, 0xf1, 0x3c, 0x8e, 0x25, 0x30, 0x57, 0xef, 0x66, 0xf3, 0x5f, 0x6e, 0x57,
+    0x3a, 0x16, 0x78, 0xb1, 0x2e, 0x2b, 0x01, 0x27, 0x13, 0xb4, 0x90, 0xa6, 0x80, 0x37, 0x58, 0x0e,
+    0xea, 0x98, 0xb1, 0x16, 0xbe, 0xf8, 0xb2, 0xe6, 0xc8, 0xdb, 0xb5, 0x29, 0x61, 0xb8, 0x17, 0xa4,
+    0x81, 0xe1, 0xe2, 0x17, 0xbb, 0x58, 0x73, 0xc3, 0x2c, 0x66, 0x90, 0x96, 0xdf, 0x53, 0x46, 0x45,
+    0x18, 0xbf, 0x73, 0x94, 0xf0, 0x0b, 0x34, 0xbc, 0xa5, 0xaa, 0x36, 0x93, 0x19, 0x92, 0x13, 0x99,
+    0x6d, 0x29, 0x52, 0x20, 0x3c, 0x52, 0x24, 0xe2, 0x97, 0x35, 0x8f, 0xd7, 0x0f, 0xaf, 0xd9, 0x3d,
+    0xaa, 0xf1, 0xb3, 0xa6, 0xe0, 0x41, 0xf5, 0x4a, 0x65, 0xa4, 0xf7, 0xb2, 0xa5, 0x60, 0x92, 0x65,
+    0x7f, 0xae, 0x87, 0xc3, 0x65, 0xe3, 0x1b, 0xa9, 0x94, 0x08, 0xab, 0x2a, 0x46, 0x79, 0x2e, 0x45,
+    0xed, 0x4e, 0xa5, 0x24, 0xc4, 0xb9, 0xad, 0xc3, 0xa2, 0x1a, 0x76, 0xb1, 0x15, 0x29, 0x48, 0x2a,
+    0xea, 0xa2, 0x56, 0xd4, 0xd9, 0x19, 0x5a, 0xa6, 0x83, 0x4d, 0xce, 0xa8, 0xee, 0x57, 0x54, 0xb4,
+    0x40, 0x42, 0x15, 0x74, 0x3b, 0x67, 0xa7, 0x77, 0x20, 0xf2, 0x1b, 0x7d, 0x20, 0x75, 0x30, 0x05,
+    0x6b, 0x5e, 0x30, 0xea, 0xd7, 0x43, 0xd4, 0x1d, 0x62, 0x73, 0xd0, 0x7c, 0x36, 0xf7, 0xa1, 0xde,
+    0xf7, 0xe8, 0xe6, 0x17, 0xa5, 0x0b, 0xdf, 0x00, 0x46, 0x30, 0xec, 0xd3, 0x01, 0xf4, 0xd5, 0xb8,
+    0xf0, 0x99, 0xf8, 0xde, 0x1a, 0xb1, 0xeb, 0x13, 0x05, 0x5b, 0x57, 0xca, 0x0d, 0xa0, 0x22, 0xa6,
+    0xab, 0xe5, 0xa5, 0xda, 0xb9, 0x0a, 0x25, 0x95, 0x02, 0x1b, 0xd3, 0x13, 0x71, 0x7b, 0x31, 0xcf,
+    0xfc, 0x5b, 0x3d, 0x76, 0xde, 0x79, 0x02, 0x6d, 0x3e, 0xeb, 0x35, 0x7a, 0xd3, 0x1c, 0xda, 0x74,
+    0x3d, 0xd2, 0x6e, 0xb8, 0xba, 0x86, 0x20, 0x54, 0xe0, 0x3d, 0x13, 0x3f, 0x0f, 0x57, 0x21, 0x7c,
+    0xb2, 0x30, 0xf1, 0xab, 0xc2, 0x09, 0x9b, 0x39, 0xed, 0xfe, 0xe0, 0xfe, 0x74, 0x4b, 0x5b, 0xc1,
+    0xce, 0x81, 0xa0, 0x22, 0x8c, 0x5b, 0xb7, 0x90, 0x4e, 0xd8, 0xd2, 0x19, 0x29, 0x88, 0xac, 0x0f,
+    0xe7, 0xa4, 0x19, 0xb7, 0x81, 0x23, 0xeb, 0x75, 0x45, 0xa3, 0x40, 0x1f, 0x17, 0x64, 0x4f, 0x4c,
+    0x76, 0x0c, 0x75, 0x5f, 0x5d, 0xdb, 0x22, 0xca, 0x3a, 0x18, 0xc6, 0xf3, 0x22, 0x01, 0x7c, 0xd3,
+    0xd1, 0x39, 0x37, 0xc6, 0x87, 0x84, 0x16, 0x13, 0xe3, 0xad, 0xd6, 0xc5, 0xb8, 0xfd, 0xb6, 0x91,
+    0x3c, 0xdc, 0xf3, 0x5f, 0xe6, 0xce, 0x03, 0xb3, 0x66, 0x57, 0x5a, 0x6f, 0xf9, 0x28, 0x2b, 0x6c,
+    0x03, 0x62, 0xbe, 0x8e, 0xef, 0x4c, 0x3c, 0x6c, 0x3f, 0x5d, 0x59, 0xdc, 0xf8, 0xa2, 0xcd, 0xe4,
+    0xa2, 0x5a, 0x3d, 0xb3, 0x58, 0xbf, 0xcd, 0x8a, 0x14, 0xbf, 0xfd, 0x40, 0x41, 0x44, 0xda, 0xaf,
+    0xf4, 0x80, 0x46, 0x19, 0xe1, 0x30, 0x8f, 0x7b, 0xcb, 0x10, 0x17, 0x35, 0x12, 0x00, 0x60, 0x84,
+    0x47, 0x2d, 0x38, 0xf9, 0x35, 0xa4, 0x53, 0xc6, 0x92, 0x51, 0xbf, 0x63, 0x06, 0x9c, 0x9b, 0x2a,
+    0x7b, 0xea, 0xce, 0x3d, 0xb7, 0x42, 0x3d, 0x67, 0xac, 0x7a, 0x2a, 0x53, 0xb2, 0xee, 0x82, 0x63,
+    0xa8, 0xed, 0x94, 0x9a, 0xd9, 0x48, 0xcd, 0x96, 0xf3, 0x73, 0x6f, 0x86, 0x54, 0x2a, 0xb2, 0x2a,
+    0xea, 0x56, 0xac, 0xe0, 0x99, 0xc5, 0xc7, 0xdf, 0x34, 0xbf, 0x34, 0x1e, 0xc3, 0xba, 0xb8, 0xe4,
+    0xfe, 0x6c, 0x7d, 0x46, 0x8b, 0xf7, 0x32, 0xb5, 0xe5, 0xcd, 0xbd, 0xea, 0x79, 0x1a, 0x59, 0x4d,
+    0x70, 0x53, 0xe9, 0xca, 0xe0, 0xeb, 0x94, 0x2b, 0x69, 0x10, 0x53, 0xb1, 0x96, 0xb1, 0x5c, 0x1f,
+    0xa5, 0x49, 0xc5, 0x49, 0xf3, 0xa4, 0xf1, 0x58, 0xdb, 0x94, 0xec, 0x35, 0x92, 0x80, 0x5e, 0xe9,
+    0xaf, 0xc2, 0xaf, 0x8f, 0x3d, 0x74, 0x4d, 0x76, 0x7a, 0x01, 0xcc, 0xf2, 0x2c, 0x3a, 0x74, 0x8d,
+    0xbd, 0xbd, 0xf0, 0xa2, 0x62, 0x50, 0xac, 0xe0, 0xaa, 0x88, 0xe7, 0x75, 0x29, 0x7d, 0x7b, 0x52,
+    0x6e, 0xbc, 0x74, 0xe8, 0xc1, 0x37, 0x91, 0x54, 0x07, 0x0b, 0x1d, 0x74, 0x9c, 0xee, 0xe6, 0x7e,
+    0xce, 0xb7, 0x9e, 0x2f, 0xb0, 0xc9, 0x3c, 0x84, 0x3a, 0x66, 0x8a, 0xdc, 0x7c, 0x05, 0x61, 0xee,
+    0x3d, 0xb8, 0x0d, 0xd8, 0xf2, 0x7d, 0x88, 0xe1, 0xa1, 0x3b, 0xe9, 0x1e, 0x33, 0xd5, 0xd9, 0x74,
+    0x5f, 0xe6, 0x61, 0x7a, 0x33, 0x05, 0x50, 0x06, 0xf6, 0x11, 0x11, 0x1c, 0xe5, 0xfa, 0xd3, 0x27,
+    0x2d, 0xb7, 0x01, 0x0a, 0x23, 0x1b, 0x7b, 0x46, 0x54, 0x5d, 0xb7, 0x64, 0x32, 0x86, 0xa3, 0x3c,
+    0xf2, 0x78, 0xd4, 0xf8, 0xa6, 0xd5, 0xd8, 0xba, 0xff, 0x70, 0x19, 0x1b, 0xf7, 0x38, 0xb1, 0xe6,
+    0x4e, 0x1d, 0x92, 0x0f, 0x2c, 0x07, 0xe6, 0xb9, 0x10, 0x1c, 0xf6, 0xfb, 0xeb, 0x4e, 0xad, 0x2f,
+    0xba, 0x57, 0xcc, 0x5a, 0x98, 0x79, 0x8f, 0xb9, 0x39, 0x4a, 0x4b, 0xae, 0xef, 0x04, 0x27, 0xd6,
+    0xba, 0x19, 0xd9, 0xca, 0x3b, 0xb3, 0x15, 0x02, 0x46, 0x1b, 0x79, 0xf8, 0xe9, 0x4c, 0x72, 0x97,
+    0x4e, 0x1d, 0x31, 0x5a, 0x35, 0xd2, 0x93, 0x24, 0x7e, 0xa6, 0xc3, 0xf0, 0xb2, 0x53, 0xe3, 0x70,
+    0xf9, 0xd3, 0xbc, 0xde, 0x41, 0xb0, 0x62, 0xef, 0x23, 0xff, 0x2e, 0x0c, 0xfa, 0x48, 0x86, 0x92,
+    0x9b, 0xc7, 0x6e, 0x07, 0xef, 0x40, 0x22, 0xc3, 0x32, 0x16, 0x5a, 0x47, 0xd5, 0xd5, 0x3e, 0x27,
+    0x30, 0xaf, 0x29, 0x50, 0x36, 0x35, 0x7b, 0x96, 0xa6, 0x4a, 0x21, 0xbe, 0x3e, 0x08, 0x12, 0xb1,
+    0x78, 0x32, 0x2a, 0xeb, 0xe8, 0xc5, 0x33, 0xeb, 0xcb, 0x84, 0xcc, 0xfa, 0xc9, 0xe2, 0x24, 0x0f,
+    0xbb, 0x44, 0x1e, 0xe9, 0xe6, 0x47, 0x27, 0x7c, 0x64, 0x70, 0xb1, 0xc3, 0x7c, 0x02, 0xab, 0xce,
+    0xf8, 0x05, 0x37, 0x5e, 0xef, 0xa0, 0xbd, 0x73, 0x57, 0xb6, 0x61, 0xd3, 0x42, 0xeb, 0x21, 0x3a,
+    0x82, 0x89, 0xb7, 0x08, 0xae, 0xc3, 0xb3, 0x2a, 0x02, 0x93, 0x46, 0xd0, 0x6e, 0x50, 0x05, 0xe8,
+    0xad, 0xd5, 0xc5, 0xf6, 0xb8, 0x07, 0x5a, 0x3e, 0xfd, 0x27, 0x1e, 0xd6, 0x5e, 0x2b, 0xe5, 0x1a,
+    0x41, 0x8b, 0x9e, 0xaf, 0xe2, 0xbb, 0x1f, 0x80, 0xbf, 0x9e, 0x50, 0x85, 0x53, 0x49, 0x8e, 0xb0,
+    0xea, 0x94, 0xc2, 0xef, 0xea, 0x5e, 0xeb, 0xba, 0x3f, 0xe9, 0x4e, 0x3b, 0x7d, 0x46, 0x8c, 0x19,
+    0x26, 0xc5, 0x0f, 0x5e, 0x74, 0x87, 0x6e, 0xc9, 0xd0, 0x43, 0x8e, 0x7a, 0x54, 0xa2, 0x2b, 0x75,
+    0xa2, 0x3e, 0x5d, 0x50, 0xe7, 0x91, 0x09, 0xd5, 0xf4, 0x1e, 0x73, 0x9c, 0xa0, 0x6d, 0x1a, 0xeb,
+    0x1c, 0x79, 0x21, 0xd3, 0x95, 0x2f, 0x18, 0x7a, 0xd8, 0x57, 0x6d, 0xa7, 0x8a, 0x70, 0x0e, 0x07,
+    0x7a, 0xc2, 0xc9, 0x86, 0xfc, 0x7a, 0x95, 0xcb, 0x8c, 0x70, 0x60, 0x97, 0x14, 0x37, 0xec, 0x4e,
+    0x8c, 0xa9, 0x6f, 0xbc, 0x6c, 0xe6, 0x5b, 0xa1, 0xce, 0xd3, 0x46, 0xb4, 0xce, 0x97, 0x0e, 0x65,
+    0xa8, 0xf9, 0xb8, 0xf8, 0xbe, 0x44, 0x32, 0x8d, 0xa4, 0x63, 0xbe, 0xa0, 0x6f, 0x3b, 0x7d, 0x33,
+    0x08, 0x74, 0xe3, 0x57, 0xf1, 0x17, 0x05, 0x5a, 0xa9, 0x8e, 0x1f, 0x1a, 0x40, 0xba, 0xaf, 0x96,
+    0x2a, 0xed, 0x8b, 0x94, 0x1a, 0xa0, 0x2b, 0x4d, 0x0e, 0xa0, 0x95, 0x26, 0x4a, 0x0b, 0xd2, 0xca,
+    0xbe, 0x9c, 0xa2, 0x5e, 0x93, 0x32, 0xb2, 0xca, 0x8d, 0xa7, 0x9a, 0x2b, 0x97, 0x41, 0x4b, 0xaa,
+    0x70, 0x6a, 0xaf, 0xa7, 0x6e, 0x4a, 0xa8, 0xc0, 0x13, 0x5d, 0xbd, 0xa5, 0xaa, 0x42, 0xbc, 0xa6,
+    0xf3, 0x07, 0xf0, 0x19, 0x36, 0x6e, 0x39, 0x6e, 0x0e, 0x88, 0x3d, 0xf4, 0xd1, 0x65, 0x0a, 0xc5,
+    0xd7, 0x37, 0xee, 0xe8, 0x09, 0x86, 0x56, 0x26, 0x03, 0x17, 0xf0, 0xb2, 0x1c, 0x70, 0x9d, 0x30,
+    0xa5, 0x3d, 0x2c, 0x84, 0xda, 0xc2, 0x82, 0xc8, 0x44, 0x00, 0x2e, 0x7a, 0xaa, 0x24, 0x7e, 0xd0,
+    0x06, 0x1d, 0x69, 0xbe, 0x14, 0x1f, 0xf5, 0x8b, 0xf5, 0xd0, 0xd1, 0xee, 0xfe, 0x5a, 0x0c, 0x4f,
+    0xcf, 0xde, 0x43, 0xed, 0x77, 0xfb, 0xdf, 0xd9, 0x52, 0xdb, 0x89, 0x7b, 0xa2, 0x8b, 0xd0, 0xf6,
+    0x76, 0x7b, 0xb1, 0x1c, 0x52, 0x33, 0xd3, 0x19, 0x01, 0x4b, 0x04, 0x26, 0xa5, 0x0e, 0x9f, 0x62,
+    0xdb, 0xd8, 0xd2, 0x2d, 0xce, 0xc9, 0xca, 0x86, 0x2e, 0x8c, 0x18, 0x17, 0x01, 0xcf, 0x49, 0x4a,
+    0x5a, 0x0a, 0xed, 0x63, 0x1f, 0xfb, 0xbe, 0x4d, 0xcd, 0x5b, 0x93, 0x3b, 0x8b, 0x0f, 0x3a, 0x36,
+    0x2a, 0x26, 0xca, 0xcf, 0x4b, 0x71, 0x7b, 0x93, 0x3c, 0x9e, 0xe1, 0x13, 0xf2, 0xba, 0x39, 0x12,
+    0x1c, 0x19, 0xf3, 0xe5, 0x42, 0x1a, 0xa4, 0x04, 0xc0, 0x96, 0x38, 0x87, 0x2d, 0x94, 0x34, 0x40,
+    0x59, 0x16, 0x7e, 0x9e, 0x33, 0x2f, 0x62, 0xbc, 0xf8, 0xca, 0xab, 0xec, 0x5f, 0xf4, 0xd4, 0x75,
+    0xd5, 0x69, 0x93, 0x8c, 0xc1, 0x48, 0xe4, 0xd0, 0xc3, 0x84, 0xee, 0xe4, 0xc0, 0x69, 0xc1, 0x0c,
+    0xa9, 0xcf, 0x21, 0xf5, 0x15, 0x23, 0x77, 0x3c, 0x65, 0x7e, 0x97, 0x31, 0x58, 0x7a, 0xb1, 0xd8,
+    0x55, 0x2a, 0xe5, 0x6e, 0x2a, 0xcd, 0xfa, 0xcb, 0x66, 0xdb, 0xbb, 0x76, 0x9d, 0xac, 0xc4, 0xfb,
+    0x0a, 0xde, 0x97, 0x26, 0xb6, 0xca, 0x57, 0xb2, 0xef, 0x5f, 0x08, 0x70, 0x76, 0x8b, 0x9c, 0xed,
+    0xf4, 0x8b, 0x14, 0xf1, 0x08, 0x15, 0x09, 0x22, 0xc7, 0x40, 0x73, 0xaa, 0xa1, 0xce, 0x5e, 0xb2,
+    0x8a, 0xf6, 0xc5, 0xd4, 0xd1, 0xce, 0x3e, 0xa8, 0xc1, 0xa3, 0x11, 0xdb, 0x0d, 0x10, 0x87, 0xb5,
+    0xcc, 0x92, 0x80, 0xf4, 0x3f, 0x0c, 0xfe, 0x6b, 0x8d, 0x96, 0x34, 0x19, 0xcf, 0x2b, 0x31, 0xc5,
+    0xbb, 0xf8, 0xfd, 0x1f, 0x99, 0x07, 0x50, 0xcd, 0x75, 0x59, 0xce, 0x06, 0xc0, 0xf8, 0xda, 0x94,
+    0x93, 0x5d, 0x3a, 0x48, 0xd1, 0x0b, 0xdd, 0x99, 0x14, 0x87, 0x4e, 0x8c, 0xe1, 0x66, 0xef, 0x9d,
+    0x92, 0xba, 0xb5, 0x97, 0xcf, 0x2c, 0x1e, 0x60, 0xbd, 0xb4, 0x64, 0xb6, 0x46, 0x3b, 0xaf, 0x70,
+    0xf2, 0xb3, 0x14, 0x56, 0x53, 0x5e, 0xc0, 0xd7, 0x0e, 0x67, 0x16, 0x4d, 0xb8, 0x50, 0xe6, 0x6b,
+    0xd0, 0x37, 0x39, 0x0b, 0xeb, 0xf2, 0xfa, 0xf3, 0xf4, 0xa8, 0xb6, 0xac, 0x36, 0xa8, 0x26, 0xd2,
+    0x69, 0xde, 0xe8, 0x8b, 0x5c, 0x89, 0xbc, 0x52, 0x09, 0x3a, 0x98, 0x75, 0x96, 0x05, 0x45, 0xf7,
+    0xbf, 0xbb, 0xa3, 0xe5, 0x8c, 0xbd, 0x9e, 0x4a, 0x31, 0xd6, 0x28, 0x89, 0xb5, 0x41, 0x18, 0xaa,
+    0xb9, 0x0d, 0x7d, 0x3c, 0xa8, 0x10, 0x9b, 0x32, 0xb4, 0xbf, 0x49, 0xbe, 0x99, 0xc3, 0xe7, 0xe1,
+    0x09, 0x4f, 0xe6, 0x3d, 0xd0, 0x5d, 0xfb, 0x28, 0x8a, 0xaf, 0xcd, 0x4b, 0xdd, 0x07, 0x1f, 0xb0,
+    0xcc, 0xb1, 0xb6, 0x3e, 0x57, 0x36, 0x72, 0x8e, 0x5d, 0x85, 0x75, 0x80, 0x50, 0x4c, 0xe4, 0x54,
+    0x1b, 0x49, 0x2e, 0xe0, 0x87, 0x79, 0x9b, 0x01, 0x7d, 0x39, 0x10, 0x6b, 0x2e, 0x2e, 0xf2, 0xf3,
+    0xd2, 0x7b, 0xab, 0x62, 0x3a, 0xfe, 0xc3, 0x97, 0x2c, 0x33, 0xfe, 0x96, 0xb8, 0x80, 0x9c, 0x4b,
+    0x57, 0xad, 0x57, 0xad, 0x7b, 0xbf, 0xa9, 0xff, 0xf7, 0x8a, 0xfc, 0x14, 0xc8, 0x55, 0x83, 0xdb,
+    0x9d, 0xd5, 0x02, 0x66, 0x1b, 0xda, 0x0a, 0x4e, 0x27, 0x02, 0xab, 0x85, 0xc9, 0x86, 0x82, 0xeb,
+    0x71, 0x31, 0x9f, 0x26, 0xfe, 0xe1, 0xd0, 0x63, 0xf2, 0x2e, 0x93, 0x9b, 0xfc, 0xd6, 0xf4, 0x6b,
+    0xc2, 0x1f, 0x3f, 0xfe, 0xcf, 0x2f, 0xc2, 0xc0, 0x60, 0xcb, 0x4d, 0xd2, 0x9c, 0xaf, 0xff, 0xfc,
+    0x9e, 0xb6, 0xc9, 0x23, 0xc8, 0xa3, 0x58, 0xba, 0xf7, 0xe1, 0xd9, 0xed, 0xd1, 0xff, 0x02, 0x4a,
+    0x15, 0x34, 0x12, 0xae, 0x8d, 0x00, 0x00,
+};
+static const static_page_t LOADING_JPG_PAGE = {
+    LOADING_JPG,
+    sizeof(LOADING_JPG),
+    "image/jpeg",
+    "\"ee73ebff3af3cab8\"",
+    true
+};
 
-<body>
-  <section id="main">
-    <div id="stream-container" class="image-container">
-      <a href="capture" download="capture.jpg">
-      <img id="stream" src="loading.jpg">
-      </a>
-    </div>
-    <div id="control" , class="control">
-      <svg id="dpad" version="1.1" viewBox="-100 -100 200 200" xmlns="http://www.w3.org/2000/svg">
-        <g id="padstyle" fill="none" stroke="#000" stroke-width="2">
-          <path d="m-10 -20 v-30 h-10 l 20 -30  20  30 h -10 v30" />
-          <path d="m10 20   v 30 h 10 l-20  30 -20 -30 h  10 v-30" />
-          <path d="m-20 10  h-30 v10  l-30 -20  30 -20 v  10 h30" />
-          <path d="m20 -10  h 30 v-10 l 30  20 -30  20 v -10 h-30" />
-          <circle id="deadzone" cx="0" cy="0" r="10" />
-          <circle id="indicator" cx="0" cy="0" r="20" />
-          <rect id="boundary" x="-100" y="-100" width="200" height="200" />
-        </g>
-      </svg>
-      <button onclick="showSettings()">Settings</button>
-    </div>
-    <div id="settings-background" onclick="hideSettings()"></div>
-    <div id="settings">
-      <h1>Settings</h1>
-      <table class="settings-table">
-        <tr>
-          <td>Lights</td>
-          <td><input type="range" id="flash" min="0" max="255" value="10"
-              onchange="setParameter('flash', this.value)"></td>
-        </tr>
-        
-        <tr>
-          <td colspan="2"><h2>Video</h2></td>
-        </tr>
-        <tr>
-          <td>Quality</td>
-          <td><input type="range" id="quality" min="10" max="63" value="10"
-              onchange="setParameter('quality', this.value)"></td>
-        </tr>
-        <tr>
-          <td>Resolution</td>
-          <td><input type="range" id="framesize" min="0" max="6" value="5"
-              onchange="setParameter('framesize', this.value)"></td>
-        </tr>
-      </table>
-      <button onclick="hideSettings()">Close</button>
-      </div>
-  </section>
-  </section>
-</body>
 
-</html>
+// style.css: 757 bytes, 314 gzipped
+static const uint8_t PROGMEM STYLE_CSS[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x91, 0xdd, 0x6a, 0xc3, 0x30,
+    0x0c, 0x85, 0xef, 0xf3, 0x14, 0x82, 0x52, 0x68, 0x61, 0x2e, 0xce, 0x46, 0x6e, 0xd2, 0xa7, 0xb1,
+    0x63, 0x35, 0x16, 0x75, 0xec, 0xe0, 0xa8, 0x3f, 0x63, 0xf4, 0xdd, 0x67, 0x27, 0x74, 0x4b, 0x43,
+    0x29, 0xbb, 0x18, 0xbe, 0x92, 0xa5, 0xe3, 0xef, 0xe8, 0x78, 0xd5, 0x29, 0xf2, 0xf0, 0x55, 0x00,
+    0x30, 0x5e, 0x59, 0x28, 0x47, 0xad, 0xaf, 0xa1, 0x41, 0xcf, 0x18, 0xf7, 0xc5, 0xad, 0x28, 0x56,
+    0x4d, 0xf0, 0x1c, 0x83, 0x1b, 0x67, 0x2e, 0x64, 0xd8, 0xd6, 0xf0, 0x21, 0x65, 0x7f, 0xdd, 0xa7,
+    0xda, 0x22, 0xb5, 0x96, 0x67, 0x17, 0x86, 0x86, 0xde, 0xa9, 0xcf, 0x1a, 0xc8, 0x3b, 0xf2, 0x28,
+    0xb4, 0x0b, 0xcd, 0x31, 0x37, 0xce, 0x18, 0x99, 0x1a, 0xe5, 0xee, 0x84, 0x8e, 0x8c, 0x71, 0x38,
+    0x11, 0x06, 0x8e, 0xa8, 0x3a, 0x91, 0x41, 0xc9, 0x0c, 0xc6, 0x39, 0x4a, 0x9d, 0x38, 0xfc, 0x37,
+    0xe9, 0xd5, 0xfb, 0xa5, 0x94, 0xeb, 0x5c, 0x77, 0x2a, 0xb6, 0xe4, 0xef, 0xfd, 0x51, 0x8b, 0xcc,
+    0xe4, 0xdb, 0x61, 0x54, 0xf7, 0x61, 0x20, 0xa6, 0x90, 0x06, 0x0e, 0x74, 0x45, 0x93, 0x15, 0x0e,
+    0x0f, 0x49, 0x9f, 0xc0, 0xcd, 0xa6, 0x92, 0x6b, 0x10, 0x50, 0x56, 0xc9, 0xea, 0x36, 0xb7, 0x38,
+    0xf4, 0x35, 0xc8, 0xfd, 0x93, 0x00, 0xb5, 0x6a, 0x8e, 0x6d, 0x0c, 0x27, 0x6f, 0x6a, 0xb8, 0x58,
+    0x62, 0xcc, 0x97, 0xbd, 0x32, 0x26, 0x91, 0x6a, 0xa8, 0xf2, 0xd0, 0x9c, 0x2d, 0x7e, 0xe7, 0x5f,
+    0xdb, 0x90, 0x4f, 0xb1, 0x69, 0xb9, 0xf3, 0x65, 0xb1, 0xed, 0xd9, 0x3e, 0xa4, 0xe9, 0x83, 0xc7,
+    0xa5, 0xb1, 0xd8, 0x6a, 0xb5, 0x91, 0x6f, 0xe3, 0xd9, 0x55, 0xdb, 0x6c, 0xe9, 0x31, 0x8d, 0x29,
+    0x2c, 0x31, 0xf2, 0xca, 0xe5, 0xff, 0x4c, 0x2f, 0xde, 0x8a, 0xdd, 0xcf, 0x12, 0xac, 0xb4, 0xc3,
+    0xd9, 0x27, 0x4c, 0x99, 0x3f, 0x64, 0x6c, 0xcb, 0xb1, 0xaf, 0x43, 0x34, 0x18, 0x85, 0x0e, 0xcc,
+    0xa1, 0xab, 0x61, 0x08, 0x8e, 0x0c, 0x68, 0x97, 0xbc, 0x41, 0xb9, 0xcc, 0x06, 0xec, 0xfb, 0x5f,
+    0x35, 0xdf, 0xb5, 0x8a, 0xf0, 0x4e, 0xf5, 0x02, 0x00, 0x00,
+};
+static const static_page_t STYLE_CSS_PAGE = {
+    STYLE_CSS,
+    sizeof(STYLE_CSS),
+    "text/css",
+    "\"1be36a17b5b4ade3\"",
+    true
+};
 
-)rawliteral";
 
+static esp_err_t static_page_handler(httpd_req_t *req){
+    const static_page_t * page = (const static_page_t *)req->user_ctx;
+    char if_none_match[64];
 
-static const char PROGMEM CONTROL_JS[] = R"rawliteral(
-"use strict";
-/*
-Copyright (c) 2021 Ross Peters, Geoffrey Irons
-
-Permission is hereby granted, free of charge, to any person obtaining a copy
-of this software and associated documentation files (the "Software"), to deal
-in the Software without restriction, including without limitation the rights
-to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-copies of the Software, and to permit persons to whom the Software is
-furnished to do so, subject to the following conditions:
-
-The above copyright notice and this permission notice shall be included in all
-copies or substantial portions of the Software.
-
-THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-SOFTWARE.
-*/
-
-const SPEED_CHANGE_THRESHOLD = 0.1 // How much the speed has to change by in order for a new speed to be sent. Shold be smaller than SPEED_MIN_THRESHOLD
-const SPEED_MIN_THRESHOLD = 0.15 // Speeds less than this are rounded to zero.
-const SPEED_MIN_SEND_DELAY_MS = 50 // Minimum time between messages
-const SPEED_MAX_SEND_DELAY_MS = 500 // Maximum time between messages
-
-// Functions for Controls via Keypress
-var speed = {
-    forward: 0,
-    steer: 0,
-}
-
-// Used for debouncing commands to the rover
-var oldSpeed = {
-    forward: 0,
-    steer: 0,
-    timeSent: 0,
-}
-
-var mouseDown = false;
-
-
-window.addEventListener("load", () => {
-    // Functions to control streaming
-    let source = document.getElementById('stream');
-    source.src = document.location.origin + ':81/stream';
-
-    let dpad = document.getElementById('dpad')
-    const padStroke = document.getElementById('padstyle').getAttribute('stroke-width')
-    const dpadsize = 1 + SPEED_CHANGE_THRESHOLD + padStroke
-    dpad.setAttribute('viewBox', `${-100 * dpadsize} ${-100 * dpadsize} ${200 * dpadsize} ${200 * dpadsize}`)
-    document.getElementById('deadzone').setAttribute('r', SPEED_MIN_THRESHOLD * 100)
-    document.getElementById('indicator').setAttribute('r', SPEED_CHANGE_THRESHOLD * 100)
-
-    dpad.addEventListener('mousedown', (event) => {
-        setSpeedFromClientPosition(event.clientX, event.clientY)
-        mouseDown = true
-    });
-    dpad.addEventListener('mousemove', (event) => {
-        if (mouseDown) {
-            setSpeedFromClientPosition(event.clientX, event.clientY)
-            event.preventDefault();
-        }
-        
-    });
-
-    document.addEventListener('mouseup', (event) => {
-        speed.steer = 0.0
-        speed.forward = 0.0
-        mouseDown = false
-    });
-    
-    document.addEventListener('touchstart', (event) => {
-        setSpeedFromClientPosition(event.changedTouches[0].clientX, event.changedTouches[0].clientY)
-    });
-    document.addEventListener('touchmove', (event) => {
-        setSpeedFromClientPosition(event.changedTouches[0].clientX, event.changedTouches[0].clientY)
-    });
-    document.addEventListener('touchend', (event) => {
-        speed.steer = 0.0
-        speed.forward = 0.0
-    });
-    
-    function setSpeedFromClientPosition(x, y) {
-        let bounds = dpad.getBoundingClientRect()
-        speed.steer = 2.0 * ((x - bounds.left) / bounds.width - 0.5) * dpadsize
-        speed.forward = -2.0 * ((y - bounds.top) / bounds.height - 0.5) * dpadsize
+    httpd_resp_set_hdr(req, "ETag", page->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+        strstr(if_none_match, page->etag) != NULL) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
     }
-});
-
 
-
-
-//Keypress Events
-document.addEventListener('keydown', function (keyon) {
-    keyon.preventDefault();
-    switch (keyon.code) {
-        case 'ArrowUp':
-            speed.forward = 1.0;
-            break;
-        case 'ArrowDown':
-            speed.forward = -1.0;
-            break;
-        case 'ArrowLeft':
-            speed.steer = -1.0;
-            break;
-        case 'ArrowRight':
-            speed.steer = 1.0;
-            break;
-    }
-});
-//KeyRelease Events
-document.addEventListener('keyup', function (keyoff) {
-    switch (keyoff.code) {
-        case 'ArrowUp':
-        case 'ArrowDown':
-            speed.forward = 0.0;
-            break;
-        case 'ArrowLeft':
-        case 'ArrowRight':
-            speed.steer = 0.0;
-            break;
-    }
-});
-
-window.setInterval(function () {
-    if ((speed.forward ** 2 + speed.steer ** 2) < SPEED_MIN_THRESHOLD ** 2) {
-        speed.forward = 0.0
-        speed.steer = 0.0
+    httpd_resp_set_type(req, page->mimetype);
+    if (page->gzipped) {
+        httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
     }
-    speed.forward = Math.min(1.0, Math.max(-1.0, speed.forward))
-    speed.steer = Math.min(1.0, Math.max(-1.0, speed.steer))
-
-    const speedChanged = (Math.abs(speed.forward - oldSpeed.forward) > SPEED_CHANGE_THRESHOLD) || (Math.abs(speed.steer - oldSpeed.steer) > SPEED_CHANGE_THRESHOLD)
-    const time = new Date().getTime();
-
-    if (speedChanged || (time - oldSpeed.timeSent > SPEED_MAX_SEND_DELAY_MS)) {
-
-        Object.assign(oldSpeed, speed);
-        oldSpeed.timeSent = time;
-        drive(speed.forward, speed.steer);
-    }
-}, SPEED_MIN_SEND_DELAY_MS);
-
-
-function setParameter(variable, value) {
-    fetch(document.location.origin + `/config?${variable}=${value}`).catch((e) => { })
-}
-
-function drive(forward, steer) {
-    fetch(document.location.origin + `/drive?forward=${Math.round(forward * 100)}&steer=${Math.round(steer * 100)}`).catch((e) => { })
-    document.getElementById('indicator').setAttribute('cy', -forward * 100)
-    document.getElementById('indicator').setAttribute('cx', steer * 100)
-}
-
-function showSettings() {
-    document.getElementById('settings-background').style.display = "block";
-    document.getElementById('settings').style.display = "block";
-}
-function hideSettings() {
-    document.getElementById('settings-background').style.display = "none";
-    document.getElementById('settings').style.display = "none";
+    return httpd_resp_send(req, (const char *)page->data, page->len);
 }
 
 
-)rawliteral";
+// 12 routes in 32 slots
+static const uint32_t ROUTE_SEED = 0x00000001;
+static const int ROUTE_SLOT_BITS = 5;
+static const size_t ROUTE_BUCKETS = 8;
 
+static const route_t routes[] = {
+    {"/control.js", static_page_handler, &CONTROL_JS_PAGE},
+    {"/index.html", static_page_handler, &INDEX_HTML_PAGE},
+    {"/loading.jpg", static_page_handler, &LOADING_JPG_PAGE},
+    {"/style.css", static_page_handler, &STYLE_CSS_PAGE},
+    {"/", static_page_handler, &INDEX_HTML_PAGE},
+    {"/capture", capture_handler, NULL},
+    {"/config", config_handler, NULL},
+    {"/drive", drive_handler, NULL},
+    {"/metrics", metrics_handler, NULL},
+    {"/recording", recording_handler, NULL},
+    {"/rtp", rtp_handler, NULL},
+    {"/stream", stream_handler, NULL},
+};
 
-static esp_err_t style_css_handler(httpd_req_t *req){
-    httpd_resp_set_type(req, "text/css");
-    return httpd_resp_send(req, (const char *)STYLE_CSS, strlen(STYLE_CSS));
-}
+// Per bucket, what its paths' hashes are mixed with to land in a free slot
+static const uint8_t route_displace[ROUTE_BUCKETS] = { 0, 0, 0, 0, 1, 1, 0, 2 };
 
+// Index into routes by slot, -1 where no path lands
+static const int8_t route_slots[1 << ROUTE_SLOT_BITS] = { -1, 3, -1, -1, 0, 1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, 8, -1, -1, -1, 9, -1, -1, 7, 10, 2, 6, -1, -1, 4, -1, 11 };
 
-static esp_err_t index_html_handler(httpd_req_t *req){
-    httpd_resp_set_type(req, "text/html");
-    return httpd_resp_send(req, (const char *)INDEX_HTML, strlen(INDEX_HTML));
+const route_t * findRoute(const char * uri){
+    uint32_t h = ROUTE_SEED;
+    const char * p = uri;
+    for(; *p && *p != '?'; p++){
+        h = (h ^ (uint8_t)*p) * 16777619u;
+    }
+    uint32_t slot = ((h ^ route_displace[h & (ROUTE_BUCKETS - 1)]) * 0x9e3779b1u) >> (32 - ROUTE_SLOT_BITS);
+    if(route_slots[slot] < 0){
+        return NULL;
+    }
+    const route_t * route = &routes[route_slots[slot]];
+    size_t len = p - uri;
+    return strncmp(route->path, uri, len) == 0 && route->path[len] == 0 ? route : NULL;
 }
 
-
-static esp_err_t control_js_handler(httpd_req_t *req){
-    httpd_resp_set_type(req, "text/javascript");
-    return httpd_resp_send(req, (const char *)CONTROL_JS, strlen(CONTROL_JS));
+static esp_err_t route_handler(httpd_req_t *req){
+    const route_t * route = findRoute(req->uri);
+    if(!route){
+        return httpd_resp_send_404(req);
+    }
+    req->user_ctx = (void *)route->ctx;
+    return route->handler(req);
 }
 
-void registerStaticPages(httpd_handle_t httpd){
-    httpd_uri_t style_css_handler_uri = {
-        .uri       = "/style.css",
-        .method    = HTTP_GET,
-        .handler   = style_css_handler,
-        .user_ctx  = NULL
-    };
-    httpd_register_uri_handler(httpd, &style_css_handler_uri);
-    
-    
-    httpd_uri_t index_html_handler_uri = {
-        .uri       = "/index.html",
-        .method    = HTTP_GET,
-        .handler   = index_html_handler,
-        .user_ctx  = NULL
-    };
-    httpd_register_uri_handler(httpd, &index_html_handler_uri);
-    
-    
-    httpd_uri_t control_js_handler_uri = {
-        .uri       = "/control.js",
-        .method    = HTTP_GET,
-        .handler   = control_js_handler,
-        .user_ctx  = NULL
-    };
-    httpd_register_uri_handler(httpd, &control_js_handler_uri);
-    
-    
-    httpd_uri_t roothandler_uri = {
-        .uri       = "/",
+void registerRoutes(httpd_handle_t httpd){
+    httpd_uri_t uri = {
+        .uri       = "/*",
         .method    = HTTP_GET,
-        .handler   = index_html_handler,
+        .handler   = route_handler,
         .user_ctx  = NULL
     };
-    httpd_register_uri_handler(httpd, &roothandler_uri);
+    httpd_register_uri_handler(httpd, &uri);
 }
@@ -2,6 +2,30 @@
 #define PAGES_H
 #include "esp_http_server.h"
 
-void registerStaticPages(httpd_handle_t httpd);
+// Every GET path but /ws is in one route table, generated with the static
+// pages by generate_pages.py, and served by a single "/*" handler: a path
+// costs one hash and one compare however many routes there are, and the
+// server's handler slots don't run out as endpoints are added. A new
+// endpoint goes in ENDPOINTS in the script and is declared below.
+typedef struct {
+    const char * path;
+    esp_err_t (*handler)(httpd_req_t *req);
+    const void * ctx;   // handed to the handler as req->user_ctx
+} route_t;
+
+// The route for `uri`, whose query is ignored, or NULL
+const route_t * findRoute(const char * uri);
+
+// Registers the dispatcher; the server needs httpd_uri_match_wildcard
+void registerRoutes(httpd_handle_t httpd);
+
+// The endpoints, in app_server.cpp
+esp_err_t capture_handler(httpd_req_t *req);
+esp_err_t config_handler(httpd_req_t *req);
+esp_err_t drive_handler(httpd_req_t *req);
+esp_err_t metrics_handler(httpd_req_t *req);
+esp_err_t recording_handler(httpd_req_t *req);
+esp_err_t rtp_handler(httpd_req_t *req);
+esp_err_t stream_handler(httpd_req_t *req);
 
 #endif
@@ -0,0 +1,141 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "power_manager.h"
+#include "camera_stream.h"
+#include "sensor_config.h"
+#include "logger.h"
+
+static const char * const state_names[POWER_STATE_COUNT] = {"active", "idle"};
+static const char * const source_names[POWER_SOURCE_COUNT] = {"stream", "capture", "drive", "motor", "config"};
+
+// Going idle stores the state before it looks at the activity clock, and
+// activity stores the clock before it looks at the state, so one of the
+// two always sees the other: activity is never missed by a rover on its
+// way to sleep.
+static std::atomic<uint32_t> last_activity_ms(0);
+static std::atomic<int> state(POWER_ACTIVE);
+static std::atomic<uint32_t> idle_timeout_ms(POWER_IDLE_TIMEOUT_MS);
+
+// Held for a whole transition: the WiFi and SCCB calls can block
+static SemaphoreHandle_t transition_lock = NULL;
+
+static portMUX_TYPE power_mux = portMUX_INITIALIZER_UNLOCKED;
+static power_stats_t stats;
+static int64_t entered_us = 0;
+
+
+static uint32_t now_ms(){
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// The hardware side of a state change
+static void apply(power_state_t next){
+    bool idle = next == POWER_IDLE;
+    uint32_t mhz = idle ? POWER_IDLE_MHZ : POWER_ACTIVE_MHZ;
+    if(!setCpuFrequencyMhz(mhz)){
+        LOG_WARN("Power: can't run the CPU at %u MHz", mhz);
+    }
+    if(WiFi.getMode() == WIFI_MODE_STA){
+        WiFi.setSleep(idle);
+    }
+    esp_err_t res = sensorConfigSetStandby(idle);
+    if(res != ESP_OK && res != ESP_ERR_NOT_SUPPORTED){
+        LOG_WARN("Power: camera standby failed: %s", esp_err_to_name(res));
+    }
+
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&power_mux);
+    stats.seconds[stats.state] += (now - entered_us) / 1e6;
+    entered_us = now;
+    stats.state = next;
+    stats.cpu_mhz = getCpuFrequencyMhz();
+    if(idle){
+        stats.idles++;
+    }
+    portEXIT_CRITICAL(&power_mux);
+}
+
+void initPowerManager(){
+    transition_lock = xSemaphoreCreateMutex();
+    last_activity_ms = now_ms();
+    entered_us = esp_timer_get_time();
+    stats.state = POWER_ACTIVE;
+    apply(POWER_ACTIVE);
+    LOG_INFO("Power: idle after %u ms at %u MHz", (unsigned)idle_timeout_ms, POWER_IDLE_MHZ);
+}
+
+void powerSetIdleTimeout(uint32_t ms){
+    idle_timeout_ms = ms;
+    // Starts the new timeout from now, and wakes us if it's 0
+    powerNoteActivity(POWER_SOURCE_CONFIG);
+}
+
+uint32_t powerIdleTimeout(){
+    return idle_timeout_ms;
+}
+
+void powerNoteActivity(power_source_t source){
+    last_activity_ms = now_ms();
+    if(state == POWER_ACTIVE || !transition_lock){
+        return;
+    }
+    int64_t start = esp_timer_get_time();
+    xSemaphoreTake(transition_lock, portMAX_DELAY);
+    // Someone else may have woken it while we waited
+    bool woke = state == POWER_IDLE;
+    if(woke){
+        apply(POWER_ACTIVE);
+        state = POWER_ACTIVE;
+    }
+    xSemaphoreGive(transition_lock);
+    if(woke){
+        uint32_t took = (uint32_t)(esp_timer_get_time() - start);
+        portENTER_CRITICAL(&power_mux);
+        stats.wakes[source]++;
+        stats.wake_us_last = took;
+        stats.wake_us_max = max(stats.wake_us_max, took);
+        portEXIT_CRITICAL(&power_mux);
+        LOG_INFO("Power: woken by %s in %u us", source_names[source], took);
+    }
+}
+
+void powerUpdate(){
+    uint32_t timeout = idle_timeout_ms;
+    if(!transition_lock || !timeout || state != POWER_ACTIVE){
+        return;
+    }
+    xSemaphoreTake(transition_lock, portMAX_DELAY);
+    uint32_t seen = last_activity_ms;
+    if(state == POWER_ACTIVE && now_ms() - seen >= timeout && !streamActive()){
+        state = POWER_IDLE;
+        if(last_activity_ms == seen){
+            apply(POWER_IDLE);
+            LOG_INFO("Power: idle");
+        } else {
+            // Activity that saw us still active: stay that way
+            state = POWER_ACTIVE;
+        }
+    }
+    xSemaphoreGive(transition_lock);
+}
+
+void powerGetStats(power_stats_t * out){
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&power_mux);
+    *out = stats;
+    out->seconds[stats.state] += (now - entered_us) / 1e6;
+    portEXIT_CRITICAL(&power_mux);
+    out->idle_timeout_ms = idle_timeout_ms;
+}
+
+const char * powerStateName(power_state_t s){
+    return s >= 0 && s < POWER_STATE_COUNT ? state_names[s] : "unknown";
+}
+
+const char * powerSourceName(power_source_t source){
+    return source >= 0 && source < POWER_SOURCE_COUNT ? source_names[source] : "unknown";
+}
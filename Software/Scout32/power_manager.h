@@ -0,0 +1,66 @@
+#ifndef power_manager_h
+#define power_manager_h
+
+#include <stdint.h>
+
+// Activity-driven power saving. Stream clients, /capture, drive commands
+// and the motor task report activity here. Once there has been none for
+// the idle timeout and no stream is running, the housekeeping task steps
+// the CPU down to POWER_IDLE_MHZ, lets the WiFi modem sleep between
+// beacons and puts the camera sensor into software standby. The first
+// activity after that undoes all three before it returns, so a client
+// connecting to an idle rover waits for one frame, as it would anyway.
+//
+// Modem sleep is station mode only: a soft AP has to stay awake for its
+// clients. While active the modem never sleeps, which also takes the
+// DTIM wait out of every drive command.
+
+typedef enum {
+    POWER_ACTIVE,
+    POWER_IDLE,
+    POWER_STATE_COUNT
+} power_state_t;
+
+typedef enum {
+    POWER_SOURCE_STREAM,   // a /stream, RTP or recorder client connecting
+    POWER_SOURCE_CAPTURE,  // /capture going to the camera
+    POWER_SOURCE_DRIVE,    // a drive command, over HTTP or the WebSocket
+    POWER_SOURCE_MOTOR,    // the motor task, until its watchdog has stopped the rover
+    POWER_SOURCE_CONFIG,   // the idle timeout being changed
+    POWER_SOURCE_COUNT
+} power_source_t;
+
+const uint32_t POWER_ACTIVE_MHZ = 240;
+// As low as the CPU goes with the radio running
+const uint32_t POWER_IDLE_MHZ = 80;
+const uint32_t POWER_IDLE_TIMEOUT_MS = 30000;
+
+typedef struct {
+    power_state_t state;
+    uint32_t cpu_mhz;
+    uint32_t idle_timeout_ms;              // 0: never idle
+    double seconds[POWER_STATE_COUNT];     // time in each state since boot
+    uint32_t idles;                        // times it went idle
+    uint32_t wakes[POWER_SOURCE_COUNT];    // times each source woke it
+    uint32_t wake_us_last;                 // how long the last wake took
+    uint32_t wake_us_max;
+} power_stats_t;
+
+// Once the camera is up: starts out active
+void initPowerManager();
+
+void powerSetIdleTimeout(uint32_t ms);
+uint32_t powerIdleTimeout();
+
+// Cheap while active (a clock read and a store); while idle, wakes
+// everything up before it returns. Any task, not from an ISR.
+void powerNoteActivity(power_source_t source);
+
+// Called by the housekeeping task: goes idle if it's time to
+void powerUpdate();
+
+void powerGetStats(power_stats_t * stats);
+const char * powerStateName(power_state_t state);
+const char * powerSourceName(power_source_t source);
+
+#endif
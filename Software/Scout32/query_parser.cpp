@@ -0,0 +1,198 @@
+#include <Arduino.h>
+#include <stdlib.h>
+#include <string.h>
+#include "query_parser.h"
+
+static void * field(const query_target_t * target, const query_param_t * param){
+    return (uint8_t *)target->out + param->offset;
+}
+
+static bool in_range(float value, const query_param_t * param){
+    // Written so that NaN is out of range
+    return value >= param->min && value <= param->max;
+}
+
+static void set_default(const query_target_t * target, const query_param_t * param){
+    void * out = field(target, param);
+    switch(param->type){
+        case QUERY_INT: *(int *)out = (int)param->def; break;
+        case QUERY_FLOAT: *(float *)out = param->def; break;
+        case QUERY_BOOL: *(bool *)out = param->def != 0; break;
+        case QUERY_STRING: *(char *)out = 0; break;
+    }
+}
+
+// Convert `len` bytes at `value`, which end at '&' or the end of the URI
+static query_status_t convert(const query_target_t * target, const query_param_t * param, const char * value, size_t len){
+    void * out = field(target, param);
+    char * end;
+    switch(param->type){
+        case QUERY_INT: {
+            // By hand: strtol also takes spaces, '+' and hex, and is slower
+            bool negative = len && value[0] == '-';
+            size_t i = negative;
+            if(i == len){
+                return QUERY_ERR_SYNTAX;
+            }
+            int32_t number = 0;
+            for(; i < len; i++){
+                unsigned digit = (unsigned)(value[i] - '0');
+                if(digit > 9){
+                    return QUERY_ERR_SYNTAX;
+                }
+                // Past any range a table can give, but kept from overflowing
+                number = min(number * 10 + (int32_t)digit, (int32_t)100000000);
+            }
+            if(negative){
+                number = -number;
+            }
+            if(!in_range(number, param)){
+                return QUERY_ERR_RANGE;
+            }
+            *(int *)out = number;
+            return QUERY_OK;
+        }
+        case QUERY_FLOAT: {
+            if(!len || (value[0] != '-' && value[0] != '.' && !isdigit((unsigned char)value[0]))){
+                return QUERY_ERR_SYNTAX;
+            }
+            float number = strtof(value, &end);
+            if(end != value + len){
+                return QUERY_ERR_SYNTAX;
+            }
+            if(!in_range(number, param)){
+                return QUERY_ERR_RANGE;
+            }
+            *(float *)out = number;
+            return QUERY_OK;
+        }
+        case QUERY_BOOL:
+            if((len == 1 && value[0] == '1') || (len == 4 && memcmp(value, "true", 4) == 0)){
+                *(bool *)out = true;
+            } else if((len == 1 && value[0] == '0') || (len == 5 && memcmp(value, "false", 5) == 0)){
+                *(bool *)out = false;
+            } else {
+                return QUERY_ERR_SYNTAX;
+            }
+            return QUERY_OK;
+        case QUERY_STRING:
+            if(len > param->max){
+                return QUERY_ERR_TOO_LONG;
+            }
+            memcpy(out, value, len);
+            ((char *)out)[len] = 0;
+            return QUERY_OK;
+    }
+    return QUERY_ERR_SYNTAX;
+}
+
+static query_status_t fail(query_result_t * result, query_status_t status, const query_param_t * param){
+    result->status = status;
+    result->param = param;
+    return status;
+}
+
+bool queryParse(const char * uri, query_target_t * targets, int count, query_result_t * result){
+    result->status = QUERY_OK;
+    result->param = NULL;
+    result->key[0] = 0;
+    for(int t = 0; t < count; t++){
+        targets[t].seen = 0;
+        for(int i = 0; i < targets[t].count; i++){
+            set_default(&targets[t], &targets[t].params[i]);
+        }
+    }
+
+    const char * p = strchr(uri, '?');
+    p = p ? p + 1 : "";
+    while(*p){
+        // One scan finds both the '=' and the end of the pair
+        const char * key = p;
+        const char * eq = NULL;
+        while(*p && *p != '&'){
+            if(*p == '=' && !eq){
+                eq = p;
+            }
+            p++;
+        }
+        const char * pair_end = p;
+        if(*p){
+            p++;
+        }
+        if(pair_end == key){
+            continue; // "&&" or a trailing '&'
+        }
+        size_t key_len = (eq ? eq : pair_end) - key;
+        const char * value = eq ? eq + 1 : pair_end;
+
+        query_target_t * target = NULL;
+        int index = -1;
+        for(int t = 0; t < count && !target; t++){
+            for(int i = 0; i < targets[t].count; i++){
+                const char * name = targets[t].params[i].name;
+                if(name[0] == key[0] && strncmp(name, key, key_len) == 0 && name[key_len] == 0){
+                    target = &targets[t];
+                    index = i;
+                    break;
+                }
+            }
+        }
+        if(!target){
+            size_t n = min(key_len, QUERY_MAX_KEY);
+            memcpy(result->key, key, n);
+            result->key[n] = 0;
+            fail(result, QUERY_ERR_UNKNOWN, NULL);
+            return false;
+        }
+        const query_param_t * param = &target->params[index];
+        if(target->seen & (1u << index)){
+            fail(result, QUERY_ERR_DUPLICATE, param);
+            return false;
+        }
+        query_status_t status = convert(target, param, value, pair_end - value);
+        if(status != QUERY_OK){
+            fail(result, status, param);
+            return false;
+        }
+        target->seen |= 1u << index;
+    }
+
+    for(int t = 0; t < count; t++){
+        for(int i = 0; i < targets[t].count; i++){
+            if(targets[t].params[i].required && !(targets[t].seen & (1u << i))){
+                fail(result, QUERY_ERR_MISSING, &targets[t].params[i]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+const char * queryErrorMessage(const query_result_t * result, char * buf, size_t size){
+    const query_param_t * param = result->param;
+    const char * name = param ? param->name : result->key;
+    switch(result->status){
+        case QUERY_OK:
+            snprintf(buf, size, "OK");
+            break;
+        case QUERY_ERR_UNKNOWN:
+            snprintf(buf, size, "%s: unknown parameter", name);
+            break;
+        case QUERY_ERR_DUPLICATE:
+            snprintf(buf, size, "%s: given more than once", name);
+            break;
+        case QUERY_ERR_SYNTAX:
+            snprintf(buf, size, param && param->type == QUERY_BOOL ? "%s: expects 0 or 1" : "%s: not a number", name);
+            break;
+        case QUERY_ERR_RANGE:
+            snprintf(buf, size, "%s: out of range (%g to %g)", name, param->min, param->max);
+            break;
+        case QUERY_ERR_TOO_LONG:
+            snprintf(buf, size, "%s: longer than %d characters", name, (int)param->max);
+            break;
+        case QUERY_ERR_MISSING:
+            snprintf(buf, size, "%s: missing", name);
+            break;
+    }
+    return buf;
+}
@@ -0,0 +1,68 @@
+#ifndef query_parser_h
+#define query_parser_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Typed query strings. A handler describes its parameters once, in a const
+// table (name, type, range, default, where the value goes in its struct),
+// and queryParse() reads the query straight out of the request URI in one
+// pass: each key=value pair is looked up, converted and range checked as
+// it's reached. Nothing is copied or allocated, except string values into
+// their fields. The first problem stops the parse and says exactly what it
+// was, so a handler can answer 400 with it.
+
+typedef enum {
+    QUERY_INT,      // int
+    QUERY_FLOAT,    // float
+    QUERY_BOOL,     // bool, from 0/1 or false/true
+    QUERY_STRING,   // char[max + 1], NUL-terminated; min is unused
+} query_type_t;
+
+typedef struct {
+    const char * name;
+    query_type_t type;
+    uint16_t offset;   // of the field in the output struct
+    float min;         // inclusive
+    float max;
+    float def;         // what the field gets when the parameter isn't given
+    bool required;
+} query_param_t;
+
+// One table and the struct it fills in. queryParse() sets a bit in `seen`
+// for every parameter given (1 << its index in `params`).
+typedef struct {
+    const query_param_t * params;
+    uint8_t count;     // at most 32
+    void * out;
+    uint32_t seen;
+} query_target_t;
+
+typedef enum {
+    QUERY_OK,
+    QUERY_ERR_UNKNOWN,    // not in any table
+    QUERY_ERR_DUPLICATE,
+    QUERY_ERR_SYNTAX,     // not a number, or not 0/1
+    QUERY_ERR_RANGE,
+    QUERY_ERR_TOO_LONG,   // string over max
+    QUERY_ERR_MISSING,    // required and not given
+} query_status_t;
+
+const size_t QUERY_MAX_KEY = 32;
+
+typedef struct {
+    query_status_t status;
+    const query_param_t * param;  // the parameter at fault, if it's known
+    char key[QUERY_MAX_KEY + 1];  // the key as given (cut short), for QUERY_ERR_UNKNOWN
+} query_result_t;
+
+// Parse the query part of `uri` (everything after '?', if there is one)
+// into the targets; fields not given get their defaults. False on the
+// first problem, with the targets only partly filled in.
+bool queryParse(const char * uri, query_target_t * targets, int count, query_result_t * result);
+
+// "forward: out of range (-100 to 100)" and the like
+const char * queryErrorMessage(const query_result_t * result, char * buf, size_t size);
+
+#endif
@@ -0,0 +1,598 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "camera_stream.h"
+#include "buffer_pool.h"
+#include "logger.h"
+#include "task_config.h"
+#include "recorder.h"
+
+typedef struct {
+    uint32_t offset;    // into `data`
+    uint32_t len;
+    int64_t timestamp;  // capture time
+    uint16_t width, height;
+} recorder_frame_t;
+
+typedef struct {
+    int64_t timestamp;
+    int16_t forward, steer;
+    uint8_t source;
+} recorder_command_t;
+
+// What a download sends: the index as it stood when the download started
+typedef struct {
+    uint32_t frame_first, frame_count;
+    uint32_t command_first, command_count;
+} recorder_snapshot_t;
+
+static const char * const source_names[] = {"http", "ws"};
+
+static const char AVI_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: video/x-msvideo\r\n"
+    "Content-Length: %u\r\n"
+    "Content-Disposition: attachment; filename=\"recording.avi\"\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "\r\n";
+static const char CSV_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/csv\r\n"
+    "Content-Length: %u\r\n"
+    "Content-Disposition: attachment; filename=\"recording.csv\"\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "\r\n";
+
+// RIFF, hdrl (avih, strl (strh, strf)) and the movi list header
+const size_t AVI_HDRL_BYTES = 12 + (8 + 56) + 12 + (8 + 56) + (8 + 40);
+const size_t AVI_HEAD_BYTES = 12 + AVI_HDRL_BYTES + 12;
+const uint32_t AVIF_HASINDEX = 0x10;
+const uint32_t AVIIF_KEYFRAME = 0x10;
+
+static portMUX_TYPE recorder_mux = portMUX_INITIALIZER_UNLOCKED;
+// One PSRAM allocation: frame index, command log, frame data. The index
+// and the log are rings, oldest entry at *_first.
+static recorder_frame_t * frames = NULL;
+static uint32_t frame_first = 0;
+static uint32_t frame_count = 0;
+static recorder_command_t * commands = NULL;
+static uint32_t command_first = 0;
+static uint32_t command_count = 0;
+static uint8_t * data = NULL;
+static size_t data_size = 0;
+static size_t data_head = 0;    // where the next frame goes
+static bool downloading = false;
+static int64_t last_drive_us = 0;
+static TaskHandle_t recorder_task_handle = NULL;
+static recorder_stats_t stats = {true, false, RECORDER_FPS};
+
+
+void recorderSetEnabled(bool enabled){
+    portENTER_CRITICAL(&recorder_mux);
+    stats.enabled = enabled;
+    portEXIT_CRITICAL(&recorder_mux);
+}
+
+void recorderSetFps(int fps){
+    portENTER_CRITICAL(&recorder_mux);
+    stats.fps = constrain(fps, 1, RECORDER_MAX_FPS);
+    portEXIT_CRITICAL(&recorder_mux);
+}
+
+void recorderLogDrive(int forward, int steer, recorder_source_t source){
+    int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&recorder_mux);
+    if(!data || !stats.enabled){
+        portEXIT_CRITICAL(&recorder_mux);
+        return;
+    }
+    bool wake = !stats.recording;
+    last_drive_us = now;
+    if(downloading){
+        stats.paused++;
+    } else {
+        recorder_command_t * command = &commands[(command_first + command_count) % RECORDER_MAX_COMMANDS];
+        if(command_count == RECORDER_MAX_COMMANDS){
+            command_first = (command_first + 1) % RECORDER_MAX_COMMANDS;
+        } else {
+            command_count++;
+        }
+        command->timestamp = now;
+        command->forward = forward;
+        command->steer = steer;
+        command->source = source;
+        stats.commands++;
+    }
+    portEXIT_CRITICAL(&recorder_mux);
+    if(wake && recorder_task_handle){
+        xTaskNotifyGive(recorder_task_handle);
+    }
+}
+
+// Call with recorder_mux held
+static void drop_oldest_frame(){
+    stats.held_bytes -= frames[frame_first].len;
+    frame_first = (frame_first + 1) % RECORDER_MAX_FRAMES;
+    frame_count--;
+    stats.evicted++;
+}
+
+// Whether the oldest frame, at `f`, is in the way of a new one going in
+// at [start, end). Frames sit in the ring in the order they were taken, so
+// the ones in the way are always the oldest: those from the previous lap
+// from `head` on, and if the new frame wraps round to the start, all of
+// those and then the ones under it.
+static bool in_the_way(const recorder_frame_t * f, size_t head, size_t start, size_t end){
+    if(start != head){
+        return f->offset >= head || f->offset < end;
+    }
+    return f->offset >= start && f->offset < end;
+}
+
+static void record(stream_frame_t * frame){
+    camera_fb_t * fb = frame->fb;
+    size_t len = fb->len;
+
+    // Make room, under the lock; copy, outside it; then add the frame to
+    // the index, where a download will see it
+    portENTER_CRITICAL(&recorder_mux);
+    if(downloading || len > data_size){
+        if(downloading){
+            stats.paused++;
+        } else {
+            stats.too_big++;
+        }
+        portEXIT_CRITICAL(&recorder_mux);
+        return;
+    }
+    while(frame_count && frames[frame_first].timestamp < frame->timestamp - RECORDER_SECONDS * 1000000LL){
+        drop_oldest_frame();
+    }
+    size_t start = data_head + len > data_size ? 0 : data_head;
+    while(frame_count && (frame_count == RECORDER_MAX_FRAMES ||
+            in_the_way(&frames[frame_first], data_head, start, start + len))){
+        drop_oldest_frame();
+    }
+    data_head = start + len;
+    uint32_t slot = (frame_first + frame_count) % RECORDER_MAX_FRAMES;
+    portEXIT_CRITICAL(&recorder_mux);
+
+    memcpy(data + start, fb->buf, len);
+
+    portENTER_CRITICAL(&recorder_mux);
+    recorder_frame_t * entry = &frames[slot];
+    entry->offset = start;
+    entry->len = len;
+    entry->timestamp = frame->timestamp;
+    entry->width = fb->width;
+    entry->height = fb->height;
+    frame_count++;
+    stats.frames++;
+    stats.bytes += len;
+    stats.held_bytes += len;
+    portEXIT_CRITICAL(&recorder_mux);
+}
+
+static bool armed(int64_t now, int * fps){
+    portENTER_CRITICAL(&recorder_mux);
+    bool on = stats.enabled && last_drive_us && now - last_drive_us < RECORDER_SECONDS * 1000000LL;
+    *fps = stats.fps;
+    portEXIT_CRITICAL(&recorder_mux);
+    return on;
+}
+
+static void set_recording(bool recording){
+    portENTER_CRITICAL(&recorder_mux);
+    stats.recording = recording;
+    portEXIT_CRITICAL(&recorder_mux);
+}
+
+static void recorder_task(void * arg){
+    int client = -1;
+    int64_t next_due = 0;
+    while(true){
+        int fps;
+        if(!armed(esp_timer_get_time(), &fps)){
+            if(client >= 0){
+                streamRemoveClient(client);
+                client = -1;
+                set_recording(false);
+                LOG_INFO("Recorder: stopped");
+            }
+            // Woken by the next drive command
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+            continue;
+        }
+        if(client < 0){
+            // The camera may not be up yet, or every client slot taken
+            client = streamAddClient();
+            if(client < 0){
+                LOG_EVERY(LOG_LEVEL_WARN, 10000, "Recorder: no stream client free");
+                vTaskDelay(pdMS_TO_TICKS(100));
+                continue;
+            }
+            set_recording(true);
+            LOG_INFO("Recorder: started");
+        }
+
+        stream_frame_t * frame = streamAcquireFrame(client);
+        if(!frame){
+            continue;
+        }
+        // Keep to the frame rate on average, whatever the sensor's is
+        if(frame->timestamp >= next_due){
+            int64_t interval = 1000000 / fps;
+            next_due += interval;
+            if(next_due < frame->timestamp){
+                next_due = frame->timestamp + interval;
+            }
+            record(frame);
+        }
+        streamReleaseFrame(frame);
+    }
+}
+
+void initRecorder(){
+    if(!psramFound()){
+        LOG_WARN("Recorder: no PSRAM, not recording");
+        return;
+    }
+    size_t index_bytes = RECORDER_MAX_FRAMES * sizeof(recorder_frame_t);
+    size_t log_bytes = RECORDER_MAX_COMMANDS * sizeof(recorder_command_t);
+    uint8_t * buffer = (uint8_t *)heap_caps_malloc(RECORDER_BUFFER_BYTES, MALLOC_CAP_SPIRAM);
+    if(!buffer){
+        LOG_ERROR("Recorder: can't allocate %u bytes", (unsigned)RECORDER_BUFFER_BYTES);
+        return;
+    }
+    portENTER_CRITICAL(&recorder_mux);
+    frames = (recorder_frame_t *)buffer;
+    commands = (recorder_command_t *)(buffer + index_bytes);
+    data = buffer + index_bytes + log_bytes;
+    data_size = RECORDER_BUFFER_BYTES - index_bytes - log_bytes;
+    portEXIT_CRITICAL(&recorder_mux);
+
+    TaskHandle_t task = NULL;
+    taskCreate(TASK_RECORDER, recorder_task, NULL, &task);
+    recorder_task_handle = task;
+}
+
+void recorderGetStats(recorder_stats_t * out){
+    portENTER_CRITICAL(&recorder_mux);
+    *out = stats;
+    out->held_frames = frame_count;
+    out->held_ms = 0;
+    if(frame_count){
+        const recorder_frame_t * newest = &frames[(frame_first + frame_count - 1) % RECORDER_MAX_FRAMES];
+        out->held_ms = (newest->timestamp - frames[frame_first].timestamp) / 1000;
+    }
+    portEXIT_CRITICAL(&recorder_mux);
+}
+
+// Freeze the recording for a download: everything within RECORDER_SECONDS
+// of the newest frame or command
+static esp_err_t begin_download(recorder_snapshot_t * snap){
+    portENTER_CRITICAL(&recorder_mux);
+    if(!data || downloading){
+        portEXIT_CRITICAL(&recorder_mux);
+        return data ? ESP_ERR_INVALID_STATE : ESP_ERR_NOT_FOUND;
+    }
+    int64_t newest = 0;
+    if(frame_count){
+        newest = frames[(frame_first + frame_count - 1) % RECORDER_MAX_FRAMES].timestamp;
+    }
+    if(command_count){
+        newest = max(newest, commands[(command_first + command_count - 1) % RECORDER_MAX_COMMANDS].timestamp);
+    }
+    int64_t cutoff = newest - RECORDER_SECONDS * 1000000LL;
+    *snap = {frame_first, frame_count, command_first, command_count};
+    while(snap->frame_count && frames[snap->frame_first].timestamp < cutoff){
+        snap->frame_first = (snap->frame_first + 1) % RECORDER_MAX_FRAMES;
+        snap->frame_count--;
+    }
+    while(snap->command_count && commands[snap->command_first].timestamp < cutoff){
+        snap->command_first = (snap->command_first + 1) % RECORDER_MAX_COMMANDS;
+        snap->command_count--;
+    }
+    bool empty = !snap->frame_count && !snap->command_count;
+    downloading = !empty;
+    portEXIT_CRITICAL(&recorder_mux);
+    return empty ? ESP_ERR_NOT_FOUND : ESP_OK;
+}
+
+static void end_download(){
+    portENTER_CRITICAL(&recorder_mux);
+    downloading = false;
+    stats.downloads++;
+    portEXIT_CRITICAL(&recorder_mux);
+}
+
+// The index doesn't move during a download, so it's read without the lock
+static const recorder_frame_t * snapshot_frame(const recorder_snapshot_t * snap, uint32_t i){
+    return &frames[(snap->frame_first + i) % RECORDER_MAX_FRAMES];
+}
+
+static const recorder_command_t * snapshot_command(const recorder_snapshot_t * snap, uint32_t i){
+    return &commands[(snap->command_first + i) % RECORDER_MAX_COMMANDS];
+}
+
+static esp_err_t send_all(httpd_req_t *req, const void * buf, size_t len){
+    const char * p = (const char *)buf;
+    while(len){
+        int sent = httpd_send(req, p, len);
+        if(sent <= 0){
+            return ESP_FAIL;
+        }
+        p += sent;
+        len -= sent;
+    }
+    return ESP_OK;
+}
+
+// The events as CSV, either sent through `buf` or, with no `req`, only
+// counted so the Content-Length can go first
+typedef struct {
+    httpd_req_t *req;
+    char * buf;
+    size_t size;
+    size_t len;
+    size_t total;
+    esp_err_t res;
+} text_writer_t;
+
+static void text_flush(text_writer_t * t){
+    if(t->req && t->len && t->res == ESP_OK){
+        t->res = send_all(t->req, t->buf, t->len);
+    }
+    t->len = 0;
+}
+
+static void text_add(text_writer_t * t, const char * format, ...){
+    char line[96];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    n = min(n, (int)sizeof(line) - 1);
+    t->total += n;
+    if(!t->req){
+        return;
+    }
+    if(t->len + n > t->size){
+        text_flush(t);
+    }
+    memcpy(t->buf + t->len, line, n);
+    t->len += n;
+}
+
+// Frames and commands in time order. Frames are numbered as in the AVI.
+static void write_events(text_writer_t * t, const recorder_snapshot_t * snap){
+    text_add(t, "time_us,event,frame,bytes,forward,steer,source\n");
+    uint32_t f = 0;
+    uint32_t c = 0;
+    while(f < snap->frame_count || c < snap->command_count){
+        const recorder_frame_t * frame = f < snap->frame_count ? snapshot_frame(snap, f) : NULL;
+        const recorder_command_t * command = c < snap->command_count ? snapshot_command(snap, c) : NULL;
+        if(frame && (!command || frame->timestamp <= command->timestamp)){
+            text_add(t, "%lld,frame,%u,%u,,,\n", (long long)frame->timestamp, f, frame->len);
+            f++;
+        } else {
+            text_add(t, "%lld,drive,,,%d,%d,%s\n", (long long)command->timestamp,
+                command->forward, command->steer, source_names[command->source]);
+            c++;
+        }
+    }
+    text_flush(t);
+}
+
+static size_t events_size(const recorder_snapshot_t * snap){
+    text_writer_t counter = {NULL, NULL, 0, 0, 0, ESP_OK};
+    write_events(&counter, snap);
+    return counter.total;
+}
+
+static uint8_t * put32(uint8_t * p, uint32_t value){
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+    return p + 4;
+}
+
+static uint8_t * put16(uint8_t * p, uint16_t value){
+    p[0] = value;
+    p[1] = value >> 8;
+    return p + 2;
+}
+
+static uint8_t * put_fourcc(uint8_t * p, const char * fourcc){
+    memcpy(p, fourcc, 4);
+    return p + 4;
+}
+
+static uint8_t * put_chunk(uint8_t * p, const char * fourcc, uint32_t size){
+    return put32(put_fourcc(p, fourcc), size);
+}
+
+static uint8_t * put_list(uint8_t * p, const char * type, uint32_t size){
+    return put_fourcc(put_chunk(p, "LIST", size + 4), type);
+}
+
+// Everything up to the first frame. `movi_bytes` is the frame chunks.
+static size_t avi_head(uint8_t * buf, const recorder_snapshot_t * snap, uint32_t riff_bytes, uint32_t movi_bytes){
+    uint32_t n = snap->frame_count;
+    const recorder_frame_t * first = snapshot_frame(snap, 0);
+    uint32_t largest = 0;
+    for(uint32_t i = 0; i < n; i++){
+        largest = max(largest, snapshot_frame(snap, i)->len);
+    }
+    // AVI wants a fixed frame rate: use the average
+    int64_t span = n > 1 ? snapshot_frame(snap, n - 1)->timestamp - first->timestamp : 0;
+    uint32_t us_per_frame = n > 1 ? span / (n - 1) : 1000000 / RECORDER_FPS;
+    us_per_frame = max(us_per_frame, 1u);
+
+    uint8_t * p = buf;
+    p = put_chunk(p, "RIFF", riff_bytes);
+    p = put_fourcc(p, "AVI ");
+    p = put_list(p, "hdrl", AVI_HDRL_BYTES - 12);
+
+    p = put_chunk(p, "avih", 56);
+    p = put32(p, us_per_frame);
+    p = put32(p, 0);                // max bytes per second
+    p = put32(p, 0);                // padding granularity
+    p = put32(p, AVIF_HASINDEX);
+    p = put32(p, n);
+    p = put32(p, 0);                // initial frames
+    p = put32(p, 1);                // streams
+    p = put32(p, largest);
+    p = put32(p, first->width);
+    p = put32(p, first->height);
+    for(int i = 0; i < 4; i++){
+        p = put32(p, 0);
+    }
+
+    p = put_list(p, "strl", (8 + 56) + (8 + 40));
+    p = put_chunk(p, "strh", 56);
+    p = put_fourcc(p, "vids");
+    p = put_fourcc(p, "MJPG");
+    p = put32(p, 0);                // flags
+    p = put16(p, 0);                // priority
+    p = put16(p, 0);                // language
+    p = put32(p, 0);                // initial frames
+    p = put32(p, us_per_frame);     // scale / rate = seconds per frame
+    p = put32(p, 1000000);
+    p = put32(p, 0);                // start
+    p = put32(p, n);
+    p = put32(p, largest);
+    p = put32(p, 0xFFFFFFFF);       // quality: default
+    p = put32(p, 0);                // sample size: varies
+    p = put16(p, 0);
+    p = put16(p, 0);
+    p = put16(p, first->width);
+    p = put16(p, first->height);
+
+    p = put_chunk(p, "strf", 40);
+    p = put32(p, 40);
+    p = put32(p, first->width);
+    p = put32(p, first->height);
+    p = put16(p, 1);                // planes
+    p = put16(p, 24);               // bits per pixel, decoded
+    p = put_fourcc(p, "MJPG");
+    p = put32(p, first->width * first->height * 3);
+    for(int i = 0; i < 4; i++){
+        p = put32(p, 0);
+    }
+
+    p = put_list(p, "movi", movi_bytes);
+    return p - buf;
+}
+
+esp_err_t recorderSendAvi(httpd_req_t *req){
+    recorder_snapshot_t snap;
+    esp_err_t res = begin_download(&snap);
+    if(res != ESP_OK){
+        return res;
+    }
+    if(!snap.frame_count){
+        end_download();
+        return ESP_ERR_NOT_FOUND;
+    }
+    uint8_t * buf = (uint8_t *)poolAlloc(POOL_REQUEST_BLOCK);
+    if(!buf){
+        end_download();
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint32_t movi_bytes = 0;
+    for(uint32_t i = 0; i < snap.frame_count; i++){
+        uint32_t len = snapshot_frame(&snap, i)->len;
+        movi_bytes += 8 + len + (len & 1);
+    }
+    uint32_t idx_bytes = 16 * snap.frame_count;
+    uint32_t events_bytes = events_size(&snap);
+    uint32_t riff_bytes = 4 + AVI_HDRL_BYTES + (12 + movi_bytes) + (8 + idx_bytes) + (8 + events_bytes + (events_bytes & 1));
+
+    char header[sizeof(AVI_HEADER) + 16];
+    int header_len = snprintf(header, sizeof(header), AVI_HEADER, (unsigned)(8 + riff_bytes));
+    res = send_all(req, header, header_len);
+    if(res == ESP_OK){
+        res = send_all(req, buf, avi_head(buf, &snap, riff_bytes, movi_bytes));
+    }
+
+    // Straight out of PSRAM
+    static const uint8_t pad = 0;
+    for(uint32_t i = 0; i < snap.frame_count && res == ESP_OK; i++){
+        const recorder_frame_t * frame = snapshot_frame(&snap, i);
+        uint8_t chunk[8];
+        put_chunk(chunk, "00dc", frame->len);
+        res = send_all(req, chunk, sizeof(chunk));
+        if(res == ESP_OK){
+            res = send_all(req, data + frame->offset, frame->len);
+        }
+        if(res == ESP_OK && (frame->len & 1)){
+            res = send_all(req, &pad, 1);
+        }
+    }
+
+    // idx1, a block at a time. Offsets are from the "movi" fourcc.
+    if(res == ESP_OK){
+        res = send_all(req, buf, put_chunk(buf, "idx1", idx_bytes) - buf);
+    }
+    uint32_t offset = 4;
+    for(uint32_t i = 0; i < snap.frame_count && res == ESP_OK; ){
+        uint8_t * p = buf;
+        for(; i < snap.frame_count && p + 16 <= buf + POOL_REQUEST_BLOCK; i++){
+            uint32_t len = snapshot_frame(&snap, i)->len;
+            p = put_fourcc(p, "00dc");
+            p = put32(p, AVIIF_KEYFRAME);
+            p = put32(p, offset);
+            p = put32(p, len);
+            offset += 8 + len + (len & 1);
+        }
+        res = send_all(req, buf, p - buf);
+    }
+
+    if(res == ESP_OK){
+        res = send_all(req, buf, put_chunk(buf, "s32e", events_bytes) - buf);
+    }
+    if(res == ESP_OK){
+        text_writer_t text = {req, (char *)buf, POOL_REQUEST_BLOCK, 0, 0, ESP_OK};
+        write_events(&text, &snap);
+        res = text.res;
+    }
+    if(res == ESP_OK && (events_bytes & 1)){
+        res = send_all(req, &pad, 1);
+    }
+
+    poolFree(buf);
+    end_download();
+    LOG_INFO("Recorder: sent %u frames, %u bytes%s", snap.frame_count, (unsigned)(8 + riff_bytes),
+        res == ESP_OK ? "" : " (client gone)");
+    return res;
+}
+
+esp_err_t recorderSendCsv(httpd_req_t *req){
+    recorder_snapshot_t snap;
+    esp_err_t res = begin_download(&snap);
+    if(res != ESP_OK){
+        return res;
+    }
+    char * buf = (char *)poolAlloc(POOL_REQUEST_BLOCK);
+    if(!buf){
+        end_download();
+        return ESP_ERR_NO_MEM;
+    }
+    char header[sizeof(CSV_HEADER) + 16];
+    int header_len = snprintf(header, sizeof(header), CSV_HEADER, (unsigned)events_size(&snap));
+    res = send_all(req, header, header_len);
+    if(res == ESP_OK){
+        text_writer_t text = {req, buf, POOL_REQUEST_BLOCK, 0, 0, ESP_OK};
+        write_events(&text, &snap);
+        res = text.res;
+    }
+    poolFree(buf);
+    end_download();
+    return res;
+}
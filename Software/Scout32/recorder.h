@@ -0,0 +1,76 @@
+#ifndef recorder_h
+#define recorder_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// Black box: the last few seconds of video and drive commands, kept in
+// PSRAM so /recording can fetch them after something goes wrong.
+//
+// The recorder is a stream client of its own (camera_stream.h) on a low
+// priority task beside the capture task. It takes up to a set number of
+// frames a second and copies each once, straight from the frame buffer
+// into a ring in PSRAM; nothing on the capture or send paths waits for it,
+// and it never holds more than one frame buffer. An index of the frames
+// and a log of drive commands share the ring's single allocation, made at
+// boot and never resized. The oldest frames go when they fall out of the
+// time window or the space runs out, whichever comes first.
+//
+// It records while the rover is being driven: a drive command starts it
+// and it carries on until RECORDER_SECONDS after the last one, so a parked
+// rover lets the camera idle but the seconds after a link drops are kept.
+//
+// /recording sends it all as an MJPEG AVI (frames, idx1 index) with the
+// events as CSV in a trailing "s32e" chunk that players skip;
+// /recording?format=csv sends just the CSV. Recording pauses while a
+// download runs, so what's sent is a consistent snapshot.
+
+// All of it: index, command log and frames. Only with PSRAM.
+const size_t RECORDER_BUFFER_BYTES = 2 * 1024 * 1024;
+const uint32_t RECORDER_SECONDS = 10;
+const int RECORDER_FPS = 10;
+const int RECORDER_MAX_FPS = 30;
+const uint32_t RECORDER_MAX_FRAMES = RECORDER_SECONDS * RECORDER_MAX_FPS;
+// Drive commands come at 20-50 a second
+const uint32_t RECORDER_MAX_COMMANDS = RECORDER_SECONDS * 50;
+
+
+typedef enum {
+    RECORDER_SOURCE_HTTP,
+    RECORDER_SOURCE_WS,
+} recorder_source_t;
+
+typedef struct {
+    bool enabled;
+    bool recording;       // a stream client right now
+    int fps;
+    uint32_t frames;      // frames recorded
+    uint32_t bytes;
+    uint32_t commands;
+    uint32_t evicted;     // frames dropped to make room or past the window
+    uint32_t too_big;     // frames bigger than the whole ring
+    uint32_t paused;      // frames and commands not recorded during a download
+    uint32_t downloads;
+    uint32_t held_frames; // what's in the buffer now
+    uint32_t held_bytes;
+    uint32_t held_ms;
+} recorder_stats_t;
+
+void initRecorder();
+void recorderSetEnabled(bool enabled);
+void recorderSetFps(int fps);
+
+// Called for every drive command applied
+void recorderLogDrive(int forward, int steer, recorder_source_t source);
+
+// Write the recording to `req` as a complete HTTP response, from a stream
+// sender task. ESP_ERR_INVALID_STATE if another download is running,
+// ESP_ERR_NOT_FOUND if there's nothing recorded; in both cases nothing has
+// been sent.
+esp_err_t recorderSendAvi(httpd_req_t *req);
+esp_err_t recorderSendCsv(httpd_req_t *req);
+
+void recorderGetStats(recorder_stats_t * stats);
+
+#endif
@@ -0,0 +1,336 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+#include "esp_timer.h"
+#include "camera_stream.h"
+#include "logger.h"
+#include "task_config.h"
+#include "rtp_stream.h"
+
+const uint8_t RTP_PAYLOAD_JPEG = 26;
+const uint8_t RTCP_SENDER_REPORT = 200;
+const int RTP_HEADER_LEN = 12;
+const int RTP_JPEG_HEADER_LEN = 8;
+const int RTP_RESTART_HEADER_LEN = 4;
+const int RTP_QUANT_HEADER_LEN = 4;
+// Q values of 128 and up mean the tables travel with the frame
+const uint8_t RTP_JPEG_Q_INBAND = 255;
+
+// What RFC 2435 needs out of a baseline JPEG
+typedef struct {
+    const uint8_t * scan;       // entropy coded data, after the SOS header
+    size_t scan_len;
+    const uint8_t * tables[2];  // luma and chroma quantisation, zig-zag order
+    uint16_t width;
+    uint16_t height;
+    uint8_t type;               // 0 for 4:2:2, 1 for 4:2:0, +64 with restart markers
+    uint16_t restart_interval;
+} rtp_jpeg_t;
+
+static portMUX_TYPE rtp_mux = portMUX_INITIALIZER_UNLOCKED;
+static rtp_stats_t stats;
+static volatile bool stop_requested = false;
+static int sock = -1;
+static struct sockaddr_in rtp_addr;
+static struct sockaddr_in rtcp_addr;
+static uint32_t ssrc;
+static uint32_t timestamp_offset;
+static uint16_t seq;
+
+
+static uint16_t read16(const uint8_t * p){
+    return (p[0] << 8) | p[1];
+}
+
+static uint8_t * put16(uint8_t * p, uint16_t v){
+    p[0] = v >> 8;
+    p[1] = v;
+    return p + 2;
+}
+
+static uint8_t * put32(uint8_t * p, uint32_t v){
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+    return p + 4;
+}
+
+// Pull out the parts of a JPEG that go on the wire. Only baseline 8-bit
+// YCbCr with the luma on table 0 and chroma on table 1 fits the format,
+// which is what the OV2640 produces.
+static bool parse_jpeg(const uint8_t * buf, size_t len, rtp_jpeg_t * out){
+    memset(out, 0, sizeof(*out));
+    if(len < 4 || buf[0] != 0xFF || buf[1] != 0xD8){
+        return false;
+    }
+    size_t i = 2;
+    while(i + 4 <= len){
+        if(buf[i] != 0xFF){
+            return false;
+        }
+        uint8_t marker = buf[i + 1];
+        if(marker == 0xFF){
+            i++; // fill byte
+            continue;
+        }
+        size_t seg_len = read16(buf + i + 2);
+        const uint8_t * seg = buf + i + 4;
+        if(seg_len < 2 || i + 2 + seg_len > len){
+            return false;
+        }
+        size_t body_len = seg_len - 2;
+
+        if(marker == 0xDB){
+            for(size_t t = 0; t + 65 <= body_len; t += 65){
+                uint8_t precision = seg[t] >> 4;
+                uint8_t id = seg[t] & 0x0F;
+                if(precision != 0 || id > 1){
+                    return false;
+                }
+                out->tables[id] = seg + t + 1;
+            }
+        } else if(marker == 0xC0){
+            if(body_len < 15 || seg[0] != 8 || seg[5] != 3){
+                return false;
+            }
+            out->height = read16(seg + 1);
+            out->width = read16(seg + 3);
+            const uint8_t * y = seg + 6;
+            const uint8_t * cb = seg + 9;
+            const uint8_t * cr = seg + 12;
+            if(y[1] == 0x21){
+                out->type = 0;
+            } else if(y[1] == 0x22){
+                out->type = 1;
+            } else {
+                return false;
+            }
+            if(cb[1] != 0x11 || cr[1] != 0x11 || y[2] != 0 || cb[2] != 1 || cr[2] != 1){
+                return false;
+            }
+        } else if(marker >= 0xC1 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC){
+            // Progressive, lossless, arithmetic coded...
+            return false;
+        } else if(marker == 0xDD){
+            out->restart_interval = read16(seg);
+        } else if(marker == 0xDA){
+            out->scan = buf + i + 2 + seg_len;
+            out->scan_len = len - (out->scan - buf);
+            if(out->scan_len >= 2 && buf[len - 2] == 0xFF && buf[len - 1] == 0xD9){
+                out->scan_len -= 2;
+            }
+            break;
+        }
+        i += 2 + seg_len;
+    }
+    if(out->restart_interval){
+        out->type += 64;
+    }
+    return out->scan && out->tables[0] && out->tables[1] && out->width
+        && out->width <= 2040 && out->height <= 2040;
+}
+
+static uint32_t rtp_timestamp(int64_t us){
+    // 90kHz media clock
+    return timestamp_offset + (uint32_t)(us * 9 / 100);
+}
+
+// Returns false if the socket couldn't take the packet
+static bool send_packet(const uint8_t * packet, size_t len, const struct sockaddr_in * to){
+    return sendto(sock, packet, len, MSG_DONTWAIT, (const struct sockaddr *)to, sizeof(*to)) == (ssize_t)len;
+}
+
+static void send_frame(const uint8_t * buf, size_t len, int64_t capture_us){
+    rtp_jpeg_t jpeg;
+    if(!parse_jpeg(buf, len, &jpeg)){
+        portENTER_CRITICAL(&rtp_mux);
+        stats.unsupported++;
+        portEXIT_CRITICAL(&rtp_mux);
+        LOG_EVERY(LOG_LEVEL_WARN, 10000, "RTP: frame isn't baseline JPEG, not sent");
+        return;
+    }
+
+    uint8_t packet[RTP_MAX_DATAGRAM];
+    uint32_t timestamp = rtp_timestamp(capture_us);
+    size_t offset = 0;
+    uint32_t packets = 0;
+    bool dropped = false;
+    while(offset < jpeg.scan_len){
+        uint8_t * p = packet;
+        // Headers first, the rest of the datagram for data: the first
+        // packet also carries the quantisation tables
+        size_t header_len = RTP_HEADER_LEN + RTP_JPEG_HEADER_LEN
+            + (jpeg.restart_interval ? RTP_RESTART_HEADER_LEN : 0)
+            + (offset == 0 ? RTP_QUANT_HEADER_LEN + 128 : 0);
+        size_t payload_len = min(jpeg.scan_len - offset, RTP_MAX_DATAGRAM - header_len);
+        // RTP header, marker bit on the last packet of the frame
+        bool last = offset + payload_len == jpeg.scan_len;
+        *p++ = 0x80;
+        *p++ = (last ? 0x80 : 0) | RTP_PAYLOAD_JPEG;
+        p = put16(p, seq++);
+        p = put32(p, timestamp);
+        p = put32(p, ssrc);
+
+        // JPEG header: type-specific, 24 bit fragment offset, type, Q, size / 8
+        *p++ = 0;
+        *p++ = offset >> 16;
+        *p++ = offset >> 8;
+        *p++ = offset;
+        *p++ = jpeg.type;
+        *p++ = RTP_JPEG_Q_INBAND;
+        *p++ = jpeg.width / 8;
+        *p++ = jpeg.height / 8;
+
+        if(jpeg.restart_interval){
+            // Fragments don't line up with restart intervals: F = L = 1,
+            // count 0x3FFF
+            p = put16(p, jpeg.restart_interval);
+            p = put16(p, 0xFFFF);
+        }
+        if(offset == 0){
+            *p++ = 0; // MBZ
+            *p++ = 0; // 8 bit tables
+            p = put16(p, 128);
+            memcpy(p, jpeg.tables[0], 64);
+            memcpy(p + 64, jpeg.tables[1], 64);
+            p += 128;
+        }
+        memcpy(p, jpeg.scan + offset, payload_len);
+        p += payload_len;
+
+        if(!send_packet(packet, p - packet, &rtp_addr)){
+            // Out of buffers: the rest of this frame would only arrive late
+            dropped = true;
+            break;
+        }
+        offset += payload_len;
+        packets++;
+    }
+
+    portENTER_CRITICAL(&rtp_mux);
+    stats.packets += packets;
+    stats.bytes += offset;
+    if(dropped){
+        stats.dropped++;
+    } else {
+        stats.frames++;
+    }
+    portEXIT_CRITICAL(&rtp_mux);
+}
+
+static void send_sender_report(){
+    int64_t now = esp_timer_get_time();
+    // NTP format time on the esp_timer clock; receivers only need it to be
+    // consistent with the RTP timestamps
+    uint32_t ntp_sec = now / 1000000;
+    uint32_t ntp_frac = (uint32_t)(((now % 1000000) << 32) / 1000000);
+    portENTER_CRITICAL(&rtp_mux);
+    uint32_t packets = stats.packets;
+    uint32_t bytes = stats.bytes;
+    portEXIT_CRITICAL(&rtp_mux);
+
+    uint8_t report[28];
+    uint8_t * p = report;
+    *p++ = 0x80;
+    *p++ = RTCP_SENDER_REPORT;
+    p = put16(p, sizeof(report) / 4 - 1);
+    p = put32(p, ssrc);
+    p = put32(p, ntp_sec);
+    p = put32(p, ntp_frac);
+    p = put32(p, rtp_timestamp(now));
+    p = put32(p, packets);
+    p = put32(p, bytes);
+    send_packet(report, sizeof(report), &rtcp_addr);
+}
+
+static void rtp_task(void * arg){
+    int client = streamAddClient();
+    if(client < 0){
+        LOG_WARN("RTP: no stream slot free, or the camera isn't ready");
+    }
+    // First report goes out with the first frame
+    int64_t last_report = esp_timer_get_time() - RTP_SENDER_REPORT_MS * 1000LL;
+    while(client >= 0 && !stop_requested){
+        stream_frame_t * frame = streamAcquireFrame(client);
+        if(!frame){
+            LOG_ERROR("RTP: camera capture failed");
+            break;
+        }
+        send_frame(frame->fb->buf, frame->fb->len, frame->timestamp);
+        streamReleaseFrame(frame);
+
+        int64_t now = esp_timer_get_time();
+        if(now - last_report >= RTP_SENDER_REPORT_MS * 1000LL){
+            send_sender_report();
+            last_report = now;
+        }
+    }
+    if(client >= 0){
+        streamRemoveClient(client);
+    }
+    close(sock);
+    sock = -1;
+
+    rtp_stats_t final_stats;
+    rtpGetStats(&final_stats);
+    LOG_INFO("RTP: stopped, %u frames, %u packets, %u dropped", final_stats.frames, final_stats.packets, final_stats.dropped);
+    portENTER_CRITICAL(&rtp_mux);
+    stats.running = false;
+    portEXIT_CRITICAL(&rtp_mux);
+    vTaskDelete(NULL);
+}
+
+esp_err_t rtpStart(uint32_t host, uint16_t port){
+    portENTER_CRITICAL(&rtp_mux);
+    bool running = stats.running;
+    if(!running){
+        memset(&stats, 0, sizeof(stats));
+        stats.running = true;
+        stats.host = host;
+        stats.port = port;
+    }
+    portEXIT_CRITICAL(&rtp_mux);
+    if(running){
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if(sock < 0){
+        LOG_ERROR("RTP: socket failed: %d", errno);
+        portENTER_CRITICAL(&rtp_mux);
+        stats.running = false;
+        portEXIT_CRITICAL(&rtp_mux);
+        return ESP_FAIL;
+    }
+    memset(&rtp_addr, 0, sizeof(rtp_addr));
+    rtp_addr.sin_family = AF_INET;
+    rtp_addr.sin_addr.s_addr = host;
+    rtp_addr.sin_port = htons(port);
+    rtcp_addr = rtp_addr;
+    rtcp_addr.sin_port = htons(port + 1);
+
+    // New session: new source id, random-looking starting points
+    uint32_t seed = (uint32_t)esp_timer_get_time() * 2654435761u;
+    ssrc = seed ^ 0x5C0A7032;
+    timestamp_offset = seed * 2246822519u;
+    seq = seed >> 16;
+    stop_requested = false;
+
+    struct in_addr addr;
+    addr.s_addr = host;
+    LOG_INFO("RTP: sending to %s:%u", inet_ntoa(addr), port);
+    taskCreate(TASK_RTP_SEND, rtp_task, NULL, NULL);
+    return ESP_OK;
+}
+
+void rtpStop(){
+    stop_requested = true;
+}
+
+void rtpGetStats(rtp_stats_t * out){
+    portENTER_CRITICAL(&rtp_mux);
+    *out = stats;
+    portEXIT_CRITICAL(&rtp_mux);
+}
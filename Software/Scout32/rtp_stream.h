@@ -0,0 +1,40 @@
+#ifndef rtp_stream_h
+#define rtp_stream_h
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// RTP/JPEG (RFC 2435) over UDP, alongside the multipart HTTP stream. A
+// sender task takes frames from the capture task like any /stream client
+// and splits each one into MTU sized datagrams. Nothing is retransmitted:
+// if the network can't take a packet the rest of that frame is dropped,
+// so a receiver sees either a whole frame or none of it, never a late one.
+// An RTCP sender report every second lets receivers map RTP timestamps to
+// capture time.
+
+const uint16_t RTP_DEFAULT_PORT = 5004;
+// Largest UDP payload that fits a 1500 byte Ethernet/WiFi MTU after the IP
+// and UDP headers. Each packet carries as much JPEG data as its RTP, JPEG,
+// restart and quantisation table headers leave room for, so none is ever
+// IP fragmented.
+const int RTP_MAX_DATAGRAM = 1500 - 20 - 8;
+const int RTP_SENDER_REPORT_MS = 1000;
+
+typedef struct {
+    bool running;
+    uint32_t host;      // network byte order
+    uint16_t port;
+    uint32_t frames;
+    uint32_t packets;
+    uint32_t bytes;
+    uint32_t dropped;     // frames cut short because the socket was full
+    uint32_t unsupported; // frames RFC 2435 can't carry, e.g. progressive
+} rtp_stats_t;
+
+// Start sending to `host` (network byte order) on `port`, with RTCP on
+// port + 1. Fails if a session is already running.
+esp_err_t rtpStart(uint32_t host, uint16_t port);
+void rtpStop();
+void rtpGetStats(rtp_stats_t * stats);
+
+#endif
@@ -0,0 +1,248 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_camera.h"
+#include "sensor_config.h"
+#include "camera_stream.h"
+#include "adaptive_bitrate.h"
+#include "chassis.h"
+#include "logger.h"
+
+// /config parameters, in sensor_setting_t order: each one fills in its
+// value in a sensor_settings_t
+#define SETTING(setting, key, min, max) \
+    {key, QUERY_INT, (uint16_t)(offsetof(sensor_settings_t, values) + (setting) * sizeof(int)), min, max, 0, false}
+static const query_param_t setting_params[SENSOR_SETTING_COUNT] = {
+    SETTING(SENSOR_FRAMESIZE, "framesize", 0, FRAMESIZE_INVALID - 1),
+    SETTING(SENSOR_QUALITY, "quality", 0, 63),
+    SETTING(SENSOR_BRIGHTNESS, "brightness", -2, 2),
+    SETTING(SENSOR_CONTRAST, "contrast", -2, 2),
+    SETTING(SENSOR_SATURATION, "saturation", -2, 2),
+    SETTING(SENSOR_AEC, "aec", 0, 1),
+    SETTING(SENSOR_AEC_VALUE, "aec_value", 0, 1200),
+    SETTING(SENSOR_AE_LEVEL, "ae_level", -2, 2),
+    SETTING(SENSOR_AGC, "agc", 0, 1),
+    SETTING(SENSOR_AGC_GAIN, "agc_gain", 0, 30),
+    SETTING(SENSOR_GAINCEILING, "gainceiling", 0, GAINCEILING_128X),
+    SETTING(SENSOR_AWB, "awb", 0, 1),
+    SETTING(SENSOR_AWB_GAIN, "awb_gain", 0, 1),
+    SETTING(SENSOR_WB_MODE, "wb_mode", 0, 4),
+    SETTING(SENSOR_HMIRROR, "hmirror", 0, 1),
+    SETTING(SENSOR_VFLIP, "vflip", 0, 1),
+    SETTING(SENSOR_FLASH, "flash", 0, 255),
+};
+#undef SETTING
+
+static portMUX_TYPE config_mux = portMUX_INITIALIZER_UNLOCKED;
+static bool ready = false;
+static sensor_settings_t applied;
+static sensor_settings_t pending;
+static uint32_t pending_mask = 0;
+static sensor_config_stats_t stats;
+// One batch on the SCCB bus at a time: a stream starting or stopping can
+// have the capture task and a request both applying
+static SemaphoreHandle_t apply_lock = NULL;
+
+
+static int read_setting(const sensor_t * s, int setting){
+    switch(setting){
+        case SENSOR_FRAMESIZE: return s->status.framesize;
+        case SENSOR_QUALITY: return s->status.quality;
+        case SENSOR_BRIGHTNESS: return s->status.brightness;
+        case SENSOR_CONTRAST: return s->status.contrast;
+        case SENSOR_SATURATION: return s->status.saturation;
+        case SENSOR_AEC: return s->status.aec;
+        case SENSOR_AEC_VALUE: return s->status.aec_value;
+        case SENSOR_AE_LEVEL: return s->status.ae_level;
+        case SENSOR_AGC: return s->status.agc;
+        case SENSOR_AGC_GAIN: return s->status.agc_gain;
+        case SENSOR_GAINCEILING: return s->status.gainceiling;
+        case SENSOR_AWB: return s->status.awb;
+        case SENSOR_AWB_GAIN: return s->status.awb_gain;
+        case SENSOR_WB_MODE: return s->status.wb_mode;
+        case SENSOR_HMIRROR: return s->status.hmirror;
+        case SENSOR_VFLIP: return s->status.vflip;
+    }
+    return 0;
+}
+
+static void write_setting(sensor_t * s, int setting, int value){
+    switch(setting){
+        case SENSOR_FRAMESIZE:
+            // The bitrate controller steps down from here, and puts it on
+            // the sensor if it's running below it
+            bitrateSetMaxFramesize((framesize_t)value);
+            if(s->status.framesize != value){
+                s->set_framesize(s, (framesize_t)value);
+            }
+            break;
+        case SENSOR_QUALITY:
+            bitrateSetBestQuality(value);
+            if(s->status.quality != value){
+                s->set_quality(s, value);
+            }
+            break;
+        case SENSOR_BRIGHTNESS: s->set_brightness(s, value); break;
+        case SENSOR_CONTRAST: s->set_contrast(s, value); break;
+        case SENSOR_SATURATION: s->set_saturation(s, value); break;
+        case SENSOR_AEC: s->set_exposure_ctrl(s, value); break;
+        case SENSOR_AEC_VALUE: s->set_aec_value(s, value); break;
+        case SENSOR_AE_LEVEL: s->set_ae_level(s, value); break;
+        case SENSOR_AGC: s->set_gain_ctrl(s, value); break;
+        case SENSOR_AGC_GAIN: s->set_agc_gain(s, value); break;
+        case SENSOR_GAINCEILING: s->set_gainceiling(s, (gainceiling_t)value); break;
+        case SENSOR_AWB: s->set_whitebal(s, value); break;
+        case SENSOR_AWB_GAIN: s->set_awb_gain(s, value); break;
+        case SENSOR_WB_MODE: s->set_wb_mode(s, value); break;
+        case SENSOR_HMIRROR: s->set_hmirror(s, value); break;
+        case SENSOR_VFLIP: s->set_vflip(s, value); break;
+        case SENSOR_FLASH: setLedBrightness(value); break;
+    }
+}
+
+void initSensorConfig(){
+    sensor_t * s = esp_camera_sensor_get();
+    if(!s){
+        return;
+    }
+    apply_lock = xSemaphoreCreateMutex();
+    portENTER_CRITICAL(&config_mux);
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        applied.values[i] = read_setting(s, i);
+    }
+    // The LED can't be read back; it starts off
+    applied.values[SENSOR_FLASH] = 0;
+    ready = true;
+    portEXIT_CRITICAL(&config_mux);
+}
+
+const char * sensorConfigKey(int setting){
+    return setting >= 0 && setting < SENSOR_SETTING_COUNT ? setting_params[setting].name : NULL;
+}
+
+const query_param_t * sensorConfigParams(){
+    return setting_params;
+}
+
+bool sensorConfigValid(int setting, int value){
+    return setting >= 0 && setting < SENSOR_SETTING_COUNT
+        && value >= setting_params[setting].min && value <= setting_params[setting].max;
+}
+
+void sensorConfigApply(sensor_t * s){
+    if(!s || !ready){
+        return;
+    }
+    portENTER_CRITICAL(&config_mux);
+    bool idle = pending_mask == 0;
+    portEXIT_CRITICAL(&config_mux);
+    if(idle){
+        return;
+    }
+
+    xSemaphoreTake(apply_lock, portMAX_DELAY);
+    portENTER_CRITICAL(&config_mux);
+    sensor_settings_t batch = pending;
+    uint32_t mask = pending_mask;
+    pending_mask = 0;
+    portEXIT_CRITICAL(&config_mux);
+
+    int writes = 0;
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        if(mask & (1u << i)){
+            write_setting(s, i, batch.values[i]);
+            writes++;
+        }
+    }
+
+    portENTER_CRITICAL(&config_mux);
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        if(mask & (1u << i)){
+            applied.values[i] = batch.values[i];
+        }
+    }
+    if(writes){
+        stats.batches++;
+        stats.writes += writes;
+    }
+    portEXIT_CRITICAL(&config_mux);
+    xSemaphoreGive(apply_lock);
+}
+
+esp_err_t sensorConfigSet(const sensor_settings_t * settings, uint32_t mask){
+    sensor_t * s = esp_camera_sensor_get();
+    if(!s || !ready){
+        return ESP_ERR_INVALID_STATE;
+    }
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        if((mask & (1u << i)) && !sensorConfigValid(i, settings->values[i])){
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    if(s->pixformat != PIXFORMAT_JPEG){
+        // Frame size only applies to the sensor's own JPEG output
+        mask &= ~(1u << SENSOR_FRAMESIZE);
+    }
+
+    // Queue what differs from the sensor, or from a batch still waiting
+    portENTER_CRITICAL(&config_mux);
+    uint32_t changed = 0;
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        if(!(mask & (1u << i))){
+            continue;
+        }
+        int current = (pending_mask & (1u << i)) ? pending.values[i] : applied.values[i];
+        if(settings->values[i] == current){
+            stats.unchanged++;
+            continue;
+        }
+        pending.values[i] = settings->values[i];
+        pending_mask |= 1u << i;
+        changed |= 1u << i;
+    }
+    portEXIT_CRITICAL(&config_mux);
+
+    // With a stream running the capture task picks the batch up at the next
+    // frame boundary; it checks again before it goes idle, so a stream
+    // stopping now can't strand it
+    if(changed && !streamActive()){
+        sensorConfigApply(s);
+    }
+    return ESP_OK;
+}
+
+esp_err_t sensorConfigSetStandby(bool standby){
+    sensor_t * s = esp_camera_sensor_get();
+    if(!s || !ready){
+        return ESP_ERR_INVALID_STATE;
+    }
+    int reg, mask;
+    switch(s->id.PID){
+        case OV2640_PID: reg = 0x109; mask = 0x10; break; // COM2 in the sensor bank
+        case OV3660_PID:
+        case OV5640_PID: reg = 0x3008; mask = 0x40; break; // SYSTEM_CTROL0
+        default: return ESP_ERR_NOT_SUPPORTED;
+    }
+    // Not in the middle of a batch
+    xSemaphoreTake(apply_lock, portMAX_DELAY);
+    int res = s->set_reg(s, reg, mask, standby ? mask : 0);
+    xSemaphoreGive(apply_lock);
+    return res == 0 ? ESP_OK : ESP_FAIL;
+}
+
+void sensorConfigGet(sensor_settings_t * settings){
+    portENTER_CRITICAL(&config_mux);
+    *settings = applied;
+    for(int i = 0; i < SENSOR_SETTING_COUNT; i++){
+        if(pending_mask & (1u << i)){
+            settings->values[i] = pending.values[i];
+        }
+    }
+    portEXIT_CRITICAL(&config_mux);
+}
+
+void sensorConfigGetStats(sensor_config_stats_t * out){
+    portENTER_CRITICAL(&config_mux);
+    *out = stats;
+    portEXIT_CRITICAL(&config_mux);
+}
@@ -0,0 +1,76 @@
+#ifndef sensor_config_h
+#define sensor_config_h
+
+#include "esp_camera.h"
+#include "query_parser.h"
+
+// Batched camera settings. A change names any number of settings at once;
+// each is compared with the value last asked for and only the ones that
+// differ are written to the sensor, together, by the capture task between
+// frames so a resize doesn't tear the frame being read out. With no stream
+// running there is no frame to wait for and the change is applied at once.
+// The lights are switched with the same batch.
+
+typedef enum {
+    SENSOR_FRAMESIZE,
+    SENSOR_QUALITY,
+    SENSOR_BRIGHTNESS,
+    SENSOR_CONTRAST,
+    SENSOR_SATURATION,
+    SENSOR_AEC,         // automatic exposure
+    SENSOR_AEC_VALUE,   // manual exposure, with aec off
+    SENSOR_AE_LEVEL,
+    SENSOR_AGC,         // automatic gain
+    SENSOR_AGC_GAIN,    // manual gain, with agc off
+    SENSOR_GAINCEILING,
+    SENSOR_AWB,         // automatic white balance
+    SENSOR_AWB_GAIN,
+    SENSOR_WB_MODE,
+    SENSOR_HMIRROR,
+    SENSOR_VFLIP,
+    SENSOR_FLASH,       // LED brightness
+    SENSOR_SETTING_COUNT
+} sensor_setting_t;
+
+typedef struct {
+    int values[SENSOR_SETTING_COUNT];
+} sensor_settings_t;
+
+typedef struct {
+    uint32_t batches;   // batches that changed at least one setting
+    uint32_t writes;    // settings written
+    uint32_t unchanged; // settings asked for that already had that value
+} sensor_config_stats_t;
+
+// Read the sensor's settings into the cache. Call once the camera is up.
+void initSensorConfig();
+
+// Query-string name of a setting (as esp32-camera's example server uses)
+const char * sensorConfigKey(int setting);
+bool sensorConfigValid(int setting, int value);
+
+// The settings as /config parameters (query_parser.h), SENSOR_SETTING_COUNT
+// of them in sensor_setting_t order, filling in a sensor_settings_t
+const query_param_t * sensorConfigParams();
+
+// Apply the settings whose bits (1 << setting) are set in `mask`. Doesn't
+// wait for the frame boundary. ESP_ERR_INVALID_ARG if a value is out of
+// range (nothing is applied), ESP_ERR_INVALID_STATE before initSensorConfig().
+esp_err_t sensorConfigSet(const sensor_settings_t * settings, uint32_t mask);
+
+// The settings as last asked for, including a batch still waiting for its
+// frame boundary. Frame size and quality are the user's choice; the
+// bitrate controller may be running below them.
+void sensorConfigGet(sensor_settings_t * settings);
+
+// Called by the capture task between frames
+void sensorConfigApply(sensor_t * s);
+
+void sensorConfigGetStats(sensor_config_stats_t * stats);
+
+// Software standby: the sensor stops its clocks and output but keeps its
+// registers, and picks up where it left off a frame after it's released.
+// ESP_ERR_NOT_SUPPORTED for a sensor we don't know the register of.
+esp_err_t sensorConfigSetStandby(bool standby);
+
+#endif
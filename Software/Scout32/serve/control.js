@@ -25,6 +25,12 @@ const SPEED_CHANGE_THRESHOLD = 0.1 // How much the speed has to change by in ord
 const SPEED_MIN_THRESHOLD = 0.15 // Speeds less than this are rounded to zero.
 const SPEED_MIN_SEND_DELAY_MS = 50 // Minimum time between messages
 const SPEED_MAX_SEND_DELAY_MS = 500 // Maximum time between messages
+const CONTROL_RECONNECT_MS = 1000 // Delay before reopening a dropped control socket
+
+// Binary control protocol, see control_protocol.h
+const CONTROL_MSG_DRIVE = 1
+const CONTROL_MSG_TELEMETRY = 2
+const CONTROL_FLAG_RESET = 0x01
 
 // Functions for Controls via Keypress
 var speed = {
@@ -41,11 +47,46 @@ var oldSpeed = {
 
 var mouseDown = false;
 
+// Persistent control socket. Falls back to GET /drive while it is down.
+var control = {
+    socket: null,
+    seq: 0,
+    reset: true,
+    rtt: 0,
+}
+
+function openControlSocket() {
+    let socket = new WebSocket(`ws://${document.location.host}/ws`)
+    socket.binaryType = 'arraybuffer'
+    socket.addEventListener('open', () => {
+        control.socket = socket
+        control.reset = true
+    })
+    socket.addEventListener('message', (event) => {
+        let msg = new DataView(event.data)
+        if (msg.byteLength < 16 || msg.getUint8(0) != CONTROL_MSG_TELEMETRY) {
+            return
+        }
+        control.rtt = (Date.now() - msg.getUint16(6, true)) & 0xFFFF
+        document.getElementById('telemetry').textContent = `${control.rtt}ms`
+    })
+    socket.addEventListener('close', () => {
+        control.socket = null
+        window.setTimeout(openControlSocket, CONTROL_RECONNECT_MS)
+    })
+}
+
 
 window.addEventListener("load", () => {
+    openControlSocket()
+    fetch(document.location.origin + '/config')
+        .then((response) => response.json())
+        .then(showConfig)
+        .catch((e) => { })
+
     // Functions to control streaming
     let source = document.getElementById('stream');
-    source.src = document.location.origin + ':81/stream';
+    source.src = document.location.origin + '/stream';
 
     let dpad = document.getElementById('dpad')
     const padStroke = document.getElementById('padstyle').getAttribute('stroke-width')
@@ -146,11 +187,36 @@ window.setInterval(function () {
 
 
 function setParameter(variable, value) {
-    fetch(document.location.origin + `/config?${variable}=${value}`).catch((e) => { })
+    fetch(document.location.origin + `/config?${variable}=${value}`)
+        .then((response) => response.json())
+        .then(showConfig)
+        .catch((e) => { })
+}
+
+// Set the settings controls from the state /config answers with
+function showConfig(state) {
+    for (const id of ['flash', 'quality', 'framesize']) {
+        document.getElementById(id).value = state[id]
+    }
+    document.getElementById('adaptive').checked = state.adaptive
+    document.getElementById('change_threshold').checked = state.change_threshold > 0
 }
 
 function drive(forward, steer) {
-    fetch(document.location.origin + `/drive?forward=${Math.round(forward * 100)}&steer=${Math.round(steer * 100)}`).catch((e) => { })
+    if (control.socket) {
+        let msg = new DataView(new ArrayBuffer(8))
+        control.seq = (control.seq + 1) & 0xFFFF
+        msg.setUint8(0, CONTROL_MSG_DRIVE)
+        msg.setUint8(1, control.reset ? CONTROL_FLAG_RESET : 0)
+        msg.setUint16(2, control.seq, true)
+        msg.setInt8(4, Math.round(forward * 100))
+        msg.setInt8(5, Math.round(steer * 100))
+        msg.setUint16(6, Date.now() & 0xFFFF, true)
+        control.socket.send(msg.buffer)
+        control.reset = false
+    } else {
+        fetch(document.location.origin + `/drive?forward=${Math.round(forward * 100)}&steer=${Math.round(steer * 100)}`).catch((e) => { })
+    }
     document.getElementById('indicator').setAttribute('cy', -forward * 100)
     document.getElementById('indicator').setAttribute('cx', steer * 100)
 }
@@ -0,0 +1,185 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+#include "esp_timer.h"
+#include "camera_stream.h"
+#include "logger.h"
+#include "task_config.h"
+#include "stream_writer.h"
+
+#define PART_BOUNDARY "123456789000000000000987654321"
+static const char STREAM_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: multipart/x-mixed-replace;boundary=" PART_BOUNDARY "\r\n"
+    "\r\n";
+static const char STREAM_BOUNDARY[] = "\r\n--" PART_BOUNDARY "\r\n";
+// Times are esp_timer seconds, as X-Timestamp is in the camera examples
+static const char STREAM_PART[] =
+    "Content-Type: image/jpeg\r\n"
+    "Content-Length: %u\r\n"
+    "X-Frame-Seq: %u\r\n"
+    "X-Timestamp: %u.%06u\r\n"
+    "X-Send-Time: %u.%06u\r\n"
+    "X-Exposure: %s\r\n"
+    "X-Gain: %s\r\n"
+    "\r\n";
+
+static volatile bool nodelay = STREAM_WRITER_NODELAY;
+static volatile int send_buffer = 0;
+
+typedef struct {
+    bool busy;
+    httpd_req_t * req;
+    stream_sender_fn send;
+    void * arg;
+} stream_sender_t;
+
+static portMUX_TYPE sender_mux = portMUX_INITIALIZER_UNLOCKED;
+static stream_sender_t senders[STREAM_SENDER_TASKS];
+static stream_sender_stats_t sender_stats = {0, 0, 0, UINT32_MAX};
+
+
+void streamWriterSetNoDelay(bool enabled){
+    nodelay = enabled;
+}
+
+void streamWriterSetSendBuffer(int bytes){
+    send_buffer = max(bytes, 0);
+}
+
+static void sender_task(void * arg){
+    stream_sender_t * sender = (stream_sender_t *)arg;
+    sender->send(sender->req, sender->arg);
+    httpd_req_async_handler_complete(sender->req);
+
+    uint32_t stack_free = uxTaskGetStackHighWaterMark(NULL);
+    portENTER_CRITICAL(&sender_mux);
+    sender->busy = false;
+    sender_stats.active--;
+    sender_stats.stack_free_min = min(sender_stats.stack_free_min, stack_free);
+    portEXIT_CRITICAL(&sender_mux);
+    vTaskDelete(NULL);
+}
+
+esp_err_t streamWriterHandOff(httpd_req_t *req, stream_sender_fn send, void * arg){
+    stream_sender_t * sender = NULL;
+    portENTER_CRITICAL(&sender_mux);
+    for(int i = 0; i < STREAM_SENDER_TASKS && !sender; i++){
+        if(!senders[i].busy){
+            sender = &senders[i];
+            sender->busy = true;
+            sender_stats.active++;
+        }
+    }
+    if(!sender){
+        sender_stats.busy++;
+    }
+    portEXIT_CRITICAL(&sender_mux);
+    if(!sender){
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    esp_err_t res = httpd_req_async_handler_begin(req, &sender->req);
+    if(res == ESP_OK){
+        sender->send = send;
+        sender->arg = arg;
+        if(taskCreate(TASK_STREAM_SEND, sender_task, sender, NULL) != pdPASS){
+            httpd_req_async_handler_complete(sender->req);
+            res = ESP_ERR_NO_MEM;
+        }
+    }
+    portENTER_CRITICAL(&sender_mux);
+    if(res == ESP_OK){
+        sender_stats.started++;
+    } else {
+        sender->busy = false;
+        sender_stats.active--;
+    }
+    portEXIT_CRITICAL(&sender_mux);
+    return res;
+}
+
+void streamWriterGetSenderStats(stream_sender_stats_t * stats){
+    portENTER_CRITICAL(&sender_mux);
+    *stats = sender_stats;
+    portEXIT_CRITICAL(&sender_mux);
+    // Until a sender has finished, all of its stack
+    stats->stack_free_min = min(stats->stack_free_min, taskSpec(TASK_STREAM_SEND)->stack);
+}
+
+esp_err_t streamWriterBegin(httpd_req_t *req){
+    int fd = httpd_req_to_sockfd(req);
+    int value = nodelay;
+    if(setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value)) != 0){
+        LOG_WARN("Stream: TCP_NODELAY failed: %d", errno);
+    }
+    value = send_buffer;
+    if(value && setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &value, sizeof(value)) != 0){
+        // lwIP only has SO_SNDBUF with LWIP_SO_SNDBUF, otherwise the send
+        // buffer is CONFIG_LWIP_TCP_SND_BUF_DEFAULT
+        LOG_EVERY(LOG_LEVEL_WARN, 60000, "Stream: SO_SNDBUF %d not supported: %d", value, errno);
+    }
+    if(httpd_send(req, STREAM_HEADER, sizeof(STREAM_HEADER) - 1) != (int)sizeof(STREAM_HEADER) - 1){
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+// A manual sensor setting, or "auto" for -1
+static const char * setting_str(char * buf, size_t size, int value){
+    if(value < 0){
+        return "auto";
+    }
+    snprintf(buf, size, "%d", value);
+    return buf;
+}
+
+esp_err_t streamWriterSendFrame(httpd_req_t *req, const uint8_t * jpg, size_t len, const stream_part_info_t * info){
+    char exposure[12];
+    char gain[12];
+    int64_t now = esp_timer_get_time();
+    char part[224];
+    int part_len = snprintf(part, sizeof(part), STREAM_PART, (unsigned)len, info->seq,
+        (unsigned)(info->timestamp / 1000000), (unsigned)(info->timestamp % 1000000),
+        (unsigned)(now / 1000000), (unsigned)(now % 1000000),
+        setting_str(exposure, sizeof(exposure), info->exposure), setting_str(gain, sizeof(gain), info->gain));
+
+    struct iovec iov[3];
+    iov[0].iov_base = part;
+    iov[0].iov_len = part_len;
+    iov[1].iov_base = (void *)jpg;
+    iov[1].iov_len = len;
+    iov[2].iov_base = (void *)STREAM_BOUNDARY;
+    iov[2].iov_len = sizeof(STREAM_BOUNDARY) - 1;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = 3;
+
+    int fd = httpd_req_to_sockfd(req);
+    size_t left = part_len + len + iov[2].iov_len;
+    while(left){
+        // Blocks up to the server's send_wait_timeout
+        ssize_t sent = sendmsg(fd, &msg, 0);
+        if(sent <= 0){
+            if(sent < 0 && errno == EINTR){
+                continue;
+            }
+            return ESP_FAIL;
+        }
+        left -= sent;
+        // Partial write: skip what went out and send the rest
+        while(msg.msg_iovlen && (size_t)sent >= msg.msg_iov->iov_len){
+            sent -= msg.msg_iov->iov_len;
+            msg.msg_iov++;
+            msg.msg_iovlen--;
+        }
+        if(msg.msg_iovlen){
+            msg.msg_iov->iov_base = (uint8_t *)msg.msg_iov->iov_base + sent;
+            msg.msg_iov->iov_len -= sent;
+        }
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,60 @@
+#ifndef stream_writer_h
+#define stream_writer_h
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+// Multipart MJPEG framing for /stream, written straight to the httpd
+// socket. Each part (header, JPEG, boundary) goes out as one scatter-gather
+// send, so a frame costs one lwIP write instead of three chunked-encoding
+// sends of six writes. The response has no Content-Length and isn't
+// chunked: like any multipart/x-mixed-replace stream it ends when the
+// connection closes.
+
+// Long-lived /stream responses don't tie up the server's task: each one is
+// handed off (httpd_req_async_handler_begin) to a sender task of its own,
+// started for the stream and gone when it ends, so /drive and /config are
+// answered while streams run and idle senders cost no RAM.
+const int STREAM_SENDER_TASKS = 2;
+
+// Send small writes immediately rather than waiting for an ACK (Nagle).
+// With one write per frame, Nagle only ever delays the frame's last segment.
+const bool STREAM_WRITER_NODELAY = true;
+
+// Socket options for streams opened after the call. A send buffer of 0
+// leaves the stack's default (CONFIG_LWIP_TCP_SND_BUF_DEFAULT).
+void streamWriterSetNoDelay(bool nodelay);
+void streamWriterSetSendBuffer(int bytes);
+
+typedef struct {
+    int active;
+    uint32_t started;
+    uint32_t busy;            // requests turned away with every sender in use
+    uint32_t stack_free_min;  // lowest stack high-water mark of a finished sender
+} stream_sender_stats_t;
+
+typedef void (*stream_sender_fn)(httpd_req_t *req, void * arg);
+
+// Call `send` on a sender task with a request that outlives the handler.
+// ESP_ERR_NOT_FOUND if all senders are busy, in which case the caller
+// still owns `req` and should answer it.
+esp_err_t streamWriterHandOff(httpd_req_t *req, stream_sender_fn send, void * arg);
+void streamWriterGetSenderStats(stream_sender_stats_t * stats);
+
+// Tune the socket and send the response header
+esp_err_t streamWriterBegin(httpd_req_t *req);
+
+// What each part's headers say about its frame, for clients measuring
+// latency: X-Frame-Seq, X-Timestamp (capture), X-Send-Time (this part
+// going out, so the device's share of the age is exact whatever the
+// client's clock) and the sensor's X-Exposure and X-Gain.
+typedef struct {
+    uint32_t seq;
+    int64_t timestamp;  // capture, esp_timer clock
+    int exposure;       // -1 for auto
+    int gain;           // -1 for auto
+} stream_part_info_t;
+
+esp_err_t streamWriterSendFrame(httpd_req_t *req, const uint8_t * jpg, size_t len, const stream_part_info_t * info);
+
+#endif
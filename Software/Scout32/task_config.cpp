@@ -0,0 +1,176 @@
+#include <Arduino.h>
+#include <WiFi.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "logger.h"
+#include "task_config.h"
+#include "power_manager.h"
+
+static const task_spec_t presets[TASK_PRESET_COUNT][TASK_ROLE_COUNT] = {
+    {   // TASK_PRESET_LOW_LATENCY
+        {"stream_capture", 1, 4, 4096},
+        {"camera_init", 1, 4, 4096},
+        {"stream_send", 0, 3, 4096},
+        {"rtp_send", 0, 3, 4096},
+        {"httpd", 1, 8, 4096},
+        {"motor_control", 1, 10, 3072},
+        {"recorder", 0, 2, 3072},
+        {"log_drain", tskNO_AFFINITY, 1, 2048},
+        {"housekeeping", tskNO_AFFINITY, 1, 3072},
+    },
+    {   // TASK_PRESET_MAX_THROUGHPUT, which is how things were laid out
+        // before there were presets
+        {"stream_capture", 1, 5, 4096},
+        {"camera_init", 1, 5, 4096},
+        {"stream_send", 0, 5, 4096},
+        {"rtp_send", 0, 5, 4096},
+        {"httpd", tskNO_AFFINITY, 5, 4096},
+        {"motor_control", 1, 10, 3072},
+        {"recorder", 1, 2, 3072},
+        {"log_drain", tskNO_AFFINITY, 1, 2048},
+        {"housekeeping", tskNO_AFFINITY, 1, 3072},
+    },
+};
+
+static const char * const preset_names[TASK_PRESET_COUNT] = {"low_latency", "max_throughput"};
+
+static task_preset_t preset = TASK_PRESET_LOW_LATENCY;
+
+// The last sample, and the run time counters it was worked out from. Only
+// the housekeeping task writes them.
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static task_stats_t stats[TASK_STATS_MAX];
+static int stats_count = 0;
+
+typedef struct {
+    TaskHandle_t handle;
+    uint32_t run_time;
+} run_time_t;
+
+static TaskStatus_t status[TASK_STATS_MAX];
+static task_stats_t sampled[TASK_STATS_MAX];
+static run_time_t last_run_time[TASK_STATS_MAX];
+static int last_count = 0;
+static uint32_t last_total = 0;
+
+
+void taskConfigSetPreset(task_preset_t p){
+    preset = p;
+}
+
+task_preset_t taskConfigPreset(){
+    return preset;
+}
+
+const char * taskConfigPresetName(task_preset_t p){
+    return preset_names[p];
+}
+
+const task_spec_t * taskSpec(task_role_t role){
+    return &presets[preset][role];
+}
+
+BaseType_t taskCreate(task_role_t role, TaskFunction_t fn, void * arg, TaskHandle_t * handle){
+    const task_spec_t * spec = taskSpec(role);
+    return xTaskCreatePinnedToCore(fn, spec->name, spec->stack, arg, spec->priority, handle, spec->core);
+}
+
+static const task_spec_t * find_spec(const char * name){
+    for(int i = 0; i < TASK_ROLE_COUNT; i++){
+        if(strcmp(presets[preset][i].name, name) == 0){
+            return &presets[preset][i];
+        }
+    }
+    return NULL;
+}
+
+static void sample(){
+#if configUSE_TRACE_FACILITY
+    uint32_t total = 0;
+    int count = uxTaskGetSystemState(status, TASK_STATS_MAX, &total);
+    uint32_t elapsed = total - last_total;
+
+    int sampled_count = 0;
+    for(int i = 0; i < count; i++){
+        const TaskStatus_t * s = &status[i];
+        // CPU since the last sample; tasks started since then count from 0
+        float cpu = -1;
+#if configGENERATE_RUN_TIME_STATS
+        uint32_t before = 0;
+        for(int j = 0; j < last_count; j++){
+            if(last_run_time[j].handle == s->xHandle){
+                before = last_run_time[j].run_time;
+                break;
+            }
+        }
+        if(last_total && elapsed){
+            cpu = 100.0f * (s->ulRunTimeCounter - before) / elapsed;
+        }
+#endif
+        task_stats_t * t = NULL;
+        for(int j = 0; j < sampled_count && !t; j++){
+            if(strncmp(sampled[j].name, s->pcTaskName, sizeof(sampled[j].name) - 1) == 0){
+                t = &sampled[j];
+            }
+        }
+        if(!t){
+            const task_spec_t * spec = find_spec(s->pcTaskName);
+            t = &sampled[sampled_count++];
+            snprintf(t->name, sizeof(t->name), "%s", s->pcTaskName);
+#if configTASKLIST_INCLUDE_COREID
+            t->core = s->xCoreID;
+#else
+            t->core = spec ? spec->core : tskNO_AFFINITY;
+#endif
+            t->priority = s->uxCurrentPriority;
+            t->instances = 0;
+            t->cpu_percent = cpu < 0 ? -1 : 0;
+            t->stack_free = s->usStackHighWaterMark;
+            t->stack = spec ? spec->stack : 0;
+        }
+        t->instances++;
+        if(cpu >= 0 && t->cpu_percent >= 0){
+            t->cpu_percent += cpu;
+        }
+        t->stack_free = min(t->stack_free, (uint32_t)s->usStackHighWaterMark);
+    }
+
+    for(int i = 0; i < count; i++){
+        last_run_time[i].handle = status[i].xHandle;
+        last_run_time[i].run_time = status[i].ulRunTimeCounter;
+    }
+    last_count = count;
+    last_total = total;
+
+    portENTER_CRITICAL(&stats_mux);
+    memcpy(stats, sampled, sampled_count * sizeof(task_stats_t));
+    stats_count = sampled_count;
+    portEXIT_CRITICAL(&stats_mux);
+#endif
+}
+
+bool taskGetStats(int index, task_stats_t * out){
+    portENTER_CRITICAL(&stats_mux);
+    bool found = index < stats_count;
+    if(found){
+        *out = stats[index];
+    }
+    portEXIT_CRITICAL(&stats_mux);
+    return found;
+}
+
+static void housekeeping_task(void * arg){
+    TickType_t wake = xTaskGetTickCount();
+    for(;;){
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(TASK_STATS_INTERVAL_MS));
+        sample();
+        powerUpdate();
+        LOG_INFO("RSSi: %d dBm", WiFi.RSSI());
+    }
+}
+
+void initHousekeeping(){
+    LOG_INFO("Tasks: %s preset", preset_names[preset]);
+    taskCreate(TASK_HOUSEKEEPING, housekeeping_task, NULL, NULL);
+}
@@ -0,0 +1,80 @@
+#ifndef task_config_h
+#define task_config_h
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Every task the firmware starts, with the core it's pinned to, its
+// priority and its stack, in one table per preset. Modules create their
+// tasks through taskCreate() rather than with numbers of their own, and
+// the web server takes its task's place from here too. The preset is
+// chosen once, before anything starts: a running task can change priority
+// but not core.
+//
+// Not ours and not in the table: the WiFi and lwIP tasks (core 0,
+// priorities 23 and 18), the camera driver's cam_task (its core is
+// CONFIG_CAMERA_CORE) and the Arduino loopTask (core 1, priority 1).
+// They still show up in the stats below.
+
+typedef enum {
+    TASK_CAPTURE,        // stream_capture: camera grabs for every client
+    TASK_CAMERA_INIT,    // camera_init: esp_camera_init() at boot, on capture's core
+    TASK_STREAM_SEND,    // stream_send: one per /stream client
+    TASK_RTP_SEND,       // rtp_send
+    TASK_HTTP,           // httpd: /drive, /config and the rest
+    TASK_MOTOR,          // motor_control
+    TASK_RECORDER,       // recorder
+    TASK_LOG,            // log_drain
+    TASK_HOUSEKEEPING,   // housekeeping: RSSI, the task stats and going idle
+    TASK_ROLE_COUNT
+} task_role_t;
+
+typedef enum {
+    // Control first: the web server and the motor task outrank capture on
+    // core 1, and video is sent from core 0, below the server, so a busy
+    // stream never holds up a drive command
+    TASK_PRESET_LOW_LATENCY,
+    // Video first: senders run at capture's priority, the server at theirs
+    // on either core. The motor task still outranks everything.
+    TASK_PRESET_MAX_THROUGHPUT,
+    TASK_PRESET_COUNT
+} task_preset_t;
+
+typedef struct {
+    const char * name;
+    BaseType_t core;       // 0, 1 or tskNO_AFFINITY
+    UBaseType_t priority;
+    uint32_t stack;        // bytes
+} task_spec_t;
+
+// Before any task is created: at the top of setup()
+void taskConfigSetPreset(task_preset_t preset);
+task_preset_t taskConfigPreset();
+const char * taskConfigPresetName(task_preset_t preset);
+const task_spec_t * taskSpec(task_role_t role);
+
+// xTaskCreatePinnedToCore() with the role's name, core, priority and stack
+BaseType_t taskCreate(task_role_t role, TaskFunction_t fn, void * arg, TaskHandle_t * handle);
+
+// Starts the housekeeping task, which samples the stats every second
+void initHousekeeping();
+
+const int TASK_STATS_MAX = 32;
+const uint32_t TASK_STATS_INTERVAL_MS = 1000;
+
+// Tasks of the same name (the stream senders) are added together
+typedef struct {
+    char name[16];
+    BaseType_t core;
+    UBaseType_t priority;
+    uint8_t instances;
+    float cpu_percent;     // of one core over the last interval; -1 if unknown
+    uint32_t stack_free;   // lowest high-water mark of any instance, bytes
+    uint32_t stack;        // configured stack in bytes, 0 for tasks not ours
+} task_stats_t;
+
+// Task `index` of the last sample; false past the end of it
+bool taskGetStats(int index, task_stats_t * stats);
+
+#endif
@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include "wifi_cache.h"
+
+// 2: no longer caches the DHCP lease
+const uint32_t WIFI_CACHE_VERSION = 2;
+
+typedef struct {
+    uint32_t version;
+    char ssid[33];
+    wifi_cache_t cache;
+} wifi_cache_record_t;
+
+static bool load_record(wifi_cache_record_t * record){
+    Preferences prefs;
+    prefs.begin("scout32", true);
+    bool ok = prefs.getBytes("wifi", record, sizeof(*record)) == sizeof(*record)
+        && record->version == WIFI_CACHE_VERSION;
+    prefs.end();
+    return ok;
+}
+
+bool wifiCacheLoad(const char * ssid, wifi_cache_t * cache){
+    wifi_cache_record_t record;
+    if(!load_record(&record) || strncmp(record.ssid, ssid, sizeof(record.ssid)) != 0){
+        return false;
+    }
+    *cache = record.cache;
+    return true;
+}
+
+void wifiCacheSave(const char * ssid, const wifi_cache_t * cache){
+    wifi_cache_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.version = WIFI_CACHE_VERSION;
+    strncpy(record.ssid, ssid, sizeof(record.ssid) - 1);
+    record.cache = *cache;
+
+    wifi_cache_record_t stored;
+    if(load_record(&stored) && memcmp(&stored, &record, sizeof(record)) == 0){
+        return;
+    }
+    Preferences prefs;
+    prefs.begin("scout32", false);
+    prefs.putBytes("wifi", &record, sizeof(record));
+    prefs.end();
+}
+
+void wifiCacheClear(){
+    Preferences prefs;
+    prefs.begin("scout32", false);
+    prefs.remove("wifi");
+    prefs.end();
+}
@@ -0,0 +1,29 @@
+#ifndef wifi_cache_h
+#define wifi_cache_h
+
+#include <stdint.h>
+
+// Where a station connection found the access point last time, kept in
+// NVS so the next boot can skip the channel scan by giving WiFi.begin the
+// channel and BSSID. That turns 1.5 s or more of scanning into a few
+// hundred ms. The address still comes from DHCP every boot: a cached lease
+// used as a static IP would never be renewed, and once it expired the
+// router could hand it to someone else. If the access point has moved, the
+// fast connect times out and we fall back to a full one, which replaces
+// the cache.
+
+typedef struct {
+    uint8_t bssid[6];
+    int32_t channel;
+} wifi_cache_t;
+
+// Give up on a cached connection after this long and scan instead
+const uint32_t WIFI_FAST_CONNECT_TIMEOUT_MS = 1500;
+
+// False if nothing is cached for this SSID
+bool wifiCacheLoad(const char * ssid, wifi_cache_t * cache);
+// Only writes the flash if something changed
+void wifiCacheSave(const char * ssid, const wifi_cache_t * cache);
+void wifiCacheClear();
+
+#endif